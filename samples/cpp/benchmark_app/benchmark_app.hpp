@@ -76,6 +76,20 @@ static const char maximum_inference_rate_message[] =
 /// @brief message for execution time
 static const char execution_time_message[] = "Optional. Time in seconds to execute topology.";
 
+/// @brief message for workload trace
+static const char trace_message[] =
+    "Optional. Path to a workload trace recorded by the ov::workload_trace property to replay: every traced inference "
+    "is started at its recorded time offset with its recorded input shapes, regardless of the completion of the "
+    "previous ones (open loop). -niter, -t and -max_irate are ignored, -data_shape is generated from the trace. "
+    "A line of the trace is \"<timestamp_us>;<model>;<data_shape>[;<input files>]\", where the optional input "
+    "files use the -i syntax with a single file per input: \"input1:1.bin input2:2.bin\". "
+    "The latency is reported for each data shape, split into the queueing delay and the compute time.";
+
+/// @brief message for workload trace model filter
+static const char trace_model_message[] =
+    "Optional. Replay only the inferences of the model with this name, for the traces recorded by processes "
+    "running several models.";
+
 static const char batch_size_message[] =
     "Optional. Batch size value. If not specified, the batch size value is determined from "
     "Intermediate Representation.";
@@ -319,6 +333,12 @@ DEFINE_uint64(nireq, 0, infer_requests_count_message);
 /// @brief Execute infer requests at a fixed frequency
 DEFINE_double(max_irate, 0, maximum_inference_rate_message);
 
+/// @brief Path to a workload trace to replay
+DEFINE_string(trace, "", trace_message);
+
+/// @brief Name of the model which inferences are replayed from the workload trace
+DEFINE_string(trace_model, "", trace_model_message);
+
 /// @brief Number of streams to use for inference on the CPU (also affects Hetero cases)
 DEFINE_string(nstreams, "", infer_num_streams_message);
 
@@ -405,6 +425,8 @@ static void show_usage() {
     std::cout << "    -niter  <integer>             " << iterations_count_message << std::endl;
     std::cout << "    -max_irate \"<float>\"        " << maximum_inference_rate_message << std::endl;
     std::cout << "    -t                            " << execution_time_message << std::endl;
+    std::cout << "    -trace  <path>                " << trace_message << std::endl;
+    std::cout << "    -trace_model  <name>          " << trace_model_message << std::endl;
     std::cout << std::endl;
     std::cout << "Input shapes" << std::endl;
     std::cout << "    -b  <integer>                 " << batch_size_message << std::endl;
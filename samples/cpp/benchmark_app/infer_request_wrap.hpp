@@ -87,6 +87,15 @@ public:
         _lat_group_id = id;
     }
 
+    // the time the inference waited for the request, when it is started at a given arrival time
+    void set_queue_delay(double milliseconds) {
+        _queue_delay = milliseconds;
+    }
+
+    double get_queue_delay_in_milliseconds() const {
+        return _queue_delay;
+    }
+
     // in case of using GPU memory we need to allocate CL buffer for
     // output blobs. By encapsulating cl buffer inside InferReqWrap
     // we will control the number of output buffers and access to it.
@@ -100,6 +109,7 @@ private:
     Time::time_point _endTime;
     size_t _id;
     size_t _lat_group_id;
+    double _queue_delay = 0;
     QueueCallbackFunction _callbackQueue;
     std::map<std::string, ::gpu::BufferType> outputClBuffer;
 };
@@ -120,6 +130,7 @@ public:
             _idleIds.push(id);
         }
         _latency_groups.resize(lat_group_n);
+        _queue_delay_groups.resize(lat_group_n);
         reset_times();
     }
 
@@ -140,6 +151,9 @@ public:
         for (auto& group : _latency_groups) {
             group.clear();
         }
+        for (auto& group : _queue_delay_groups) {
+            group.clear();
+        }
     }
 
     double get_duration_in_milliseconds() {
@@ -157,6 +171,7 @@ public:
             _latencies.push_back(latency);
             if (enable_lat_groups) {
                 _latency_groups[lat_group_id].push_back(latency);
+                _queue_delay_groups[lat_group_id].push_back(requests.at(id)->get_queue_delay_in_milliseconds());
             }
             _idleIds.push(id);
             _endTime = std::max(Time::now(), _endTime);
@@ -196,6 +211,10 @@ public:
         return _latency_groups;
     }
 
+    std::vector<std::vector<double>> get_queue_delay_groups() {
+        return _queue_delay_groups;
+    }
+
     std::vector<InferReqWrap::Ptr> requests;
 
 private:
@@ -206,6 +225,7 @@ private:
     Time::time_point _endTime;
     std::vector<double> _latencies;
     std::vector<std::vector<double>> _latency_groups;
+    std::vector<std::vector<double>> _queue_delay_groups;
     bool enable_lat_groups;
     std::exception_ptr inferenceException = nullptr;
 };
@@ -35,6 +35,7 @@
 #include "remote_tensors_filling.hpp"
 #include "statistics_report.hpp"
 #include "utils.hpp"
+#include "workload_trace.hpp"
 
 #if defined(_WIN32)
 #include <windows.h>
@@ -141,11 +142,21 @@ bool parse_and_check_command_line(int argc, char* argv[]) {
         throw std::logic_error("The percentile value is incorrect. The applicable values range is [1, 100].");
     }
     if (FLAGS_api == "") {
-        FLAGS_api = FLAGS_hint == "latency" ? "sync" : "async";
+        FLAGS_api = FLAGS_hint == "latency" && FLAGS_trace.empty() ? "sync" : "async";
     }
     if (FLAGS_api != "async" && FLAGS_api != "sync") {
         throw std::logic_error("Incorrect API. Please set -api option to `sync` or `async` value.");
     }
+    if (!FLAGS_trace.empty()) {
+        if (FLAGS_api == "sync") {
+            throw std::logic_error("The workload trace is replayed with the async API only.");
+        }
+        if (!FLAGS_data_shape.empty()) {
+            throw std::logic_error("-data_shape is generated from the workload trace and can't be set with -trace.");
+        }
+    } else if (!FLAGS_trace_model.empty()) {
+        throw std::logic_error("-trace_model is applicable to -trace only.");
+    }
     if (FLAGS_api == "sync") {
         if ((FLAGS_t == 0) && FLAGS_niter != 0 && (FLAGS_nireq > FLAGS_niter)) {
             throw std::logic_error(
@@ -393,6 +404,13 @@ int main(int argc, char* argv[]) {
         /** This vector stores paths to the processed images with input names**/
         auto inputFiles = parse_input_arguments(gflags::GetArgvs());
 
+        /** The inferences to replay, their input shapes and data are set by the trace **/
+        std::unique_ptr<WorkloadTrace> trace;
+        if (!FLAGS_trace.empty()) {
+            trace = std::make_unique<WorkloadTrace>(FLAGS_trace, FLAGS_trace_model);
+            trace->add_input_files(inputFiles);
+        }
+
         // ----------------- 2. Loading the OpenVINO Runtime
         // -----------------------------------------------------------
         next_step();
@@ -676,7 +694,7 @@ int main(int argc, char* argv[]) {
             app_inputs_info = get_inputs_info(FLAGS_shape,
                                               FLAGS_layout,
                                               batchSize,
-                                              FLAGS_data_shape,
+                                              trace ? trace->data_shape(compiledModel.inputs()) : FLAGS_data_shape,
                                               inputFiles,
                                               FLAGS_scale_values,
                                               FLAGS_mean_values,
@@ -724,7 +742,7 @@ int main(int argc, char* argv[]) {
             app_inputs_info = get_inputs_info(FLAGS_shape,
                                               FLAGS_layout,
                                               FLAGS_b,
-                                              FLAGS_data_shape,
+                                              trace ? trace->data_shape(inputInfo) : FLAGS_data_shape,
                                               inputFiles,
                                               FLAGS_scale_values,
                                               FLAGS_mean_values,
@@ -910,7 +928,7 @@ int main(int argc, char* argv[]) {
             app_inputs_info = get_inputs_info(FLAGS_shape,
                                               FLAGS_layout,
                                               FLAGS_b,
-                                              FLAGS_data_shape,
+                                              trace ? trace->data_shape(compiledModel.inputs()) : FLAGS_data_shape,
                                               inputFiles,
                                               FLAGS_scale_values,
                                               FLAGS_mean_values,
@@ -966,6 +984,10 @@ int main(int argc, char* argv[]) {
             }
             inferenceOnly = isFlagSetInCommandLine("inference_only") && inferenceOnly && app_inputs_info.size() == 1;
         }
+        if (trace) {
+            // every replayed inference takes the inputs of its trace entry
+            inferenceOnly = false;
+        }
 
         // ----------------- 8. Querying optimal runtime parameters
         // -----------------------------------------------------
@@ -1046,6 +1068,11 @@ int main(int argc, char* argv[]) {
             // default time limit
             duration_seconds = device_default_device_duration_in_seconds(device_name);
         }
+        if (trace) {
+            // the trace is replayed once, at its own pace
+            niter = trace->entries().size();
+            duration_seconds = 0;
+        }
         uint64_t duration_nanoseconds = get_duration_in_nanoseconds(duration_seconds);
 
         if (statistics) {
@@ -1079,7 +1106,10 @@ int main(int argc, char* argv[]) {
         // ----------------------------------------
         next_step();
 
-        InferRequestsQueue inferRequestsQueue(compiledModel, nireq, app_inputs_info.size(), FLAGS_pcseq);
+        InferRequestsQueue inferRequestsQueue(compiledModel,
+                                              nireq,
+                                              trace ? trace->groups_num() : app_inputs_info.size(),
+                                              FLAGS_pcseq || trace);
 
         bool inputHasName = false;
         if (inputFiles.size() > 0) {
@@ -1256,45 +1286,69 @@ int main(int argc, char* argv[]) {
             slog::info << "Skipping warmup inference due to -no_warmup flag" << slog::endl;
         }
 
+        // sets the inputs of the test config to the request in full mode
+        auto set_inputs = [&](const std::shared_ptr<InferReqWrap>& request, size_t config) {
+            auto inputs = app_inputs_info[config % app_inputs_info.size()];
+
+            if (isDynamicNetwork) {
+                batchSize = get_batch_size(inputs);
+            }
+
+            for (auto& item : inputs) {
+                auto inputName = item.first;
+                const auto& data = inputsData.at(inputName)[config % inputsData.at(inputName).size()];
+                request->set_tensor(inputName, data);
+            }
+
+            if (useGpuMem) {
+                auto outputTensors = ::gpu::get_remote_output_tensors(compiledModel, request->get_output_cl_buffer());
+                for (auto& output : compiledModel.outputs()) {
+                    request->set_tensor(output.get_any_name(), outputTensors[output.get_any_name()]);
+                }
+            }
+        };
+
         size_t processedFramesN = 0;
         auto startTime = Time::now();
         auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
 
+        /** Replay the trace: every inference arrives at its recorded time, whether the previous ones are completed or
+         * not, so the time it waits for an idle request is the queueing delay of a server with nireq workers **/
+        if (trace) {
+            for (const auto& entry : trace->entries()) {
+                const auto arrival = startTime + std::chrono::microseconds(entry.timestamp_us);
+                std::this_thread::sleep_until(arrival);
+                inferRequest = inferRequestsQueue.get_idle_request();
+                if (!inferRequest) {
+                    OPENVINO_THROW("No idle Infer Requests!");
+                }
+                inferRequest->set_queue_delay(std::chrono::duration_cast<ns>(Time::now() - arrival).count() *
+                                              0.000001);
+                inferRequest->set_latency_group_id(entry.group);
+                set_inputs(inferRequest, entry.group);
+
+                inferRequest->start_async();
+                ++iteration;
+                processedFramesN += batchSize;
+            }
+        }
+
         /** Start inference & calculate performance **/
         /** to align number if iterations to guarantee that last infer requests are
          * executed in the same conditions **/
-        while ((niter != 0LL && iteration < niter) ||
-               (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
-               (FLAGS_api == "async" && iteration % nireq != 0)) {
+        while (!trace && ((niter != 0LL && iteration < niter) ||
+                          (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
+                          (FLAGS_api == "async" && iteration % nireq != 0))) {
             inferRequest = inferRequestsQueue.get_idle_request();
             if (!inferRequest) {
                 OPENVINO_THROW("No idle Infer Requests!");
             }
 
             if (!inferenceOnly) {
-                auto inputs = app_inputs_info[iteration % app_inputs_info.size()];
-
                 if (FLAGS_pcseq) {
                     inferRequest->set_latency_group_id(iteration % app_inputs_info.size());
                 }
-
-                if (isDynamicNetwork) {
-                    batchSize = get_batch_size(inputs);
-                }
-
-                for (auto& item : inputs) {
-                    auto inputName = item.first;
-                    const auto& data = inputsData.at(inputName)[iteration % inputsData.at(inputName).size()];
-                    inferRequest->set_tensor(inputName, data);
-                }
-
-                if (useGpuMem) {
-                    auto outputTensors =
-                        ::gpu::get_remote_output_tensors(compiledModel, inferRequest->get_output_cl_buffer());
-                    for (auto& output : compiledModel.outputs()) {
-                        inferRequest->set_tensor(output.get_any_name(), outputTensors[output.get_any_name()]);
-                    }
-                }
+                set_inputs(inferRequest, iteration);
             }
 
             if (FLAGS_api == "sync") {
@@ -1319,7 +1373,7 @@ int main(int argc, char* argv[]) {
 
         LatencyMetrics generalLatency(inferRequestsQueue.get_latencies(), "", FLAGS_latency_percentile);
         std::vector<LatencyMetrics> groupLatencies = {};
-        if (FLAGS_pcseq && app_inputs_info.size() > 1) {
+        if (FLAGS_pcseq && app_inputs_info.size() > 1 && !trace) {
             const auto& lat_groups = inferRequestsQueue.get_latency_groups();
             for (size_t i = 0; i < lat_groups.size(); i++) {
                 const auto& lats = lat_groups[i];
@@ -1368,6 +1422,12 @@ int main(int argc, char* argv[]) {
             statistics->add_parameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                        {StatisticsVariant("throughput", "throughput", fps)});
         }
+        if (trace) {
+            trace->report(inferRequestsQueue.get_queue_delay_groups(),
+                          inferRequestsQueue.get_latency_groups(),
+                          totalDuration,
+                          statistics.get());
+        }
         // ----------------- 11. Dumping statistics report
         // -------------------------------------------------------------
         next_step();
@@ -1425,7 +1485,7 @@ int main(int argc, char* argv[]) {
             slog::info << "Latency:" << slog::endl;
             generalLatency.write_to_slog(true);
 
-            if (FLAGS_pcseq && app_inputs_info.size() > 1) {
+            if (FLAGS_pcseq && app_inputs_info.size() > 1 && !trace) {
                 slog::info << "Latency for each data shape group:" << slog::endl;
                 for (size_t i = 0; i < app_inputs_info.size(); ++i) {
                     slog::info << (i + 1) << ".";
@@ -0,0 +1,282 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "workload_trace.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <functional>
+#include <numeric>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+// clang-format off
+#include "samples/common.hpp"
+#include "samples/slog.hpp"
+
+#include "utils.hpp"
+// clang-format on
+
+namespace {
+
+// "input1[1,3,224,224],input2[1,4]"
+std::map<std::string, std::string> parse_shapes(const std::string& shapes_string) {
+    std::map<std::string, std::string> shapes;
+    size_t pos = 0;
+    while (pos < shapes_string.size()) {
+        const auto open = shapes_string.find('[', pos);
+        const auto close = open == std::string::npos ? std::string::npos : shapes_string.find(']', open);
+        if (close == std::string::npos) {
+            throw std::logic_error("Can't parse the input shapes " + shapes_string);
+        }
+        shapes[shapes_string.substr(pos, open - pos)] = shapes_string.substr(open + 1, close - open - 1);
+        pos = close + 1;
+        if (pos < shapes_string.size()) {
+            if (shapes_string[pos] != ',') {
+                throw std::logic_error("Can't parse the input shapes " + shapes_string);
+            }
+            ++pos;
+        }
+    }
+    return shapes;
+}
+
+// "input1:1.bin input2:2.bin"
+std::map<std::string, std::string> parse_files(const std::string& files_string) {
+    std::map<std::string, std::string> files;
+    std::istringstream stream(files_string);
+    std::string item;
+    while (stream >> item) {
+        auto input_files = parse_input_files(item);
+        if (input_files.second.size() != 1) {
+            throw std::logic_error("A single file per input is expected in the workload trace: " + item);
+        }
+        files[input_files.first] = input_files.second[0];
+    }
+    return files;
+}
+
+struct Percentiles {
+    explicit Percentiles(std::vector<double> values) {
+        if (values.empty()) {
+            return;
+        }
+        std::sort(values.begin(), values.end());
+        // nearest-rank percentile
+        auto percentile = [&](double p) {
+            const auto rank = static_cast<size_t>(std::ceil(p / 100.0 * values.size()));
+            return values[std::max<size_t>(rank, 1) - 1];
+        };
+        avg = std::accumulate(values.begin(), values.end(), 0.0) / values.size();
+        p50 = percentile(50);
+        p90 = percentile(90);
+        p99 = percentile(99);
+        max = values.back();
+    }
+
+    double avg = 0;
+    double p50 = 0;
+    double p90 = 0;
+    double p99 = 0;
+    double max = 0;
+};
+
+}  // namespace
+
+WorkloadTrace::WorkloadTrace(const std::string& path, const std::string& model_name) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        throw std::logic_error("Can't open the workload trace " + path);
+    }
+
+    std::set<std::string> models;
+    std::map<std::pair<std::string, std::string>, size_t> group_ids;
+    std::string line;
+    size_t line_num = 0;
+    while (std::getline(file, line)) {
+        ++line_num;
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        if (line.empty() || line.front() == '#') {
+            continue;
+        }
+        auto fields = split(line, ';');
+        if (fields.size() == 2 && line.back() == ';') {
+            // a model without inputs
+            fields.emplace_back();
+        }
+        if (fields.size() != 3 && fields.size() != 4) {
+            throw std::logic_error("Can't parse line " + std::to_string(line_num) + " of the workload trace " + path +
+                                   ": " + line);
+        }
+        if (!model_name.empty() && fields[1] != model_name) {
+            continue;
+        }
+        models.insert(fields[1]);
+
+        uint64_t timestamp_us = 0;
+        try {
+            timestamp_us = std::stoull(fields[0]);
+        } catch (const std::exception&) {
+            throw std::logic_error("Can't parse the timestamp at line " + std::to_string(line_num) +
+                                   " of the workload trace " + path + ": " + fields[0]);
+        }
+        auto key = std::make_pair(fields[2], fields.size() == 4 ? fields[3] : std::string{});
+        const auto group = group_ids.emplace(key, _groups.size());
+        if (group.second) {
+            _groups.push_back({key.first, parse_shapes(key.first), parse_files(key.second)});
+        }
+        _entries.push_back({timestamp_us, group.first->second});
+    }
+
+    if (_entries.empty()) {
+        throw std::logic_error("No inferences" + (model_name.empty() ? "" : " of the model " + model_name) +
+                               " were found in the workload trace " + path);
+    }
+    if (models.size() > 1) {
+        std::string names;
+        for (const auto& name : models) {
+            names += (names.empty() ? "" : ", ") + name;
+        }
+        throw std::logic_error("The workload trace " + path + " contains the inferences of several models: " + names +
+                               ". Please select one of them with -trace_model.");
+    }
+    const auto groups_with_files = std::count_if(_groups.begin(), _groups.end(), [](const Group& group) {
+        return !group.files.empty();
+    });
+    if (groups_with_files != 0 && static_cast<size_t>(groups_with_files) != _groups.size()) {
+        throw std::logic_error("The input files should be set either for all the inferences of the workload trace " +
+                               path + " or for none of them.");
+    }
+
+    // the inferences started by several threads are recorded slightly out of order
+    std::stable_sort(_entries.begin(), _entries.end(), [](const Entry& a, const Entry& b) {
+        return a.timestamp_us < b.timestamp_us;
+    });
+    const auto start_us = _entries.front().timestamp_us;
+    for (auto& entry : _entries) {
+        entry.timestamp_us -= start_us;
+    }
+
+    slog::info << "Workload trace: " << _entries.size() << " inferences with " << _groups.size()
+               << " distinct inputs during " << double_to_string(_entries.back().timestamp_us / 1000.0) << " ms"
+               << slog::endl;
+}
+
+std::string WorkloadTrace::data_shape(const std::vector<ov::Output<const ov::Node>>& inputs) const {
+    std::string data_shape;
+    for (const auto& input : inputs) {
+        if (input.get_partial_shape().is_static()) {
+            continue;
+        }
+        std::string dims;
+        for (const auto& group : _groups) {
+            const auto shape = std::find_if(group.shapes.begin(), group.shapes.end(), [&](const auto& item) {
+                return item.first.empty() ? inputs.size() == 1 : input.get_names().count(item.first) != 0;
+            });
+            if (shape == group.shapes.end()) {
+                throw std::logic_error("The workload trace has no shape of the input " + input.get_any_name() +
+                                       " for the inferences with " + group.shapes_string);
+            }
+            dims += "[" + shape->second + "]";
+        }
+        data_shape += (data_shape.empty() ? "" : ",") + input.get_any_name() + dims;
+    }
+    return data_shape;
+}
+
+void WorkloadTrace::add_input_files(std::map<std::string, std::vector<std::string>>& inputFiles) const {
+    if (_groups.front().files.empty()) {
+        return;
+    }
+    if (!inputFiles.empty()) {
+        throw std::logic_error("-i can't be set when the workload trace refers to the input files.");
+    }
+    for (const auto& group : _groups) {
+        for (const auto& file : group.files) {
+            inputFiles[file.first].push_back(file.second);
+        }
+    }
+    for (const auto& files : inputFiles) {
+        if (files.second.size() != _groups.size()) {
+            throw std::logic_error("The inferences of the workload trace refer to the files of different inputs.");
+        }
+    }
+}
+
+void WorkloadTrace::report(const std::vector<std::vector<double>>& queue_delays,
+                           const std::vector<std::vector<double>>& compute_times,
+                           double duration_ms,
+                           StatisticsReport* statistics) const {
+    auto report_latencies = [&](const std::string& name,
+                                const std::string& json_prefix,
+                                const std::vector<double>& queue,
+                                const std::vector<double>& compute) {
+        std::vector<double> end_to_end(queue.size());
+        std::transform(queue.begin(), queue.end(), compute.begin(), end_to_end.begin(), std::plus<double>());
+        const Percentiles latency(end_to_end);
+        const Percentiles queueing(queue);
+        const Percentiles computing(compute);
+
+        slog::info << name << ": " << end_to_end.size() << " inferences" << slog::endl;
+        slog::info << "   Latency:      p50 " << double_to_string(latency.p50) << " ms, p90 "
+                   << double_to_string(latency.p90) << " ms, p99 " << double_to_string(latency.p99) << " ms, max "
+                   << double_to_string(latency.max) << " ms" << slog::endl;
+        slog::info << "   Queueing:     avg " << double_to_string(queueing.avg) << " ms, p99 "
+                   << double_to_string(queueing.p99) << " ms" << slog::endl;
+        slog::info << "   Compute:      avg " << double_to_string(computing.avg) << " ms, p99 "
+                   << double_to_string(computing.p99) << " ms" << slog::endl;
+
+        if (statistics) {
+            const auto csv_prefix = name + " ";
+            statistics->add_parameters(
+                StatisticsReport::Category::EXECUTION_RESULTS,
+                {StatisticsVariant(csv_prefix + "latency p50 (ms)", json_prefix + "latency_p50", latency.p50),
+                 StatisticsVariant(csv_prefix + "latency p90 (ms)", json_prefix + "latency_p90", latency.p90),
+                 StatisticsVariant(csv_prefix + "latency p99 (ms)", json_prefix + "latency_p99", latency.p99),
+                 StatisticsVariant(csv_prefix + "latency max (ms)", json_prefix + "latency_max", latency.max),
+                 StatisticsVariant(csv_prefix + "queueing avg (ms)", json_prefix + "queueing_avg", queueing.avg),
+                 StatisticsVariant(csv_prefix + "queueing p99 (ms)", json_prefix + "queueing_p99", queueing.p99),
+                 StatisticsVariant(csv_prefix + "compute avg (ms)", json_prefix + "compute_avg", computing.avg),
+                 StatisticsVariant(csv_prefix + "compute p99 (ms)", json_prefix + "compute_p99", computing.p99)});
+        }
+    };
+
+    std::vector<double> all_queue_delays;
+    std::vector<double> all_compute_times;
+    for (size_t i = 0; i < _groups.size(); ++i) {
+        all_queue_delays.insert(all_queue_delays.end(), queue_delays[i].begin(), queue_delays[i].end());
+        all_compute_times.insert(all_compute_times.end(), compute_times[i].begin(), compute_times[i].end());
+    }
+
+    const double span_ms = _entries.back().timestamp_us / 1000.0;
+    const double offered = span_ms > 0 ? 1000.0 * (_entries.size() - 1) / span_ms : 0.0;
+    const double achieved = duration_ms > 0 ? 1000.0 * all_compute_times.size() / duration_ms : 0.0;
+    slog::info << "Trace replay:" << slog::endl;
+    slog::info << "   Offered load:  " << double_to_string(offered) << " inferences/s" << slog::endl;
+    slog::info << "   Achieved load: " << double_to_string(achieved) << " inferences/s" << slog::endl;
+    if (statistics) {
+        statistics->add_parameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                   {StatisticsVariant("trace offered load (inferences/s)", "trace_offered_load", offered),
+                                    StatisticsVariant("trace achieved load (inferences/s)",
+                                                      "trace_achieved_load",
+                                                      achieved)});
+    }
+
+    report_latencies("Trace", "trace_", all_queue_delays, all_compute_times);
+    if (_groups.size() > 1) {
+        for (size_t i = 0; i < _groups.size(); ++i) {
+            report_latencies("Trace shape " + _groups[i].shapes_string,
+                             "trace_group_" + std::to_string(i) + "_",
+                             queue_delays[i],
+                             compute_times[i]);
+        }
+    }
+}
@@ -0,0 +1,75 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <openvino/openvino.hpp>
+#include <string>
+#include <vector>
+
+// clang-format off
+#include "statistics_report.hpp"
+// clang-format on
+
+/// @brief Inferences recorded by the ov::workload_trace property, replayed by the -trace option
+class WorkloadTrace {
+public:
+    struct Entry {
+        // the arrival time, relative to the first inference of the trace
+        uint64_t timestamp_us;
+        // the distinct combination of the input shapes and data of the inference
+        size_t group;
+    };
+
+    /// @param model_name replays the inferences of this model only, all of them if empty
+    WorkloadTrace(const std::string& path, const std::string& model_name);
+
+    /// @brief The inferences in the order of their arrival
+    const std::vector<Entry>& entries() const {
+        return _entries;
+    }
+
+    size_t groups_num() const {
+        return _groups.size();
+    }
+
+    /// @brief The input shapes of the group, in the -data_shape syntax
+    const std::string& group_shapes(size_t group) const {
+        return _groups.at(group).shapes_string;
+    }
+
+    /**
+     * @brief The -data_shape value with a shape per group for every dynamic input. The static inputs are skipped as
+     * -data_shape is not applicable to them.
+     */
+    std::string data_shape(const std::vector<ov::Output<const ov::Node>>& inputs) const;
+
+    /// @brief Adds a file per group for every input, if the trace refers to the input data
+    void add_input_files(std::map<std::string, std::vector<std::string>>& inputFiles) const;
+
+    /**
+     * @brief Reports the end-to-end latency of the replayed inferences, split into the queueing delay and the compute
+     * time, overall and for every group, and the achieved load against the offered one
+     * @param queue_delays the queueing delays by group
+     * @param compute_times the compute times by group
+     * @param duration_ms the time from the first arrival to the last completion
+     */
+    void report(const std::vector<std::vector<double>>& queue_delays,
+                const std::vector<std::vector<double>>& compute_times,
+                double duration_ms,
+                StatisticsReport* statistics) const;
+
+private:
+    struct Group {
+        std::string shapes_string;
+        // the dims by the input name, an empty name stands for the only input of the model
+        std::map<std::string, std::string> shapes;
+        std::map<std::string, std::string> files;
+    };
+
+    std::vector<Entry> _entries;
+    std::vector<Group> _groups;
+};
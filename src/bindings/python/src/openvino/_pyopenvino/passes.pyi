@@ -63,8 +63,13 @@ class ConstantFolding(ModelPass, PassBase):
     """
     openvino.passes.ConstantFolding transformation
     """
-    def __init__(self) -> None:
-        ...
+    def __init__(self, parallel: bool = False) -> None:
+        """
+                Create ConstantFolding pass.
+        
+                :param parallel: Evaluate the nodes which do not depend on each other concurrently.
+                :type parallel: bool
+        """
     def __repr__(self) -> str:
         ...
 class ConvertFP32ToFP16(ModelPass, PassBase):
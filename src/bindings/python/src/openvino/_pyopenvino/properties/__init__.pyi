@@ -13,7 +13,7 @@ import typing
 """
 openvino.properties submodule
 """
-__all__: list[str] = ['CacheMode', 'CompatibilityCheck', 'WorkloadType', 'auto_batch_timeout', 'available_devices', 'cache_dir', 'cache_encryption_callbacks', 'cache_mode', 'compatibility_check', 'compilation_num_threads', 'device', 'enable_mmap', 'enable_profiling', 'enable_weightless', 'execution_devices', 'force_tbb_terminate', 'hint', 'inference_num_threads', 'intel_auto', 'intel_cpu', 'intel_gpu', 'intel_npu', 'key_cache_group_size', 'key_cache_precision', 'loaded_from_cache', 'log', 'max_batch_size', 'model_name', 'num_streams', 'optimal_batch_size', 'optimal_number_of_infer_requests', 'range_for_async_infer_requests', 'range_for_streams', 'runtime_requirements', 'streams', 'supported_properties', 'value_cache_group_size', 'value_cache_precision', 'weights_path', 'workload_type']
+__all__: list[str] = ['CacheMode', 'CompatibilityCheck', 'WorkloadType', 'auto_batch_latency_target', 'auto_batch_timeout', 'available_devices', 'cache_dir', 'cache_encryption_callbacks', 'cache_mode', 'compatibility_check', 'compilation_num_threads', 'device', 'enable_mmap', 'enable_profiling', 'enable_weightless', 'execution_devices', 'force_tbb_terminate', 'hint', 'inference_num_threads', 'intel_auto', 'intel_cpu', 'intel_gpu', 'intel_npu', 'key_cache_group_size', 'key_cache_precision', 'loaded_from_cache', 'log', 'max_batch_size', 'model_name', 'num_streams', 'optimal_batch_size', 'optimal_number_of_infer_requests', 'range_for_async_infer_requests', 'range_for_streams', 'runtime_requirements', 'streams', 'supported_properties', 'value_cache_group_size', 'value_cache_precision', 'weights_path', 'workload_type']
 class CacheMode:
     """
     Members:
@@ -153,6 +153,12 @@ class WorkloadType:
     def value(self) -> int:
         ...
 @typing.overload
+def auto_batch_latency_target() -> str:
+    ...
+@typing.overload
+def auto_batch_latency_target(arg0: typing.SupportsInt | typing.SupportsIndex) -> tuple[str, openvino._pyopenvino.OVAny]:
+    ...
+@typing.overload
 def auto_batch_timeout() -> str:
     ...
 @typing.overload
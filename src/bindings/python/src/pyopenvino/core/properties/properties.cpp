@@ -36,14 +36,18 @@ void regmodule_properties(py::module m) {
     // Submodule properties - properties
     wrap_property_RW(m_properties, ov::enable_profiling, "enable_profiling");
     wrap_property_RW(m_properties, ov::cache_dir, "cache_dir");
+    wrap_property_RW(m_properties, ov::cache_size_budget, "cache_size_budget");
     wrap_property_RW(m_properties, ov::workload_type, "workload_type");
     wrap_property_RW(m_properties, ov::cache_mode, "cache_mode");
     wrap_property_RW(m_properties, ov::auto_batch_timeout, "auto_batch_timeout");
+    wrap_property_RW(m_properties, ov::auto_batch_latency_target, "auto_batch_latency_target");
     wrap_property_RW(m_properties, ov::num_streams, "num_streams");
     wrap_property_RW(m_properties, ov::inference_num_threads, "inference_num_threads");
     wrap_property_RW(m_properties, ov::compilation_num_threads, "compilation_num_threads");
     wrap_property_RW(m_properties, ov::force_tbb_terminate, "force_tbb_terminate");
     wrap_property_RW(m_properties, ov::enable_mmap, "enable_mmap");
+    wrap_property_RW(m_properties, ov::workload_trace, "workload_trace");
+    wrap_property_RW(m_properties, ov::tensor_memory_pool, "tensor_memory_pool");
     wrap_property_RW(m_properties, ov::weights_path, "weights_path");
     wrap_property_RW(m_properties, ov::key_cache_precision, "key_cache_precision");
     wrap_property_RW(m_properties, ov::value_cache_precision, "value_cache_precision");
@@ -63,6 +67,7 @@ void regmodule_properties(py::module m) {
     wrap_property_RO(m_properties, ov::loaded_from_cache, "loaded_from_cache");
     wrap_property_RO(m_properties, ov::compatibility_check, "compatibility_check");
     wrap_property_RO(m_properties, ov::runtime_requirements, "runtime_requirements");
+    wrap_property_RO(m_properties, ov::tensor_memory_pool_statistics, "tensor_memory_pool_statistics");
 
     wrap_property_WO(m_properties, ov::cache_encryption_callbacks, "cache_encryption_callbacks");
 
@@ -73,7 +73,14 @@ void regclass_transformations(py::module m) {
                ov::pass::PassBase>
         cf(m, "ConstantFolding");
     cf.doc() = "openvino.passes.ConstantFolding transformation";
-    cf.def(py::init<>());
+    cf.def(py::init<bool>(),
+           py::arg("parallel") = false,
+           R"(
+        Create ConstantFolding pass.
+
+        :param parallel: Evaluate the nodes which do not depend on each other concurrently.
+        :type parallel: bool
+    )");
     cf.def("__repr__", [](const ov::pass::ConstantFolding& self) {
         return Common::get_simple_repr(self);
     });
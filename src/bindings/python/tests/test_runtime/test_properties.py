@@ -195,6 +195,7 @@ def test_conflicting_enum(proxy_enums, expected_values):
         (props.loaded_from_cache, "LOADED_FROM_CACHE"),
         (props.runtime_requirements, "RUNTIME_REQUIREMENTS"),
         (props.compatibility_check, "COMPATIBILITY_CHECK"),
+        (props.tensor_memory_pool_statistics, "TENSOR_MEMORY_POOL_STATISTICS"),
         (device.full_name, "FULL_DEVICE_NAME"),
         (device.architecture, "DEVICE_ARCHITECTURE"),
         (device.type, "DEVICE_TYPE"),
@@ -242,6 +243,11 @@ def test_properties_ro(ov_property_ro, expected_value):
             "CACHE_DIR",
             (("./test_cache", "./test_cache"),),
         ),
+        (
+            props.cache_size_budget,
+            "CACHE_SIZE_BUDGET",
+            ((1 << 30, 1 << 30),),
+        ),
         (
             props.cache_mode,
             "CACHE_MODE",
@@ -260,6 +266,14 @@ def test_properties_ro(ov_property_ro, expected_value):
                 (np.uint32(37), np.uint32(37)),
             ),
         ),
+        (
+            props.auto_batch_latency_target,
+            "AUTO_BATCH_LATENCY_TARGET",
+            (
+                (50, 50),
+                (np.uint32(20), 20),
+            ),
+        ),
         (
             props.inference_num_threads,
             "INFERENCE_NUM_THREADS",
@@ -275,6 +289,7 @@ def test_properties_ro(ov_property_ro, expected_value):
         ),
         (props.force_tbb_terminate, "FORCE_TBB_TERMINATE", ((True, True), (False, False))),
         (props.enable_mmap, "ENABLE_MMAP", ((True, True), (False, False))),
+        (props.tensor_memory_pool, "TENSOR_MEMORY_POOL", ((True, True), (False, False))),
         (
             props.weights_path,
             "WEIGHTS_PATH",
@@ -22,6 +22,7 @@ set(DEV_HEADERS
     ${CMAKE_CURRENT_LIST_DIR}/openvino/core/type/nf4.hpp
     ${CMAKE_CURRENT_LIST_DIR}/openvino/op/gated_delta_net.hpp
     ${CMAKE_CURRENT_LIST_DIR}/openvino/op/group_query_attention.hpp
+    ${CMAKE_CURRENT_LIST_DIR}/openvino/op/kquant_matmul.hpp
     ${CMAKE_CURRENT_LIST_DIR}/openvino/op/moe.hpp
     ${CMAKE_CURRENT_LIST_DIR}/openvino/op/ops_decl.hpp
     ${CMAKE_CURRENT_LIST_DIR}/openvino/op/pa_kv_reorder.hpp
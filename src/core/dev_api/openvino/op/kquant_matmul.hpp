@@ -0,0 +1,61 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/op/op.hpp"
+
+namespace ov::op::internal {
+/// \note KQuantMatMul op class is under development and subject to change
+///
+/// \brief Matrix multiplication with weights kept in the packed GGML K-quant super-block layout.
+///
+/// Computes out = data * dequantize(weights)^T without materializing the dequantized weights, so
+/// Q4_K/Q5_K/Q6_K weights keep their native size (4.5/5.5/6.5 bits per weight) in memory.
+/// \ingroup ov_ops_cpp_api
+class OPENVINO_API KQuantMatMul : public ov::op::Op {
+public:
+    OPENVINO_OP("KQuantMatMul");
+
+    enum class QuantType { Q4_K, Q5_K, Q6_K };
+
+    KQuantMatMul() = default;
+    /// \brief Constructs a KQuantMatMul operation.
+    ///
+    /// \param data Activations of shape [..., K], f32/f16/bf16. K must be a multiple of 256.
+    /// \param weights Raw super-blocks as u8 of shape [N, K / 256 * block_bytes], one row per output channel.
+    /// \param quant_type Super-block layout of `weights`.
+    KQuantMatMul(const Output<Node>& data, const Output<Node>& weights, QuantType quant_type);
+
+    void validate_and_infer_types() override;
+    bool visit_attributes(AttributeVisitor& visitor) override;
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+
+    QuantType get_quant_type() const {
+        return m_quant_type;
+    }
+
+    /// \brief Returns the size of one 256-element super-block of the given type in bytes.
+    static size_t get_block_bytes(QuantType quant_type);
+
+private:
+    QuantType m_quant_type = QuantType::Q4_K;
+};
+
+}  // namespace ov::op::internal
+
+namespace ov {
+std::ostream& operator<<(std::ostream& s, const ov::op::internal::KQuantMatMul::QuantType& type);
+
+template <>
+class AttributeAdapter<ov::op::internal::KQuantMatMul::QuantType>
+    : public EnumAttributeAdapterBase<ov::op::internal::KQuantMatMul::QuantType> {
+public:
+    AttributeAdapter(ov::op::internal::KQuantMatMul::QuantType& value)
+        : EnumAttributeAdapterBase<ov::op::internal::KQuantMatMul::QuantType>(value) {}
+
+    OPENVINO_RTTI("AttributeAdapter<ov::op::internal::KQuantMatMul::QuantType>");
+    ~AttributeAdapter() override = default;
+};
+}  // namespace ov
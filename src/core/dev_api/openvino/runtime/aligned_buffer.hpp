@@ -77,6 +77,10 @@ public:
     /// \brief Ensures the buffer is available and populated with actual data.
     virtual void hint_prefetch() const;
 
+    /// \brief Returns the hash of the buffer content. It is computed on every call, as the content may be modified in
+    /// place, unless the buffer is a read-only mapping of a file.
+    virtual size_t get_hash() const;
+
 protected:
     virtual void hint_evict(size_t offset, size_t size) noexcept;
     static void invoke_evict(AlignedBuffer& buffer, size_t offset, size_t size) noexcept;
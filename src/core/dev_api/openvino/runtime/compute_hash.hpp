@@ -16,5 +16,13 @@ namespace runtime {
  */
 size_t compute_hash(const void* src, size_t size);
 
+/**
+ * @brief Computes the hash value for the input data by chunks in parallel, the large data are hashed much faster
+ * than by compute_hash. The values differ from the ones of compute_hash for the data larger than two chunks.
+ * @param src  A pointer to the input data
+ * @param size The length of the input data in bytes
+ */
+size_t compute_hash_parallel(const void* src, size_t size);
+
 }  // namespace runtime
 }  // namespace ov
@@ -117,6 +117,33 @@ public:
      */
     virtual void copy_to(const std::shared_ptr<ov::ITensor>& dst) const;
 
+    /**
+     * @brief Options of the tensor copy
+     */
+    struct CopyOptions {
+        /**
+         * @brief Converts the elements to the element type of the destination tensor in the same pass. Supports
+         * f32 <-> f16, f32 <-> bf16, bf16 -> f16, u8 -> f32 and u8 -> f16.
+         */
+        bool convert = false;
+        /**
+         * @brief The maximal number of threads of the copy, 0 means all the available threads
+         */
+        size_t threads = 0;
+    };
+
+    /**
+     * @brief Copy tensor, destination tensor should have the same shape and the same element type unless the
+     * conversion is requested
+     *
+     * The dimensions contiguous in both tensors are coalesced, the large copies are split between the threads and the
+     * converted destinations larger than the last level cache are written with the non-temporal stores.
+     *
+     * @param dst destination tensor
+     * @param options copy options
+     */
+    void copy_to(const std::shared_ptr<ov::ITensor>& dst, const CopyOptions& options) const;
+
 protected:
     virtual ~ITensor();
 };
@@ -0,0 +1,42 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+#include "openvino/core/core_visibility.hpp"
+
+namespace ov {
+
+/**
+ * @brief Sets whether the allocators constructed by ov::Allocator() use the process-wide pool returned by
+ * ov::get_pooled_allocator(), e.g. the ones of the tensors created without an explicit allocator. The memory allocated
+ * before keeps its allocator, so the setting may be changed at any time.
+ * @param pooled true to pool the default allocations, false (default) to allocate them by the system allocator
+ */
+OPENVINO_API void set_default_allocator_pooled(bool pooled);
+
+/**
+ * @brief Returns whether the allocators constructed by ov::Allocator() use the process-wide pool.
+ */
+OPENVINO_API bool is_default_allocator_pooled();
+
+/**
+ * @brief Returns the counters of the pooled allocators summed over the NUMA nodes: the number of "allocations", served
+ * from the "thread_cache_hits" and the "pool_hits", or by the "system_allocations" with the "huge_page_blocks" among
+ * them, the "system_frees", the bytes "in_use_bytes" and "cached_bytes" of the blocks, their sum "system_bytes" and
+ * its "peak_system_bytes".
+ */
+OPENVINO_API std::map<std::string, uint64_t> get_pooled_allocator_statistics();
+
+/**
+ * @brief Returns the blocks cached by the pools and by the thread cache of the calling thread to the system. The
+ * caches of the other threads are returned when the threads exit.
+ */
+OPENVINO_API void release_pooled_allocator_memory();
+
+}  // namespace ov
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <mutex>
 #include <type_traits>
 
 #include "openvino/runtime/aligned_buffer.hpp"
@@ -43,6 +44,18 @@ public:
         }
     }
 
+    size_t get_hash() const override {
+        if (is_read_only_mapping()) {
+            // The weights mapped from a file are never modified, so the hash is kept for the next compilations of the
+            // model and of its clones, which share the buffer. The other buffers may be modified in place.
+            std::call_once(m_hash_once, [this] {
+                m_hash = AlignedBuffer::get_hash();
+            });
+            return m_hash;
+        }
+        return AlignedBuffer::get_hash();
+    }
+
 protected:
     template <typename U>
     struct is_aligned_buffer_ptr : std::false_type {};
@@ -105,6 +118,19 @@ protected:
         m_byte_size = size;
     }
 
+    // the buffer is a read-only mapping of a file, or a view of one (e.g. a constant of the IR weights mapped by the
+    // frontend)
+    bool is_read_only_mapping() const {
+        if constexpr (std::is_same_v<std::shared_ptr<ov::MappedMemory>, T>) {
+            return true;
+        } else if constexpr (is_aligned_buffer_ptr_v<T>) {
+            return std::dynamic_pointer_cast<const SharedBufferBase<std::shared_ptr<ov::MappedMemory>>>(
+                       m_shared_object) != nullptr;
+        } else {
+            return false;
+        }
+    }
+
     size_t get_offset() const {
         if (m_source_buffer) {
             return reinterpret_cast<uintptr_t>(m_aligned_buffer) -
@@ -120,6 +146,10 @@ protected:
     // may or may not reference the same data as m_shared_object
     std::shared_ptr<ov::AlignedBuffer> m_source_buffer;
     std::shared_ptr<IBufferDescriptor> m_descriptor;
+
+private:
+    mutable std::once_flag m_hash_once;
+    mutable size_t m_hash = 0;
 };
 
 template <typename T>
@@ -13,6 +13,10 @@
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/core/visibility.hpp"
 
+namespace ov {
+class AlignedBuffer;
+}  // namespace ov
+
 namespace ov::util {
 
 class OPENVINO_API ConstantWriter {
@@ -33,6 +37,13 @@ public:
 
     virtual FilePosition write(const std::vector<std::string_view>& chunks, size_t& new_size);
 
+    /// Writes the content of the buffer, the hash of the content is taken from the buffer which can memoize it
+    FilePosition write(const ov::AlignedBuffer& buffer,
+                       size_t& new_size,
+                       bool compress_to_fp16,
+                       ov::element::Type src_type,
+                       bool ptr_is_temporary);
+
     uint64_t get_data_hash() const {
         return m_data_hash;
     }
@@ -49,5 +60,7 @@ private:
     bool m_enable_compression;
     FilePosition m_blob_offset;  // blob offset inside output stream
     uint64_t m_data_hash;
+    // the buffer being written by write(const AlignedBuffer&)
+    const ov::AlignedBuffer* m_buffer = nullptr;
 };
 }  // namespace ov::util
@@ -177,6 +177,13 @@ public:
 
     void validate_nodes_and_infer_types() const;
 
+    /// \brief Validates the nodes changed since the last validation of the model and propagates the
+    ///        changes of their output types and shapes forward: the consumers of a revalidated node are
+    ///        revalidated only if its outputs were changed. Validates all nodes for the first time.
+    ///        The nodes are tracked as changed when their inputs are reconnected or when they are
+    ///        marked by Node::mark_dirty.
+    void validate_dirty_nodes_and_infer_types() const;
+
     /// \brief Returns the sum of the size of all nodes in the graph plus the size of
     /// all constant data. This has little value beyond comparing the relative size of
     /// graphs and should not be considered the actual memory consumption of a graph.
@@ -254,6 +254,15 @@ public:
         invalidate_values();
         validate_and_infer_types();
     }
+
+    /// \brief Marks the node to be revalidated by Model::validate_dirty_nodes_and_infer_types.
+    ///        The nodes are marked automatically when their inputs are reconnected. Call it after
+    ///        changing the attributes which the output element types and shapes depend on.
+    void mark_dirty();
+    /// \returns true if the node has been changed since its last validation as a part of a model
+    bool is_dirty() const {
+        return m_dirty;
+    }
     /// \brief Get the string name for the type of the node, such as `Add` or `Multiply`.
     ///        The class name, must not contain spaces as it is used for codegen.
     /// \returns A const reference to the node's type name
@@ -454,6 +463,8 @@ private:
     std::deque<descriptor::Input> m_inputs;
     std::deque<descriptor::Output> m_outputs;
     RTMap m_rt_info;
+    // new nodes are validated by the constructors, but not against the inputs they are connected to later
+    bool m_dirty = true;
 
     // The vector of SharedRTInfo attributes associated to Functions
     // where this node belongs to. SharedRTInfo is private field which
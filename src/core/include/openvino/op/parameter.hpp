@@ -50,6 +50,7 @@ public:
     }
     void set_element_type(const element::Type& element_type) {
         m_element_type = element_type;
+        mark_dirty();
     }
 
     /// \brief Returns current layout, or empty Layout if it is not set
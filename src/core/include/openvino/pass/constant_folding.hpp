@@ -19,6 +19,15 @@ namespace pass {
 class OPENVINO_API ConstantFolding : public ModelPass {
 public:
     OPENVINO_MODEL_PASS_RTTI("ConstantFolding");
+
+    ConstantFolding() = default;
+    /**
+     * @brief Creates the pass
+     * @param parallel  Evaluate the nodes which do not depend on each other concurrently. The graph is rewritten in
+     * the same way as in the sequential mode.
+     */
+    explicit ConstantFolding(bool parallel);
+
     bool run_on_model(const std::shared_ptr<ov::Model>& model) override;
 
 protected:
@@ -26,6 +35,9 @@ protected:
     /// \brief Folds pre-calculated output tensor values to constants in case lower and
     /// upper estimations are equal. Traverses graph backwards starting from the results.
     bool pre_calculated_values_folding(const std::shared_ptr<ov::Model>& model);
+
+private:
+    bool m_parallel = false;
 };
 
 /**
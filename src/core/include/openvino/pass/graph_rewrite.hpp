@@ -23,6 +23,8 @@
 
 namespace ov {
 namespace pass {
+class Manager;
+
 /// \brief GraphRewrite is a container for MatcherPasses that allows to run them on Function
 /// in
 /// efficient way
@@ -32,9 +34,8 @@ namespace pass {
 /// class.
 /// As a default algorithm graph rewrite pass traverse Function in topological order and
 /// applies
-/// registered matcher passes for each node. But if all registered matcher passes have type
-/// based
-/// root node in Matcher pattern then efficient mechanism is used to execute them.
+/// registered matcher passes for each node. But matcher passes that have type based root node
+/// in Matcher pattern are applied only to the nodes of that type.
 /// Matcher pattern root is type based if it's operation from opset or
 /// pattern::op::WrapType.
 /// Note: when implementing pattern for Matcher make sure that root node is an operation
@@ -128,6 +129,9 @@ public:
     void set_pass_config(const std::shared_ptr<PassConfig>& pass_config) override;
 
 protected:
+    // pass::Manager runs the matchers of consecutive GraphRewrites together in the fused mode
+    friend class Manager;
+
     bool apply_matcher_passes(std::shared_ptr<Model> f, std::deque<std::weak_ptr<Node>> nodes_to_run);
 
     bool m_enable_shape_inference = false;
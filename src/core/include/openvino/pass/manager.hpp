@@ -80,6 +80,27 @@ public:
     /// \param new_state Value "true" enables Validate pass run; "false", otherwise
     void set_per_pass_validation(bool new_state);
 
+    /// \brief Set flag to enable/disable the fused execution of matcher passes
+    ///
+    /// In the fused mode consecutive MatcherPasses and GraphRewrite instances (not the classes
+    /// derived from GraphRewrite, as they may customize the graph traversal) are executed as a
+    /// single GraphRewrite: every node is visited once per group and the matchers are looked up
+    /// by the node type in a single index of the whole group. The nodes created by the group are
+    /// visited once more after the traversal, so that later passes of the group see them.
+    /// Unlike the sequential execution, a pass of the group does not see the in-place changes
+    /// made by the later passes to the nodes it has already visited.
+    /// \param new_state Value "true" enables the fused execution; "false", otherwise
+    void set_fuse_matcher_passes(bool new_state);
+
+    /// \brief Set flag to enable/disable the incremental mode of the Validate passes
+    ///
+    /// In the incremental mode the Validate passes revalidate only the nodes changed by the
+    /// previous passes and propagate the changes of the output types and shapes forward, see
+    /// ov::Model::validate_dirty_nodes_and_infer_types. The passes changing the attributes of
+    /// nodes in place have to mark them by ov::Node::mark_dirty.
+    /// \param new_state Value "true" enables the incremental validation; "false", otherwise
+    void set_incremental_validation(bool new_state);
+
     /// \return PassConfig shared object. This object is used for transformations pipeline
     /// configuration.
     /// This object allows to disable/enable transformations execution, set callback to
@@ -105,10 +126,13 @@ protected:
     std::shared_ptr<PassConfig> m_pass_config;
     std::vector<std::shared_ptr<PassBase>> m_pass_list;
     bool m_per_pass_validation = true;
+    bool m_fuse_matcher_passes = false;
+    bool m_incremental_validation = false;
     std::string m_name = "UnnamedManager";
 
 private:
     bool run_pass(const std::shared_ptr<PassBase>& pass, const std::shared_ptr<Model>& model);
+    bool is_fusible(const std::shared_ptr<PassBase>& pass) const;
 };
 }  // namespace pass
 }  // namespace ov
@@ -21,13 +21,29 @@ namespace pass {
 /// pass does not break the shape and data type requirement on a computation node.
 /// This default validation run can be changed via calling the
 /// \link ov::pass::Manager::set_per_pass_validation(bool) \endlink function.
+///
+/// In the incremental mode only the nodes changed since the previous validation and the
+/// consumers of the nodes whose outputs were changed are validated, see
+/// \link ov::Model::validate_dirty_nodes_and_infer_types() \endlink.
 /// \ingroup ov_pass_cpp_api
 class OPENVINO_API Validate : public ModelPass {
 public:
     OPENVINO_MODEL_PASS_RTTI("ov::pass::Validate");
 
     Validate() : ModelPass() {}
+    explicit Validate(bool incremental) : ModelPass(), m_incremental(incremental) {}
     bool run_on_model(const std::shared_ptr<ov::Model>& f) override;
+
+    void set_incremental(bool incremental) {
+        m_incremental = incremental;
+    }
+
+    bool is_incremental() const {
+        return m_incremental;
+    }
+
+private:
+    bool m_incremental = false;
 };
 }  // namespace pass
 }  // namespace ov
@@ -175,4 +175,19 @@ public:
     explicit operator bool() const noexcept;
 };
 
+/**
+ * @brief Returns an allocator backed by the process-wide pool of memory blocks, to create the tensors allocated and
+ * released at a high rate without the system allocator calls and the page faults.
+ *
+ * The sizes are rounded up to one of four size classes per power of two, the released blocks are kept in the free
+ * lists of their size class and in a small cache of the releasing thread. The blocks of 2 MiB and larger are aligned
+ * to and advised to be backed by the transparent huge pages where available (Linux).
+ *
+ * @param numa_node The NUMA node of the system the pages of the blocks are bound to (Linux), -1 (default) places the
+ * pages where they are touched first. Every node has its own pool.
+ * @return Allocator of the pool
+ * @ingroup ov_runtime_cpp_api
+ */
+OPENVINO_API Allocator get_pooled_allocator(int numa_node = -1);
+
 }  // namespace ov
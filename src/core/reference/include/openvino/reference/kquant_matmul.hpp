@@ -0,0 +1,143 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "openvino/core/type/float16.hpp"
+
+namespace ov::reference {
+namespace kquant {
+
+/// \brief Number of weights in one GGML K-quant super-block.
+constexpr size_t block_size = 256;
+/// \brief Bytes of one Q4_K super-block: f16 d, f16 dmin, 12 bytes of 6-bit scales/mins, 128 bytes of nibbles.
+constexpr size_t q4_k_block_bytes = 144;
+/// \brief Bytes of one Q5_K super-block: Q4_K layout plus 32 bytes of high bits.
+constexpr size_t q5_k_block_bytes = 176;
+/// \brief Bytes of one Q6_K super-block: 128 bytes of low nibbles, 64 bytes of high bits, 16 i8 scales, f16 d.
+constexpr size_t q6_k_block_bytes = 210;
+
+inline float load_f16(const uint8_t* p) {
+    uint16_t bits;
+    std::memcpy(&bits, p, sizeof(bits));
+    return static_cast<float>(ov::float16::from_bits(bits));
+}
+
+inline void get_scale_min_k4(size_t j, const uint8_t* q, uint8_t& d, uint8_t& m) {
+    if (j < 4) {
+        d = q[j] & 63;
+        m = q[j + 4] & 63;
+    } else {
+        d = (q[j + 4] & 0xF) | ((q[j - 4] >> 6) << 4);
+        m = (q[j + 4] >> 4) | ((q[j] >> 6) << 4);
+    }
+}
+
+/// \brief Dequantizes one Q4_K super-block into 256 floats, y = d * sc * q - dmin * m.
+inline void dequantize_q4_k_block(const uint8_t* blk, float* y) {
+    const float d = load_f16(blk);
+    const float dmin = load_f16(blk + 2);
+    const uint8_t* sc = blk + 4;
+    const uint8_t* q = blk + 16;
+    for (size_t j = 0; j < 4; ++j, q += 32, y += 64) {
+        uint8_t s1, m1, s2, m2;
+        get_scale_min_k4(2 * j, sc, s1, m1);
+        get_scale_min_k4(2 * j + 1, sc, s2, m2);
+        const float d1 = d * s1, mn1 = dmin * m1, d2 = d * s2, mn2 = dmin * m2;
+        for (size_t l = 0; l < 32; ++l) {
+            y[l] = d1 * (q[l] & 0xF) - mn1;
+            y[32 + l] = d2 * (q[l] >> 4) - mn2;
+        }
+    }
+}
+
+/// \brief Dequantizes one Q5_K super-block into 256 floats.
+inline void dequantize_q5_k_block(const uint8_t* blk, float* y) {
+    const float d = load_f16(blk);
+    const float dmin = load_f16(blk + 2);
+    const uint8_t* sc = blk + 4;
+    const uint8_t* qh = blk + 16;
+    const uint8_t* ql = blk + 48;
+    for (size_t j = 0; j < 4; ++j, ql += 32, y += 64) {
+        uint8_t s1, m1, s2, m2;
+        get_scale_min_k4(2 * j, sc, s1, m1);
+        get_scale_min_k4(2 * j + 1, sc, s2, m2);
+        const float d1 = d * s1, mn1 = dmin * m1, d2 = d * s2, mn2 = dmin * m2;
+        const uint8_t u1 = static_cast<uint8_t>(1u << (2 * j));
+        const uint8_t u2 = static_cast<uint8_t>(2u << (2 * j));
+        for (size_t l = 0; l < 32; ++l) {
+            y[l] = d1 * static_cast<float>((ql[l] & 0xF) + ((qh[l] & u1) ? 16 : 0)) - mn1;
+            y[32 + l] = d2 * static_cast<float>((ql[l] >> 4) + ((qh[l] & u2) ? 16 : 0)) - mn2;
+        }
+    }
+}
+
+/// \brief Dequantizes one Q6_K super-block into 256 floats, y = d * sc * (q - 32).
+inline void dequantize_q6_k_block(const uint8_t* blk, float* y) {
+    const uint8_t* ql = blk;
+    const uint8_t* qh = blk + 128;
+    const auto* sc = reinterpret_cast<const int8_t*>(blk + 192);
+    const float d = load_f16(blk + 208);
+    for (size_t n = 0; n < 2; ++n, ql += 64, qh += 32, sc += 8, y += 128) {
+        for (size_t l = 0; l < 32; ++l) {
+            const size_t is = l / 16;
+            const int q1 = ((ql[l] & 0xF) | (((qh[l] >> 0) & 3) << 4)) - 32;
+            const int q2 = ((ql[l + 32] & 0xF) | (((qh[l] >> 2) & 3) << 4)) - 32;
+            const int q3 = ((ql[l] >> 4) | (((qh[l] >> 4) & 3) << 4)) - 32;
+            const int q4 = ((ql[l + 32] >> 4) | (((qh[l] >> 6) & 3) << 4)) - 32;
+            y[l] = d * sc[is] * q1;
+            y[l + 32] = d * sc[is + 2] * q2;
+            y[l + 64] = d * sc[is + 4] * q3;
+            y[l + 96] = d * sc[is + 6] * q4;
+        }
+    }
+}
+
+using dequantize_block_fn = void (*)(const uint8_t*, float*);
+
+}  // namespace kquant
+
+/// \brief Reference matrix multiplication with GGML K-quant packed weights, out = data * dequantize(weights)^T.
+///
+/// \param data            Activations, [M, K] row-major.
+/// \param weights         Raw GGML super-blocks, N rows of K / 256 blocks each.
+/// \param out             Output, [M, N] row-major.
+/// \param M               Number of activation rows.
+/// \param N               Number of weight rows (output channels).
+/// \param K               Reduction size, multiple of 256.
+/// \param block_bytes     Size of one super-block in bytes.
+/// \param dequantize      Super-block dequantization function matching `block_bytes`.
+template <typename T>
+void kquant_matmul(const T* data,
+                   const uint8_t* weights,
+                   T* out,
+                   size_t M,
+                   size_t N,
+                   size_t K,
+                   size_t block_bytes,
+                   kquant::dequantize_block_fn dequantize) {
+    const size_t blocks = K / kquant::block_size;
+    std::vector<float> row(K);
+    for (size_t n = 0; n < N; ++n) {
+        const uint8_t* w = weights + n * blocks * block_bytes;
+        for (size_t b = 0; b < blocks; ++b) {
+            dequantize(w + b * block_bytes, row.data() + b * kquant::block_size);
+        }
+        for (size_t m = 0; m < M; ++m) {
+            const T* x = data + m * K;
+            float acc = 0.0f;
+            for (size_t k = 0; k < K; ++k) {
+                acc += static_cast<float>(x[k]) * row[k];
+            }
+            out[m * N + n] = static_cast<T>(acc);
+        }
+    }
+}
+
+}  // namespace ov::reference
@@ -156,6 +156,7 @@ set(REFERENCE_HEADERS
     ${CMAKE_CURRENT_LIST_DIR}/include/openvino/reference/is_inf.hpp
     ${CMAKE_CURRENT_LIST_DIR}/include/openvino/reference/is_nan.hpp
     ${CMAKE_CURRENT_LIST_DIR}/include/openvino/reference/istft.hpp
+    ${CMAKE_CURRENT_LIST_DIR}/include/openvino/reference/kquant_matmul.hpp
     ${CMAKE_CURRENT_LIST_DIR}/include/openvino/reference/less.hpp
     ${CMAKE_CURRENT_LIST_DIR}/include/openvino/reference/less_eq.hpp
     ${CMAKE_CURRENT_LIST_DIR}/include/openvino/reference/log.hpp
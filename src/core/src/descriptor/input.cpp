@@ -54,6 +54,8 @@ void ov::descriptor::Input::replace_output(Output& new_output) {
              [](const std::shared_ptr<SharedRTInfo>& info) {
                  info->set_use_topological_cache(false);
              });
+    // the node has to be revalidated against its new input
+    m_node->mark_dirty();
 }
 
 void ov::descriptor::Input::replace_output(const std::shared_ptr<ov::Node>& node, size_t i) {
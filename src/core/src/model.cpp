@@ -7,6 +7,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "evaluator.hpp"
 #include "itt.hpp"
@@ -17,6 +18,7 @@
 #include "openvino/core/meta_data.hpp"
 #include "openvino/core/partial_shape.hpp"
 #include "openvino/op/parameter.hpp"
+#include "openvino/op/util/multi_subgraph_base.hpp"
 #include "openvino/op/util/op_types.hpp"
 #include "openvino/op/util/variable_context.hpp"
 #include "openvino/op/util/variable_extension.hpp"
@@ -45,6 +47,52 @@ void check_all_variables_registered(const std::vector<shared_ptr<ov::Node>>& ord
                     unregistered_variables.str());
 }
 
+void check_outputs_layout(const ov::Model& model) {
+    for (const auto& output : model.outputs()) {
+        OPENVINO_ASSERT(ov::layout::utils::is_compatible(ov::layout::get_layout(output), output.get_partial_shape()),
+                        "Result '",
+                        output,
+                        "' with shape ",
+                        output.get_partial_shape(),
+                        " is incompatible with layout ",
+                        ov::layout::get_layout(output).to_string());
+    }
+}
+
+// The output properties the consumers are validated against
+class OutputState {
+public:
+    explicit OutputState(const ov::descriptor::Tensor& tensor)
+        : m_element_type(tensor.get_element_type()),
+          m_shape(tensor.get_partial_shape()),
+          // the values are computed on demand of the consumers, which may depend on them
+          m_has_values(tensor.get_lower_value() || tensor.get_upper_value() || !tensor.get_value_symbol().empty()) {}
+
+    bool changed(const ov::descriptor::Tensor& tensor) const {
+        if (m_has_values || m_element_type != tensor.get_element_type()) {
+            return true;
+        }
+        const auto& shape = tensor.get_partial_shape();
+        if (m_shape != shape) {
+            return true;
+        }
+        if (shape.rank().is_dynamic()) {
+            return false;
+        }
+        for (size_t i = 0; i < shape.size(); ++i) {
+            if (m_shape[i].get_symbol() != shape[i].get_symbol()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    ov::element::Type m_element_type;
+    ov::PartialShape m_shape;
+    bool m_has_values;
+};
+
 void check_all_parameters_registered(const std::vector<shared_ptr<ov::Node>>& ordered_ops,
                                      const ov::ParameterVector& parameters) {
     OV_ITT_SCOPED_TASK(ov::itt::domains::ov_core, "Model::check_all_parameters_registered");
@@ -244,6 +292,7 @@ void ov::Model::validate_nodes_and_infer_types() const {
 
     for (auto& node : get_ordered_ops()) {
         node->revalidate_and_infer_types();
+        node->m_dirty = false;
         for (const auto& output : node->outputs()) {
             const auto& tensor = output.get_tensor();
             // Skip results outputs tensors because result_input_tensor == result_output_tensor
@@ -269,15 +318,52 @@ void ov::Model::validate_nodes_and_infer_types() const {
                     "Model references undeclared Variables: ",
                     unregistered_variables.str());
 
-    for (const auto& output : outputs()) {
-        OPENVINO_ASSERT(ov::layout::utils::is_compatible(ov::layout::get_layout(output), output.get_partial_shape()),
-                        "Result '",
-                        output,
-                        "' with shape ",
-                        output.get_partial_shape(),
-                        " is incompatible with layout ",
-                        ov::layout::get_layout(output).to_string());
+    check_outputs_layout(*this);
+    m_shared_rt_info->set_has_dirty_nodes(false);
+}
+
+void ov::Model::validate_dirty_nodes_and_infer_types() const {
+    OV_ITT_SCOPED_TASK(ov::itt::domains::ov_core, "Model::validate_dirty_nodes_and_infer_types");
+
+    const bool topology_changed = !m_shared_rt_info->get_use_topological_cache();
+    if (!topology_changed && !m_shared_rt_info->get_has_dirty_nodes()) {
+        return;
+    }
+
+    const auto ordered_ops = get_ordered_ops();
+    // the nodes whose outputs were changed by the revalidation, their consumers are revalidated too
+    std::unordered_set<const Node*> changed_nodes;
+    std::vector<OutputState> outputs_state;
+    for (const auto& node : ordered_ops) {
+        // the bodies of the sub-graph operations are not tracked
+        bool revalidate = node->m_dirty || ov::is_type<op::util::MultiSubGraphOp>(node);
+        for (size_t i = 0; !revalidate && i < node->get_input_size(); ++i) {
+            revalidate = changed_nodes.count(node->get_input_node_ptr(i)) != 0;
+        }
+        if (!revalidate) {
+            continue;
+        }
+
+        outputs_state.clear();
+        for (const auto& output : node->outputs()) {
+            outputs_state.emplace_back(output.get_tensor());
+        }
+        node->revalidate_and_infer_types();
+        node->m_dirty = false;
+        for (size_t i = 0; i < outputs_state.size(); ++i) {
+            if (i >= node->get_output_size() || outputs_state[i].changed(node->get_output_tensor(i))) {
+                changed_nodes.insert(node.get());
+                break;
+            }
+        }
+    }
+
+    if (topology_changed) {
+        check_all_parameters_registered(ordered_ops, m_parameters);
+        check_all_variables_registered(ordered_ops, m_variables);
     }
+    check_outputs_layout(*this);
+    m_shared_rt_info->set_has_dirty_nodes(false);
 }
 
 std::vector<shared_ptr<ov::Node>> ov::Model::get_ordered_ops() const {
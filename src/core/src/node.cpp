@@ -208,6 +208,14 @@ void ov::Node::set_arguments(const OutputVector& arguments) {
     for_each(this->m_shared_rt_info.cbegin(), this->m_shared_rt_info.cend(), [](std::shared_ptr<SharedRTInfo> info) {
         info->set_use_topological_cache(false);
     });
+    mark_dirty();
+}
+
+void ov::Node::mark_dirty() {
+    m_dirty = true;
+    for (const auto& info : m_shared_rt_info) {
+        info->set_has_dirty_nodes(true);
+    }
 }
 
 ov::descriptor::Input& ov::Node::get_input_descriptor(size_t position) {
@@ -0,0 +1,123 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/op/kquant_matmul.hpp"
+
+#include "itt.hpp"
+
+namespace ov::op::internal {
+
+KQuantMatMul::KQuantMatMul(const Output<Node>& data, const Output<Node>& weights, QuantType quant_type)
+    : Op({data, weights}),
+      m_quant_type(quant_type) {
+    constructor_validate_and_infer_types();
+}
+
+size_t KQuantMatMul::get_block_bytes(QuantType quant_type) {
+    switch (quant_type) {
+    case QuantType::Q4_K:
+        return 144;
+    case QuantType::Q5_K:
+        return 176;
+    case QuantType::Q6_K:
+        return 210;
+    default:
+        OPENVINO_THROW("Unsupported KQuantMatMul quant type");
+    }
+}
+
+void KQuantMatMul::validate_and_infer_types() {
+    OV_OP_SCOPE(internal_KQuantMatMul_validate_and_infer_types);
+    NODE_VALIDATION_CHECK(this, get_input_size() == 2, "KQuantMatMul expects 2 inputs, but it has ", get_input_size());
+
+    const auto& data_type = get_input_element_type(0);
+    NODE_VALIDATION_CHECK(this,
+                          data_type.is_dynamic() || data_type == element::f32 || data_type == element::f16 ||
+                              data_type == element::bf16,
+                          "Element type of `data` input should be f32, f16 or bf16, but it is ",
+                          data_type,
+                          ".");
+    const auto& weights_type = get_input_element_type(1);
+    NODE_VALIDATION_CHECK(this,
+                          weights_type.is_dynamic() || weights_type == element::u8,
+                          "Element type of `weights` input should be u8, but it is ",
+                          weights_type,
+                          ".");
+
+    const auto& data_shape = get_input_partial_shape(0);
+    const auto& weights_shape = get_input_partial_shape(1);
+    NODE_VALIDATION_CHECK(this,
+                          weights_shape.rank().compatible(2),
+                          "Rank of `weights` input should be 2, but it is ",
+                          weights_shape.rank(),
+                          ".");
+    if (data_shape.rank().is_dynamic()) {
+        set_output_type(0, data_type, PartialShape::dynamic());
+        return;
+    }
+    NODE_VALIDATION_CHECK(this, data_shape.size() >= 1, "`data` input must have at least one dimension.");
+
+    const auto& K = data_shape[data_shape.size() - 1];
+    NODE_VALIDATION_CHECK(this,
+                          K.is_dynamic() || K.get_length() % 256 == 0,
+                          "Reduction dimension of `data` must be a multiple of 256, but it is ",
+                          K,
+                          ".");
+
+    auto output_shape = data_shape;
+    if (weights_shape.rank().is_static()) {
+        const auto& row_bytes = weights_shape[1];
+        if (K.is_static() && row_bytes.is_static()) {
+            const auto expected = K.get_length() / 256 * static_cast<int64_t>(get_block_bytes(m_quant_type));
+            NODE_VALIDATION_CHECK(this,
+                                  row_bytes.get_length() == expected,
+                                  "`weights` row must hold ",
+                                  expected,
+                                  " bytes for K = ",
+                                  K,
+                                  " and quant type ",
+                                  ov::as_string(m_quant_type),
+                                  ", but it holds ",
+                                  row_bytes,
+                                  ".");
+        }
+        output_shape[output_shape.size() - 1] = weights_shape[0];
+    } else {
+        output_shape[output_shape.size() - 1] = Dimension::dynamic();
+    }
+    set_output_type(0, data_type, output_shape);
+}
+
+bool KQuantMatMul::visit_attributes(AttributeVisitor& visitor) {
+    OV_OP_SCOPE(internal_KQuantMatMul_visit_attributes);
+    visitor.on_attribute("quant_type", m_quant_type);
+    return true;
+}
+
+std::shared_ptr<ov::Node> KQuantMatMul::clone_with_new_inputs(const ov::OutputVector& new_args) const {
+    OV_OP_SCOPE(internal_KQuantMatMul_clone_with_new_inputs);
+    check_new_args_count(this, new_args);
+    return std::make_shared<KQuantMatMul>(new_args.at(0), new_args.at(1), m_quant_type);
+}
+
+}  // namespace ov::op::internal
+
+namespace ov {
+std::ostream& operator<<(std::ostream& s, const ov::op::internal::KQuantMatMul::QuantType& type) {
+    return s << as_string(type);
+}
+
+template <>
+OPENVINO_API EnumNames<ov::op::internal::KQuantMatMul::QuantType>&
+EnumNames<ov::op::internal::KQuantMatMul::QuantType>::get() {
+    static auto enum_names = EnumNames<ov::op::internal::KQuantMatMul::QuantType>(
+        "ov::op::internal::KQuantMatMul::QuantType",
+        {
+            {"q4_k", ov::op::internal::KQuantMatMul::QuantType::Q4_K},
+            {"q5_k", ov::op::internal::KQuantMatMul::QuantType::Q5_K},
+            {"q6_k", ov::op::internal::KQuantMatMul::QuantType::Q6_K},
+        });
+    return enum_names;
+}
+}  // namespace ov
@@ -64,6 +64,7 @@ void op::v0::Parameter::set_partial_shape(const PartialShape& partial_shape) {
                     get_layout().to_string(),
                     ". Layout is not compatible with shape");
     m_partial_shape = partial_shape;
+    mark_dirty();
 }
 
 AttributeAdapter<ParameterVector>::AttributeAdapter(ParameterVector& ref) : m_ref(ref) {}
@@ -4,8 +4,13 @@
 
 #include "openvino/pass/constant_folding.hpp"
 
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
 #include "openvino/cc/pass/itt.hpp"
 #include "openvino/core/constant_fold_utils.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/rt_info.hpp"
 #include "openvino/core/rt_info/weightless_caching_attributes.hpp"
 #include "openvino/core/weight_sharing_util.hpp"
@@ -102,16 +107,15 @@ static void remove_requires_precision_conversion_attribute(const std::shared_ptr
     }
 }
 
+ov::pass::ConstantFolding::ConstantFolding(bool parallel) : m_parallel(parallel) {}
+
 bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& model) {
     RUN_ON_MODEL_SCOPE(ConstantFolding);
 
     bool rewritten = pre_calculated_values_folding(model);
 
-    // Creating a local vector and moving each element to reduce memory peak.
-    // Elements of 'nodes' vector are nullptr after the std::move in the loop.
-    auto nodes = model->get_ordered_ops();
-    for (size_t n = 0; n < nodes.size(); ++n) {
-        auto original_node = std::move(nodes[n]);
+    // Returns the node to evaluate for the original one or nullptr if it cannot be folded
+    auto prepare = [&](const std::shared_ptr<Node>& original_node) -> std::shared_ptr<Node> {
         auto node = original_node;
         if (!original_node->can_constant_fold(original_node->input_values())) {
             if (auto sub_graph_node = ov::as_type_ptr<ov::op::util::MultiSubGraphOp>(node)) {
@@ -126,7 +130,7 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& m
             if (rewritten) {
                 original_node->validate_and_infer_types();
             }
-            continue;
+            return nullptr;
         }
         if (node_has_requires_precision_conversion_attribute(node)) {
             remove_requires_precision_conversion_attribute(node);
@@ -138,9 +142,14 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& m
         if (rewritten) {
             node->validate_and_infer_types();
         }
-
-        OutputVector replacements(node->get_output_size());
-        if (node->constant_fold(replacements, node->input_values())) {
+        return node;
+    };
+
+    auto apply = [&](const std::shared_ptr<Node>& original_node,
+                     const std::shared_ptr<Node>& node,
+                     bool folded,
+                     const OutputVector& replacements) {
+        if (folded) {
             OPENVINO_ASSERT(!constant_folding_is_disabled(original_node),
                             "Node folded but constant folding disabled. Check constant_fold implementation for ",
                             node);
@@ -182,6 +191,91 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& m
                 rewritten = true;
             }
         }
+    };
+
+    // Creating a local vector and moving each element to reduce memory peak.
+    // Elements of 'nodes' vector are nullptr after the std::move in the loop.
+    auto nodes = model->get_ordered_ops();
+    if (!m_parallel) {
+        for (size_t n = 0; n < nodes.size(); ++n) {
+            auto original_node = std::move(nodes[n]);
+            if (auto node = prepare(original_node)) {
+                OutputVector replacements(node->get_output_size());
+                const bool folded = node->constant_fold(replacements, node->input_values());
+                apply(original_node, node, folded, replacements);
+            }
+        }
+        return rewritten;
+    }
+
+    // The nodes of the same depth do not depend on each other, so a wave of them is prepared and the results are
+    // applied sequentially in the topological order, while the evaluations run concurrently. The waves are processed
+    // in chunks of the number of threads, so at most one chunk of folded values is alive before the replacements
+    // release the inputs of the folded nodes, as it is in the sequential mode.
+    std::vector<std::vector<std::shared_ptr<Node>>> waves;
+    {
+        std::unordered_map<const Node*, size_t> depths;
+        for (auto& node : nodes) {
+            size_t depth = 0;
+            for (const auto& input : node->input_values()) {
+                depth = std::max(depth, depths[input.get_node()] + 1);
+            }
+            for (const auto& dependency : node->get_control_dependencies()) {
+                depth = std::max(depth, depths[dependency.get()] + 1);
+            }
+            depths[node.get()] = depth;
+            if (waves.size() <= depth) {
+                waves.resize(depth + 1);
+            }
+            waves[depth].push_back(std::move(node));
+        }
+    }
+    nodes.clear();
+
+    const auto chunk_size = static_cast<size_t>(std::max(parallel_get_max_threads(), 1));
+    std::vector<std::shared_ptr<Node>> to_fold;
+    std::vector<OutputVector> replacements;
+    std::vector<char> folded;
+    std::vector<size_t> concurrent;
+    for (auto& wave : waves) {
+        for (size_t begin = 0; begin < wave.size(); begin += chunk_size) {
+            const size_t count = std::min(chunk_size, wave.size() - begin);
+            to_fold.assign(count, nullptr);
+            replacements.assign(count, {});
+            folded.assign(count, 0);
+            concurrent.clear();
+            for (size_t i = 0; i < count; ++i) {
+                to_fold[i] = prepare(wave[begin + i]);
+                if (!to_fold[i]) {
+                    continue;
+                }
+                replacements[i].resize(to_fold[i]->get_output_size());
+                // Only the nodes evaluating Constants are folded concurrently: the folding of the other ones
+                // (e.g. ShapeOf of a non-constant input) may evaluate the bounds of the shared upstream tensors.
+                const auto& inputs = to_fold[i]->input_values();
+                if (std::all_of(inputs.begin(), inputs.end(), [](const Output<Node>& input) {
+                        return ov::is_type<ov::op::v0::Constant>(input.get_node());
+                    })) {
+                    concurrent.push_back(i);
+                } else {
+                    folded[i] = to_fold[i]->constant_fold(replacements[i], inputs);
+                }
+            }
+            ov::parallel_for(concurrent.size(), [&](size_t c) {
+                const auto i = concurrent[c];
+                folded[i] = to_fold[i]->constant_fold(replacements[i], to_fold[i]->input_values());
+            });
+            for (size_t i = 0; i < count; ++i) {
+                if (to_fold[i]) {
+                    apply(wave[begin + i], to_fold[i], folded[i] != 0, replacements[i]);
+                }
+                to_fold[i].reset();
+                replacements[i].clear();
+                wave[begin + i].reset();
+            }
+        }
+        wave.clear();
+        wave.shrink_to_fit();
     }
 
     return rewritten;
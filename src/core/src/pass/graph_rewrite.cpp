@@ -101,9 +101,10 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
     bool rewritten = false;
     const auto& pass_config = get_pass_config();
 
-    // Check that all Matchers in MatcherPasses has type bases root node
-    bool all_roots_has_type = true;
+    // MatcherPasses with the type based root node are indexed by the root type for the fast MatcherPass search,
+    // the rest of them are applied to every node
     std::unordered_map<NodeTypeInfo, std::vector<size_t>> type_to_matcher;
+    std::vector<size_t> untyped_matchers;
     for (size_t matcher_index = 0; matcher_index < m_matchers.size(); ++matcher_index) {
         // Skip passes that are disabled
         if (pass_config->is_disabled(m_matchers[matcher_index]->get_type_info()))
@@ -111,8 +112,8 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
 
         auto matcher = m_matchers[matcher_index]->get_matcher();
         if (!matcher) {
-            all_roots_has_type = false;
-            break;
+            untyped_matchers.push_back(matcher_index);
+            continue;
         }
 
         auto root = matcher->get_pattern_value().get_node_shared_ptr();
@@ -125,24 +126,40 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         // if root is an operation from opset or has pattern::op::WrapType type then we can extract
         // it's type
         // and use it in unordered_map as key for fast MatcherPass search. Otherwise type is unknown
-        // and default algorithm is used.
+        // and the MatcherPass is applied to every node.
         if (auto p = std::dynamic_pointer_cast<pattern::op::Pattern>(root)) {
             if (auto any_type = ov::as_type_ptr<ov::pass::pattern::op::WrapType>(p)) {
                 for (const auto& root_type_info : any_type->get_wrapped_types()) {
                     type_to_matcher[root_type_info].push_back(matcher_index);
                 }
             } else {
-                all_roots_has_type = false;
-                break;
+                untyped_matchers.push_back(matcher_index);
             }
         } else {
             type_to_matcher[root->get_type_info()].push_back(matcher_index);
         }
-
-        // TODO: traverse parents for root_type_info in order to register complete list of matchers
-        // including ones triggered by parent type info.
     }
 
+    // The matchers of the node type including ones triggered by its parent types, in the order of the registration.
+    // They are collected once per node type, the nodes created by the MatcherPasses extend the cache with their types.
+    std::unordered_map<const DiscreteTypeInfo*, std::vector<size_t>> node_type_to_matchers;
+    auto get_matchers = [&](const DiscreteTypeInfo& type_info) -> const std::vector<size_t>& {
+        auto it = node_type_to_matchers.find(&type_info);
+        if (it != node_type_to_matchers.end()) {
+            return it->second;
+        }
+        std::vector<size_t> matchers = untyped_matchers;
+        for (auto node_type_info = &type_info; node_type_info; node_type_info = node_type_info->parent) {
+            auto typed = type_to_matcher.find(*node_type_info);
+            if (typed != type_to_matcher.end()) {
+                matchers.insert(matchers.end(), typed->second.begin(), typed->second.end());
+            }
+        }
+        std::sort(matchers.begin(), matchers.end());
+        matchers.erase(std::unique(matchers.begin(), matchers.end()), matchers.end());
+        return node_type_to_matchers.emplace(&type_info, std::move(matchers)).first->second;
+    };
+
     // This lambda preforms execution of particular MatcherPass on given node.
     // It automatically handles nodes registered by MatcherPass during transformation and set
     // transformation callback.
@@ -175,9 +192,6 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         return status;
     };
 
-    // list of matchers to run for a node; define here to keep memory allocated
-    std::vector<size_t> matcher_passes_to_run;
-
     while (!nodes_to_run.empty()) {
         auto weak_node = nodes_to_run.front();
         nodes_to_run.pop_front();
@@ -200,47 +214,11 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         if (m_enable_shape_inference) {
             node->revalidate_and_infer_types();
         }
-        // If all Matchers in MatcherPasses has type based root node then we apply efficient
-        // algorithm for finding matchers
-        if (all_roots_has_type) {
-            const DiscreteTypeInfo* node_type_info = &node->get_type_info();
-            matcher_passes_to_run.clear();
-            while (node_type_info) {
-                auto matchers = type_to_matcher.find(*node_type_info);
-                if (matchers != type_to_matcher.end()) {
-                    // do not run found matchers immediately, need to collect all matchers for
-                    // parents
-                    // and sort them in order of the registration
-                    matcher_passes_to_run.insert(matcher_passes_to_run.end(),
-                                                 matchers->second.begin(),
-                                                 matchers->second.end());
-                }
-                node_type_info = node_type_info->parent;
-            }
-
-            std::sort(matcher_passes_to_run.begin(), matcher_passes_to_run.end());
-
-            // TODO: type_to_matcher with just collected list of matchers to enable
-            // fast processing at the next time when node with the same type will be processed
 
-            for (size_t matcher_index : matcher_passes_to_run) {
-                if (run_matcher_pass(m_matchers[matcher_index], node)) {
-                    rewritten = true;
-                    break;
-                }
-            }
-        }
-        // Otherwise we use default algorithm that iterates over all registered matcher passes
-        else {
-            for (auto& m_pass : m_matchers) {
-                // Skip passes that are disabled
-                if (pass_config->is_disabled(m_pass->get_type_info()))
-                    continue;
-
-                if (run_matcher_pass(m_pass, node)) {
-                    rewritten = true;
-                    break;
-                }
+        for (size_t matcher_index : get_matchers(node->get_type_info())) {
+            if (run_matcher_pass(m_matchers[matcher_index], node)) {
+                rewritten = true;
+                break;
             }
         }
     }
@@ -6,6 +6,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <deque>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
@@ -17,6 +18,7 @@
 #include "itt.hpp"
 #include "openvino/pass/graph_rewrite.hpp"
 #include "openvino/pass/serialize.hpp"
+#include "openvino/pass/validate.hpp"
 #include "openvino/pass/visualize_tree.hpp"
 #include "openvino/util/common_util.hpp"
 #include "openvino/util/env_util.hpp"
@@ -314,6 +316,63 @@ private:
     std::fstream m_file;
 };
 
+/**
+ * @brief Runs the matchers of a group of consecutive passes in a single graph traversal, see
+ * ov::pass::Manager::set_fuse_matcher_passes.
+ */
+class FusedGraphRewrite : public ov::pass::GraphRewrite {
+public:
+    OPENVINO_GRAPH_REWRITE_RTTI("ov::pass::FusedGraphRewrite");
+
+    bool run_on_model(const std::shared_ptr<ov::Model>& model) override {
+        std::deque<std::weak_ptr<ov::Node>> nodes_to_run;
+        size_t last_instance_id = 0;
+        for (const auto& node : model->get_ordered_ops()) {
+            last_instance_id = std::max(last_instance_id, node->get_instance_id());
+            nodes_to_run.emplace_back(node);
+        }
+        if (!apply_matcher_passes(model, std::move(nodes_to_run))) {
+            return false;
+        }
+
+        // The nodes created by a pass of the group are visited by the passes registered after it in the sequential
+        // execution. Instance ids grow monotonically, so the nodes created during the traversal have greater ones.
+        std::deque<std::weak_ptr<ov::Node>> new_nodes;
+        for (const auto& node : model->get_ordered_ops()) {
+            if (node->get_instance_id() > last_instance_id) {
+                new_nodes.emplace_back(node);
+            }
+        }
+        apply_matcher_passes(model, std::move(new_nodes));
+        return true;
+    }
+};
+
+// Switches a Validate pass to the incremental mode for a single run and restores its own mode afterwards, as the pass
+// instance may be registered in other managers as well.
+class IncrementalValidationScope {
+public:
+    explicit IncrementalValidationScope(std::shared_ptr<ov::pass::Validate> validate) : m_validate(std::move(validate)) {
+        if (m_validate) {
+            m_was_incremental = m_validate->is_incremental();
+            m_validate->set_incremental(true);
+        }
+    }
+
+    ~IncrementalValidationScope() {
+        if (m_validate) {
+            m_validate->set_incremental(m_was_incremental);
+        }
+    }
+
+    IncrementalValidationScope(const IncrementalValidationScope&) = delete;
+    IncrementalValidationScope& operator=(const IncrementalValidationScope&) = delete;
+
+private:
+    std::shared_ptr<ov::pass::Validate> m_validate;
+    bool m_was_incremental = false;
+};
+
 }  // namespace
 
 ov::pass::Manager::Manager() : m_pass_config(std::make_shared<PassConfig>()) {}
@@ -333,6 +392,14 @@ void ov::pass::Manager::set_per_pass_validation(bool new_state) {
     m_per_pass_validation = new_state;
 }
 
+void ov::pass::Manager::set_fuse_matcher_passes(bool new_state) {
+    m_fuse_matcher_passes = new_state;
+}
+
+void ov::pass::Manager::set_incremental_validation(bool new_state) {
+    m_incremental_validation = new_state;
+}
+
 bool ov::pass::Manager::run_passes(const std::shared_ptr<ov::Model>& model) {
     OV_ITT_SCOPED_TASK(ov::itt::domains::ov_core, "pass::Manager::run_passes");
     Profiler profiler(m_name);
@@ -340,17 +407,10 @@ bool ov::pass::Manager::run_passes(const std::shared_ptr<ov::Model>& model) {
     bool manager_changed_model = false;
     bool needs_validation = false;
 
-    profiler.start_timer(m_name);
-    for (const auto& pass : m_pass_list) {
-        if (needs_validation) {
-            m_pass_config->enable<ov::pass::Validate>();
-        } else {
-            m_pass_config->disable<ov::pass::Validate>();
-        }
-
+    auto is_skipped = [&](const std::shared_ptr<PassBase>& pass) {
         if (m_pass_config->is_disabled(pass->get_type_info())) {
             OPENVINO_DEBUG("Pass ", pass->get_name(), " is disabled.");
-            continue;
+            return true;
         }
 
         // This checks if we need to skip the graph transformation when the graph pass relies on
@@ -360,11 +420,63 @@ bool ov::pass::Manager::run_passes(const std::shared_ptr<ov::Model>& model) {
                            pass->get_name(),
                            " requires static shape but the ",
                            "model is dynamic. Skipping this transformation.");
+            return true;
+        }
+        return false;
+    };
+
+    profiler.start_timer(m_name);
+    for (size_t pass_index = 0; pass_index < m_pass_list.size(); ++pass_index) {
+        auto pass = m_pass_list[pass_index];
+        if (needs_validation) {
+            m_pass_config->enable<ov::pass::Validate>();
+        } else {
+            m_pass_config->disable<ov::pass::Validate>();
+        }
+
+        if (is_skipped(pass)) {
             continue;
         }
 
-        const auto& pass_name = pass->get_name();
+        auto pass_name = pass->get_name();
+
+        if (m_fuse_matcher_passes && is_fusible(pass)) {
+            auto fused = std::make_shared<FusedGraphRewrite>();
+            fused->set_pass_config(m_pass_config);
+            size_t fused_passes = 0;
+            size_t last_fused_index = pass_index;
+            for (size_t index = pass_index; index < m_pass_list.size(); ++index) {
+                const auto& next_pass = m_pass_list[index];
+                // the per pass validation is postponed till the end of the group
+                if (m_per_pass_validation && ov::as_type_ptr<ov::pass::Validate>(next_pass)) {
+                    continue;
+                }
+                if (!is_fusible(next_pass)) {
+                    break;
+                }
+                if (is_skipped(next_pass)) {
+                    continue;
+                }
+                if (auto matcher_pass = ov::as_type_ptr<MatcherPass>(next_pass)) {
+                    fused->add_matcher(matcher_pass);
+                } else {
+                    for (const auto& matcher : ov::as_type_ptr<GraphRewrite>(next_pass)->m_matchers) {
+                        fused->add_matcher(matcher);
+                    }
+                }
+                ++fused_passes;
+                last_fused_index = index;
+            }
+
+            if (fused_passes > 1) {
+                pass_name = "Fused:" + pass_name + ".." + m_pass_list[last_fused_index]->get_name();
+                pass = fused;
+                pass_index = last_fused_index;
+            }
+        }
 
+        const IncrementalValidationScope validation_scope(
+            m_incremental_validation ? ov::as_type_ptr<ov::pass::Validate>(pass) : nullptr);
         profiler.start_timer(pass_name);
         bool pass_changed_model = run_pass(pass, model);
         profiler.stop_timer(pass_name, pass_changed_model);
@@ -391,3 +503,8 @@ bool ov::pass::Manager::run_pass(const std::shared_ptr<PassBase>& pass, const st
     }
     return false;
 }
+
+bool ov::pass::Manager::is_fusible(const std::shared_ptr<PassBase>& pass) const {
+    // the classes derived from GraphRewrite may customize the traversal, so only GraphRewrite instances are fused
+    return ov::as_type_ptr<MatcherPass>(pass) || pass->get_type_info() == GraphRewrite::get_type_info_static();
+}
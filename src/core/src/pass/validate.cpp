@@ -8,6 +8,10 @@
 
 bool ov::pass::Validate::run_on_model(const std::shared_ptr<ov::Model>& m) {
     RUN_ON_MODEL_SCOPE(Validate);
-    m->validate_nodes_and_infer_types();
+    if (m_incremental) {
+        m->validate_dirty_nodes_and_infer_types();
+    } else {
+        m->validate_nodes_and_infer_types();
+    }
     return false;
 }
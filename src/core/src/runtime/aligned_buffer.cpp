@@ -8,6 +8,7 @@
 #include <memory>
 #include <utility>
 
+#include "openvino/runtime/compute_hash.hpp"
 #include "openvino/util/memory.hpp"
 
 namespace ov {
@@ -58,4 +59,8 @@ void AlignedBuffer::hint_prefetch() const {}
 void AlignedBuffer::invoke_hint_prefetch(const AlignedBuffer& buffer) {
     buffer.hint_prefetch();
 }
+
+size_t AlignedBuffer::get_hash() const {
+    return runtime::compute_hash_parallel(get_ptr(), size());
+}
 }  // namespace ov
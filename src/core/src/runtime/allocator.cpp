@@ -5,6 +5,7 @@
 #include "openvino/runtime/allocator.hpp"
 
 #include "openvino/core/except.hpp"
+#include "openvino/runtime/pooled_allocator.hpp"
 
 namespace ov {
 namespace {
@@ -54,7 +55,13 @@ struct DefaultAllocator {
 
 Allocator::Base::~Base() = default;
 
-Allocator::Allocator() : Allocator{DefaultAllocator{}} {}
+namespace {
+Allocator make_default_allocator() {
+    return is_default_allocator_pooled() ? get_pooled_allocator() : Allocator{DefaultAllocator{}};
+}
+}  // namespace
+
+Allocator::Allocator() : Allocator{make_default_allocator()} {}
 
 Allocator::~Allocator() {
     _impl = {};
@@ -8,18 +8,21 @@
 
 #include "openvino/runtime/compute_hash.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <cstring>
 #include <iterator>
+#include <vector>
 
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/visibility.hpp"
+#include "openvino/util/hash_util.hpp"
 
 #if !defined(OS_CHROMEOS) && (defined(OPENVINO_ARCH_X86) || defined(OPENVINO_ARCH_X86_64))
 #    define OV_CORE_USE_XBYAK_JIT
 #endif
 
 #ifdef OV_CORE_USE_XBYAK_JIT
-#    include "openvino/core/parallel.hpp"
 #    include "openvino/reference/utils/registers_pool.hpp"
 #    include "openvino/util/os.hpp"
 #endif  // OV_CORE_USE_XBYAK_JIT
@@ -935,5 +938,27 @@ size_t compute_hash(const void* src, size_t size) {
     return seed;
 }
 
+size_t compute_hash_parallel(const void* src, size_t size) {
+    // compute_hash itself uses two threads at most, the chunks keep all the cores busy on multi-GB weights
+    constexpr size_t chunk_size = 16lu << 20;
+    if (size <= 2 * chunk_size) {
+        return compute_hash(src, size);
+    }
+
+    const size_t chunks_num = (size + chunk_size - 1) / chunk_size;
+    std::vector<size_t> chunk_hashes(chunks_num);
+    ov::parallel_for(chunks_num, [&](size_t chunk) {
+        const size_t offset = chunk * chunk_size;
+        chunk_hashes[chunk] =
+            compute_hash(static_cast<const uint8_t*>(src) + offset, std::min(chunk_size, size - offset));
+    });
+
+    uint64_t seed = size;
+    for (const auto hash : chunk_hashes) {
+        seed = util::u64_hash_combine(seed, hash);
+    }
+    return static_cast<size_t>(seed);
+}
+
 }  // namespace runtime
 }  // namespace ov
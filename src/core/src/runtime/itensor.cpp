@@ -4,16 +4,26 @@
 
 #include "openvino/runtime/itensor.hpp"
 
+#include <algorithm>
+#include <cstring>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "compare.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/memory_util.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/shape_util.hpp"
+#include "openvino/reference/convert.hpp"
 #include "openvino/runtime/iremote_tensor.hpp"
 #include "openvino/runtime/make_tensor.hpp"
 #include "openvino/runtime/properties.hpp"
 
+#if defined(OPENVINO_ARCH_X86_64)
+#    include <emmintrin.h>
+#endif
+
 namespace ov {
 
 namespace {
@@ -65,19 +75,189 @@ bool ITensor::is_continuous() const {
                                                 std::all_of(default_stride, default_last, cmp::Equal(*default_stride)));
 }
 
+namespace {
+// The converted destinations of at least this size don't fit in the last level cache and are written with the
+// non-temporal stores, which neither read the destination lines nor evict the data of the other threads from the cache
+constexpr size_t streaming_threshold = 8 * 1024 * 1024;
+// Bytes of the destination per thread, the smaller copies don't pay off the threads wake up
+constexpr size_t parallel_grain = 256 * 1024;
+// Elements converted at once by the strided or streamed rows, small enough for the staging buffers to stay in L1
+constexpr size_t staging_size = 1024;
+// The largest element of the supported conversions
+constexpr size_t staging_element_size = sizeof(float);
+
+using convert_function = void (*)(const uint8_t*, uint8_t*, size_t);
+
+template <typename TI, typename TO>
+void convert_elements(const uint8_t* src, uint8_t* dst, size_t count) {
+    reference::convert(reinterpret_cast<const TI*>(src), reinterpret_cast<TO*>(dst), count);
+}
+
+convert_function get_convert_function(const element::Type& src, const element::Type& dst) {
+    if (src == element::f32 && dst == element::f16)
+        return convert_elements<float, float16>;
+    if (src == element::f16 && dst == element::f32)
+        return convert_elements<float16, float>;
+    if (src == element::f32 && dst == element::bf16)
+        return convert_elements<float, bfloat16>;
+    if (src == element::bf16 && dst == element::f32)
+        return convert_elements<bfloat16, float>;
+    if (src == element::bf16 && dst == element::f16)
+        return convert_elements<bfloat16, float16>;
+    if (src == element::u8 && dst == element::f32)
+        return convert_elements<uint8_t, float>;
+    if (src == element::u8 && dst == element::f16)
+        return convert_elements<uint8_t, float16>;
+    return nullptr;
+}
+
+void stream_copy(const uint8_t* src, uint8_t* dst, size_t bytes) {
+#if defined(OPENVINO_ARCH_X86_64)
+    constexpr size_t vec = sizeof(__m128i);
+    size_t i = std::min(bytes, (vec - reinterpret_cast<uintptr_t>(dst) % vec) % vec);
+    std::memcpy(dst, src, i);
+    for (; i + 4 * vec <= bytes; i += 4 * vec) {
+        const auto v0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        const auto v1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + vec));
+        const auto v2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 2 * vec));
+        const auto v3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 3 * vec));
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst + i), v0);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst + i + vec), v1);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst + i + 2 * vec), v2);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst + i + 3 * vec), v3);
+    }
+    for (; i + vec <= bytes; i += vec) {
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst + i),
+                         _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+    }
+    std::memcpy(dst + i, src + i, bytes - i);
+#else
+    std::memcpy(dst, src, bytes);
+#endif
+}
+
+// The non-temporal stores are weakly ordered, every thread which issued them fences them before the data is read
+void stream_fence() {
+#if defined(OPENVINO_ARCH_X86_64)
+    _mm_sfence();
+#endif
+}
+
+template <size_t N>
+void copy_strided(const uint8_t* src, size_t src_stride, uint8_t* dst, size_t dst_stride, size_t count) {
+    for (size_t i = 0; i < count; ++i, src += src_stride, dst += dst_stride) {
+        std::memcpy(dst, src, N);
+    }
+}
+
+void copy_strided(const uint8_t* src, size_t src_stride, uint8_t* dst, size_t dst_stride, size_t count, size_t size) {
+    switch (size) {
+    case 1:
+        copy_strided<1>(src, src_stride, dst, dst_stride, count);
+        break;
+    case 2:
+        copy_strided<2>(src, src_stride, dst, dst_stride, count);
+        break;
+    case 4:
+        copy_strided<4>(src, src_stride, dst, dst_stride, count);
+        break;
+    case 8:
+        copy_strided<8>(src, src_stride, dst, dst_stride, count);
+        break;
+    default:
+        for (size_t i = 0; i < count; ++i, src += src_stride, dst += dst_stride) {
+            std::memcpy(dst, src, size);
+        }
+    }
+}
+
+// A dimension of the copy with the strides in bytes
+struct CopyDim {
+    size_t size;
+    size_t src_stride;
+    size_t dst_stride;
+};
+
+// Copies the elements of the innermost dimension
+struct RowCopy {
+    size_t src_stride;
+    size_t dst_stride;
+    size_t src_size;
+    size_t dst_size;
+    convert_function convert;
+    bool strings;
+    bool streaming;
+
+    void operator()(const uint8_t* src, uint8_t* dst, size_t count) const {
+        if (strings) {
+            // std::string objects have to be copied by the assignment, memcpy is not suitable
+            for (size_t i = 0; i < count; ++i, src += src_stride, dst += dst_stride) {
+                *reinterpret_cast<std::string*>(dst) = *reinterpret_cast<const std::string*>(src);
+            }
+            return;
+        }
+        const bool src_dense = src_stride == src_size;
+        const bool dst_dense = dst_stride == dst_size;
+        if (!convert) {
+            // memcpy switches to the non-temporal stores for the large copies itself
+            if (src_dense && dst_dense) {
+                std::memcpy(dst, src, count * src_size);
+            } else {
+                copy_strided(src, src_stride, dst, dst_stride, count, src_size);
+            }
+            return;
+        }
+        if (src_dense && dst_dense && !streaming) {
+            convert(src, dst, count);
+            return;
+        }
+        // the strided elements are gathered to / scattered from the staging buffers converted in place
+        alignas(64) uint8_t src_staging[staging_size * staging_element_size];
+        alignas(64) uint8_t dst_staging[staging_size * staging_element_size];
+        for (size_t i = 0; i < count; i += staging_size) {
+            const auto n = std::min(staging_size, count - i);
+            const uint8_t* s = src + i * src_stride;
+            if (!src_dense) {
+                copy_strided(s, src_stride, src_staging, src_size, n, src_size);
+                s = src_staging;
+            }
+            uint8_t* d = dst + i * dst_stride;
+            if (dst_dense && !streaming) {
+                convert(s, d, n);
+            } else {
+                convert(s, dst_staging, n);
+                if (dst_dense) {
+                    stream_copy(dst_staging, d, n * dst_size);
+                } else {
+                    copy_strided(dst_staging, dst_size, d, dst_stride, n, dst_size);
+                }
+            }
+        }
+    }
+};
+}  // namespace
+
 void ITensor::copy_to(const std::shared_ptr<ov::ITensor>& dst) const {
-    const auto& is_scalar = [](const ov::Shape& shape) {
-        return shape.empty() || (shape.size() == 1 && shape[0] == 1);
-    };
+    copy_to(dst, CopyOptions{});
+}
+
+void ITensor::copy_to(const std::shared_ptr<ov::ITensor>& dst, const CopyOptions& options) const {
     OPENVINO_ASSERT(dst, "Destination tensor was not initialized.");
     OPENVINO_ASSERT(!dynamic_cast<const ov::IRemoteTensor*>(this),
                     "Default copy to doesn't support copy from remote tensor.");
-    OPENVINO_ASSERT(dst->get_element_type() == get_element_type(),
-                    "Tensor element types are not equal. (src: ",
-                    get_element_type(),
-                    " != dst: ",
-                    dst->get_element_type(),
-                    ")");
+    const auto& src_type = get_element_type();
+    const auto& dst_type = dst->get_element_type();
+    convert_function convert = nullptr;
+    if (src_type != dst_type) {
+        OPENVINO_ASSERT(options.convert,
+                        "Tensor element types are not equal. (src: ",
+                        src_type,
+                        " != dst: ",
+                        dst_type,
+                        ")");
+        convert = get_convert_function(src_type, dst_type);
+        OPENVINO_ASSERT(convert, "Tensor copy doesn't support the conversion from ", src_type, " to ", dst_type);
+    }
 
     const auto& shape = get_shape();
     if (shape != dst->get_shape()) {
@@ -85,108 +265,107 @@ void ITensor::copy_to(const std::shared_ptr<ov::ITensor>& dst) const {
     }
 
     if (auto remote_tensor_dst = std::dynamic_pointer_cast<ov::IRemoteTensor>(dst)) {
+        OPENVINO_ASSERT(!convert, "Copy to remote tensor doesn't support the element type conversion.");
         remote_tensor_dst->copy_from(shared_from_this());
         return;
     }
 
-    auto* src_data = static_cast<const uint8_t*>(data());
+    const auto size = get_size();
+    if (size == 0) {
+        return;
+    }
+    const auto* src_data = static_cast<const uint8_t*>(data());
     auto* dst_data = static_cast<uint8_t*>(dst->data());
-    ov::Strides src_strides{get_byte_size()};
-    ov::Strides dst_strides{dst->get_byte_size()};
-    ov::Shape cur_pos{0};
-    ov::Shape max_pos{1};
-
-    if (get_element_type().bitwidth() < 8 || (get_strides() == dst->get_strides() && is_continuous()) ||
-        (is_scalar(shape) && is_scalar(dst->get_shape()))) {
+    if (src_type.bitwidth() < 8) {
         // OpenVINO doesn't support strides for LP types
-        // or both tensors have default strides
-        // Strides and positions already initialized
-    } else {
-        // Tensors have default strides
-        const auto& type = get_element_type();
-        const auto shape_rank = shape.size();
-        const auto default_strides = default_byte_strides(shape, type);
-
-        src_strides = get_strides();
-        dst_strides = dst->get_strides();
-
-        ov::Strides src_str, dst_str;
-
-        // Calculate src and dst shapes
-        bool found_step = false;
-        for (size_t inverted_idx = shape_rank - 1; inverted_idx < shape_rank; --inverted_idx) {
-            if (!found_step) {
-                if (default_strides[inverted_idx] == src_strides[inverted_idx] &&
-                    src_strides[inverted_idx] == dst_strides[inverted_idx]) {
-                    continue;
-                } else {
-                    found_step = true;
-                    size_t strides_size = inverted_idx + 1;
-                    // Set right size
-                    src_str.resize(strides_size + 1);
-                    dst_str.resize(strides_size + 1);
-                    max_pos.resize(strides_size + 1);
-                    cur_pos.resize(strides_size + 1);
-                    // In case of default continuous strides we can copy several elements
-                    // In other case only one element
-                    size_t dim = 1;
-                    size_t strides = type.size();
-
-                    if (strides_size < default_strides.size()) {
-                        strides = default_strides[strides_size];
-                        dim = shape[strides_size];
-                    }
-                    src_str[strides_size] = strides;
-                    dst_str[strides_size] = strides;
-                    max_pos[strides_size] = dim;
-                    cur_pos[strides_size] = 0;
-                }
-            }
-            src_str[inverted_idx] = src_strides[inverted_idx];
-            dst_str[inverted_idx] = dst_strides[inverted_idx];
-            max_pos[inverted_idx] = shape[inverted_idx];
-            cur_pos[inverted_idx] = 0;
+        std::memcpy(dst_data, src_data, get_byte_size());
+        return;
+    }
+
+    // The dimensions of size 1 don't move the data and the neighbour dimensions contiguous in both tensors are merged,
+    // so a dense tensor, or a view of dense rows, is copied by a few long rows
+    const auto& src_strides = get_strides();
+    const auto& dst_strides = dst->get_strides();
+    std::vector<CopyDim> dims;
+    for (size_t i = 0; i < shape.size(); ++i) {
+        if (shape[i] == 1) {
+            continue;
         }
-        src_strides = std::move(src_str);
-        dst_strides = std::move(dst_str);
+        if (!dims.empty() && dims.back().src_stride == shape[i] * src_strides[i] &&
+            dims.back().dst_stride == shape[i] * dst_strides[i]) {
+            dims.back() = {dims.back().size * shape[i], src_strides[i], dst_strides[i]};
+        } else {
+            dims.push_back({shape[i], src_strides[i], dst_strides[i]});
+        }
+    }
+    if (dims.empty()) {
+        dims.push_back({1, src_type.size(), dst_type.size()});
     }
+    const auto row = dims.back();
+    dims.pop_back();
 
-    const auto update_index = [](const ov::Shape& pos, const ov::Strides& strides) {
-        return std::inner_product(pos.begin(), pos.end(), strides.begin(), static_cast<size_t>(0));
-    };
+    const auto dst_bytes = size * dst_type.size();
+    const RowCopy copy_row{row.src_stride,
+                           row.dst_stride,
+                           src_type.size(),
+                           dst_type.size(),
+                           convert,
+                           src_type == element::string,
+                           convert != nullptr && dst_bytes >= streaming_threshold};
 
-    using copy_function_def = std::function<void(const uint8_t*, uint8_t*, size_t)>;
-    copy_function_def memcpy_based_copy = [](const uint8_t* src_data, uint8_t* dst_data, size_t bytes_size) {
-        memcpy(dst_data, src_data, bytes_size);
-    };
-    copy_function_def strings_copy = [](const uint8_t* src_data, uint8_t* dst_data, size_t bytes_size) {
-        // in case string tensors, it needs to copy of new values for std::string objects
-        // memcpy is not suitable
-        auto dst_string = reinterpret_cast<std::string*>(dst_data);
-        auto src_string = reinterpret_cast<const std::string*>(src_data);
-        size_t num_elements_stride = bytes_size / element::string.size();
-        std::copy_n(src_string, num_elements_stride, dst_string);
-    };
-    copy_function_def copy_function = (get_element_type() == element::string) ? strings_copy : memcpy_based_copy;
-
-    bool finish = false;
-    for (size_t dst_idx = 0, src_idx = 0; !finish;) {
-        copy_function(src_data + src_idx, dst_data + dst_idx, src_strides[src_strides.size() - 1]);
-
-        // update indexes
-        for (size_t i = 0; i < cur_pos.size(); i++) {
-            size_t inverted_idx = cur_pos.size() - i - 1;
-            cur_pos[inverted_idx]++;
-            if (cur_pos[inverted_idx] != max_pos[inverted_idx]) {
-                break;
+    // The rows are split between the threads, the long rows are split into parts when there are fewer rows than threads
+    const auto rows = size / row.size;
+    const auto max_threads = options.threads ? options.threads : static_cast<size_t>(parallel_get_max_threads());
+    const auto threads = std::max<size_t>(1, std::min(max_threads, dst_bytes / parallel_grain));
+    const auto parts = std::min(row.size, (threads + rows - 1) / rows);
+    const auto items = rows * parts;
+
+    auto copy = [&](size_t ithr, size_t nthr) {
+        size_t start = 0, end = 0;
+        splitter(items, nthr, ithr, start, end);
+        if (start >= end) {
+            return;
+        }
+        std::vector<size_t> pos(dims.size());
+        size_t src_offset = 0, dst_offset = 0;
+        for (size_t i = dims.size(), idx = start / parts; i-- > 0;) {
+            pos[i] = idx % dims[i].size;
+            idx /= dims[i].size;
+            src_offset += pos[i] * dims[i].src_stride;
+            dst_offset += pos[i] * dims[i].dst_stride;
+        }
+        for (size_t item = start, part = start % parts; item < end; ++item) {
+            size_t begin = 0, finish = 0;
+            splitter(row.size, parts, part, begin, finish);
+            copy_row(src_data + src_offset + begin * row.src_stride,
+                     dst_data + dst_offset + begin * row.dst_stride,
+                     finish - begin);
+            if (++part < parts) {
+                continue;
+            }
+            part = 0;
+            for (size_t i = dims.size(); i-- > 0;) {
+                src_offset += dims[i].src_stride;
+                dst_offset += dims[i].dst_stride;
+                if (++pos[i] < dims[i].size) {
+                    break;
+                }
+                src_offset -= dims[i].size * dims[i].src_stride;
+                dst_offset -= dims[i].size * dims[i].dst_stride;
+                pos[i] = 0;
             }
-            if (inverted_idx)
-                cur_pos[inverted_idx] = 0;
-            else
-                finish = true;
         }
-        src_idx = update_index(cur_pos, src_strides);
-        dst_idx = update_index(cur_pos, dst_strides);
+        if (copy_row.streaming) {
+            stream_fence();
+        }
+    };
+
+    if (threads == 1) {
+        copy(0, 1);
+    } else {
+        parallel_nt(static_cast<int>(threads), [&](const int ithr, const int nthr) {
+            copy(static_cast<size_t>(ithr), static_cast<size_t>(nthr));
+        });
     }
 }
 }  // namespace ov
@@ -0,0 +1,487 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/runtime/pooled_allocator.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+#include "openvino/runtime/allocator.hpp"
+
+#if defined(_WIN32)
+#    include <malloc.h>
+#endif
+
+#if defined(__linux__)
+#    include <sys/mman.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#endif
+
+namespace ov {
+namespace {
+constexpr uint64_t max_supported_allocation_size = uint64_t{1} << 40;  // 1 TiB
+// every block is aligned to the cache line, the requests of a larger alignment are pooled if the block is aligned more
+constexpr size_t block_alignment = 64;
+constexpr size_t page_size = 4096;
+// the blocks of the size of a huge page and larger are aligned to it and advised to be backed by the huge pages
+constexpr size_t huge_page_size = 2 * 1024 * 1024;
+// the classes of the blocks cached by the threads
+constexpr size_t thread_cache_max_block = 256 * 1024;
+constexpr size_t thread_cache_blocks = 8;
+constexpr size_t thread_cache_max_bytes = 1024 * 1024;
+// the blocks released above it are returned to the system instead of the free lists
+constexpr size_t pool_max_cached_bytes = 512 * 1024 * 1024;
+
+// The size classes: 64 bytes, then four classes per power of two, so a block is at most 25% larger than requested
+constexpr size_t min_class_size = 64;
+constexpr size_t min_class_log2 = 6;
+constexpr size_t floor_log2(size_t value) {
+    size_t result = 0;
+    while (value >>= 1) {
+        ++result;
+    }
+    return result;
+}
+
+constexpr size_t size_class(size_t bytes) {
+    if (bytes <= min_class_size) {
+        return 0;
+    }
+    const auto p = floor_log2(bytes - 1);
+    const auto step = size_t{1} << (p - 2);
+    const auto k = (bytes - (size_t{1} << p) + step - 1) / step;
+    return 1 + (p - min_class_log2) * 4 + (k - 1);
+}
+
+constexpr size_t class_size(size_t cls) {
+    if (cls == 0) {
+        return min_class_size;
+    }
+    const auto p = min_class_log2 + (cls - 1) / 4;
+    const auto k = (cls - 1) % 4 + 1;
+    return (size_t{1} << p) + k * (size_t{1} << (p - 2));
+}
+
+constexpr size_t classes = 1 + (sizeof(size_t) * 8 - min_class_log2) * 4;
+constexpr size_t thread_classes = size_class(thread_cache_max_block) + 1;
+static_assert(class_size(size_class(thread_cache_max_block)) == thread_cache_max_block);
+
+// Android arm64 (aarch64) the seccomp filter forbids the mbind syscall. Android devices
+// are single-NUMA-node anyway, so the binding is unnecessary there.
+#if defined(__linux__) && !(defined(__ANDROID__) && defined(__aarch64__)) && defined(__NR_mbind)
+bool bind_to_node(void* data, size_t size, int numa_node) {
+    constexpr int mpol_bind = 2;
+    if (numa_node < 0 || numa_node >= 64) {
+        return false;
+    }
+    const uint64_t mask = uint64_t{1} << numa_node;
+    return syscall(__NR_mbind, data, size, mpol_bind, &mask, sizeof(mask) * 8, 0) == 0;
+}
+#else
+bool bind_to_node(void*, size_t, int) {
+    return false;
+}
+#endif
+
+bool advise_huge_pages([[maybe_unused]] void* data, [[maybe_unused]] size_t size) {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    return madvise(data, size, MADV_HUGEPAGE) == 0;
+#else
+    return false;
+#endif
+}
+
+void* system_allocate(size_t bytes, size_t alignment) {
+#if defined(_WIN32)
+    void* result = _aligned_malloc(bytes, alignment);
+    OPENVINO_ASSERT(result, "_aligned_malloc failed");
+#else
+    void* result = nullptr;
+    if (posix_memalign(&result, std::max(sizeof(void*), alignment), bytes) != 0) {
+        OPENVINO_THROW("posix_memalign failed");
+    }
+#endif
+    return result;
+}
+
+void system_free(void* handle) noexcept {
+#if defined(_WIN32)
+    _aligned_free(handle);
+#else
+    free(handle);
+#endif
+}
+
+struct Counters {
+    std::atomic<uint64_t> allocations{0};
+    std::atomic<uint64_t> thread_cache_hits{0};
+    std::atomic<uint64_t> pool_hits{0};
+    std::atomic<uint64_t> system_allocations{0};
+    std::atomic<uint64_t> huge_page_blocks{0};
+    std::atomic<uint64_t> system_frees{0};
+    std::atomic<uint64_t> in_use_bytes{0};
+    std::atomic<uint64_t> cached_bytes{0};
+    std::atomic<uint64_t> system_bytes{0};
+    std::atomic<uint64_t> peak_system_bytes{0};
+};
+
+class Pool;
+
+// The blocks of the small classes released by a thread, taken without a lock by its next allocations
+class ThreadCache {
+public:
+    ~ThreadCache();
+
+    void* pop(Pool* pool, size_t cls);
+    bool push(Pool* pool, size_t cls, void* block);
+    void flush(Pool* pool);
+
+private:
+    struct Entry {
+        Pool* pool;
+        std::array<std::vector<void*>, thread_classes> bins;
+        size_t bytes = 0;
+    };
+
+    Entry& get(Pool* pool);
+
+    std::vector<Entry> m_entries;
+};
+
+thread_local ThreadCache thread_cache;
+// The blocks released by the destructors of the other thread local objects after the cache bypass it
+thread_local bool thread_cache_destroyed = false;
+
+class Pool {
+public:
+    explicit Pool(int numa_node) : m_numa_node(numa_node) {}
+
+    void* allocate(size_t bytes, size_t alignment) {
+        OPENVINO_ASSERT(static_cast<uint64_t>(bytes) <= max_supported_allocation_size,
+                        "Requested allocation size ",
+                        bytes,
+                        " exceeds maximum supported allocation size");
+        OPENVINO_ASSERT(alignment && !static_cast<bool>(alignment & (alignment - static_cast<size_t>(1))),
+                        "Alignment is not power of 2: ",
+                        alignment);
+        m_counters.allocations.fetch_add(1, std::memory_order_relaxed);
+        if (!is_pooled(bytes, alignment)) {
+            auto* block = system_allocate(bytes, alignment);
+            on_system_allocate(bytes);
+            m_counters.in_use_bytes.fetch_add(bytes, std::memory_order_relaxed);
+            return block;
+        }
+
+        const auto cls = size_class(bytes);
+        const auto size = class_size(cls);
+        void* block = nullptr;
+        if (size <= thread_cache_max_block && !thread_cache_destroyed && (block = thread_cache.pop(this, cls))) {
+            m_counters.thread_cache_hits.fetch_add(1, std::memory_order_relaxed);
+            m_counters.cached_bytes.fetch_sub(size, std::memory_order_relaxed);
+        } else if ((block = pop(cls))) {
+            m_counters.pool_hits.fetch_add(1, std::memory_order_relaxed);
+            m_counters.cached_bytes.fetch_sub(size, std::memory_order_relaxed);
+        } else {
+            block = allocate_block(size);
+        }
+        m_counters.in_use_bytes.fetch_add(size, std::memory_order_relaxed);
+        return block;
+    }
+
+    void deallocate(void* handle, size_t bytes, size_t alignment) noexcept {
+        if (!handle) {
+            return;
+        }
+        if (!is_pooled(bytes, alignment)) {
+            system_free(handle);
+            on_system_free(bytes);
+            m_counters.in_use_bytes.fetch_sub(bytes, std::memory_order_relaxed);
+            return;
+        }
+        const auto cls = size_class(bytes);
+        const auto size = class_size(cls);
+        m_counters.in_use_bytes.fetch_sub(size, std::memory_order_relaxed);
+        if (size <= thread_cache_max_block && !thread_cache_destroyed && thread_cache.push(this, cls, handle)) {
+            m_counters.cached_bytes.fetch_add(size, std::memory_order_relaxed);
+            return;
+        }
+        release(cls, handle);
+    }
+
+    // Moves a block from a thread cache or a released block to the free list of its class, or returns it to the system
+    // above the limit of the cached bytes. The cached bytes of the thread caches are already accounted.
+    void release(size_t cls, void* block, bool cached = false) noexcept {
+        const auto size = class_size(cls);
+        if (m_central_bytes.fetch_add(size, std::memory_order_relaxed) + size <= pool_max_cached_bytes) {
+            try {
+                std::lock_guard<std::mutex> lock(m_bins[cls].mutex);
+                m_bins[cls].blocks.push_back(block);
+                if (!cached) {
+                    m_counters.cached_bytes.fetch_add(size, std::memory_order_relaxed);
+                }
+                return;
+            } catch (...) {
+            }
+        }
+        m_central_bytes.fetch_sub(size, std::memory_order_relaxed);
+        if (cached) {
+            m_counters.cached_bytes.fetch_sub(size, std::memory_order_relaxed);
+        }
+        system_free(block);
+        on_system_free(size);
+    }
+
+    void clear() {
+        for (size_t cls = 0; cls < classes; ++cls) {
+            std::vector<void*> blocks;
+            {
+                std::lock_guard<std::mutex> lock(m_bins[cls].mutex);
+                blocks.swap(m_bins[cls].blocks);
+            }
+            const auto size = class_size(cls);
+            for (auto* block : blocks) {
+                system_free(block);
+                on_system_free(size);
+            }
+            m_central_bytes.fetch_sub(size * blocks.size(), std::memory_order_relaxed);
+            m_counters.cached_bytes.fetch_sub(size * blocks.size(), std::memory_order_relaxed);
+        }
+    }
+
+    void add_statistics(std::map<std::string, uint64_t>& statistics) const {
+        statistics["allocations"] += m_counters.allocations.load(std::memory_order_relaxed);
+        statistics["thread_cache_hits"] += m_counters.thread_cache_hits.load(std::memory_order_relaxed);
+        statistics["pool_hits"] += m_counters.pool_hits.load(std::memory_order_relaxed);
+        statistics["system_allocations"] += m_counters.system_allocations.load(std::memory_order_relaxed);
+        statistics["huge_page_blocks"] += m_counters.huge_page_blocks.load(std::memory_order_relaxed);
+        statistics["system_frees"] += m_counters.system_frees.load(std::memory_order_relaxed);
+        statistics["in_use_bytes"] += m_counters.in_use_bytes.load(std::memory_order_relaxed);
+        statistics["cached_bytes"] += m_counters.cached_bytes.load(std::memory_order_relaxed);
+        statistics["system_bytes"] += m_counters.system_bytes.load(std::memory_order_relaxed);
+        statistics["peak_system_bytes"] += m_counters.peak_system_bytes.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct Bin {
+        std::mutex mutex;
+        std::vector<void*> blocks;
+    };
+
+    // The blocks are aligned to the cache line, to the page when they are bound to a NUMA node, and to the huge page
+    // when they are as large
+    size_t block_alignment_of(size_t size) const {
+        if (size >= huge_page_size) {
+            return huge_page_size;
+        }
+        return m_numa_node >= 0 && size >= page_size ? page_size : block_alignment;
+    }
+
+    // The decision depends only on the arguments passed to both allocate and deallocate
+    bool is_pooled(size_t bytes, size_t alignment) const {
+        return alignment <= block_alignment_of(class_size(size_class(bytes)));
+    }
+
+    void* pop(size_t cls) {
+        std::lock_guard<std::mutex> lock(m_bins[cls].mutex);
+        auto& blocks = m_bins[cls].blocks;
+        if (blocks.empty()) {
+            return nullptr;
+        }
+        auto* block = blocks.back();
+        blocks.pop_back();
+        m_central_bytes.fetch_sub(class_size(cls), std::memory_order_relaxed);
+        return block;
+    }
+
+    void* allocate_block(size_t size) {
+        const auto alignment = block_alignment_of(size);
+        // the pages of the bound blocks aren't shared with the other allocations
+        const auto bytes = alignment >= page_size ? (size + page_size - 1) / page_size * page_size : size;
+        auto* block = system_allocate(bytes, alignment);
+        if (alignment == huge_page_size && advise_huge_pages(block, bytes)) {
+            m_counters.huge_page_blocks.fetch_add(1, std::memory_order_relaxed);
+        }
+        if (alignment >= page_size) {
+            bind_to_node(block, bytes, m_numa_node);
+        }
+        on_system_allocate(size);
+        return block;
+    }
+
+    void on_system_allocate(size_t size) {
+        m_counters.system_allocations.fetch_add(1, std::memory_order_relaxed);
+        const auto bytes = m_counters.system_bytes.fetch_add(size, std::memory_order_relaxed) + size;
+        auto peak = m_counters.peak_system_bytes.load(std::memory_order_relaxed);
+        while (bytes > peak &&
+               !m_counters.peak_system_bytes.compare_exchange_weak(peak, bytes, std::memory_order_relaxed)) {
+        }
+    }
+
+    void on_system_free(size_t size) noexcept {
+        m_counters.system_frees.fetch_add(1, std::memory_order_relaxed);
+        m_counters.system_bytes.fetch_sub(size, std::memory_order_relaxed);
+    }
+
+    const int m_numa_node;
+    std::array<Bin, classes> m_bins;
+    std::atomic<size_t> m_central_bytes{0};
+    Counters m_counters;
+};
+
+ThreadCache::~ThreadCache() {
+    thread_cache_destroyed = true;
+    for (auto& entry : m_entries) {
+        flush(entry.pool);
+    }
+}
+
+ThreadCache::Entry& ThreadCache::get(Pool* pool) {
+    for (auto& entry : m_entries) {
+        if (entry.pool == pool) {
+            return entry;
+        }
+    }
+    m_entries.emplace_back();
+    m_entries.back().pool = pool;
+    return m_entries.back();
+}
+
+void* ThreadCache::pop(Pool* pool, size_t cls) {
+    auto& entry = get(pool);
+    auto& blocks = entry.bins[cls];
+    if (blocks.empty()) {
+        return nullptr;
+    }
+    auto* block = blocks.back();
+    blocks.pop_back();
+    entry.bytes -= class_size(cls);
+    return block;
+}
+
+bool ThreadCache::push(Pool* pool, size_t cls, void* block) {
+    try {
+        auto& entry = get(pool);
+        auto& blocks = entry.bins[cls];
+        const auto size = class_size(cls);
+        if (blocks.size() >= thread_cache_blocks || entry.bytes + size > thread_cache_max_bytes) {
+            return false;
+        }
+        blocks.push_back(block);
+        entry.bytes += size;
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
+void ThreadCache::flush(Pool* pool) {
+    for (auto& entry : m_entries) {
+        if (entry.pool != pool) {
+            continue;
+        }
+        for (size_t cls = 0; cls < thread_classes; ++cls) {
+            for (auto* block : entry.bins[cls]) {
+                pool->release(cls, block, true);
+            }
+            entry.bins[cls].clear();
+        }
+        entry.bytes = 0;
+    }
+}
+
+// The pools live until the process exits: the thread caches of the threads which exit after the static objects are
+// destroyed still return their blocks to them
+class Pools {
+public:
+    static Pools& get() {
+        static auto* pools = new Pools();
+        return *pools;
+    }
+
+    Pool* pool(int numa_node) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto& pool = m_pools[numa_node];
+        if (!pool) {
+            pool = std::make_unique<Pool>(numa_node);
+        }
+        return pool.get();
+    }
+
+    template <typename F>
+    void for_each(F&& f) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto& pool : m_pools) {
+            f(*pool.second);
+        }
+    }
+
+    std::atomic<bool> default_pooled{false};
+
+private:
+    std::mutex m_mutex;
+    std::map<int, std::unique_ptr<Pool>> m_pools;
+};
+
+struct PooledAllocator {
+    void* allocate(const size_t bytes, const size_t alignment) {
+        return pool->allocate(bytes, alignment);
+    }
+
+    void deallocate(void* handle, const size_t bytes, const size_t alignment) noexcept {
+        pool->deallocate(handle, bytes, alignment);
+    }
+
+    bool is_equal(const PooledAllocator& other) const {
+        return pool == other.pool;
+    }
+
+    Pool* pool;
+};
+}  // namespace
+
+Allocator get_pooled_allocator(int numa_node) {
+    OPENVINO_ASSERT(numa_node >= -1, "Invalid NUMA node: ", numa_node);
+    return PooledAllocator{Pools::get().pool(numa_node)};
+}
+
+void set_default_allocator_pooled(bool pooled) {
+    Pools::get().default_pooled.store(pooled, std::memory_order_relaxed);
+}
+
+bool is_default_allocator_pooled() {
+    return Pools::get().default_pooled.load(std::memory_order_relaxed);
+}
+
+std::map<std::string, uint64_t> get_pooled_allocator_statistics() {
+    std::map<std::string, uint64_t> statistics{{"allocations", 0},
+                                               {"thread_cache_hits", 0},
+                                               {"pool_hits", 0},
+                                               {"system_allocations", 0},
+                                               {"huge_page_blocks", 0},
+                                               {"system_frees", 0},
+                                               {"in_use_bytes", 0},
+                                               {"cached_bytes", 0},
+                                               {"system_bytes", 0},
+                                               {"peak_system_bytes", 0}};
+    Pools::get().for_each([&](const Pool& pool) {
+        pool.add_statistics(statistics);
+    });
+    return statistics;
+}
+
+void release_pooled_allocator_memory() {
+    Pools::get().for_each([](Pool& pool) {
+        thread_cache.flush(&pool);
+        pool.clear();
+    });
+}
+
+}  // namespace ov
@@ -11,7 +11,7 @@
 namespace ov {
 class SharedRTInfo {
 public:
-    SharedRTInfo() : m_use_topological_cache(false) {}
+    SharedRTInfo() : m_use_topological_cache(false), m_has_dirty_nodes(true) {}
 
     void set_use_topological_cache(bool status) {
         m_use_topological_cache = status;
@@ -21,7 +21,17 @@ public:
         return m_use_topological_cache;
     }
 
+    void set_has_dirty_nodes(bool status) {
+        m_has_dirty_nodes = status;
+    }
+
+    bool get_has_dirty_nodes() const {
+        return m_has_dirty_nodes;
+    }
+
 private:
     bool m_use_topological_cache;
+    // a node of the model was changed after its last validation
+    bool m_has_dirty_nodes;
 };
 }  // namespace ov
@@ -150,6 +150,7 @@ set(LIBRARY_SRC
     ${CMAKE_CURRENT_LIST_DIR}/op/is_inf.cpp
     ${CMAKE_CURRENT_LIST_DIR}/op/is_nan.cpp
     ${CMAKE_CURRENT_LIST_DIR}/op/istft.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/op/kquant_matmul.cpp
     ${CMAKE_CURRENT_LIST_DIR}/op/less.cpp
     ${CMAKE_CURRENT_LIST_DIR}/op/less_eq.cpp
     ${CMAKE_CURRENT_LIST_DIR}/op/log.cpp
@@ -370,6 +371,7 @@ set(LIBRARY_SRC
     ${CMAKE_CURRENT_LIST_DIR}/runtime/compute_hash.cpp
     ${CMAKE_CURRENT_LIST_DIR}/runtime/itensor.cpp
     ${CMAKE_CURRENT_LIST_DIR}/runtime/lazy_buffer.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/runtime/pooled_allocator.cpp
     ${CMAKE_CURRENT_LIST_DIR}/runtime/shared_buffer.cpp
     ${CMAKE_CURRENT_LIST_DIR}/runtime/string_aligned_buffer.cpp
     ${CMAKE_CURRENT_LIST_DIR}/runtime/tensor.cpp
@@ -6,6 +6,7 @@
 
 #include "openvino/core/except.hpp"
 #include "openvino/reference/convert.hpp"
+#include "openvino/runtime/aligned_buffer.hpp"
 #include "openvino/runtime/compute_hash.hpp"
 #include "openvino/util/hash_util.hpp"
 
@@ -38,7 +39,9 @@ ConstantWriter::FilePosition ConstantWriter::write(const char* ptr,
         // the same hash for {2, 2} and {0, 128} arrays.
         // But even strong hashing algorithms sometimes give collisions.
         // Therefore we always have to compare values when finding a match in the hash multimap.
-        const HashValue hash = ov::runtime::compute_hash(data_ptr, new_size);
+        const HashValue hash = m_buffer && m_buffer->get_ptr() == data_ptr && m_buffer->size() == new_size
+                                   ? m_buffer->get_hash()
+                                   : ov::runtime::compute_hash_parallel(data_ptr, new_size);
 
         const auto found = m_hash_to_file_positions.equal_range(hash);
         // iterate over all matches of the key in the multimap
@@ -74,7 +77,7 @@ ConstantWriter::FilePosition ConstantWriter::write(const std::vector<std::string
             dst += sv.size();
         }
 
-        const HashValue hash = ov::runtime::compute_hash(tmp.data(), new_size);
+        const HashValue hash = ov::runtime::compute_hash_parallel(tmp.data(), new_size);
         const auto found = m_hash_to_file_positions.equal_range(hash);
         for (auto it = found.first; it != found.second; ++it) {
             if (memcmp(tmp.data(), it->second.second, new_size) == 0) {
@@ -101,6 +104,27 @@ ConstantWriter::FilePosition ConstantWriter::write(const std::vector<std::string
     }
 }
 
+ConstantWriter::FilePosition ConstantWriter::write(const ov::AlignedBuffer& buffer,
+                                                   size_t& new_size,
+                                                   bool compress_to_fp16,
+                                                   ov::element::Type src_type,
+                                                   bool ptr_is_temporary) {
+    struct BufferGuard {
+        const ov::AlignedBuffer*& buffer;
+        ~BufferGuard() {
+            buffer = nullptr;
+        }
+    } guard{m_buffer};
+    m_buffer = &buffer;
+    // the derived writers override the write of the raw data
+    return write(static_cast<const char*>(buffer.get_ptr()),
+                 buffer.size(),
+                 new_size,
+                 compress_to_fp16,
+                 src_type,
+                 ptr_is_temporary);
+}
+
 std::unique_ptr<char[]> ConstantWriter::compress_data_to_fp16(const char* ptr,
                                                               size_t size,
                                                               const element::Type& src_type,
@@ -0,0 +1,131 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "openvino/core/model.hpp"
+#include "openvino/core/type/float16.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/gather.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/reshape.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/op/subtract.hpp"
+#include "openvino/pass/constant_folding.hpp"
+
+// These benchmarks measure wall-clock timing and are meaningless in a Debug (-O0) build.
+#ifndef NDEBUG
+#    error \
+        "constant_folding_benchmark.cpp must be built in Release mode: rebuild with -DCMAKE_BUILD_TYPE=Release, or delete this #error to build in Debug anyway."
+#endif
+
+namespace ov::test {
+
+namespace {
+
+// u8 weights with the per-group zero points and scales, decompressed the way the compressed LLMs are:
+// Convert -> Subtract -> Multiply -> Reshape to [N, K]
+std::shared_ptr<ov::Node> make_decompressed_weights(size_t n, size_t k, size_t group_size, uint8_t seed) {
+    const size_t groups = k / group_size;
+    auto weights = std::make_shared<ov::op::v0::Constant>(ov::element::u8, ov::Shape{n, groups, group_size});
+    auto* data = static_cast<uint8_t*>(const_cast<void*>(weights->get_data_ptr()));
+    for (size_t i = 0; i < n * k; ++i) {
+        data[i] = static_cast<uint8_t>(i * 31 + seed);
+    }
+    auto convert = std::make_shared<ov::op::v0::Convert>(weights, ov::element::f32);
+    auto zero_point = ov::op::v0::Constant::create(ov::element::u8, ov::Shape{n, groups, 1}, {8});
+    auto zero_point_convert = std::make_shared<ov::op::v0::Convert>(zero_point, ov::element::f32);
+    auto subtract = std::make_shared<ov::op::v1::Subtract>(convert, zero_point_convert);
+    auto scale = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{n, groups, 1}, {0.01f});
+    auto multiply = std::make_shared<ov::op::v1::Multiply>(subtract, scale);
+    auto shape = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{2}, {n, k});
+    return std::make_shared<ov::op::v1::Reshape>(multiply, shape, false);
+}
+
+// The decoder layers of a compressed LLM: 4 attention projections and the gated MLP
+std::shared_ptr<ov::Model> make_llm(size_t layers, size_t hidden, size_t intermediate) {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, hidden});
+    ov::Output<ov::Node> last = param;
+    uint8_t seed = 0;
+    auto projection = [&](const ov::Output<ov::Node>& input, size_t n, size_t k) {
+        return std::make_shared<ov::op::v0::MatMul>(input, make_decompressed_weights(n, k, 128, seed++), false, true);
+    };
+    for (size_t l = 0; l < layers; ++l) {
+        for (size_t p = 0; p < 4; ++p) {
+            last = projection(last, hidden, hidden);
+        }
+        auto gate = projection(last, intermediate, hidden);
+        auto up = projection(last, intermediate, hidden);
+        last = projection(std::make_shared<ov::op::v1::Multiply>(gate, up), hidden, intermediate);
+    }
+    return std::make_shared<ov::Model>(ov::OutputVector{last}, ov::ParameterVector{param});
+}
+
+// A recommender with many f16 embedding tables converted to f32
+std::shared_ptr<ov::Model> make_recommender(size_t tables, size_t rows, size_t dim) {
+    auto indices = std::make_shared<ov::op::v0::Parameter>(ov::element::i64, ov::Shape{tables});
+    auto axis = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{}, {0});
+    ov::OutputVector outputs;
+    for (size_t t = 0; t < tables; ++t) {
+        auto table = std::make_shared<ov::op::v0::Constant>(ov::element::f16, ov::Shape{rows, dim});
+        auto* data = static_cast<ov::float16*>(const_cast<void*>(table->get_data_ptr()));
+        for (size_t i = 0; i < rows * dim; ++i) {
+            data[i] = static_cast<float>(i % 97) * 0.01f;
+        }
+        auto convert = std::make_shared<ov::op::v0::Convert>(table, ov::element::f32);
+        outputs.push_back(std::make_shared<ov::op::v8::Gather>(convert, indices, axis));
+    }
+    return std::make_shared<ov::Model>(outputs, ov::ParameterVector{indices});
+}
+
+// mean duration of the pass over fresh copies of the model, the copying is not measured
+long long bench_constant_folding(const std::shared_ptr<ov::Model>& model, bool parallel, int runs) {
+    long long total_ms = 0;
+    for (int r = 0; r < runs; ++r) {
+        auto copy = model->clone();
+        const auto start = std::chrono::steady_clock::now();
+        ov::pass::ConstantFolding(parallel).run_on_model(copy);
+        total_ms +=
+            std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+    }
+    return total_ms / runs;
+}
+
+}  // namespace
+
+TEST(ConstantFoldingBenchmark, large_models) {
+    constexpr int runs = 3;
+    struct Case {
+        std::string name;
+        std::shared_ptr<ov::Model> model;
+    };
+    const std::vector<Case> cases = {
+        {"llm 8x1024", make_llm(8, 1024, 2816)},
+        {"llm 12x1536", make_llm(12, 1536, 4096)},
+        {"recsys 64 tables", make_recommender(64, 50000, 64)},
+    };
+
+    printf("\n--- ConstantFolding duration (ms, mean of %d runs) ---\n", runs);
+    printf("%-20s | %13s | %13s | %7s\n", "Model", "sequential", "parallel", "speedup");
+    printf("%-20s-|-%13s-|-%13s-|-%7s\n", "--------------------", "-------------", "-------------", "-------");
+    for (const auto& c : cases) {
+        const auto sequential_ms = bench_constant_folding(c.model, false, runs);
+        const auto parallel_ms = bench_constant_folding(c.model, true, runs);
+        printf("%-20s | %10lld ms | %10lld ms | %6.2fx\n",
+               c.name.c_str(),
+               sequential_ms,
+               parallel_ms,
+               parallel_ms ? static_cast<double>(sequential_ms) / static_cast<double>(parallel_ms) : 0.0);
+    }
+}
+
+}  // namespace ov::test
@@ -20,6 +20,11 @@
 #include <tuple>
 #include <vector>
 
+#include "openvino/core/graph_util.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/runtime/core.hpp"
 #include "openvino/util/file_util.hpp"
 #include "openvino/util/memory.hpp"
 #include "openvino/util/mmap_object.hpp"
@@ -527,4 +532,83 @@ TEST_F(FileLoadBenchmark, hint_prefetch_with_offset_table) {
     }
 }
 
+TEST_F(FileLoadBenchmark, read_model_startup) {
+    // IRs of many mid-sized constants, the way the weights of the large models are laid out
+    const std::vector<size_t> sizes_mib = {500, 2000, 5000};
+    constexpr size_t constant_size_mib = 16;
+    constexpr int warmup = 0;
+    constexpr int runs = 3;
+
+    struct Row {
+        size_t size_mib;
+        long long read_ms;
+        long long mmap_ms;
+        long long bin_ifstream_ms;
+    };
+    std::vector<Row> results;
+
+    ov::Core core;
+    for (const auto size_mib : sizes_mib) {
+        const auto xml_path = std::filesystem::path("test_model" + std::to_string(size_mib) + "mib.xml");
+        auto bin_path = xml_path;
+        bin_path.replace_extension(".bin");
+        if (!util::file_exists(xml_path) || !util::file_exists(bin_path)) {
+            const size_t constant_elements = constant_size_mib * util::one_mib / sizeof(float);
+            auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{constant_elements});
+            ov::Output<ov::Node> last = param;
+            for (size_t i = 0; i < size_mib / constant_size_mib; ++i) {
+                auto constant = ov::op::v0::Constant::create(ov::element::f32,
+                                                             ov::Shape{constant_elements},
+                                                             std::vector<float>(constant_elements, float(i)));
+                last = std::make_shared<ov::op::v1::Add>(last, constant);
+            }
+            auto model = std::make_shared<ov::Model>(ov::OutputVector{last}, ov::ParameterVector{param});
+            ov::serialize(model, xml_path, bin_path);
+        }
+        const size_t bin_size = std::filesystem::file_size(bin_path);
+        evict_cache(bin_path, bin_size);
+
+        const auto read_model = [&](bool enable_mmap) {
+            return bench(
+                [&]() {
+                    core.set_property(ov::enable_mmap(enable_mmap));
+                    ASSERT_NE(core.read_model(xml_path), nullptr);
+                },
+                bin_path,
+                bin_size,
+                warmup,
+                runs);
+        };
+        const auto read_ms = read_model(false);
+        const auto mmap_ms = read_model(true);
+        // the single std::ifstream::read the weights used to be loaded with
+        const auto bin_ifstream_ms = bench(
+            [&]() {
+                std::vector<char> destination(bin_size);
+                std::ifstream stream(bin_path, std::ios::binary);
+                ASSERT_TRUE(stream.read(destination.data(), static_cast<std::streamsize>(destination.size())));
+            },
+            bin_path,
+            bin_size,
+            warmup,
+            runs);
+        results.push_back({size_mib, read_ms, mmap_ms, bin_ifstream_ms});
+    }
+
+    printf("\n--- Cold-cache read_model latency (ms, mean of %d runs) ---\n", runs);
+    printf("%-12s | %16s | %16s | %16s\n", "Size (MiB)", "read_model", "read_model mmap", ".bin ifstream");
+    printf("%-12s-|-%16s-|-%16s-|-%16s\n",
+           "------------",
+           "----------------",
+           "----------------",
+           "----------------");
+    for (const auto& row : results) {
+        printf("%-12zu | %13lld ms | %13lld ms | %13lld ms\n",
+               row.size_mib,
+               row.read_ms,
+               row.mmap_ms,
+               row.bin_ifstream_ms);
+    }
+}
+
 }  // namespace ov::test
@@ -0,0 +1,266 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "openvino/core/graph_util.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/reshape.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/op/softmax.hpp"
+#include "openvino/op/transpose.hpp"
+#include "openvino/pass/manager.hpp"
+#include "openvino/pass/matcher_pass.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+
+// These benchmarks measure wall-clock timing and are meaningless in a Debug (-O0) build.
+#ifndef NDEBUG
+#    error \
+        "graph_rewrite_benchmark.cpp must be built in Release mode: rebuild with -DCMAKE_BUILD_TYPE=Release, or delete this #error to build in Debug anyway."
+#endif
+
+namespace ov::test {
+
+namespace {
+
+// A fusion rooted at a node of the given type fed by a node of the producer type. Like most of the fusions of a
+// pipeline, it is tried on every node of the root type and rarely applies.
+class ProducerFusion : public ov::pass::MatcherPass {
+public:
+    OPENVINO_MATCHER_PASS_RTTI("ProducerFusion");
+    ProducerFusion(const ov::NodeTypeInfo& root_type, const ov::NodeTypeInfo& producer_type) {
+        auto root = std::make_shared<ov::pass::pattern::op::WrapType>(root_type);
+        ov::matcher_pass_callback callback = [producer_type](ov::pass::pattern::Matcher& m) {
+            const auto& producer = m.get_match_root()->input_value(0);
+            return producer.get_node()->get_type_info() == producer_type && producer.get_partial_shape().size() > 8;
+        };
+        register_matcher(std::make_shared<ov::pass::pattern::Matcher>(root, "ProducerFusion"), callback);
+    }
+};
+
+// Removes the multiplications by one, which creates the work for the fusions registered after it
+class EliminateMultiplyByOne : public ov::pass::MatcherPass {
+public:
+    OPENVINO_MATCHER_PASS_RTTI("EliminateMultiplyByOne");
+    EliminateMultiplyByOne() {
+        auto one = ov::pass::pattern::wrap_type<ov::op::v0::Constant>();
+        auto multiply = ov::pass::pattern::wrap_type<ov::op::v1::Multiply>({ov::pass::pattern::any_input(), one});
+        ov::matcher_pass_callback callback = [=](ov::pass::pattern::Matcher& m) {
+            const auto& pattern_map = m.get_pattern_value_map();
+            auto constant = ov::as_type_ptr<ov::op::v0::Constant>(pattern_map.at(one).get_node_shared_ptr());
+            const auto values = constant->cast_vector<float>();
+            if (values.size() != 1 || values[0] != 1.0f) {
+                return false;
+            }
+            auto root = m.get_match_root();
+            return ov::replace_output_update_name(root->output(0), root->input_value(0));
+        };
+        register_matcher(std::make_shared<ov::pass::pattern::Matcher>(multiply, "EliminateMultiplyByOne"), callback);
+    }
+};
+
+// Replaces the activation of the given layer by its copy, a local change like the ones of most of the passes
+class ReplaceActivation : public ov::pass::ModelPass {
+public:
+    OPENVINO_MODEL_PASS_RTTI("ReplaceActivation");
+    explicit ReplaceActivation(size_t layer) : m_layer(layer) {}
+
+    bool run_on_model(const std::shared_ptr<ov::Model>& model) override {
+        size_t layer = 0;
+        for (const auto& op : model->get_ordered_ops()) {
+            if (ov::is_type<ov::op::v0::Relu>(op) && layer++ == m_layer) {
+                ov::replace_node(op, op->clone_with_new_inputs(op->input_values()));
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    size_t m_layer;
+};
+
+std::shared_ptr<ov::Node> make_weights(size_t rows, size_t cols) {
+    return ov::op::v0::Constant::create(ov::element::f32, ov::Shape{rows, cols}, std::vector<float>(rows * cols, 0.1f));
+}
+
+std::shared_ptr<ov::Node> make_i64(const std::vector<int64_t>& values) {
+    return ov::op::v0::Constant::create(ov::element::i64, ov::Shape{values.size()}, values);
+}
+
+// The decoder layers of a transformer: multi-head attention and MLP with the residual connections.
+// The sequence length is dynamic if seq is 0.
+std::shared_ptr<ov::Model> make_transformer(size_t layers, size_t seq, size_t hidden, size_t heads) {
+    const auto head_size = static_cast<int64_t>(hidden / heads);
+    const auto s = seq ? static_cast<int64_t>(seq) : -1;
+    const auto h = static_cast<int64_t>(heads);
+    auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32,
+                                                         ov::PartialShape{1, s, static_cast<int64_t>(hidden)});
+    auto mask = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{1, 1, s, s});
+    auto scalar = [](float value) {
+        return ov::op::v0::Constant::create(ov::element::f32, ov::Shape{}, {value});
+    };
+    auto split_heads = [&](const ov::Output<ov::Node>& x) {
+        auto projection = std::make_shared<ov::op::v0::MatMul>(x, make_weights(hidden, hidden));
+        auto reshape = std::make_shared<ov::op::v1::Reshape>(projection, make_i64({1, s, h, head_size}), false);
+        return std::make_shared<ov::op::v1::Transpose>(reshape, make_i64({0, 2, 1, 3}));
+    };
+
+    ov::Output<ov::Node> x = input;
+    for (size_t l = 0; l < layers; ++l) {
+        auto q = split_heads(x);
+        auto k = split_heads(x);
+        auto v = split_heads(x);
+        auto scores = std::make_shared<ov::op::v0::MatMul>(q, k, false, true);
+        auto scaled = std::make_shared<ov::op::v1::Multiply>(scores, scalar(0.125f));
+        auto masked = std::make_shared<ov::op::v1::Add>(scaled, mask);
+        auto softmax = std::make_shared<ov::op::v1::Softmax>(masked, 3);
+        auto attention = std::make_shared<ov::op::v0::MatMul>(softmax, v);
+        auto transpose = std::make_shared<ov::op::v1::Transpose>(attention, make_i64({0, 2, 1, 3}));
+        auto merged =
+            std::make_shared<ov::op::v1::Reshape>(transpose, make_i64({1, s, static_cast<int64_t>(hidden)}), false);
+        auto output = std::make_shared<ov::op::v0::MatMul>(merged, make_weights(hidden, hidden));
+        auto residual = std::make_shared<ov::op::v1::Add>(output, x);
+
+        auto up = std::make_shared<ov::op::v0::MatMul>(residual, make_weights(hidden, 4 * hidden));
+        auto relu = std::make_shared<ov::op::v0::Relu>(up);
+        auto identity = std::make_shared<ov::op::v1::Multiply>(relu, scalar(1.0f));
+        auto down = std::make_shared<ov::op::v0::MatMul>(identity, make_weights(4 * hidden, hidden));
+        x = std::make_shared<ov::op::v1::Add>(down, residual);
+    }
+    auto result = std::make_shared<ov::op::v0::Result>(x);
+    return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{input, mask});
+}
+
+// A pipeline of the fusions of every op type of the model fed by every other one, with the elimination in the middle
+void register_pipeline(ov::pass::Manager& manager) {
+    const std::vector<ov::NodeTypeInfo> types = {ov::op::v0::MatMul::get_type_info_static(),
+                                                 ov::op::v1::Add::get_type_info_static(),
+                                                 ov::op::v1::Multiply::get_type_info_static(),
+                                                 ov::op::v1::Reshape::get_type_info_static(),
+                                                 ov::op::v1::Transpose::get_type_info_static(),
+                                                 ov::op::v1::Softmax::get_type_info_static(),
+                                                 ov::op::v0::Relu::get_type_info_static()};
+    for (size_t i = 0; i < types.size(); ++i) {
+        if (i == types.size() / 2) {
+            manager.register_pass<EliminateMultiplyByOne>();
+        }
+        for (const auto& producer : types) {
+            manager.register_pass<ProducerFusion>(types[i], producer);
+        }
+    }
+}
+
+// mean duration of the pipeline over fresh copies of the model, the copying is not measured
+double bench_pipeline(const std::shared_ptr<ov::Model>& model, bool fused, int runs) {
+    double total_ms = 0;
+    for (int r = 0; r < runs; ++r) {
+        auto copy = model->clone();
+        ov::pass::Manager manager("GraphRewriteBenchmark");
+        manager.set_fuse_matcher_passes(fused);
+        register_pipeline(manager);
+        const auto start = std::chrono::steady_clock::now();
+        manager.run_passes(copy);
+        total_ms += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+    return total_ms / runs;
+}
+
+// mean duration of a pass per layer, each followed by the validation, over fresh copies of the validated model
+double bench_validation(const std::shared_ptr<ov::Model>& model, size_t layers, bool incremental, int runs) {
+    double total_ms = 0;
+    for (int r = 0; r < runs; ++r) {
+        auto copy = model->clone();
+        copy->validate_nodes_and_infer_types();
+        ov::pass::Manager manager("ValidationBenchmark");
+        manager.set_incremental_validation(incremental);
+        for (size_t layer = 0; layer < layers; ++layer) {
+            manager.register_pass<ReplaceActivation>(layer);
+        }
+        const auto start = std::chrono::steady_clock::now();
+        manager.run_passes(copy);
+        total_ms += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+    return total_ms / runs;
+}
+
+}  // namespace
+
+TEST(GraphRewriteBenchmark, large_models) {
+    constexpr int runs = 3;
+    struct Case {
+        std::string name;
+        std::shared_ptr<ov::Model> model;
+    };
+    const std::vector<Case> cases = {
+        {"transformer 24 layers", make_transformer(24, 16, 64, 4)},
+        {"transformer 48 layers", make_transformer(48, 16, 64, 4)},
+        {"transformer 96 layers", make_transformer(96, 16, 64, 4)},
+    };
+
+    printf("\n--- Transformation pipeline duration (ms, mean of %d runs) ---\n", runs);
+    printf("%-22s | %6s | %13s | %13s | %7s\n", "Model", "nodes", "sequential", "fused", "speedup");
+    printf("%-22s-|-%6s-|-%13s-|-%13s-|-%7s\n",
+           "----------------------",
+           "------",
+           "-------------",
+           "-------------",
+           "-------");
+    for (const auto& c : cases) {
+        const auto sequential_ms = bench_pipeline(c.model, false, runs);
+        const auto fused_ms = bench_pipeline(c.model, true, runs);
+        printf("%-22s | %6zu | %10.1f ms | %10.1f ms | %6.2fx\n",
+               c.name.c_str(),
+               c.model->get_ops().size(),
+               sequential_ms,
+               fused_ms,
+               fused_ms > 0 ? sequential_ms / fused_ms : 0.0);
+    }
+}
+
+TEST(GraphRewriteBenchmark, incremental_validation) {
+    constexpr int runs = 3;
+    struct Case {
+        std::string name;
+        size_t layers;
+        std::shared_ptr<ov::Model> model;
+    };
+    const std::vector<Case> cases = {
+        {"dynamic transformer 24", 24, make_transformer(24, 0, 64, 4)},
+        {"dynamic transformer 48", 48, make_transformer(48, 0, 64, 4)},
+        {"dynamic transformer 96", 96, make_transformer(96, 0, 64, 4)},
+    };
+
+    printf("\n--- Pipeline of a local rewrite per layer with per pass validation (ms, mean of %d runs) ---\n", runs);
+    printf("%-22s | %6s | %13s | %13s | %7s\n", "Model", "nodes", "full", "incremental", "speedup");
+    printf("%-22s-|-%6s-|-%13s-|-%13s-|-%7s\n",
+           "----------------------",
+           "------",
+           "-------------",
+           "-------------",
+           "-------");
+    for (const auto& c : cases) {
+        const auto full_ms = bench_validation(c.model, c.layers, false, runs);
+        const auto incremental_ms = bench_validation(c.model, c.layers, true, runs);
+        printf("%-22s | %6zu | %10.1f ms | %10.1f ms | %6.2fx\n",
+               c.name.c_str(),
+               c.model->get_ops().size(),
+               full_ms,
+               incremental_ms,
+               incremental_ms > 0 ? full_ms / incremental_ms : 0.0);
+    }
+}
+
+}  // namespace ov::test
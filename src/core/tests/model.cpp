@@ -2350,3 +2350,44 @@ TEST(model, create_model) {
     EXPECT_THROW(ov::Model(ov::ResultVector{}, {}, {}, {nullptr}, ""), ov::Exception);
     EXPECT_THROW(ov::Model(ov::OutputVector{ov::Output<ov::Node>{nullptr, 0}}, {}, {}, {}, ""), ov::Exception);
 }
+
+TEST(model, validate_dirty_nodes_propagates_changes) {
+    auto param = std::make_shared<Parameter>(ov::element::f32, ov::PartialShape{1, 3});
+    auto relu = std::make_shared<Relu>(param);
+    auto abs = std::make_shared<ov::op::v0::Abs>(relu);
+    auto model = std::make_shared<ov::Model>(ov::OutputVector{abs}, ov::ParameterVector{param});
+    model->validate_nodes_and_infer_types();
+    EXPECT_FALSE(param->is_dirty());
+    EXPECT_FALSE(abs->is_dirty());
+
+    param->set_partial_shape(ov::PartialShape{2, 3});
+    EXPECT_TRUE(param->is_dirty());
+    EXPECT_FALSE(relu->is_dirty());
+
+    model->validate_dirty_nodes_and_infer_types();
+    EXPECT_FALSE(param->is_dirty());
+    EXPECT_EQ(model->output().get_partial_shape(), ov::PartialShape({2, 3}));
+}
+
+TEST(model, validate_dirty_nodes_stops_at_unchanged_outputs) {
+    auto param = std::make_shared<Parameter>(ov::element::f32, ov::PartialShape{1, 3});
+    auto relu = std::make_shared<Relu>(param);
+    auto abs = std::make_shared<ov::op::v0::Abs>(relu);
+    auto last = std::make_shared<Relu>(abs);
+    auto model = std::make_shared<ov::Model>(ov::OutputVector{last}, ov::ParameterVector{param});
+    model->validate_nodes_and_infer_types();
+
+    // the wrong shape stays until the node is revalidated
+    last->set_output_type(0, ov::element::f32, ov::PartialShape{7});
+    ov::replace_node(relu, std::make_shared<Relu>(param));
+    EXPECT_TRUE(abs->is_dirty());
+    EXPECT_FALSE(last->is_dirty());
+
+    model->validate_dirty_nodes_and_infer_types();
+    EXPECT_FALSE(abs->is_dirty());
+    EXPECT_EQ(last->get_output_partial_shape(0), ov::PartialShape({7}));
+
+    last->mark_dirty();
+    model->validate_dirty_nodes_and_infer_types();
+    EXPECT_EQ(last->get_output_partial_shape(0), ov::PartialShape({1, 3}));
+}
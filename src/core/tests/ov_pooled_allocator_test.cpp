@@ -0,0 +1,135 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include "common_test_utils/test_assertions.hpp"
+#include "openvino/core/except.hpp"
+#include "openvino/runtime/allocator.hpp"
+#include "openvino/runtime/pooled_allocator.hpp"
+#include "openvino/runtime/tensor.hpp"
+
+namespace ov::test {
+using ::testing::_;
+
+class OVPooledAllocatorTest : public ::testing::Test {
+protected:
+    void TearDown() override {
+        ov::set_default_allocator_pooled(false);
+        ov::release_pooled_allocator_memory();
+    }
+};
+
+TEST_F(OVPooledAllocatorTest, canAllocateAndDeallocate) {
+    auto allocator = ov::get_pooled_allocator();
+    for (const size_t bytes : {size_t{0}, size_t{1}, size_t{64}, size_t{1000}, size_t{3} << 20}) {
+        void* ptr = nullptr;
+        OV_ASSERT_NO_THROW(ptr = allocator.allocate(bytes, 64));
+        ASSERT_NE(ptr, nullptr);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % 64, 0u);
+        if (bytes) {
+            static_cast<char*>(ptr)[bytes - 1] = 11;
+        }
+        OV_ASSERT_NO_THROW(allocator.deallocate(ptr, bytes, 64));
+    }
+}
+
+TEST_F(OVPooledAllocatorTest, reusesReleasedBlocks) {
+    auto allocator = ov::get_pooled_allocator();
+    const auto before = ov::get_pooled_allocator_statistics();
+
+    void* first = allocator.allocate(1000);
+    allocator.deallocate(first, 1000);
+    // the same size class
+    void* second = allocator.allocate(900);
+    EXPECT_EQ(first, second);
+    allocator.deallocate(second, 900);
+
+    const auto after = ov::get_pooled_allocator_statistics();
+    EXPECT_EQ(after.at("allocations") - before.at("allocations"), 2u);
+    EXPECT_GE(after.at("thread_cache_hits") + after.at("pool_hits"),
+              before.at("thread_cache_hits") + before.at("pool_hits") + 1);
+    EXPECT_EQ(after.at("in_use_bytes"), before.at("in_use_bytes"));
+}
+
+TEST_F(OVPooledAllocatorTest, releasesCachedMemory) {
+    auto allocator = ov::get_pooled_allocator();
+    void* ptr = allocator.allocate(size_t{4} << 20);
+    allocator.deallocate(ptr, size_t{4} << 20);
+    EXPECT_GE(ov::get_pooled_allocator_statistics().at("cached_bytes"), size_t{4} << 20);
+
+    ov::release_pooled_allocator_memory();
+    EXPECT_EQ(ov::get_pooled_allocator_statistics().at("cached_bytes"), 0u);
+}
+
+TEST_F(OVPooledAllocatorTest, blocksReleasedByOtherThreads) {
+    auto allocator = ov::get_pooled_allocator();
+    std::vector<void*> blocks;
+    for (size_t i = 0; i < 64; ++i) {
+        blocks.push_back(allocator.allocate(256 * (i + 1)));
+    }
+    std::thread releaser([&] {
+        for (size_t i = 0; i < blocks.size(); ++i) {
+            allocator.deallocate(blocks[i], 256 * (i + 1));
+        }
+    });
+    releaser.join();
+    EXPECT_EQ(ov::get_pooled_allocator_statistics().at("in_use_bytes"), 0u);
+}
+
+TEST_F(OVPooledAllocatorTest, allocatorsOfSamePoolAreEqual) {
+    EXPECT_TRUE(ov::get_pooled_allocator() == ov::get_pooled_allocator());
+    EXPECT_FALSE(ov::get_pooled_allocator() == ov::Allocator{});
+    EXPECT_FALSE(ov::get_pooled_allocator() == ov::get_pooled_allocator(0));
+}
+
+TEST_F(OVPooledAllocatorTest, throwsOnInvalidNumaNode) {
+    OV_EXPECT_THROW(std::ignore = ov::get_pooled_allocator(-2), ov::Exception, _);
+}
+
+TEST_F(OVPooledAllocatorTest, tensorWithPooledAllocator) {
+    const auto before = ov::get_pooled_allocator_statistics().at("allocations");
+    {
+        ov::Tensor tensor(ov::element::f32, {1, 3, 224, 224}, ov::get_pooled_allocator());
+        std::fill_n(tensor.data<float>(), tensor.get_size(), 1.f);
+    }
+    EXPECT_EQ(ov::get_pooled_allocator_statistics().at("allocations"), before + 1);
+}
+
+TEST_F(OVPooledAllocatorTest, defaultAllocatorCanBePooled) {
+    ov::Allocator system;
+    ov::set_default_allocator_pooled(true);
+    EXPECT_TRUE(ov::is_default_allocator_pooled());
+    ov::Allocator pooled;
+    EXPECT_TRUE(pooled == ov::get_pooled_allocator());
+
+    const auto before = ov::get_pooled_allocator_statistics().at("allocations");
+    {
+        ov::Tensor tensor(ov::element::u8, {1024});
+        tensor.data<uint8_t>()[1023] = 11;
+    }
+    EXPECT_EQ(ov::get_pooled_allocator_statistics().at("allocations"), before + 1);
+
+    // the memory allocated by the system allocator is released by it after the switch back
+    ov::set_default_allocator_pooled(false);
+    EXPECT_FALSE(ov::is_default_allocator_pooled());
+    EXPECT_TRUE(ov::Allocator{} == system);
+}
+
+TEST_F(OVPooledAllocatorTest, throwsOnAllocationLargerThanOneTiB) {
+    if (sizeof(size_t) < sizeof(uint64_t)) {
+        GTEST_SKIP() << "Allocation larger than 1 TiB cannot be represented by size_t";
+    }
+
+    auto allocator = ov::get_pooled_allocator();
+    constexpr uint64_t one_tib = uint64_t{1} << 40;
+    OV_EXPECT_THROW_HAS_SUBSTRING(std::ignore = allocator.allocate(static_cast<size_t>(one_tib + 1)),
+                                  ov::Exception,
+                                  "exceeds maximum supported allocation size");
+}
+}  // namespace ov::test
@@ -1250,6 +1250,92 @@ INSTANTIATE_TEST_SUITE_P(copy_tests_strings,
                                            )));
 // clang-format on
 
+namespace {
+template <class TS, class TD>
+void check_converted(const ov::Tensor& src, const ov::Tensor& dst) {
+    const auto source_vec = fill_data<TS>(src);
+    const auto dest_vec = fill_data<TD>(dst);
+    ASSERT_EQ(source_vec.size(), dest_vec.size());
+    for (size_t i = 0; i < source_vec.size(); i++) {
+        const auto expected = static_cast<TD>(static_cast<float>(source_vec[i]));
+        ASSERT_EQ(static_cast<float>(expected), static_cast<float>(dest_vec[i])) << i;
+    }
+}
+
+template <class TS, class TD>
+void copy_converted(const ov::Tensor& src,
+                    const ov::Coordinate& roi_begin,
+                    const ov::Coordinate& roi_end,
+                    size_t threads) {
+    const ov::Tensor roi{src, roi_begin, roi_end};
+    ov::Tensor dst(ov::element::from<TD>(), {});
+    ov::ITensor::CopyOptions options;
+    options.convert = true;
+    options.threads = threads;
+    ov::get_tensor_impl(roi)._ptr->copy_to(ov::get_tensor_impl(dst)._ptr, options);
+    ASSERT_EQ(roi.get_shape(), dst.get_shape());
+    check_converted<TS, TD>(roi, dst);
+}
+
+template <class T>
+ov::Tensor make_filled_tensor(const ov::Shape& shape) {
+    ov::Tensor tensor(ov::element::from<T>(), shape);
+    auto* data = tensor.data<T>();
+    for (size_t i = 0; i < tensor.get_size(); ++i) {
+        data[i] = static_cast<T>(static_cast<float>(i % 251) * 0.5f);
+    }
+    return tensor;
+}
+}  // namespace
+
+TEST_F(OVTensorTest, copyToConvertsElementType) {
+    // the ROI rows are strided, the dense rows of the conversion are coalesced
+    const ov::Shape shape{2, 3, 16, 24};
+    const ov::Coordinate roi_begin{0, 1, 2, 3}, roi_end{2, 3, 14, 24};
+    for (const size_t threads : {1, 4}) {
+        copy_converted<float, ov::float16>(make_filled_tensor<float>(shape), roi_begin, roi_end, threads);
+        copy_converted<ov::float16, float>(make_filled_tensor<ov::float16>(shape), roi_begin, roi_end, threads);
+        copy_converted<float, ov::bfloat16>(make_filled_tensor<float>(shape), roi_begin, roi_end, threads);
+        copy_converted<ov::bfloat16, float>(make_filled_tensor<ov::bfloat16>(shape), roi_begin, roi_end, threads);
+        copy_converted<ov::bfloat16, ov::float16>(make_filled_tensor<ov::bfloat16>(shape), roi_begin, roi_end, threads);
+        copy_converted<uint8_t, float>(make_filled_tensor<uint8_t>(shape), roi_begin, roi_end, threads);
+        copy_converted<uint8_t, ov::float16>(make_filled_tensor<uint8_t>(shape), roi_begin, roi_end, threads);
+    }
+}
+
+TEST_F(OVTensorTest, copyToLargeTensorsInParallel) {
+    // a single long row split between the threads, and many rows of a view
+    const ov::Shape shape{4, 3, 384, 512};
+    const auto src = make_filled_tensor<float>(shape);
+    for (const size_t threads : {1, 3, 8}) {
+        ov::ITensor::CopyOptions options;
+        options.threads = threads;
+        ov::Tensor dst(ov::element::f32, shape);
+        ov::get_tensor_impl(src)._ptr->copy_to(ov::get_tensor_impl(dst)._ptr, options);
+        compare_tensors(src, dst);
+
+        const ov::Tensor roi{src, {1, 0, 5, 7}, {4, 3, 380, 500}};
+        ov::Tensor roi_dst(ov::element::f32, {});
+        ov::get_tensor_impl(roi)._ptr->copy_to(ov::get_tensor_impl(roi_dst)._ptr, options);
+        compare_tensors(roi, roi_dst);
+
+        // the large converted destinations are written with the non-temporal stores
+        options.convert = true;
+        ov::Tensor converted(ov::element::f16, shape);
+        ov::get_tensor_impl(src)._ptr->copy_to(ov::get_tensor_impl(converted)._ptr, options);
+        check_converted<float, ov::float16>(src, converted);
+    }
+}
+
+TEST_F(OVTensorTest, copyToUnsupportedConversion) {
+    const auto src = ov::get_tensor_impl(make_filled_tensor<float>({2, 3}))._ptr;
+    const auto dst = ov::get_tensor_impl(ov::Tensor(ov::element::i32, {2, 3}))._ptr;
+    OV_EXPECT_THROW(src->copy_to(dst), ov::Exception, HasSubstr("Tensor element types are not equal"));
+    ov::ITensor::CopyOptions options;
+    options.convert = true;
+    OV_EXPECT_THROW(src->copy_to(dst, options), ov::Exception, HasSubstr("doesn't support the conversion"));
+}
+
 TEST_F(OVTensorTest, sourceIdSetGet) {
     float data[6] = {};
     ov::Tensor tensor{ov::element::f32, ov::Shape{2, 3}, data};
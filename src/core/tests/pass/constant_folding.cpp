@@ -4158,4 +4158,72 @@ TEST(constant_folding, loop_with_node_which_has_no_evaluate) {
     EXPECT_NO_THROW(pass::ConstantFolding().run_on_model(model));
     EXPECT_EQ(count_ops_of_type<op::v5::Loop>(model), 1);
 }
+
+namespace {
+
+// Decompression subgraphs of the weights of several MatMuls, a ShapeOf of a static input and a chain which is
+// folded over several waves
+std::shared_ptr<Model> make_decompression_model() {
+    auto param = make_shared<op::v0::Parameter>(element::f32, Shape{2, 16});
+    ResultVector results;
+    for (size_t i = 0; i < 8; i++) {
+        vector<float16> weights_values(16 * 16);
+        for (size_t j = 0; j < weights_values.size(); j++) {
+            weights_values[j] = static_cast<float>((i + j) % 7) - 3.0f;
+        }
+        auto weights = op::v0::Constant::create(element::f16, Shape{16, 16}, weights_values);
+        weights->set_friendly_name("weights_" + std::to_string(i));
+        auto convert = make_shared<op::v0::Convert>(weights, element::f32);
+        convert->set_friendly_name("convert_" + std::to_string(i));
+        auto zero_point = op::v0::Constant::create(element::f32, Shape{16, 1}, {static_cast<float>(i)});
+        auto subtract = make_shared<op::v1::Subtract>(convert, zero_point);
+        subtract->set_friendly_name("subtract_" + std::to_string(i));
+        auto scale = op::v0::Constant::create(element::f32, Shape{16, 1}, {0.5f});
+        auto multiply = make_shared<op::v1::Multiply>(subtract, scale);
+        multiply->set_friendly_name("multiply_" + std::to_string(i));
+        auto matmul = make_shared<op::v0::MatMul>(param, multiply, false, true);
+        results.push_back(make_shared<op::v0::Result>(matmul));
+    }
+    auto shape_of = make_shared<op::v3::ShapeOf>(param);
+    shape_of->set_friendly_name("shape_of");
+    auto shape_add = make_shared<op::v1::Add>(shape_of, op::v0::Constant::create(element::i64, Shape{2}, {1, 1}));
+    shape_add->set_friendly_name("shape_add");
+    results.push_back(make_shared<op::v0::Result>(shape_add));
+    return make_shared<Model>(results, ParameterVector{param});
+}
+
+}  // namespace
+
+TEST(constant_folding, parallel_matches_sequential) {
+    auto model = make_decompression_model();
+    auto model_ref = model->clone();
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<ov::pass::InitNodeInfo>();
+    pass_manager.register_pass<pass::ConstantFolding>(true);
+    pass_manager.run_passes(model);
+    run_constant_folding(model_ref);
+
+    // the weights are folded into the MatMul inputs, the shape subgraph into the result
+    for (size_t i = 0; i < 8; i++) {
+        const auto matmul = model->get_results()[i]->get_input_node_shared_ptr(0);
+        ASSERT_TRUE(ov::is_type<op::v0::Constant>(matmul->get_input_node_ptr(1)));
+        check_names(matmul->get_input_node_shared_ptr(1),
+                    {"weights_" + std::to_string(i),
+                     "convert_" + std::to_string(i),
+                     "subtract_" + std::to_string(i),
+                     "multiply_" + std::to_string(i)},
+                    "multiply_" + std::to_string(i),
+                    false);
+    }
+    ASSERT_EQ(get_result_constant_data<int64_t>(model, 8), (vector<int64_t>{3, 17}));
+
+    const auto fc = FunctionsComparator::with_default()
+                        .enable(FunctionsComparator::CONST_VALUES)
+                        .enable(FunctionsComparator::NAMES)
+                        .enable(FunctionsComparator::RUNTIME_KEYS);
+    const auto res = fc.compare(model, model_ref);
+    ASSERT_TRUE(res.valid) << res.message;
+}
+
 }  // namespace ov::test
@@ -4,6 +4,7 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -19,6 +20,7 @@
 #include "openvino/pass/graph_rewrite.hpp"
 #include "openvino/pass/manager.hpp"
 #include "openvino/pass/pass.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
 #include "openvino/pass/validate.hpp"
 
 using namespace ov;
@@ -349,6 +351,121 @@ TEST(pass_manager, Validate_counter_1) {
     EXPECT_EQ(manager.get_num_validate_executed(), /*no Validate inserted*/ 0);
 }
 
+using VisitLog = std::shared_ptr<std::vector<std::string>>;
+
+class TestAddToMultiply : public ov::pass::MatcherPass {
+public:
+    OPENVINO_MATCHER_PASS_RTTI("TestAddToMultiply");
+    explicit TestAddToMultiply(const VisitLog& log) {
+        auto add = ov::pass::pattern::wrap_type<ov::op::v1::Add>();
+        ov::matcher_pass_callback callback = [log](ov::pass::pattern::Matcher& m) {
+            log->push_back("add");
+            auto root = m.get_match_root();
+            ov::replace_node(root, std::make_shared<ov::op::v1::Multiply>(root->input_value(0), root->input_value(1)));
+            return true;
+        };
+        register_matcher(std::make_shared<ov::pass::pattern::Matcher>(add, "TestAddToMultiply"), callback);
+    }
+};
+
+class TestVisitMultiply : public ov::pass::MatcherPass {
+public:
+    OPENVINO_MATCHER_PASS_RTTI("TestVisitMultiply");
+    explicit TestVisitMultiply(const VisitLog& log) {
+        auto multiply = ov::pass::pattern::wrap_type<ov::op::v1::Multiply>();
+        ov::matcher_pass_callback callback = [log](ov::pass::pattern::Matcher&) {
+            log->push_back("multiply");
+            return false;
+        };
+        register_matcher(std::make_shared<ov::pass::pattern::Matcher>(multiply, "TestVisitMultiply"), callback);
+    }
+};
+
+class TestVisitMultiplyRewrite : public ov::pass::GraphRewrite {
+public:
+    OPENVINO_GRAPH_REWRITE_RTTI("TestVisitMultiplyRewrite");
+    explicit TestVisitMultiplyRewrite(const VisitLog& log) {
+        add_matcher<TestVisitMultiply>(log);
+    }
+};
+
+size_t count_ops(const std::shared_ptr<ov::Model>& model, const ov::NodeTypeInfo& type_info) {
+    const auto ops = model->get_ops();
+    return std::count_if(ops.begin(), ops.end(), [&](const std::shared_ptr<ov::Node>& op) {
+        return op->get_type_info() == type_info;
+    });
+}
+
+TEST(pass_manager, Fused_matcher_passes) {
+    auto run = [](bool fused, VisitLog log) {
+        pass::Manager manager;
+        manager.set_fuse_matcher_passes(fused);
+        manager.register_pass<TestAddToMultiply>(log);
+        manager.register_pass<TestVisitMultiply>(log);
+        auto graph = make_test_graph();
+        EXPECT_TRUE(manager.run_passes(graph));
+        EXPECT_EQ(count_ops(graph, ov::op::v1::Add::get_type_info_static()), 0u);
+        EXPECT_EQ(count_ops(graph, ov::op::v1::Multiply::get_type_info_static()), 5u);
+    };
+    auto sequential = std::make_shared<std::vector<std::string>>();
+    auto fused = std::make_shared<std::vector<std::string>>();
+    run(false, sequential);
+    run(true, fused);
+
+    // the Multiply nodes created by the first pass are visited by the second one in both modes
+    EXPECT_EQ(std::count(fused->begin(), fused->end(), "add"), 4);
+    EXPECT_EQ(std::count(fused->begin(), fused->end(), "multiply"), 5);
+    EXPECT_EQ(std::count(sequential->begin(), sequential->end(), "multiply"), 5);
+    // the sequential passes traverse the graph one after another, the fused ones together
+    EXPECT_EQ(sequential->front(), "add");
+    EXPECT_EQ(sequential->back(), "multiply");
+    EXPECT_LT(std::find(fused->begin(), fused->end(), "multiply") - fused->begin(),
+              std::find(fused->rbegin(), fused->rend(), "add").base() - fused->begin());
+}
+
+TEST(pass_manager, Fused_matcher_passes_skip_disabled) {
+    auto log = std::make_shared<std::vector<std::string>>();
+    pass::Manager manager;
+    manager.set_fuse_matcher_passes(true);
+    manager.register_pass<TestAddToMultiply>(log);
+    manager.register_pass<TestVisitMultiply>(log);
+    manager.get_pass_config()->disable<TestAddToMultiply>();
+    auto graph = make_test_graph();
+
+    EXPECT_FALSE(manager.run_passes(graph));
+    EXPECT_EQ(*log, std::vector<std::string>{"multiply"});
+    EXPECT_EQ(count_ops(graph, ov::op::v1::Add::get_type_info_static()), 4u);
+}
+
+TEST(pass_manager, Fused_matcher_passes_derived_graph_rewrite_not_fused) {
+    auto log = std::make_shared<std::vector<std::string>>();
+    pass::Manager manager;
+    manager.set_fuse_matcher_passes(true);
+    manager.register_pass<TestAddToMultiply>(log);
+    manager.register_pass<TestVisitMultiplyRewrite>(log);
+    auto graph = make_test_graph();
+
+    EXPECT_TRUE(manager.run_passes(graph));
+    const std::vector<std::string> expected{"add", "add", "add", "add", "multiply", "multiply", "multiply", "multiply",
+                                            "multiply"};
+    EXPECT_EQ(*log, expected);
+}
+
+TEST(pass_manager, Fused_matcher_passes_validate) {
+    ValidateTestManager manager;
+    manager.set_fuse_matcher_passes(true);
+    auto log = std::make_shared<std::vector<std::string>>();
+
+    manager.register_pass<TestAddToMultiply>(log);
+    manager.register_pass<TestVisitMultiply>(log);
+    manager.register_pass<TestModelPassFalse>();
+    const auto res = manager.run_passes(make_test_graph());
+
+    EXPECT_TRUE(res);
+    // the validation between the fused passes is postponed till the end of the group
+    EXPECT_EQ(manager.get_num_validate_executed(), 1);
+}
+
 }  // namespace
 
 TEST(pass_manager, add) {
@@ -364,3 +481,28 @@ TEST(pass_manager, add) {
     EXPECT_EQ(node_count, sorted.size());
     EXPECT_TRUE(validate_list(sorted));
 }
+
+TEST(pass_manager, incremental_validation_keeps_mode_of_shared_validate) {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{1, 3});
+    auto add = std::make_shared<ov::op::v1::Add>(param, param);
+    auto multiply = std::make_shared<ov::op::v1::Multiply>(add, add);
+    auto model = std::make_shared<ov::Model>(ov::OutputVector{multiply}, ov::ParameterVector{param});
+    auto validate = std::make_shared<pass::Validate>();
+
+    pass::Manager incremental_manager;
+    incremental_manager.set_per_pass_validation(false);
+    incremental_manager.set_incremental_validation(true);
+    incremental_manager.register_pass<TestModelPassTrue>();
+    incremental_manager.register_pass_instance(validate);
+    incremental_manager.run_passes(model);
+    EXPECT_FALSE(validate->is_incremental());
+
+    // the shape set by hand is not a change the incremental validation sees, the full one recomputes it
+    multiply->set_output_type(0, ov::element::f32, ov::PartialShape{7});
+    pass::Manager manager;
+    manager.set_per_pass_validation(false);
+    manager.register_pass<TestModelPassTrue>();
+    manager.register_pass_instance(validate);
+    manager.run_passes(model);
+    EXPECT_EQ(multiply->get_output_partial_shape(0), ov::PartialShape({1, 3}));
+}
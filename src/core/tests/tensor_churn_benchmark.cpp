@@ -0,0 +1,99 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "openvino/runtime/allocator.hpp"
+#include "openvino/runtime/pooled_allocator.hpp"
+#include "openvino/runtime/tensor.hpp"
+
+// These benchmarks measure wall-clock timing and are meaningless in a Debug (-O0) build.
+#ifndef NDEBUG
+#    error \
+        "tensor_churn_benchmark.cpp must be built in Release mode: rebuild with -DCMAKE_BUILD_TYPE=Release, or delete this #error to build in Debug anyway."
+#endif
+
+namespace ov::test {
+
+namespace {
+
+// The tensors an infer request creates and releases per inference
+struct Request {
+    std::string name;
+    std::vector<std::pair<ov::element::Type, ov::Shape>> tensors;
+};
+
+std::vector<Request> make_requests() {
+    return {
+        {"small outputs", {{ov::element::f32, {1, 1000}}, {ov::element::i64, {1, 5}}, {ov::element::f32, {1, 4, 4}}}},
+        {"CNN 224x224", {{ov::element::f32, {1, 3, 224, 224}}, {ov::element::f32, {1, 1000}}}},
+        {"detection 640x640", {{ov::element::f32, {1, 3, 640, 640}}, {ov::element::f32, {1, 84, 8400}}}},
+        {"LLM logits", {{ov::element::i64, {1, 1}}, {ov::element::f32, {1, 1, 151936}}}},
+        {"1080p frames", {{ov::element::u8, {1, 1080, 1920, 3}}, {ov::element::f32, {1, 3, 1080, 1920}}}},
+    };
+}
+
+// tensors per second of the threads creating, touching and releasing the tensors of the request
+double churn(const Request& request, const ov::Allocator& allocator, size_t threads, size_t iterations) {
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&] {
+            for (size_t i = 0; i < iterations; ++i) {
+                for (const auto& [type, shape] : request.tensors) {
+                    ov::Tensor tensor(type, shape, allocator);
+                    // a page per 4 KiB is touched as the plugins write the outputs
+                    auto* data = static_cast<uint8_t*>(tensor.data());
+                    for (size_t offset = 0; offset < tensor.get_byte_size(); offset += 4096) {
+                        data[offset] = static_cast<uint8_t>(i);
+                    }
+                }
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    const auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return static_cast<double>(threads * iterations * request.tensors.size()) / seconds;
+}
+
+}  // namespace
+
+TEST(TensorChurnBenchmark, system_vs_pooled) {
+    constexpr size_t iterations = 2000;
+    const auto hw_threads = std::max(1u, std::thread::hardware_concurrency());
+
+    printf("\n--- Tensors created and released per second (thousands) ---\n");
+    printf("%-18s | %7s | %10s | %10s | %7s\n", "Request", "threads", "system", "pooled", "speedup");
+    printf("%-18s-|-%7s-|-%10s-|-%10s-|-%7s\n", "------------------", "-------", "----------", "----------", "-------");
+    for (const auto& request : make_requests()) {
+        for (const size_t threads : {size_t{1}, static_cast<size_t>(hw_threads)}) {
+            const auto system = churn(request, ov::Allocator{}, threads, iterations);
+            const auto pooled = churn(request, ov::get_pooled_allocator(), threads, iterations);
+            printf("%-18s | %7zu | %10.1f | %10.1f | %6.2fx\n",
+                   request.name.c_str(),
+                   threads,
+                   system / 1000,
+                   pooled / 1000,
+                   system > 0 ? pooled / system : 0.0);
+        }
+    }
+
+    const auto statistics = ov::get_pooled_allocator_statistics();
+    printf("\n--- Pooled allocator statistics ---\n");
+    for (const auto& [name, value] : statistics) {
+        printf("%-18s | %llu\n", name.c_str(), static_cast<unsigned long long>(value));
+    }
+    ov::release_pooled_allocator_memory();
+}
+
+}  // namespace ov::test
@@ -0,0 +1,179 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "openvino/runtime/itensor.hpp"
+#include "openvino/runtime/make_tensor.hpp"
+#include "openvino/runtime/tensor.hpp"
+
+// These benchmarks measure wall-clock timing and are meaningless in a Debug (-O0) build.
+#ifndef NDEBUG
+#    error \
+        "tensor_copy_benchmark.cpp must be built in Release mode: rebuild with -DCMAKE_BUILD_TYPE=Release, or delete this #error to build in Debug anyway."
+#endif
+
+namespace ov::test {
+
+namespace {
+
+// A source view of the common shapes the plugins copy from and to
+struct View {
+    std::string name;
+    ov::Tensor owner;
+    ov::Tensor view;
+};
+
+ov::Tensor make_owner(const ov::element::Type& type, const ov::Shape& shape) {
+    ov::Tensor tensor(type, shape);
+    auto* data = static_cast<uint8_t*>(tensor.data());
+    for (size_t i = 0; i < tensor.get_byte_size(); ++i) {
+        data[i] = static_cast<uint8_t>(i % 61);
+    }
+    return tensor;
+}
+
+View make_dense(const std::string& name, const ov::element::Type& type, const ov::Shape& shape) {
+    auto owner = make_owner(type, shape);
+    return {name, owner, owner};
+}
+
+View make_roi(const std::string& name,
+              const ov::element::Type& type,
+              const ov::Shape& shape,
+              const ov::Coordinate& begin,
+              const ov::Coordinate& end) {
+    auto owner = make_owner(type, shape);
+    return {name, owner, ov::Tensor(owner, begin, end)};
+}
+
+// NHWC data seen as NCHW, the innermost dimension is strided
+View make_nhwc_as_nchw(const std::string& name, const ov::element::Type& type, const ov::Shape& nchw) {
+    const auto n = nchw[0], c = nchw[1], h = nchw[2], w = nchw[3];
+    auto owner = make_owner(type, {n, h, w, c});
+    const auto s = type.size();
+    const ov::Strides strides{h * w * c * s, s, w * c * s, c * s};
+    return {name, owner, ov::Tensor(type, nchw, owner.data(), strides)};
+}
+
+// the best of the runs, the first run touches the destination pages
+double bench(const std::function<void()>& copy, int runs) {
+    double best_ms = 0;
+    for (int r = 0; r <= runs; ++r) {
+        const auto start = std::chrono::steady_clock::now();
+        copy();
+        const auto ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        if (r > 0) {
+            best_ms = r == 1 ? ms : std::min(best_ms, ms);
+        }
+    }
+    return best_ms;
+}
+
+void copy_to(const ov::Tensor& src, const ov::Tensor& dst, bool convert, size_t threads) {
+    ov::ITensor::CopyOptions options;
+    options.convert = convert;
+    options.threads = threads;
+    ov::get_tensor_impl(src)._ptr->copy_to(ov::get_tensor_impl(dst)._ptr, options);
+}
+
+std::vector<View> make_views(const ov::element::Type& type) {
+    std::vector<View> views;
+    views.push_back(make_dense("dense 8x3x640x640", type, {8, 3, 640, 640}));
+    views.push_back(make_roi("ROI 1080p -> 720p", type, {4, 3, 1080, 1920}, {0, 0, 180, 320}, {4, 3, 900, 1600}));
+    views.push_back(make_roi("batch 2 of 16", type, {16, 3, 640, 640}, {4, 0, 0, 0}, {6, 3, 640, 640}));
+    views.push_back(make_nhwc_as_nchw("NHWC as NCHW 1080p", type, {4, 3, 1080, 1920}));
+    views.push_back(make_roi("KV cache slice", type, {1, 32, 4096, 128}, {0, 0, 0, 0}, {1, 32, 2048, 128}));
+    return views;
+}
+
+}  // namespace
+
+TEST(TensorCopyBenchmark, views) {
+    constexpr int runs = 5;
+    printf("\n--- ITensor::copy_to of the f32 views (ms, best of %d runs) ---\n", runs);
+    printf("%-22s | %8s | %11s | %11s | %7s\n", "View", "MiB", "1 thread", "all threads", "speedup");
+    printf("%-22s-|-%8s-|-%11s-|-%11s-|-%7s\n",
+           "----------------------",
+           "--------",
+           "-----------",
+           "-----------",
+           "-------");
+    for (const auto& v : make_views(ov::element::f32)) {
+        ov::Tensor dst(ov::element::f32, v.view.get_shape());
+        const auto single_ms = bench(
+            [&] {
+                copy_to(v.view, dst, false, 1);
+            },
+            runs);
+        const auto parallel_ms = bench(
+            [&] {
+                copy_to(v.view, dst, false, 0);
+            },
+            runs);
+        printf("%-22s | %8.1f | %8.2f ms | %8.2f ms | %6.2fx\n",
+               v.name.c_str(),
+               static_cast<double>(dst.get_byte_size()) / (1 << 20),
+               single_ms,
+               parallel_ms,
+               parallel_ms > 0 ? single_ms / parallel_ms : 0.0);
+    }
+}
+
+TEST(TensorCopyBenchmark, fused_conversion) {
+    constexpr int runs = 5;
+    struct Case {
+        ov::element::Type src;
+        ov::element::Type dst;
+    };
+    const std::vector<Case> cases = {
+        {ov::element::f32, ov::element::f16},
+        {ov::element::f16, ov::element::f32},
+        {ov::element::f32, ov::element::bf16},
+        {ov::element::u8, ov::element::f32},
+    };
+
+    printf("\n--- Copy of the views with the conversion (ms, best of %d runs) ---\n", runs);
+    printf("%-22s | %-10s | %11s | %11s | %7s\n", "View", "Precision", "two passes", "fused", "speedup");
+    printf("%-22s-|-%-10s-|-%11s-|-%11s-|-%7s\n",
+           "----------------------",
+           "----------",
+           "-----------",
+           "-----------",
+           "-------");
+    for (const auto& c : cases) {
+        const auto precision = c.src.get_type_name() + "->" + c.dst.get_type_name();
+        for (const auto& v : make_views(c.src)) {
+            ov::Tensor staging(c.src, v.view.get_shape());
+            ov::Tensor dst(c.dst, v.view.get_shape());
+            // the copy to a dense tensor followed by the conversion
+            const auto two_passes_ms = bench(
+                [&] {
+                    copy_to(v.view, staging, false, 0);
+                    copy_to(staging, dst, true, 0);
+                },
+                runs);
+            const auto fused_ms = bench(
+                [&] {
+                    copy_to(v.view, dst, true, 0);
+                },
+                runs);
+            printf("%-22s | %-10s | %8.2f ms | %8.2f ms | %6.2fx\n",
+                   v.name.c_str(),
+                   precision.c_str(),
+                   two_passes_ms,
+                   fused_ms,
+                   fused_ms > 0 ? two_passes_ms / fused_ms : 0.0);
+        }
+    }
+}
+
+}  // namespace ov::test
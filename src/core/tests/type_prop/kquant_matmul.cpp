@@ -0,0 +1,71 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/op/kquant_matmul.hpp"
+
+#include <gtest/gtest.h>
+
+#include "common_test_utils/test_assertions.hpp"
+#include "openvino/openvino.hpp"
+
+namespace ov::test {
+using op::internal::KQuantMatMul;
+
+TEST(type_prop, kquant_matmul_static_q4_k) {
+    auto data = std::make_shared<op::v0::Parameter>(element::f32, Shape{1, 3, 512});
+    auto weights = std::make_shared<op::v0::Parameter>(element::u8, Shape{64, 2 * 144});
+    const auto op = std::make_shared<KQuantMatMul>(data, weights, KQuantMatMul::QuantType::Q4_K);
+
+    EXPECT_EQ(op->get_output_element_type(0), element::f32);
+    EXPECT_EQ(op->get_output_partial_shape(0), PartialShape(Shape{1, 3, 64}));
+}
+
+TEST(type_prop, kquant_matmul_dynamic_rows_q6_k) {
+    auto data = std::make_shared<op::v0::Parameter>(element::f16, PartialShape{-1, -1, 256});
+    auto weights = std::make_shared<op::v0::Parameter>(element::u8, Shape{32, 210});
+    const auto op = std::make_shared<KQuantMatMul>(data, weights, KQuantMatMul::QuantType::Q6_K);
+
+    EXPECT_EQ(op->get_output_element_type(0), element::f16);
+    EXPECT_EQ(op->get_output_partial_shape(0), PartialShape({-1, -1, 32}));
+}
+
+TEST(type_prop, kquant_matmul_dynamic_rank) {
+    auto data = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic());
+    auto weights = std::make_shared<op::v0::Parameter>(element::u8, Shape{32, 176});
+    const auto op = std::make_shared<KQuantMatMul>(data, weights, KQuantMatMul::QuantType::Q5_K);
+
+    EXPECT_EQ(op->get_output_partial_shape(0), PartialShape::dynamic());
+}
+
+TEST(type_prop, kquant_matmul_block_bytes) {
+    EXPECT_EQ(KQuantMatMul::get_block_bytes(KQuantMatMul::QuantType::Q4_K), 144);
+    EXPECT_EQ(KQuantMatMul::get_block_bytes(KQuantMatMul::QuantType::Q5_K), 176);
+    EXPECT_EQ(KQuantMatMul::get_block_bytes(KQuantMatMul::QuantType::Q6_K), 210);
+}
+
+TEST(type_prop, kquant_matmul_k_not_multiple_of_block) {
+    auto data = std::make_shared<op::v0::Parameter>(element::f32, Shape{1, 100});
+    auto weights = std::make_shared<op::v0::Parameter>(element::u8, Shape{32, 144});
+    OV_EXPECT_THROW(std::ignore = std::make_shared<KQuantMatMul>(data, weights, KQuantMatMul::QuantType::Q4_K),
+                    NodeValidationFailure,
+                    testing::HasSubstr("multiple of 256"));
+}
+
+TEST(type_prop, kquant_matmul_row_bytes_mismatch) {
+    auto data = std::make_shared<op::v0::Parameter>(element::f32, Shape{1, 256});
+    auto weights = std::make_shared<op::v0::Parameter>(element::u8, Shape{32, 144});
+    OV_EXPECT_THROW(std::ignore = std::make_shared<KQuantMatMul>(data, weights, KQuantMatMul::QuantType::Q6_K),
+                    NodeValidationFailure,
+                    testing::HasSubstr("row must hold 210 bytes"));
+}
+
+TEST(type_prop, kquant_matmul_wrong_weights_type) {
+    auto data = std::make_shared<op::v0::Parameter>(element::f32, Shape{1, 256});
+    auto weights = std::make_shared<op::v0::Parameter>(element::i8, Shape{32, 144});
+    OV_EXPECT_THROW(std::ignore = std::make_shared<KQuantMatMul>(data, weights, KQuantMatMul::QuantType::Q4_K),
+                    NodeValidationFailure,
+                    testing::HasSubstr("should be u8"));
+}
+
+}  // namespace ov::test
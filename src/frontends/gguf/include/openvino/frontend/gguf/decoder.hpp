@@ -141,6 +141,12 @@ public:
     // cgraph path) or with already-extracted weight/scales/zp tensors (get_attribute<bool>(
     // "gguf_weight") + "gguf.blob.<sub>" + "gguf_qtype", the native .gguf builder path).
     // translate_weight accepts both and builds the same compressed decompression subgraph.
+    //
+    // The "data" tensor is referenced, not copied, whenever the weight needs no conversion (F32,
+    // F16, BF16, packed MXFP4 experts and "native_kquant" K-quants): the resulting Constant keeps
+    // the tensor alive. A decoder reading a .gguf file should therefore pass each tensor's region
+    // as an mmap-backed ov::read_tensor_data(path, ov::element::u8, {bsize}, data_offset + offset)
+    // so compile_model pages weights in on demand and processes share the file's page cache.
 
 protected:
     // Shared empty map backing the optional accessors above, which return by const reference.
@@ -4,6 +4,7 @@
 
 #include "node_context.hpp"
 #include "op_table.hpp"
+#include "quant/weights.hpp"
 #include "utils.hpp"
 
 #include <climits>
@@ -15,6 +16,7 @@
 #include "openvino/op/concat.hpp"
 #include "openvino/op/constant.hpp"
 #include "openvino/op/convert.hpp"
+#include "openvino/op/kquant_matmul.hpp"
 #include "openvino/op/matmul.hpp"
 #include "openvino/op/reshape.hpp"
 #include "openvino/op/slice.hpp"
@@ -37,6 +39,16 @@ OutputVector translate_mulmat(const NodeContext & context) {
     ov::Output<ov::Node> B = context.get_input(0);
     ov::Output<ov::Node> A = context.get_input(1);
 
+    // Packed K-quant weight (see translate_weight "native_kquant"): multiply against the raw
+    // super-blocks directly. KQuantMatMul takes the activations as [..., K] and the weights as
+    // [N, row_bytes], which is exactly MUL_MAT's transpose_b layout, and yields [..., N].
+    if (op_case != 2 && op_case != 3) {
+        if (auto kquant_type = get_packed_kquant_type(B)) {
+            res = std::make_shared<ov::op::internal::KQuantMatMul>(A, B, *kquant_type);
+            return rename_outputs_with_suffix({res}, context.get_name());
+        }
+    }
+
     bool transpose_b = true;
     if (op_case == 2) {
         B = B.get_node_shared_ptr()->input_value(0);
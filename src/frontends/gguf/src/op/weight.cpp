@@ -33,7 +33,8 @@ namespace op {
 //
 //   2. llama.cpp cgraph path: the node carries the raw ggml bytes in "data" plus the ggml type
 //      name "quant_type"; make_weight_node(data, quant_type, shape) re-extracts and builds. This
-//      path also handles the MoE MXFP4 packed / rank>2 expert-weight layouts.
+//      path also handles the MoE MXFP4 packed / rank>2 expert-weight layouts and, when the decoder
+//      sets "native_kquant", keeps Q4_K/Q5_K/Q6_K matmul weights packed for KQuantMatMul.
 //
 // (Model-input leaves are also GGML_OP_NONE, but they are resolved to Parameters before the graph
 // walk and never reach this translator.)
@@ -67,7 +68,8 @@ OutputVector translate_weight(const NodeContext& context) {
     // MoE MXFP4 expert weights stay PACKED: MUL_MAT_ID gathers the selected expert and dequantizes
     // on-graph, so materializing all experts to f32 here would waste memory. Surface the raw bytes
     // as a rank-5 u8 constant [1, n_expert, m, k_blocks, 17] (17 = 1 e8m0 scale byte + 16 nibble
-    // bytes per 32-element block), which the mul_mat_id MXFP4 path recognizes.
+    // bytes per 32-element block), which the mul_mat_id MXFP4 path recognizes. The constant shares
+    // the decoder's bytes rather than copying every expert.
     if (shape.size() > 2 && quant_type == "MXFP4") {
         constexpr size_t kQk = 32, kBlockBytes = 17;
         const size_t n_expert = shape[shape.size() - 3];
@@ -78,10 +80,20 @@ OutputVector translate_weight(const NodeContext& context) {
         ov::Shape packed_shape{1, n_expert, m, k_blocks, kBlockBytes};
         FRONT_END_OP_CONVERSION_CHECK(data.get_byte_size() == n_expert * m * k_blocks * kBlockBytes,
                                       "MXFP4 MoE packed byte size mismatch");
-        auto packed = std::make_shared<ov::op::v0::Constant>(ov::element::u8, packed_shape, data.data());
+        auto packed = make_shared_weight_constant(data, ov::element::u8, packed_shape);
         return rename_outputs_with_suffix({packed}, context.get_name());
     }
 
+    // Native K-quant opt-in: a decoder that knows every consumer of this leaf is a MUL_MAT marks it
+    // "native_kquant". Q4_K/Q5_K/Q6_K bytes then stay packed (and shared with the decoder's buffer)
+    // and MUL_MAT emits ov::op::internal::KQuantMatMul instead of the Q8_0_C / u4 decompression
+    // subgraph below, which remains the serializable default.
+    if (context.get_attribute<bool>("native_kquant", false)) {
+        if (auto packed = make_packed_kquant_weight(data, quant_type, shape)) {
+            return rename_outputs_with_suffix({packed}, context.get_name());
+        }
+    }
+
     // MoE expert weights are rank > 2 ([1, n_expert, m, k]). The dequant path works on a 2D
     // [rows, cols] tensor, so flatten the leading dims to rows, dequantize, then reshape the f32
     // result back to the full expert shape for MUL_MAT_ID. (Regular weights are already 2D.)
@@ -17,6 +17,7 @@
 #include <vector>
 
 #include "openvino/core/except.hpp"
+#include "openvino/core/memory_util.hpp"
 #include "openvino/core/type/float16.hpp"
 #include "openvino/decompositions/low_precision_dequantize.hpp"
 #include "openvino/op/constant.hpp"
@@ -27,6 +28,7 @@
 #include "openvino/op/subtract.hpp"
 #include "openvino/pass/constant_folding.hpp"
 #include "openvino/pass/manager.hpp"
+#include "openvino/runtime/shared_buffer.hpp"
 
 namespace ov {
 namespace frontend {
@@ -90,11 +92,7 @@ ov::Shape per_group_shape(const ov::Shape& orig, size_t num_groups) {
 std::shared_ptr<ov::op::v0::Constant> make_compressed_weight_constant(ov::element::Type et,
                                                                       const ov::Shape& shape,
                                                                       const ov::Tensor& weight) {
-    // Shared-buffer ctor: the Constant wraps the bytes without copying and keeps the Tensor alive.
-    return std::make_shared<ov::op::v0::Constant>(et,
-                                                  shape,
-                                                  static_cast<const void*>(weight.data()),
-                                                  std::make_shared<ov::Tensor>(weight));
+    return make_shared_weight_constant(weight, et, shape);
 }
 
 // Q4_0 symmetric: i4 weights (XOR-converted from u4) + f16 scale, no zero-point.
@@ -494,6 +492,24 @@ std::shared_ptr<ov::Node> make_weight_node(const std::string& base,
 }
 
 
+std::shared_ptr<ov::op::v0::Constant> make_shared_weight_constant(const ov::Tensor& data,
+                                                                  ov::element::Type et,
+                                                                  const ov::Shape& shape) {
+    const size_t byte_size = ov::util::get_memory_size(et, ov::shape_size(shape));
+    OPENVINO_ASSERT(data.get_byte_size() >= byte_size,
+                    "[GGUF] weight payload holds ",
+                    data.get_byte_size(),
+                    " bytes, ",
+                    et,
+                    shape,
+                    " needs ",
+                    byte_size);
+    // The cast only lets the buffer store the pointer; the bytes are never written through it.
+    auto* bytes = const_cast<char*>(static_cast<const char*>(data.data()));
+    auto buffer = std::make_shared<ov::SharedBuffer<ov::Tensor>>(bytes, byte_size, data);
+    return std::make_shared<ov::op::v0::Constant>(et, shape, buffer);
+}
+
 gguf_tensor_type gguf_type_from_name(const std::string& quant_type) {
     static const std::unordered_map<std::string, gguf_tensor_type> names = {{"F32", GGUF_TYPE_F32},
                                                                             {"F16", GGUF_TYPE_F16},
@@ -522,6 +538,56 @@ gguf_tensor_type gguf_type_from_name(const std::string& quant_type) {
     return it->second;
 }
 
+namespace {
+// rt_info key tagging a packed K-quant weight Constant with its KQuantMatMul quant type name.
+constexpr const char* kPackedKQuantKey = "gguf_packed_kquant";
+}  // namespace
+
+std::shared_ptr<ov::Node> make_packed_kquant_weight(const ov::Tensor& data,
+                                                    const std::string& quant_type,
+                                                    const ov::Shape& logical_shape) {
+    using QuantType = ov::op::internal::KQuantMatMul::QuantType;
+    if (logical_shape.size() != 2 || logical_shape[1] % 256 != 0) {
+        return nullptr;
+    }
+    QuantType kquant_type;
+    switch (gguf_type_from_name(quant_type)) {
+    case GGUF_TYPE_Q4_K:
+        kquant_type = QuantType::Q4_K;
+        break;
+    case GGUF_TYPE_Q5_K:
+        kquant_type = QuantType::Q5_K;
+        break;
+    case GGUF_TYPE_Q6_K:
+        kquant_type = QuantType::Q6_K;
+        break;
+    default:
+        return nullptr;
+    }
+    const size_t rows = logical_shape[0];
+    const size_t row_bytes = logical_shape[1] / 256 * ov::op::internal::KQuantMatMul::get_block_bytes(kquant_type);
+    OPENVINO_ASSERT(data.get_byte_size() == rows * row_bytes,
+                    "[GGUF] packed ",
+                    quant_type,
+                    " weight holds ",
+                    data.get_byte_size(),
+                    " bytes, expected ",
+                    rows * row_bytes);
+
+    auto packed = make_shared_weight_constant(data, ov::element::u8, ov::Shape{rows, row_bytes});
+    packed->get_rt_info()[kPackedKQuantKey] = ov::as_string(kquant_type);
+    return packed;
+}
+
+std::optional<ov::op::internal::KQuantMatMul::QuantType> get_packed_kquant_type(const ov::Output<ov::Node>& weight) {
+    const auto& rt_info = weight.get_node()->get_rt_info();
+    auto it = rt_info.find(kPackedKQuantKey);
+    if (it == rt_info.end() || weight.get_element_type() != ov::element::u8) {
+        return std::nullopt;
+    }
+    return ov::as_enum<ov::op::internal::KQuantMatMul::QuantType>(it->second.as<std::string>());
+}
+
 std::array<FusedQkvPart, 3> split_fused_qkv_extracted(
     const std::string& base,
     const std::unordered_map<std::string, ov::Tensor>& weights,
@@ -618,15 +684,19 @@ std::shared_ptr<ov::Node> make_weight_node(const ov::Tensor& data,
 
     const std::string base = "weight";
 
-    // Non-quantized weights: wrap the bytes directly as a Constant of the matching type.
+    // Non-quantized weights need no conversion: share the decoder's bytes as a Constant of the
+    // matching type (no copy, and the Constant keeps `data` -- possibly an mmap of the .gguf --
+    // alive). The plugin sees the f16/bf16 Constant -> Convert as a compressed weight.
     if (qtype == GGUF_TYPE_F32 || qtype == GGUF_TYPE_F16 || qtype == GGUF_TYPE_BF16) {
         ov::element::Type et = qtype == GGUF_TYPE_F32   ? ov::element::f32
                                : qtype == GGUF_TYPE_F16 ? ov::element::f16
                                                         : ov::element::bf16;
-        ov::Tensor typed(et, logical_shape, data.data());
-        std::unordered_map<std::string, ov::Tensor> w{{base + ".weight", typed}};
-        std::unordered_map<std::string, gguf_tensor_type> q{{base + ".qtype", qtype}};
-        return make_weight_node(base, w, q);
+        std::shared_ptr<ov::Node> node = make_shared_weight_constant(data, et, logical_shape);
+        if (et != ov::element::f32) {
+            node = std::make_shared<ov::op::v0::Convert>(node, ov::element::f32);
+        }
+        node->set_friendly_name(base + ".weight");
+        return node;
     }
 
     // Quantized weights: run the matching fill function to extract weights/scales/zp into
@@ -6,14 +6,14 @@
 
 #include <array>
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 
 #include "gguf.hpp"
-
-namespace ov {
-class Node;
-}
+#include "openvino/core/node_output.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/kquant_matmul.hpp"
 
 namespace ov::frontend::gguf {
 
@@ -50,9 +50,30 @@ std::shared_ptr<ov::Node> make_weight_node(const ov::Tensor& data,
                                            const ov::Shape& logical_shape,
                                            const std::string& name = "");
 
+// Wrap `data`'s bytes as a Constant of type `et` and `shape` without copying. The Constant holds a
+// reference to `data`, so when the decoder hands over a memory-mapped tensor (e.g. a region of the
+// .gguf opened with ov::read_tensor_data(path, u8, {bsize}, offset)) the weight stays backed by the
+// page cache: loading is page-fault driven and processes mapping the same file share its pages.
+// Throws if `data` holds fewer bytes than `shape` needs.
+std::shared_ptr<ov::op::v0::Constant> make_shared_weight_constant(const ov::Tensor& data,
+                                                                  ov::element::Type et,
+                                                                  const ov::Shape& shape);
+
 // Map a ggml quant type name (e.g. "Q4_K") to its gguf_tensor_type id. Throws if unknown.
 gguf_tensor_type gguf_type_from_name(const std::string& quant_type);
 
+// Wrap the raw bytes of a 2D Q4_K/Q5_K/Q6_K weight as a PACKED u8 Constant
+// [rows, cols / 256 * block_bytes] that shares `data`'s memory (no dequant, no copy), so a
+// memory-mapped GGUF keeps its 4.5-6.5 bits per weight at runtime. Only MUL_MAT consumes it,
+// through ov::op::internal::KQuantMatMul. Returns nullptr for any other quant type or shape.
+std::shared_ptr<ov::Node> make_packed_kquant_weight(const ov::Tensor& data,
+                                                    const std::string& quant_type,
+                                                    const ov::Shape& logical_shape);
+
+// The KQuantMatMul quant type of a weight built by make_packed_kquant_weight, or nullopt for
+// any other node.
+std::optional<ov::op::internal::KQuantMatMul::QuantType> get_packed_kquant_type(const ov::Output<ov::Node>& weight);
+
 // One split part of a fused attn_qkv weight: the extracted tensors keyed as "<part>.weight"
 // [+ ".scales" [+ ".zp"]] plus the shared quant type. Used by the GGUF builder to emit a
 // GGML_OP_NONE weight leaf per q/k/v part (routing them through translate_weight like any other
@@ -12,9 +12,17 @@
 // test_dequant_vs_ggml.cpp.
 
 #include <cmath>
+#include <cstdio>
 #include <cstring>
+#include <fstream>
+#include <memory>
 
+#include "common_test_utils/common_utils.hpp"
 #include "op_test_utils.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/kquant_matmul.hpp"
+#include "openvino/op/parameter.hpp"
+#include "quant/weights.hpp"
 
 using namespace ov_gguf_test;
 
@@ -176,6 +184,61 @@ TEST(GGUFWeightPlain, BF16) {
         EXPECT_NEAR(a[i], static_cast<float>(vals[i]), 1e-6f);
 }
 
+// Plain weights need no conversion, so the Constant references the decoder's bytes instead of
+// copying them and keeps the payload alive after the decoder drops its handle.
+TEST(GGUFWeightPlain, F16SharesDecoderBytes) {
+    std::vector<ov::float16> vals{1.0f, -2.0f, 3.5f, -4.25f, 0.0f, 7.0f};
+    auto data = std::make_unique<ov::Tensor>(ov::element::u8, ov::Shape{vals.size() * sizeof(ov::float16)});
+    std::memcpy(data->data(), vals.data(), data->get_byte_size());
+    const void* bytes = data->data();
+
+    auto node = make_weight_node(*data, "F16", ov::Shape{2, 3}, "blk.0.attn_q.weight");
+    data.reset();
+
+    auto cnst = ov::as_type_ptr<ov::op::v0::Constant>(node->get_input_node_shared_ptr(0));
+    ASSERT_NE(cnst, nullptr);
+    EXPECT_EQ(cnst->get_element_type(), ov::element::f16);
+    EXPECT_EQ(cnst->get_data_ptr(), bytes);
+    const auto* w = cnst->get_data_ptr<ov::float16>();
+    for (size_t i = 0; i < vals.size(); ++i)
+        EXPECT_EQ(w[i], vals[i]);
+}
+
+// A decoder reading a .gguf file passes each tensor's region as an mmap-backed tensor; the weight
+// is compiled and executed straight from the mapping.
+TEST(GGUFWeightPlain, F16FromMappedFile) {
+    std::vector<ov::float16> vals{1.0f, -2.0f, 3.5f, -4.25f, 0.0f, 7.0f};
+    constexpr size_t data_offset = 32;  // GGUF aligns the tensor data section to 32 bytes
+    const auto path = ov::test::utils::generateTestFilePrefix() + "_gguf_f16_weight.bin";
+    {
+        std::ofstream out(path, std::ios::binary);
+        const std::vector<char> header(data_offset, 0);
+        out.write(header.data(), header.size());
+        out.write(reinterpret_cast<const char*>(vals.data()), vals.size() * sizeof(ov::float16));
+    }
+
+    {
+        auto data = ov::read_tensor_data(path,
+                                         ov::element::u8,
+                                         ov::PartialShape{static_cast<int64_t>(vals.size() * sizeof(ov::float16))},
+                                         data_offset,
+                                         true);
+        auto model = SingleOpBuilder()
+                         .op("GGML_OP_NONE")
+                         .output("w", ov::element::f32, {2, 3})
+                         .attr<ov::Tensor>("data", data)
+                         .attr<std::string>("quant_type", "F16")
+                         .build();
+
+        auto out = run_on_cpu(model, {});
+        ASSERT_EQ(out.get_size(), vals.size());
+        const float* a = out.data<float>();
+        for (size_t i = 0; i < vals.size(); ++i)
+            EXPECT_NEAR(a[i], static_cast<float>(vals[i]), 1e-6f);
+    }
+    std::remove(path.c_str());
+}
+
 // Contract tests for the two ggml types that are NOT supported as stored GGUF *weights*.
 //
 // Q8_K is a ggml intermediate activation-quantization type: it only ever appears as the
@@ -215,3 +278,80 @@ TEST(GGUFWeightUnsupported, Mxfp4TwoDimIsNotAStoredWeight) {
             .build();
     });
 }
+
+// With "native_kquant" a K-quant weight leaf is not dequantized: translate_weight surfaces the raw
+// super-blocks as a packed u8 constant for MUL_MAT's KQuantMatMul, byte for byte.
+TEST(GGUFPackedKQuantLeaf, WeightLeafStaysPacked) {
+    const auto qbytes = load_npy<uint8_t>("q4_k_qbytes");
+
+    auto model = SingleOpBuilder()
+                     .op("GGML_OP_NONE")
+                     .output("w", ov::element::f32, {kRows, kCols})
+                     .attr<ov::Tensor>("data", bytes_to_u8_tensor(qbytes))
+                     .attr<std::string>("quant_type", "Q4_K")
+                     .attr<bool>("native_kquant", true)
+                     .build();
+
+    auto packed = ov::as_type_ptr<ov::op::v0::Constant>(model->get_results()[0]->get_input_node_shared_ptr(0));
+    ASSERT_NE(packed, nullptr);
+    ASSERT_EQ(packed->get_element_type(), ov::element::u8);
+    EXPECT_EQ(packed->get_shape(), (ov::Shape{kRows, kCols / 256 * 144}));
+    ASSERT_EQ(packed->get_byte_size(), qbytes.size());
+    EXPECT_EQ(std::memcmp(packed->get_data_ptr(), qbytes.data(), qbytes.size()), 0);
+    EXPECT_EQ(get_packed_kquant_type(packed), ov::op::internal::KQuantMatMul::QuantType::Q4_K);
+}
+
+// Types without a native kernel ignore the opt-in and keep the regular decompression subgraph.
+TEST(GGUFPackedKQuantLeaf, OtherTypesAreNotPacked) {
+    ov::Tensor data(ov::element::u8, ov::Shape{kRows * kCols / 32 * 18});
+    EXPECT_EQ(make_packed_kquant_weight(data, "Q4_0", ov::Shape{kRows, kCols}), nullptr);
+    EXPECT_EQ(make_packed_kquant_weight(data, "Q4_K", ov::Shape{kRows, 100}), nullptr);
+}
+
+class GGUFPackedKQuant : public ::testing::TestWithParam<WeightCase> {};
+
+// KQuantMatMul over the packed bytes matches a matmul against ggml's faithful to_float: unlike the
+// Q8_0_C / integer-zp paths above, no requantization error is introduced.
+TEST_P(GGUFPackedKQuant, MatMulMatchesGgmlToFloat) {
+    const WeightCase c = GetParam();
+    const auto qbytes = load_npy<uint8_t>(std::string(c.stem) + "_qbytes");
+    const auto ref = load_npy<float>(std::string(c.stem) + "_deq");
+    ASSERT_EQ(ref.size(), kRows * kCols);
+
+    auto weights = make_packed_kquant_weight(bytes_to_u8_tensor(qbytes), c.quant_type, ov::Shape{kRows, kCols});
+    ASSERT_NE(weights, nullptr);
+    const auto quant_type = get_packed_kquant_type(weights);
+    ASSERT_TRUE(quant_type.has_value());
+
+    constexpr size_t tokens = 3;
+    auto x = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{tokens, kCols});
+    x->set_friendly_name("x");
+    x->output(0).set_names({"x"});
+    auto matmul = std::make_shared<ov::op::internal::KQuantMatMul>(x, weights, *quant_type);
+    auto model = std::make_shared<ov::Model>(ov::OutputVector{matmul}, ov::ParameterVector{x});
+
+    std::vector<float> act(tokens * kCols);
+    for (size_t i = 0; i < act.size(); ++i) {
+        act[i] = std::sin(0.37f * static_cast<float>(i));
+    }
+    auto out = run_on_cpu(model, {{"x", make_f32_tensor({tokens, kCols}, act)}});
+
+    std::vector<float> expected(tokens * kRows, 0.f);
+    for (size_t t = 0; t < tokens; ++t) {
+        for (size_t r = 0; r < kRows; ++r) {
+            for (size_t k = 0; k < kCols; ++k) {
+                expected[t * kRows + r] += act[t * kCols + k] * ref[r * kCols + k];
+            }
+        }
+    }
+    expect_near(out, expected, c.tol, 1e-4f);
+}
+
+INSTANTIATE_TEST_SUITE_P(KQuantTypes,
+                         GGUFPackedKQuant,
+                         ::testing::Values(WeightCase{"q4_k", "Q4_K", kTolFaithful},
+                                           WeightCase{"q5_k", "Q5_K", kTolFaithful},
+                                           WeightCase{"q6_k", "Q6_K", kTolFaithful}),
+                         [](const ::testing::TestParamInfo<WeightCase>& i) {
+                             return std::string(i.param.stem);
+                         });
@@ -5,6 +5,7 @@
 #include "openvino/frontend/ir/frontend.hpp"
 
 #include <array>
+#include <future>
 #include <optional>
 #include <pugixml.hpp>
 #include <vector>
@@ -17,6 +18,7 @@
 #include "openvino/runtime/shared_buffer.hpp"
 #include "openvino/util/file_util.hpp"
 #include "openvino/util/mmap_object.hpp"
+#include "openvino/util/parallel_read_streambuf.hpp"
 #include "openvino/util/xml_parse_utils.hpp"
 #include "transformations/fp16_compression/convert_legacy_precision_attribute.hpp"
 #include "transformations/resolve_names_collisions.hpp"
@@ -154,6 +156,7 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
     std::istream* provided_model_stream = nullptr;
     std::shared_ptr<ov::AlignedBuffer> model_buf;
     std::shared_ptr<ov::AlignedBuffer> weights;
+    std::future<void> weights_read;
 
     auto create_extensions_map = [&]() -> std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr> {
         std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr> exts;
@@ -225,10 +228,18 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
         } else if (std::ifstream bin_stream(weights_path, std::ios::binary); bin_stream.is_open()) {
             bin_stream.seekg(0, std::ios::end);
             size_t file_size = bin_stream.tellg();
-            bin_stream.seekg(0, std::ios::beg);
+            bin_stream.close();
 
             auto aligned_weights_buffer = std::make_shared<ov::AlignedBuffer>(file_size);
-            bin_stream.read(aligned_weights_buffer->get_ptr<char>(), aligned_weights_buffer->size());
+            // the weights are read in chunks by several threads while the xml is parsed, nothing reads them before
+            // the model is converted
+            weights_read = std::async(std::launch::async, [aligned_weights_buffer, weights_path] {
+                ov::util::ParallelReadStreamBuf buffer(weights_path);
+                std::istream stream(&buffer);
+                const auto size = static_cast<std::streamsize>(aligned_weights_buffer->size());
+                stream.read(aligned_weights_buffer->get_ptr<char>(), size);
+                OPENVINO_ASSERT(stream.gcount() == size, "Cannot read ", size, " bytes from ", weights_path);
+            });
 
             weights = std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::AlignedBuffer>>>(
                 aligned_weights_buffer->get_ptr<char>(),
@@ -244,7 +255,10 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
         }
     }
 
-    return create_input_model(std::move(weights_path));
+    auto input_model = create_input_model(std::move(weights_path));
+    if (weights_read.valid())
+        weights_read.get();
+    return input_model;
 }
 
 std::shared_ptr<ov::Model> FrontEnd::convert(const InputModel::Ptr& model) const {
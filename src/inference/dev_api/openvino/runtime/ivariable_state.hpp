@@ -51,6 +51,28 @@ public:
      */
     virtual ov::SoPtr<ov::ITensor> get_state() const;
 
+    /**
+     * @brief Makes the state take the value of another state of the same variable, e.g. of another infer request of
+     * the same compiled model or of a snapshot. The default implementation copies the value with set_state(), plugins
+     * may share the memory of the states until one of them is modified instead.
+     * @param source The state to take the value from
+     */
+    virtual void fork(const ov::SoPtr<ov::IVariableState>& source);
+
+    /**
+     * @brief Captures the current value of the state, which is not changed by the following inferences and can be
+     * given to fork() later. The default implementation copies the value.
+     * @return The captured state
+     */
+    virtual ov::SoPtr<ov::IVariableState> snapshot();
+
+    /**
+     * @brief Keeps the first \p length elements of the sequence stored by the state, e.g. the tokens of a KV cache,
+     * and drops the following ones. Not implemented by default.
+     * @param length The new length of the sequence
+     */
+    virtual void truncate(size_t length);
+
 protected:
     /**
      * @brief A default dtor
@@ -4,6 +4,12 @@
 
 #pragma once
 
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <utility>
+#include <vector>
+
 #include "openvino/core/weight_sharing_util.hpp"
 #include "openvino/runtime/icache_manager.hpp"
 #include "openvino/runtime/tlv_format.hpp"
@@ -19,12 +25,18 @@ public:
         String = 0x02,
         Blob = 0x03,
         BlobMap = 0x04,
+        BlobRemoved = 0x05,
+        BlobAccess = 0x06,
+        BlobIndex = 0x07,
         ConstantMeta = 0x10,
         WeightSource = 0x11,
     };
 
     explicit SingleFileStorage(const std::filesystem::path& path);
 
+    /** @brief Appends the pending access records to the storage file. */
+    ~SingleFileStorage() override;
+
     /**
      * @brief Write a cache entry to the storage.
      * @param blob_id The identifier of the blob.
@@ -42,11 +54,31 @@ public:
 
     /**
      * @brief Remove a cache entry from the storage.
-     * @note This function does nothing - the storage is append-only.
+     * @note The storage is append-only, so the blob is only marked as removed. Its data is dropped by compaction.
      * @param blob_id The identifier of the blob to be removed.
      */
     void remove_cache_entry(const std::string& blob_id) override;
 
+    /**
+     * @brief Rewrite live records into a new file and atomically replace the storage file with it.
+     * Removed blobs and access records are dropped, the remaining blobs are realigned to blob_alignment and followed by
+     * a blob index record, so the next initialization loads the index instead of scanning every blob record.
+     * If the size budget is set, the least recently used blobs are evicted until the file fits the budget.
+     * Reads of the storage wait until the compaction is done.
+     * @return True if the storage file has been replaced, false if the file could not be swapped (e.g. it is mapped on
+     * a platform which doesn't allow renaming over mapped files). The storage stays usable in both cases.
+     */
+    bool compact();
+
+    /**
+     * @brief Set the size budget of the storage file.
+     * When the budget is set and the file exceeds it after writing a cache entry, the storage is compacted online.
+     * A cache entry which doesn't fit the budget next to the context records alone is not stored.
+     * The budget is set by the ov::cache_size_budget core property.
+     * @param size_budget Maximum size of the storage file in bytes, 0 means unlimited.
+     */
+    void set_size_budget(uint64_t size_budget);
+
     /**
      * @brief Write the weight sharing context to the storage.
      * @param context The weight sharing context to be stored.
@@ -74,13 +106,30 @@ private:
         uint64_t offset;
         uint64_t size;
         std::string model_name;
+        uint64_t last_access;
     };
+    // Readers share the lock for the whole read, as compaction moves the blobs. Writers, removal and compaction append
+    // to or replace the file and hold it exclusively.
+    mutable std::shared_mutex m_index_mutex;
     std::unordered_map<BlobIdType, BlobInfo> m_blob_index;
     std::shared_ptr<wsh::Context> m_shared_context;
+    std::atomic<uint64_t> m_access_clock{0};  // logical clock ordering blob accesses for LRU eviction
+    std::atomic<uint64_t> m_size_budget{0};
+    // upper bound of the version and context records in the compacted file, a blob which doesn't fit next to them is not
+    // kept
+    uint64_t m_context_size = 0;
+    // accesses not yet applied to the index and appended to the file, flushed in batches
+    std::mutex m_access_mutex;
+    std::vector<std::pair<BlobIdType, uint64_t>> m_pending_accesses;
+    static constexpr size_t access_batch_size = 64;
     bool build_content_index(std::ifstream& stream);
 
     static BlobIdType convert_blob_id(const std::string& blob_id);
     void write_blob_entry(std::fstream& stream, BlobIdType blob_id, StreamWriter& writer);
     bool has_blob_id(BlobIdType blob_id) const;
+    bool record_access(BlobIdType blob_id);
+    void flush_accesses();
+    bool compact_index();
+    void copy_context_records(std::istream& src, std::ostream& dst) const;
 };
 }  // namespace ov::runtime
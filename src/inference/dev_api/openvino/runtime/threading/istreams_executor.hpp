@@ -72,6 +72,16 @@ public:
             THROUGHPUT,              //!< throughput mode
         };
 
+        /**
+         * @enum       TaskScheduling
+         * @brief      Defines how tasks submitted through `run()` are distributed between stream threads
+         */
+        enum class TaskScheduling {
+            SHARED_QUEUE,   //!< All stream threads pull tasks from a single queue guarded by one mutex
+            WORK_STEALING,  //!< Each stream thread owns a task queue, idle threads steal from the queues of
+                            //!< other streams (same NUMA node first) and spin before parking
+        };
+
     private:
         std::string _name;             //!< Used by `ITT` to name executor threads
         int _streams = 1;              //!< Number of streams.
@@ -95,6 +105,7 @@ public:
         int _sub_streams = 0;
         std::vector<int> _rank = {};
         bool _add_lock = true;
+        TaskScheduling _task_scheduling = TaskScheduling::SHARED_QUEUE;  //!< Tasks distribution between streams
 
         /**
          * @brief Get and reserve cpu ids based on configuration and hardware information,
@@ -127,6 +138,8 @@ public:
          * @param[in]  cpu_pinning                  @copybrief Config::_cpu_pinning
          * @param[in]  streams_info_table           @copybrief Config::_streams_info_table
          * @param[in]  rank                         @copybrief Config::_rank
+         * @param[in]  add_lock                     Whether to guard cpu map updates with the global lock
+         * @param[in]  task_scheduling              @copybrief Config::_task_scheduling
          */
         Config(std::string name = "StreamsExecutor",
                int streams = 1,
@@ -137,7 +150,8 @@ public:
                bool cores_limit = true,
                std::vector<std::vector<int>> streams_info_table = {},
                std::vector<int> rank = {},
-               bool add_lock = true)
+               bool add_lock = true,
+               TaskScheduling task_scheduling = TaskScheduling::SHARED_QUEUE)
             : _name{std::move(name)},
               _streams{streams},
               _threads_per_stream{threads_per_stream},
@@ -147,7 +161,8 @@ public:
               _cores_limit{cores_limit},
               _streams_info_table{std::move(streams_info_table)},
               _rank{std::move(rank)},
-              _add_lock(add_lock) {
+              _add_lock(add_lock),
+              _task_scheduling(task_scheduling) {
             update_executor_config(_add_lock);
         }
 
@@ -209,6 +224,12 @@ public:
         std::vector<int> get_rank() const {
             return _rank;
         }
+        TaskScheduling get_task_scheduling() const {
+            return _task_scheduling;
+        }
+        void set_task_scheduling(TaskScheduling task_scheduling) {
+            _task_scheduling = task_scheduling;
+        }
         StreamsMode get_sub_stream_mode() const {
             const auto proc_type_table = get_proc_type_table();
             int sockets = proc_type_table.size() > 1 ? static_cast<int>(proc_type_table.size()) - 1 : 1;
@@ -7,8 +7,11 @@
 
 #include <atomic>
 #include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <mutex>
 #include <queue>
+#include <thread>
 #include <type_traits>
 
 #include "openvino/core/parallel.hpp"
@@ -47,6 +50,96 @@ protected:
     std::queue<T> _queue;
     std::mutex _mutex;
 };
+
+/**
+ * @brief Bounded lock-free queue for many producers and a single consumer.
+ *
+ * Producers claim a cell with a CAS on the enqueue position, while the dequeue position is advanced by the consumer
+ * only. Every cell carries a sequence number, which tells whether the cell is free for the producer of the current
+ * lap or holds a value for the consumer (the bounded queue of D. Vyukov). So neither side takes a lock and the
+ * producers contend on a single atomic only.
+ *
+ * set_capacity() must be called before the queue is used, try_push() fails when the queue is full.
+ */
+template <typename T>
+class LockFreeBoundedMPSCQueue {
+public:
+    LockFreeBoundedMPSCQueue() = default;
+    LockFreeBoundedMPSCQueue(const LockFreeBoundedMPSCQueue&) = delete;
+    LockFreeBoundedMPSCQueue& operator=(const LockFreeBoundedMPSCQueue&) = delete;
+
+    /// Allocates the cells for at least `capacity` values, not thread-safe
+    void set_capacity(std::size_t capacity) {
+        std::size_t cells = 1;
+        while (cells < capacity)
+            cells <<= 1;
+        _cells.reset(new Cell[cells]);
+        _mask = cells - 1;
+        for (std::size_t i = 0; i < cells; i++)
+            _cells[i].sequence.store(i, std::memory_order_relaxed);
+        _enqueue_pos.store(0, std::memory_order_relaxed);
+        _dequeue_pos = 0;
+        _size.store(0, std::memory_order_relaxed);
+    }
+
+    bool try_push(T value) {
+        if (!_cells)
+            return false;
+        auto pos = _enqueue_pos.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = _cells[pos & _mask];
+            const auto sequence = cell.sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos);
+            if (diff == 0) {
+                if (_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.value = std::move(value);
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    // sequentially consistent, so that the consumer announcing its wait and re-checking the size
+                    // cannot miss the value while the producer misses the announcement
+                    _size.fetch_add(1, std::memory_order_seq_cst);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _enqueue_pos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /// Must be called from the single consumer thread only
+    bool try_pop(T& value) {
+        if (_size.load(std::memory_order_acquire) == 0)
+            return false;
+        Cell& cell = _cells[_dequeue_pos & _mask];
+        // a pushed value means that every cell before it has been claimed, but the producer of this one may still
+        // be storing the value
+        while (cell.sequence.load(std::memory_order_acquire) != _dequeue_pos + 1)
+            std::this_thread::yield();
+        value = std::move(cell.value);
+        cell.sequence.store(_dequeue_pos + _mask + 1, std::memory_order_release);
+        ++_dequeue_pos;
+        _size.fetch_sub(1, std::memory_order_release);
+        return true;
+    }
+
+    std::size_t size() const {
+        return _size.load(std::memory_order_seq_cst);
+    }
+
+protected:
+    struct Cell {
+        std::atomic<std::size_t> sequence{0};
+        T value{};
+    };
+    std::unique_ptr<Cell[]> _cells;
+    std::size_t _mask = 0;
+    // the producers and the consumer update their positions on separate cache lines
+    alignas(64) std::atomic<std::size_t> _enqueue_pos{0};
+    alignas(64) std::size_t _dequeue_pos = 0;
+    alignas(64) std::atomic<std::size_t> _size{0};
+};
+
 #if ((OV_THREAD == OV_THREAD_TBB) || (OV_THREAD == OV_THREAD_TBB_AUTO) || (OV_THREAD == OV_THREAD_TBB_ADAPTIVE))
 template <typename T>
 using ThreadSafeQueue = tbb::concurrent_queue<T>;
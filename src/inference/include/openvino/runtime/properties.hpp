@@ -772,6 +772,16 @@ static constexpr Property<std::string> cache_dir{"CACHE_DIR"};
  */
 inline constexpr Property<std::filesystem::path> cache_path{"CACHE_PATH"};
 
+/**
+ * @brief Read-write property to limit the size of a single file cache, i.e. a cache directory or path ending with
+ * ".bin". When a newly written blob makes the cache file exceed the budget, the file is compacted and the least
+ * recently used blobs are evicted until it fits. The budget has no effect on a cache directory.
+ *
+ * value type: uint64_t, size in bytes, 0 (default) means unlimited
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<uint64_t, PropertyMutability::RW> cache_size_budget{"CACHE_SIZE_BUDGET"};
+
 /**
  * @brief Read-only property to notify user that compiled model was loaded from the cache
  * @ingroup ov_runtime_cpp_prop_api
@@ -960,6 +970,15 @@ static constexpr Property<uint32_t, PropertyMutability::RO> max_batch_size{"MAX_
  */
 static constexpr Property<uint32_t, PropertyMutability::RW> auto_batch_timeout{"AUTO_BATCH_TIMEOUT"};
 
+/**
+ * @brief Read-write property to set the target for the 99th percentile latency (in milliseconds) of the requests
+ * executed with the auto-batching. When set (non-zero), the time a batch is collected for is adapted online from the
+ * observed arrival rate and batch execution time instead of the fixed ov::auto_batch_timeout, and the batches that are
+ * not full by then are executed padded to the compiled batch size rather than with the batch size of 1.
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> auto_batch_latency_target{"AUTO_BATCH_LATENCY_TARGET"};
+
 /**
  * @brief Read-only property to provide a hint for a range for number of async infer requests. If device supports
  * streams, the metric provides range for number of IRs per stream.
@@ -993,6 +1012,39 @@ static constexpr Property<bool, PropertyMutability::RW> force_tbb_terminate{"FOR
  */
 static constexpr Property<bool, PropertyMutability::RW> enable_mmap{"ENABLE_MMAP"};
 
+/**
+ * @brief Read-write property to record the workload of the application: the path of the file where the start time,
+ * the model name and the input shapes of every inference are written. The trace can be replayed by the benchmark_app
+ * with the -trace option. Like ov::force_tbb_terminate, the property is applied to the whole process.
+ *
+ * value type: string
+ *   - Path of the trace file, an existing file is overwritten
+ *   - Empty string (default) stops recording
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<std::string, PropertyMutability::RW> workload_trace{"WORKLOAD_TRACE"};
+
+/**
+ * @brief Read-write property to allocate the tensors created without an explicit allocator, e.g. the output tensors of
+ * the infer requests, from the process-wide pool returned by ov::get_pooled_allocator() instead of the system
+ * allocator. Like ov::force_tbb_terminate, the property is applied to the whole process.
+ *
+ * value type: boolean
+ *   - True the allocations are pooled
+ *   - False (default) the allocations are served by the system allocator, the memory cached by the pool is released
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<bool, PropertyMutability::RW> tensor_memory_pool{"TENSOR_MEMORY_POOL"};
+
+/**
+ * @brief Read-only property to get the counters of the pooled allocators: "allocations", "thread_cache_hits",
+ * "pool_hits", "system_allocations", "huge_page_blocks", "system_frees", "in_use_bytes", "cached_bytes",
+ * "system_bytes" and "peak_system_bytes".
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> tensor_memory_pool_statistics{
+    "TENSOR_MEMORY_POOL_STATISTICS"};
+
 /**
  * @brief Namespace with device properties
  */
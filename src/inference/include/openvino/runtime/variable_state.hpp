@@ -74,6 +74,29 @@ public:
      * @param state The current state to set.
      */
     void set_state(const Tensor& state);
+
+    /**
+     * @brief Makes the state take the value of another state of the same variable for the next inference, e.g. to start
+     * several infer requests of the same compiled model from a common prefix. Unlike set_state(source.get_state()), the
+     * plugins supporting it don't copy the value: the states share the memory until one of them is modified.
+     * @param source A state of the same variable of another infer request or a snapshot.
+     */
+    void fork(const VariableState& source);
+
+    /**
+     * @brief Captures the current value of the state, e.g. to roll back to it later with fork(). The snapshot is not
+     * changed by the following inferences, the plugins supporting it share the memory with the state until one of them
+     * is modified.
+     * @return The captured state.
+     */
+    VariableState snapshot();
+
+    /**
+     * @brief Keeps the first elements of the sequence stored by the state and drops the following ones, e.g. the
+     * rejected draft tokens of the speculative decoding from a KV cache.
+     * @param length The new length of the sequence.
+     */
+    void truncate(size_t length);
 };
 
 }  // namespace ov
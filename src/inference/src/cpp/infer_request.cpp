@@ -17,6 +17,7 @@
 #include "openvino/runtime/make_tensor.hpp"
 #include "openvino/runtime/so_ptr.hpp"
 #include "transformations/utils/utils.hpp"
+#include "workload_trace.hpp"
 
 #define OV_INFER_REQ_CALL_STATEMENT(...)                                    \
     OPENVINO_ASSERT(_impl != nullptr, "InferRequest was not initialized."); \
@@ -221,7 +222,12 @@ Tensor InferRequest::get_output_tensor() {
 }
 
 void InferRequest::infer() {
-    OV_INFER_REQ_CALL_STATEMENT(_impl->infer());
+    OV_INFER_REQ_CALL_STATEMENT({
+        if (auto& trace = ov::WorkloadTrace::get(); trace.enabled()) {
+            trace.record(*_impl);
+        }
+        _impl->infer();
+    });
 }
 
 void InferRequest::cancel() {
@@ -233,7 +239,12 @@ std::vector<ProfilingInfo> InferRequest::get_profiling_info() const {
 }
 
 void InferRequest::start_async() {
-    OV_INFER_REQ_CALL_STATEMENT(_impl->start_async());
+    OV_INFER_REQ_CALL_STATEMENT({
+        if (auto& trace = ov::WorkloadTrace::get(); trace.enabled()) {
+            trace.record(*_impl);
+        }
+        _impl->start_async();
+    });
 }
 
 void InferRequest::wait() {
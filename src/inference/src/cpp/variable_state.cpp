@@ -49,4 +49,20 @@ void VariableState::set_state(const Tensor& state) {
     OV_VARIABLE_CALL_STATEMENT(_impl->set_state(get_tensor_impl(state)));
 }
 
+void VariableState::fork(const VariableState& source) {
+    OPENVINO_ASSERT(source._impl != nullptr, "VariableState was not initialized.");
+    OV_VARIABLE_CALL_STATEMENT(_impl->fork({source._impl, source._so}));
+}
+
+VariableState VariableState::snapshot() {
+    OV_VARIABLE_CALL_STATEMENT({
+        auto snapshot = _impl->snapshot();
+        return {snapshot._ptr, snapshot._so ? snapshot._so : _so};
+    });
+}
+
+void VariableState::truncate(size_t length) {
+    OV_VARIABLE_CALL_STATEMENT(_impl->truncate(length));
+}
+
 }  // namespace ov
@@ -13,9 +13,9 @@
 
 #include "itt.hpp"
 #include "openvino/core/memory_util.hpp"
-#include "openvino/core/parallel.hpp"
 #include "openvino/pass/manager.hpp"
 #include "openvino/runtime/compilation_context.hpp"
+#include "openvino/runtime/compute_hash.hpp"
 #include "openvino/util/file_util.hpp"
 #include "openvino/util/xml_parse_utils.hpp"
 #include "transformations/hash.hpp"
@@ -126,43 +126,7 @@ std::string ModelCache::compute_hash(const std::string& model_str,
     // tensor data
     if (tensor) {
         seed = hash_combine(seed, tensor.get_size());
-
-        auto ptr = static_cast<const size_t*>(tensor.data());
-        size_t size = tensor.get_size() / sizeof(size_t);
-
-        // 10MB block size in size_t
-        const size_t block_size = 10000000 / sizeof(size_t);
-        size_t blocks_num = size / block_size;
-        std::vector<uint64_t> block_hashes(blocks_num + 1, 0);
-
-        ov::parallel_for(blocks_num, [&](size_t block_idx) {
-            uint64_t local_hash = 0;
-            auto local_ptr = ptr + block_size * block_idx;
-            for (size_t i = 0; i < block_size; i++) {
-                local_hash = hash_combine(local_hash, local_ptr[i]);
-            }
-            block_hashes[block_idx] = local_hash;
-        });
-
-        {
-            uint64_t local_hash = 0;
-            auto local_ptr = ptr + block_size * blocks_num;
-            auto elements_left = size - block_size * blocks_num;
-            for (size_t i = 0; i < elements_left; i++) {
-                local_hash = hash_combine(local_hash, local_ptr[i]);
-            }
-            block_hashes[blocks_num] = local_hash;
-        }
-
-        for (auto hash : block_hashes) {
-            seed = hash_combine(seed, hash);
-        }
-
-        auto size_done = size * sizeof(size_t);
-        auto ptr_left = static_cast<const uint8_t*>(tensor.data()) + size_done;
-        size_t size_left = tensor.get_size() - size_done;
-        for (size_t i = 0; i < size_left; i++)
-            seed = hash_combine(seed, ptr_left[i]);
+        seed = hash_combine(seed, ov::runtime::compute_hash_parallel(tensor.data(), tensor.get_byte_size()));
     }
 
     // compile options
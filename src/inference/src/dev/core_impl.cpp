@@ -26,6 +26,7 @@
 #include "openvino/runtime/internal_properties.hpp"
 #include "openvino/runtime/itensor.hpp"
 #include "openvino/runtime/make_tensor.hpp"
+#include "openvino/runtime/pooled_allocator.hpp"
 #include "openvino/runtime/remote_context.hpp"
 #include "openvino/runtime/shared_buffer.hpp"
 #include "openvino/runtime/single_file_storage.hpp"
@@ -39,6 +40,7 @@
 #include "openvino/util/xml_parse_utils.hpp"
 #include "ov_plugins.hpp"
 #include "shared_context_manager.hpp"
+#include "workload_trace.hpp"
 #ifdef PROXY_PLUGIN_ENABLED
 #    include "openvino/proxy/plugin.hpp"
 #    include "openvino/proxy/properties.hpp"
@@ -212,13 +214,18 @@ void clean_batch_properties(const std::string& device_name, ov::AnyMap& config,
 
 static const auto core_properties_names = ov::util::make_array(ov::cache_dir.name(),
                                                                ov::cache_path.name(),
+                                                               ov::cache_size_budget.name(),
                                                                ov::cache_model_path.name(),
                                                                ov::cache_blob_id.name(),
                                                                ov::enable_mmap.name(),
-                                                               ov::force_tbb_terminate.name());
+                                                               ov::force_tbb_terminate.name(),
+                                                               ov::workload_trace.name(),
+                                                               ov::tensor_memory_pool.name());
 
 static const auto auto_batch_properties_names =
-    ov::util::make_array(ov::auto_batch_timeout.name(), ov::hint::allow_auto_batching.name());
+    ov::util::make_array(ov::auto_batch_timeout.name(),
+                         ov::auto_batch_latency_target.name(),
+                         ov::hint::allow_auto_batching.name());
 
 std::filesystem::path extract_weight_path(const std::string& compiled_properties) {
     if (auto start = compiled_properties.find(ov::weights_path.name()); start != std::string::npos) {
@@ -1294,9 +1301,17 @@ ov::Any ov::CoreImpl::get_property_for_core(const std::string& name) const {
         return ov::Any(util::path_to_string(m_core_config.get_cache_dir()));
     } else if (name == ov::cache_path.name()) {
         return {m_core_config.get_cache_dir()};
+    } else if (name == ov::cache_size_budget.name()) {
+        return decltype(ov::cache_size_budget)::value_type(m_core_config.get_cache_size_budget());
     } else if (name == ov::enable_mmap.name()) {
         const auto flag = m_core_config.get_enable_mmap();
         return decltype(ov::enable_mmap)::value_type(flag);
+    } else if (name == ov::workload_trace.name()) {
+        return decltype(ov::workload_trace)::value_type(WorkloadTrace::get().path());
+    } else if (name == ov::tensor_memory_pool.name()) {
+        return decltype(ov::tensor_memory_pool)::value_type(ov::is_default_allocator_pooled());
+    } else if (name == ov::tensor_memory_pool_statistics.name()) {
+        return decltype(ov::tensor_memory_pool_statistics)::value_type(ov::get_pooled_allocator_statistics());
     }
 
     OPENVINO_THROW("Exception is thrown while trying to call get_property with unsupported property: '", name, "'");
@@ -1721,21 +1736,37 @@ ov::CoreConfig::CoreConfig(const CoreConfig& other) {
         std::lock_guard<std::mutex> lock(other.m_cache_config_mutex);
         m_cache_config = other.m_cache_config;
         m_devices_cache_config = other.m_devices_cache_config;
+        m_cache_size_budget = other.m_cache_size_budget;
     }
     m_flag_enable_mmap = other.m_flag_enable_mmap;
 }
 
 void ov::CoreConfig::set(const ov::AnyMap& config, const std::string& device_name) {
+    if (const auto cfg_entry = config.find(ov::cache_size_budget.name()); cfg_entry != config.end()) {
+        std::lock_guard<std::mutex> lock(m_cache_config_mutex);
+        m_cache_size_budget = cfg_entry->second.as<uint64_t>();
+        // the budget applies to the single file storages already in use as well
+        const auto update_budget = [this](const CacheConfig& cache_config) {
+            if (auto storage = std::dynamic_pointer_cast<runtime::SingleFileStorage>(cache_config.m_cache_manager)) {
+                storage->set_size_budget(m_cache_size_budget);
+            }
+        };
+        update_budget(m_cache_config);
+        for (const auto& device_cfg : m_devices_cache_config) {
+            update_budget(device_cfg.second);
+        }
+    }
+
     if (const auto cache_path = get_cache_path_from_config(config); cache_path.has_value()) {
         if (std::lock_guard<std::mutex> lock(m_cache_config_mutex); device_name.empty()) {
             // fill global cache config
-            m_cache_config = CoreConfig::CacheConfig::create(*cache_path);
+            m_cache_config = CoreConfig::CacheConfig::create(*cache_path, m_cache_size_budget);
             // sets cache config per-device if it's not set explicitly before
             for (auto& device_cfg : m_devices_cache_config) {
-                device_cfg.second = CoreConfig::CacheConfig::create(*cache_path);
+                device_cfg.second = CoreConfig::CacheConfig::create(*cache_path, m_cache_size_budget);
             }
         } else {
-            m_devices_cache_config[device_name] = CoreConfig::CacheConfig::create(*cache_path);
+            m_devices_cache_config[device_name] = CoreConfig::CacheConfig::create(*cache_path, m_cache_size_budget);
         }
     }
 
@@ -1746,6 +1777,18 @@ void ov::CoreConfig::set(const ov::AnyMap& config, const std::string& device_nam
     if (const auto cfg_entry = config.find(ov::enable_mmap.name()); cfg_entry != config.end()) {
         m_flag_enable_mmap = cfg_entry->second.as<bool>();
     }
+
+    if (const auto cfg_entry = config.find(ov::workload_trace.name()); cfg_entry != config.end()) {
+        WorkloadTrace::get().open(cfg_entry->second.as<std::string>());
+    }
+
+    if (const auto cfg_entry = config.find(ov::tensor_memory_pool.name()); cfg_entry != config.end()) {
+        const auto pooled = cfg_entry->second.as<bool>();
+        ov::set_default_allocator_pooled(pooled);
+        if (!pooled) {
+            ov::release_pooled_allocator_memory();
+        }
+    }
 }
 
 void ov::CoreConfig::set_and_update(ov::AnyMap& config, const std::string& device_name) {
@@ -1768,16 +1811,24 @@ bool ov::CoreConfig::get_enable_mmap() const {
     return m_flag_enable_mmap;
 }
 
+uint64_t ov::CoreConfig::get_cache_size_budget() const {
+    std::lock_guard<std::mutex> lock(m_cache_config_mutex);
+    return m_cache_size_budget;
+}
+
 ov::CoreConfig::CacheConfig ov::CoreConfig::get_cache_config_for_device(const ov::Plugin& plugin) const {
     std::lock_guard<std::mutex> lock(m_cache_config_mutex);
     return m_devices_cache_config.count(plugin.get_name()) ? m_devices_cache_config.at(plugin.get_name())
                                                            : m_cache_config;
 }
 
-ov::CoreConfig::CacheConfig ov::CoreConfig::CacheConfig::create(const std::filesystem::path& dir) {
+ov::CoreConfig::CacheConfig ov::CoreConfig::CacheConfig::create(const std::filesystem::path& dir,
+                                                                uint64_t size_budget) {
     auto cfg = CacheConfig{dir, nullptr};
     if (dir.extension() == ".bin") {
-        cfg.m_cache_manager = std::make_shared<runtime::SingleFileStorage>(dir);
+        auto storage = std::make_shared<runtime::SingleFileStorage>(dir);
+        storage->set_size_budget(size_budget);
+        cfg.m_cache_manager = std::move(storage);
     } else if (!dir.empty()) {
         cfg.m_cache_manager = std::make_shared<FileStorageCacheManager>(dir);
     }
@@ -32,7 +32,7 @@ public:
         std::filesystem::path m_cache_dir;
         std::shared_ptr<ov::ICacheManager> m_cache_manager;
 
-        static CacheConfig create(const std::filesystem::path& dir);
+        static CacheConfig create(const std::filesystem::path& dir, uint64_t size_budget);
     };
 
     void set(const ov::AnyMap& config, const std::string& device_name);
@@ -48,6 +48,8 @@ public:
 
     bool get_enable_mmap() const;
 
+    uint64_t get_cache_size_budget() const;
+
     // Creating thread-safe copy of global config including shared_ptr to ICacheManager
     CacheConfig get_cache_config_for_device(const ov::Plugin& plugin) const;
 
@@ -59,6 +61,7 @@ private:
     CacheConfig m_cache_config{};
     std::map<std::string, CacheConfig> m_devices_cache_config{};
     bool m_flag_enable_mmap{true};
+    uint64_t m_cache_size_budget{0};
 };
 
 struct Parsed {
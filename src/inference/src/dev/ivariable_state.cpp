@@ -5,6 +5,22 @@
 #include "openvino/runtime/ivariable_state.hpp"
 
 #include "openvino/core/except.hpp"
+#include "openvino/runtime/make_tensor.hpp"
+
+namespace {
+
+// the value of a state captured by the default snapshot()
+class CapturedVariableState : public ov::IVariableState {
+public:
+    CapturedVariableState(const std::string& name, const ov::SoPtr<ov::ITensor>& value) : ov::IVariableState(name) {
+        OPENVINO_ASSERT(value, "The state ", name, " has no value to capture");
+        auto copy = ov::make_tensor(value->get_element_type(), value->get_shape());
+        value->copy_to(copy);
+        m_state = {copy, nullptr};
+    }
+};
+
+}  // namespace
 
 ov::IVariableState::IVariableState(const std::string& name) : m_name(name) {}
 
@@ -25,3 +41,16 @@ void ov::IVariableState::set_state(const ov::SoPtr<ov::ITensor>& state) {
 ov::SoPtr<ov::ITensor> ov::IVariableState::get_state() const {
     return m_state;
 }
+
+void ov::IVariableState::fork(const ov::SoPtr<ov::IVariableState>& source) {
+    OPENVINO_ASSERT(source, "Cannot fork the state ", get_name(), " from an empty state");
+    set_state(source->get_state());
+}
+
+ov::SoPtr<ov::IVariableState> ov::IVariableState::snapshot() {
+    return {std::make_shared<CapturedVariableState>(get_name(), get_state()), nullptr};
+}
+
+void ov::IVariableState::truncate(size_t) {
+    OPENVINO_NOT_IMPLEMENTED;
+}
@@ -7,6 +7,7 @@
 #include <algorithm>
 #include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <queue>
@@ -25,7 +26,45 @@
 
 namespace ov {
 namespace threading {
+namespace {
+// Number of steal attempts an idle worker makes before parking on the condition variable
+constexpr int idle_spin_count = 256;
+}  // namespace
+
 struct CPUStreamsExecutor::Impl {
+    // Task queue owned by a single stream thread in TaskScheduling::WORK_STEALING mode. Tasks are pushed from any
+    // thread, so the queue keeps a short per-stream lock instead of a single-producer Chase-Lev deque; contention is
+    // spread across streams and thieves never block on a busy queue.
+    struct StreamTaskQueue {
+        void push(Task&& task) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _tasks.emplace_back(std::move(task));
+        }
+        bool pop(Task& task) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            return pop_front(task);
+        }
+        bool steal(Task& task) {
+            std::unique_lock<std::mutex> lock(_mutex, std::try_to_lock);
+            return lock.owns_lock() && pop_front(task);
+        }
+
+        std::atomic<int> _numaNodeId{-1};
+
+    private:
+        bool pop_front(Task& task) {
+            if (_tasks.empty()) {
+                return false;
+            }
+            task = std::move(_tasks.front());
+            _tasks.pop_front();
+            return true;
+        }
+
+        std::mutex _mutex;
+        std::deque<Task> _tasks;
+    };
+
     struct Stream {
 #if OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO || OV_THREAD == OV_THREAD_TBB_ADAPTIVE
         struct Observer : public custom::task_scheduler_observer {
@@ -396,6 +435,10 @@ struct CPUStreamsExecutor::Impl {
                 std::lock_guard<std::mutex> lock(_cpu_ids_mutex);
                 _cpu_ids_all.insert(_cpu_ids_all.end(), processor_ids[streamId].begin(), processor_ids[streamId].end());
             }
+            if (_config.get_task_scheduling() == Config::TaskScheduling::WORK_STEALING) {
+                _streamTaskQueues.emplace_back(new StreamTaskQueue);
+                continue;
+            }
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config.get_name() + "_" + std::to_string(streamId));
                 for (bool stopped = false; !stopped;) {
@@ -416,9 +459,19 @@ struct CPUStreamsExecutor::Impl {
                 }
             });
         }
+        for (size_t queueId = 0; queueId < _streamTaskQueues.size(); ++queueId) {
+            _threads.emplace_back([this, queueId] {
+                openvino::itt::threadName(_config.get_name() + "_" + std::to_string(queueId));
+                WorkStealingLoop(queueId);
+            });
+        }
     }
 
     void Enqueue(Task task) {
+        if (!_streamTaskQueues.empty()) {
+            EnqueueToStream(std::move(task));
+            return;
+        }
         {
             std::lock_guard<std::mutex> lock(_mutex);
             _taskQueue.emplace(std::move(task));
@@ -426,6 +479,68 @@ struct CPUStreamsExecutor::Impl {
         _queueCondVar.notify_one();
     }
 
+    // Tasks submitted from a stream thread stay on its own queue, external submissions are spread round-robin
+    void EnqueueToStream(Task task) {
+        const auto queueId = (t_owner == this)
+                                 ? t_queueId
+                                 : _nextQueueId.fetch_add(1, std::memory_order_relaxed) % _streamTaskQueues.size();
+        _streamTaskQueues[queueId]->push(std::move(task));
+        _pendingTasks.fetch_add(1);
+        // Pairs with the increment of _parkedWorkers in WorkStealingLoop: either the worker observes the new pending
+        // task before waiting, or this thread observes the parked worker and wakes it up
+        if (_parkedWorkers.load() > 0) {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+            }
+            _queueCondVar.notify_one();
+        }
+    }
+
+    bool PopTask(const size_t queueId, Task& task) {
+        bool found = _streamTaskQueues[queueId]->pop(task);
+        if (!found) {
+            // steal from streams of the same NUMA node first, then from the remaining ones
+            const auto numaNodeId = _streamTaskQueues[queueId]->_numaNodeId.load(std::memory_order_relaxed);
+            const auto queuesNum = _streamTaskQueues.size();
+            for (int localPass = 1; localPass >= 0 && !found; --localPass) {
+                for (size_t i = 1; i < queuesNum && !found; ++i) {
+                    auto& victim = *_streamTaskQueues[(queueId + i) % queuesNum];
+                    const bool isLocal = victim._numaNodeId.load(std::memory_order_relaxed) == numaNodeId;
+                    if (isLocal == static_cast<bool>(localPass)) {
+                        found = victim.steal(task);
+                    }
+                }
+            }
+        }
+        if (found) {
+            _pendingTasks.fetch_sub(1);
+        }
+        return found;
+    }
+
+    void WorkStealingLoop(const size_t queueId) {
+        t_owner = this;
+        t_queueId = queueId;
+        _streamTaskQueues[queueId]->_numaNodeId = _streams->local()->_numaNodeId;
+        for (bool stopped = false; !stopped;) {
+            Task task;
+            for (int spin = 0; spin < idle_spin_count && !PopTask(queueId, task); ++spin) {
+                std::this_thread::yield();
+            }
+            if (task) {
+                Execute(task, *(_streams->local()));
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(_mutex);
+            _parkedWorkers.fetch_add(1);
+            _queueCondVar.wait(lock, [&] {
+                return _pendingTasks.load() > 0 || (stopped = _isStopped);
+            });
+            _parkedWorkers.fetch_sub(1);
+        }
+        t_owner = nullptr;
+    }
+
     void Execute(const Task& task, Stream& stream) {
 #if OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO || OV_THREAD == OV_THREAD_TBB_ADAPTIVE
         auto& arena = stream._taskArena;
@@ -494,6 +609,12 @@ struct CPUStreamsExecutor::Impl {
     std::mutex _mutex;
     std::condition_variable _queueCondVar;
     std::queue<Task> _taskQueue;
+    std::vector<std::unique_ptr<StreamTaskQueue>> _streamTaskQueues;
+    std::atomic<size_t> _nextQueueId{0};
+    std::atomic<int64_t> _pendingTasks{0};
+    std::atomic<int> _parkedWorkers{0};
+    static thread_local const Impl* t_owner;
+    static thread_local size_t t_queueId;
     bool _isStopped = false;
     std::vector<int> _usedNumaNodes;
     std::shared_ptr<CustomThreadLocal> _streams;
@@ -505,6 +626,9 @@ struct CPUStreamsExecutor::Impl {
 CPUStreamsExecutor::Impl::CustomThreadLocal::ThreadCleaner::ResourceKeeper
     CPUStreamsExecutor::Impl::CustomThreadLocal::ThreadCleaner::global_resource_holder;
 
+thread_local const CPUStreamsExecutor::Impl* CPUStreamsExecutor::Impl::t_owner = nullptr;
+thread_local size_t CPUStreamsExecutor::Impl::t_queueId = 0;
+
 int CPUStreamsExecutor::get_stream_id() {
     if (!_impl->_streams->find_thread_id()) {
         return 0;
@@ -4,6 +4,10 @@
 
 #include "openvino/runtime/single_file_storage.hpp"
 
+#include <algorithm>
+#include <mutex>
+#include <shared_mutex>
+
 #include "openvino/runtime/aligned_buffer.hpp"
 #include "openvino/util/file_util.hpp"
 #include "openvino/util/mmap_object.hpp"
@@ -66,6 +70,33 @@ void write_padding(std::ostream& stream, uint64_t alignment) {
         stream.write(padding.data(), padding.size());
     }
 }
+
+bool copy_stream_data(std::istream& src, std::ostream& dst, uint64_t size) {
+    constexpr uint64_t chunk_size = 4 * 1024 * 1024;
+    std::vector<char> buffer(static_cast<size_t>(std::min(size, chunk_size)));
+    while (size > 0 && src.good() && dst.good()) {
+        const auto chunk = std::min<uint64_t>(size, buffer.size());
+        src.read(buffer.data(), static_cast<std::streamsize>(chunk));
+        dst.write(buffer.data(), static_cast<std::streamsize>(chunk));
+        size -= chunk;
+    }
+    return src.good() && dst.good();
+}
+
+constexpr uint64_t tlv_header_size = sizeof(TLVTraits::TagType) + sizeof(TLVTraits::LengthType);
+// BlobIndex record without entries: region end and blobs count
+constexpr uint64_t blob_index_header_size = tlv_header_size + 2 * sizeof(uint64_t);
+
+// Upper bound of the bytes taken by a blob in the compacted file: Blob and BlobMap records, the padding before the blob
+// data and the blob index entry.
+uint64_t estimate_blob_footprint(uint64_t blob_size, uint64_t model_name_size) {
+    constexpr uint64_t blob_header_size =
+        tlv_header_size + sizeof(SingleFileStorage::BlobIdType) + sizeof(SingleFileStorage::PadSizeType);
+    constexpr uint64_t blob_map_size = 2 * tlv_header_size + sizeof(SingleFileStorage::BlobIdType);
+    constexpr uint64_t index_entry_size = sizeof(SingleFileStorage::BlobIdType) + 3 * sizeof(uint64_t) + tlv_header_size;
+    return blob_header_size + SingleFileStorage::blob_alignment + blob_size + blob_map_size + index_entry_size +
+           2 * model_name_size;
+}
 }  // namespace
 
 const size_t SingleFileStorage::blob_alignment = []() {
@@ -81,15 +112,27 @@ SingleFileStorage::SingleFileStorage(const std::filesystem::path& path)
     if (!util::file_exists(m_file_path)) {
         std::ofstream stream(m_file_path, std::ios::binary);
         write_version(stream, m_version);
+        m_context_size = static_cast<uint64_t>(stream.tellp());
     } else {
         std::ifstream stream(m_file_path, std::ios::binary);
         util::Version file_version{0, 0, 0};
         read_version(stream, file_version);
         validate_version(file_version);
+        m_context_size = static_cast<uint64_t>(stream.tellg());
+    }
+}
+
+SingleFileStorage::~SingleFileStorage() {
+    try {
+        std::unique_lock<std::shared_mutex> lock(m_index_mutex);
+        flush_accesses();
+    } catch (...) {
+        // Access records are best effort only
     }
 }
 
 bool SingleFileStorage::build_content_index(std::ifstream& stream) {
+    m_context_size = static_cast<uint64_t>(stream.tellg());
     const auto blob_reader = [this](std::istream& s, TLVTraits::LengthType size) {
         if (size == 0) {
             return true;
@@ -116,6 +159,7 @@ bool SingleFileStorage::build_content_index(std::ifstream& stream) {
         }
         m_blob_index[id].offset = static_cast<uint64_t>(blob_data_pos);
         m_blob_index[id].size = static_cast<uint64_t>(blob_data_size);
+        m_blob_index[id].last_access = ++m_access_clock;
         return true;
     };
     const auto blob_map_reader = [this](std::istream& s, TLVTraits::LengthType size) {
@@ -141,6 +185,7 @@ bool SingleFileStorage::build_content_index(std::ifstream& stream) {
         if (size == 0) {
             return true;
         }
+        m_context_size += tlv_header_size + size;
         uint64_t source_id;
         if (size < sizeof(source_id)) {
             return false;
@@ -189,13 +234,81 @@ bool SingleFileStorage::build_content_index(std::ifstream& stream) {
             return false;
         }
         const auto weight_size = size - header_size - padding_size;
+        // compaction realigns the weights, the padding may grow up to the alignment
+        m_context_size += tlv_header_size + header_size + blob_alignment + weight_size;
         m_shared_context->m_cache_sources[source_id] = {};
         s.seekg(weight_size, std::ios::cur);
         return s.good();
     };
+    const auto blob_removed_reader = [this](std::istream& s, TLVTraits::LengthType size) {
+        BlobIdType id;
+        if (size != sizeof(id)) {
+            return false;
+        }
+        s.read(reinterpret_cast<char*>(&id), sizeof(id));
+        if (!s.good()) {
+            return false;
+        }
+        m_blob_index.erase(id);
+        return true;
+    };
+    const auto blob_access_reader = [this](std::istream& s, TLVTraits::LengthType size) {
+        BlobIdType id;
+        uint64_t last_access;
+        if (size != sizeof(id) + sizeof(last_access)) {
+            return false;
+        }
+        s.read(reinterpret_cast<char*>(&id), sizeof(id));
+        s.read(reinterpret_cast<char*>(&last_access), sizeof(last_access));
+        if (!s.good()) {
+            return false;
+        }
+        if (auto blob_it = m_blob_index.find(id); blob_it != m_blob_index.end()) {
+            blob_it->second.last_access = last_access;
+        }
+        m_access_clock = std::max(m_access_clock.load(), last_access);
+        return true;
+    };
+    const auto blob_index_reader = [this](std::istream& s, TLVTraits::LengthType size) {
+        uint64_t region_end, blobs_count;
+        if (size < sizeof(region_end) + sizeof(blobs_count)) {
+            return false;
+        }
+        const auto index_end = s.tellg() + static_cast<std::streamoff>(size);
+        s.read(reinterpret_cast<char*>(&region_end), sizeof(region_end));
+        s.read(reinterpret_cast<char*>(&blobs_count), sizeof(blobs_count));
+        for (uint64_t i = 0; i < blobs_count && s.good(); ++i) {
+            BlobIdType id;
+            uint64_t offset, blob_size, last_access;
+            s.read(reinterpret_cast<char*>(&id), sizeof(id));
+            s.read(reinterpret_cast<char*>(&offset), sizeof(offset));
+            s.read(reinterpret_cast<char*>(&blob_size), sizeof(blob_size));
+            s.read(reinterpret_cast<char*>(&last_access), sizeof(last_access));
+            std::string model_name;
+            if (!s.good() || !read_tlv_string(s, model_name) || s.tellg() > index_end ||
+                blob_size > region_end || offset > region_end - blob_size) {
+                return false;
+            }
+            m_blob_index[id] = {offset, blob_size, std::move(model_name), last_access};
+            m_access_clock = std::max(m_access_clock.load(), last_access);
+        }
+        if (!s.good() || s.tellg() != index_end || region_end < static_cast<uint64_t>(index_end)) {
+            return false;
+        }
+        // The indexed region holds only blob records, continue the scan with records appended after compaction
+        const auto stream_end = s.seekg(0, std::ios::end).tellg();
+        if (!s.good() || region_end > static_cast<uint64_t>(stream_end)) {
+            return false;
+        }
+        s.seekg(static_cast<std::streamoff>(region_end), std::ios::beg);
+        return s.good();
+    };
     const TLVValueScanner scanners = {
         {static_cast<TLVTraits::TagType>(Tag::Blob), blob_reader},
         {static_cast<TLVTraits::TagType>(Tag::BlobMap), blob_map_reader},
+        {static_cast<TLVTraits::TagType>(Tag::BlobRemoved), blob_removed_reader},
+        {static_cast<TLVTraits::TagType>(Tag::BlobAccess), blob_access_reader},
+        {static_cast<TLVTraits::TagType>(Tag::BlobIndex), blob_index_reader},
         {static_cast<TLVTraits::TagType>(Tag::ConstantMeta), constant_meta_reader},
         {static_cast<TLVTraits::TagType>(Tag::WeightSource), weight_source_reader},
     };
@@ -235,14 +348,84 @@ void SingleFileStorage::write_blob_entry(std::fstream& stream, BlobIdType blob_i
     };
     write_tlv_record(stream, static_cast<TLVTraits::TagType>(Tag::BlobMap), blob_map_writer);
 
-    m_blob_index[blob_id] = {static_cast<uint64_t>(blob_pos), static_cast<uint64_t>(blob_size), std::move(model_name)};
+    m_blob_index[blob_id] = {static_cast<uint64_t>(blob_pos),
+                             static_cast<uint64_t>(blob_size),
+                             std::move(model_name),
+                             ++m_access_clock};
+}
+
+bool SingleFileStorage::record_access(BlobIdType blob_id) {
+    std::lock_guard<std::mutex> lock(m_access_mutex);
+    m_pending_accesses.emplace_back(blob_id, ++m_access_clock);
+    return m_pending_accesses.size() >= access_batch_size;
+}
+
+void SingleFileStorage::flush_accesses() {
+    decltype(m_pending_accesses) accesses;
+    {
+        std::lock_guard<std::mutex> lock(m_access_mutex);
+        accesses.swap(m_pending_accesses);
+    }
+    if (accesses.empty()) {
+        return;
+    }
+    for (const auto& [blob_id, last_access] : accesses) {
+        if (auto blob_it = m_blob_index.find(blob_id); blob_it != m_blob_index.end()) {
+            blob_it->second.last_access = std::max(blob_it->second.last_access, last_access);
+        }
+    }
+    // Access records are best effort only, a storage placed in read-only location shall remain readable
+    if (std::ofstream stream(m_file_path, std::ios::binary | std::ios::in | std::ios::ate); stream.good()) {
+        for (const auto& [blob_id, last_access] : accesses) {
+            write_tlv_record(stream, static_cast<TLVTraits::TagType>(Tag::BlobAccess), [&](std::ostream& s) {
+                s.write(reinterpret_cast<const char*>(&blob_id), sizeof(blob_id));
+                s.write(reinterpret_cast<const char*>(&last_access), sizeof(last_access));
+            });
+        }
+    }
 }
 
 void SingleFileStorage::write_cache_entry(const std::string& blob_id, StreamWriter writer) {
     ScopedLocale plocal_C(LC_ALL, "C");
-    std::fstream stream(m_file_path, std::ios::binary | std::ios::in | std::ios::out | std::ios::ate);
-    OPENVINO_ASSERT(stream.good(), "Failed to open cache file ", m_file_path, " for writing blob id ", blob_id);
-    write_blob_entry(stream, convert_blob_id(blob_id), writer);
+    const auto cid = convert_blob_id(blob_id);
+    std::unique_lock<std::shared_mutex> lock(m_index_mutex);
+    uint64_t file_end = 0;
+    {
+        std::fstream stream(m_file_path, std::ios::binary | std::ios::in | std::ios::out | std::ios::ate);
+        OPENVINO_ASSERT(stream.good(), "Failed to open cache file ", m_file_path, " for writing blob id ", blob_id);
+        file_end = static_cast<uint64_t>(stream.tellp());
+        write_blob_entry(stream, cid, writer);
+    }
+    const auto size_budget = m_size_budget.load();
+    if (size_budget == 0) {
+        return;
+    }
+    // The blob size is known once it is written. A blob which doesn't fit the budget next to the context records even
+    // alone is dropped: compacting would evict every other blob and then the blob itself.
+    const auto& info = m_blob_index.at(cid);
+    if (m_context_size + blob_index_header_size + estimate_blob_footprint(info.size, info.model_name.size()) >
+        size_budget) {
+        m_blob_index.erase(cid);
+        std::error_code ec;
+        std::filesystem::resize_file(m_file_path, file_end, ec);
+        if (ec) {
+            // e.g. the file is mapped on a platform which doesn't allow resizing mapped files
+            std::ofstream stream(m_file_path, std::ios::binary | std::ios::in | std::ios::ate);
+            write_tlv_record(stream,
+                             static_cast<TLVTraits::TagType>(Tag::BlobRemoved),
+                             sizeof(cid),
+                             reinterpret_cast<const char*>(&cid));
+        }
+        return;
+    }
+    if (static_cast<uint64_t>(util::file_size(m_file_path)) > size_budget) {
+        // The blob is stored already, a failed compaction leaves the storage over budget until the next write
+        try {
+            flush_accesses();
+            compact_index();
+        } catch (...) {
+        }
+    }
 }
 
 void SingleFileStorage::read_cache_entry(const std::string& blob_id, bool enable_mmap, StreamReader reader) {
@@ -250,8 +433,12 @@ void SingleFileStorage::read_cache_entry(const std::string& blob_id, bool enable
 
     const auto cid = convert_blob_id(blob_id);
 
-    if (std::filesystem::exists(m_file_path) && has_blob_id(cid)) {
-        const auto& [blob_pos, blob_size, model_name] = m_blob_index[cid];
+    // The lock is held until the blob is read: compaction moves the blob data
+    std::shared_lock<std::shared_mutex> lock(m_index_mutex);
+    const auto blob_it = m_blob_index.find(cid);
+    if (std::filesystem::exists(m_file_path) && blob_it != m_blob_index.end()) {
+        const bool flush = record_access(cid);
+        const auto& [blob_pos, blob_size, model_name, last_access] = blob_it->second;
         if (enable_mmap) {
             CompiledBlobVariant compiled_blob{std::in_place_index<0>,
                                               read_tensor_data(m_file_path,
@@ -266,10 +453,183 @@ void SingleFileStorage::read_cache_entry(const std::string& blob_id, bool enable
             CompiledBlobVariant compiled_blob{std::in_place_index<1>, std::ref(stream)};
             reader(compiled_blob);
         }
+        if (flush) {
+            lock.unlock();
+            std::unique_lock<std::shared_mutex> flush_lock(m_index_mutex);
+            flush_accesses();
+        }
+    }
+}
+
+void SingleFileStorage::remove_cache_entry(const std::string& blob_id) {
+    ScopedLocale plocal_C(LC_ALL, "C");
+
+    const auto cid = convert_blob_id(blob_id);
+    std::unique_lock<std::shared_mutex> lock(m_index_mutex);
+    if (!has_blob_id(cid)) {
+        return;
     }
+    std::ofstream stream(m_file_path, std::ios::binary | std::ios::in | std::ios::ate);
+    OPENVINO_ASSERT(stream.good(), "Failed to open cache file ", m_file_path, " for removing blob id ", blob_id);
+    write_tlv_record(stream,
+                     static_cast<TLVTraits::TagType>(Tag::BlobRemoved),
+                     sizeof(cid),
+                     reinterpret_cast<const char*>(&cid));
+    m_blob_index.erase(cid);
 }
 
-void SingleFileStorage::remove_cache_entry(const std::string& id) {}
+void SingleFileStorage::set_size_budget(uint64_t size_budget) {
+    m_size_budget = size_budget;
+}
+
+void SingleFileStorage::copy_context_records(std::istream& src, std::ostream& dst) const {
+    const auto constant_meta_copier = [&dst](std::istream& s, TLVTraits::LengthType size) {
+        std::vector<char> value(size);
+        s.read(value.data(), static_cast<std::streamsize>(size));
+        write_tlv_record(dst, static_cast<TLVTraits::TagType>(Tag::ConstantMeta), size, value.data());
+        return s.good() && dst.good();
+    };
+    const auto weight_source_copier = [&dst](std::istream& s, TLVTraits::LengthType size) {
+        constexpr auto header_size = sizeof(DataIdType) + sizeof(DataIdType) + sizeof(PadSizeType);
+        if (size < header_size) {
+            return false;
+        }
+        DataIdType device_id, source_id;
+        PadSizeType padding_size;
+        s.read(reinterpret_cast<char*>(&device_id), sizeof(device_id));
+        s.read(reinterpret_cast<char*>(&source_id), sizeof(source_id));
+        s.read(reinterpret_cast<char*>(&padding_size), sizeof(padding_size));
+        if (!s.good() || padding_size > size - header_size) {
+            return false;
+        }
+        s.seekg(padding_size, std::ios::cur);
+        bool copied = false;
+        write_tlv_record(dst, static_cast<TLVTraits::TagType>(Tag::WeightSource), [&](std::ostream& d) {
+            d.write(reinterpret_cast<const char*>(&device_id), sizeof(device_id));
+            d.write(reinterpret_cast<const char*>(&source_id), sizeof(source_id));
+            write_padding(d, blob_alignment);
+            copied = copy_stream_data(s, d, size - header_size - padding_size);
+        });
+        return copied;
+    };
+    const TLVValueScanner scanners = {
+        {static_cast<TLVTraits::TagType>(Tag::ConstantMeta), constant_meta_copier},
+        {static_cast<TLVTraits::TagType>(Tag::WeightSource), weight_source_copier},
+    };
+    OPENVINO_ASSERT(scan_tlv_records(src, scanners), "Failed to copy context of cache file ", m_file_path);
+}
+
+bool SingleFileStorage::compact() {
+    ScopedLocale plocal_C(LC_ALL, "C");
+    std::unique_lock<std::shared_mutex> lock(m_index_mutex);
+    flush_accesses();
+    return compact_index();
+}
+
+bool SingleFileStorage::compact_index() {
+    auto compacted_path = m_file_path;
+    compacted_path += ".compact";
+    decltype(m_blob_index) compacted_index;
+    uint64_t context_size = 0;
+    try {
+        std::ifstream src(m_file_path, std::ios::binary);
+        OPENVINO_ASSERT(src.good(), "Failed to open cache file ", m_file_path, " for compaction");
+        std::ofstream dst(compacted_path, std::ios::binary | std::ios::trunc);
+        OPENVINO_ASSERT(dst.good(), "Failed to create compacted cache file ", compacted_path);
+
+        util::Version file_version;
+        read_version(src, file_version);
+        write_version(dst, m_version);
+        copy_context_records(src, dst);
+        src.clear();
+        context_size = static_cast<uint64_t>(dst.tellp());
+
+        // Keep the most recently used blobs which fit the budget
+        std::vector<std::pair<BlobIdType, const BlobInfo*>> blobs;
+        blobs.reserve(m_blob_index.size());
+        for (const auto& blob : m_blob_index) {
+            blobs.emplace_back(blob.first, &blob.second);
+        }
+        std::sort(blobs.begin(), blobs.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.second->last_access > rhs.second->last_access;
+        });
+        if (const uint64_t size_budget = m_size_budget; size_budget > 0) {
+            auto estimated_size = context_size + blob_index_header_size;
+            blobs.erase(std::find_if(blobs.begin(),
+                                     blobs.end(),
+                                     [&](const auto& blob) {
+                                         estimated_size += estimate_blob_footprint(blob.second->size,
+                                                                                   blob.second->model_name.size());
+                                         return estimated_size > size_budget;
+                                     }),
+                        blobs.end());
+        }
+        // Copy blobs in the source file order to read it sequentially
+        std::sort(blobs.begin(), blobs.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.second->offset < rhs.second->offset;
+        });
+
+        // The index is written twice: first to reserve its space, then with the offsets of the copied blobs
+        uint64_t region_end = 0;
+        const auto blob_index_writer = [&](std::ostream& s) {
+            const uint64_t blobs_count = blobs.size();
+            s.write(reinterpret_cast<const char*>(&region_end), sizeof(region_end));
+            s.write(reinterpret_cast<const char*>(&blobs_count), sizeof(blobs_count));
+            for (const auto& blob : blobs) {
+                const auto compacted_it = compacted_index.find(blob.first);
+                const auto& info = compacted_it != compacted_index.end() ? compacted_it->second : *blob.second;
+                s.write(reinterpret_cast<const char*>(&blob.first), sizeof(blob.first));
+                s.write(reinterpret_cast<const char*>(&info.offset), sizeof(info.offset));
+                s.write(reinterpret_cast<const char*>(&info.size), sizeof(info.size));
+                s.write(reinterpret_cast<const char*>(&info.last_access), sizeof(info.last_access));
+                write_tlv_string(s, info.model_name);
+            }
+        };
+        const auto index_pos = dst.tellp();
+        write_tlv_record(dst, static_cast<TLVTraits::TagType>(Tag::BlobIndex), blob_index_writer);
+
+        for (const auto& blob : blobs) {
+            const auto blob_id = blob.first;
+            const auto& info = *blob.second;
+            std::streampos blob_pos;
+            src.seekg(static_cast<std::streamoff>(info.offset), std::ios::beg);
+            write_tlv_record(dst, static_cast<TLVTraits::TagType>(Tag::Blob), [&](std::ostream& s) {
+                s.write(reinterpret_cast<const char*>(&blob_id), sizeof(blob_id));
+                write_padding(s, blob_alignment);
+                blob_pos = s.tellp();
+                OPENVINO_ASSERT(copy_stream_data(src, s, info.size),
+                                "Failed to copy blob id ",
+                                blob_id,
+                                " to compacted cache file ",
+                                compacted_path);
+            });
+            write_tlv_record(dst, static_cast<TLVTraits::TagType>(Tag::BlobMap), [&](std::ostream& s) {
+                s.write(reinterpret_cast<const char*>(&blob_id), sizeof(blob_id));
+                write_tlv_string(s, info.model_name);
+            });
+            compacted_index[blob_id] = {static_cast<uint64_t>(blob_pos), info.size, info.model_name, info.last_access};
+        }
+
+        region_end = static_cast<uint64_t>(dst.tellp());
+        dst.seekp(index_pos);
+        write_tlv_record(dst, static_cast<TLVTraits::TagType>(Tag::BlobIndex), blob_index_writer);
+        OPENVINO_ASSERT(dst.good(), "Failed to write compacted cache file ", compacted_path);
+    } catch (...) {
+        std::error_code ec;
+        std::filesystem::remove(compacted_path, ec);
+        throw;
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(compacted_path, m_file_path, ec);
+    if (ec) {
+        std::filesystem::remove(compacted_path, ec);
+        return false;
+    }
+    m_blob_index = std::move(compacted_index);
+    m_context_size = context_size;
+    return true;
+}
 
 std::shared_ptr<wsh::Context> SingleFileStorage::get_context() const {
     return m_shared_context;
@@ -277,7 +637,9 @@ std::shared_ptr<wsh::Context> SingleFileStorage::get_context() const {
 
 void SingleFileStorage::write_context(const weight_sharing::Context& context) {
     ScopedLocale plocal_C(LC_ALL, "C");
+    std::unique_lock<std::shared_mutex> lock(m_index_mutex);
     std::ofstream stream(m_file_path, std::ios::binary | std::ios::in | std::ios::ate);
+    const auto context_begin = stream.tellp();
 
     weight_sharing::WeightRegistry delta_weight_registry;
     for (const auto& [source_id, const_meta_map] : context.m_weight_registry) {
@@ -328,6 +690,11 @@ void SingleFileStorage::write_context(const weight_sharing::Context& context) {
             m_shared_context->m_cache_sources[source_id] = weight_buffer;
         }
     }
+    if (stream.good()) {
+        // compaction realigns the weights, their padding may grow up to the alignment
+        m_context_size +=
+            static_cast<uint64_t>(stream.tellp() - context_begin) + delta_cache_sources.size() * blob_alignment;
+    }
 
     for (const auto& [source_id, buffer] : context.m_runtime_sources) {
         m_shared_context->m_runtime_sources.emplace(source_id, buffer);
@@ -339,6 +706,7 @@ void SingleFileStorage::initialize(std::shared_ptr<ov::wsh::Context> weight_shar
         m_shared_context = std::move(weight_sharing_context);
     }
 
+    std::unique_lock<std::shared_mutex> lock(m_index_mutex);
     if (std::ifstream stream(m_file_path, std::ios::binary); stream.good()) {
         util::Version file_version;
         read_version(stream, file_version);
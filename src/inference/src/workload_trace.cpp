@@ -0,0 +1,70 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "workload_trace.hpp"
+
+#include <sstream>
+
+#include "openvino/core/except.hpp"
+#include "openvino/runtime/icompiled_model.hpp"
+#include "openvino/runtime/properties.hpp"
+
+namespace ov {
+
+WorkloadTrace& WorkloadTrace::get() {
+    static WorkloadTrace trace;
+    return trace;
+}
+
+void WorkloadTrace::open(const std::string& path) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_enabled = false;
+    if (m_file.is_open()) {
+        m_file.close();
+    }
+    m_path = path;
+    if (path.empty()) {
+        return;
+    }
+    m_file.open(path, std::ios::out | std::ios::trunc);
+    OPENVINO_ASSERT(m_file.is_open(), "Failed to create the workload trace file ", path);
+    m_file << "# timestamp_us;model;data_shape\n";
+    m_start = std::chrono::steady_clock::now();
+    m_enabled = true;
+}
+
+std::string WorkloadTrace::path() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_path;
+}
+
+void WorkloadTrace::record(const ov::IAsyncInferRequest& request) {
+    const auto now = std::chrono::steady_clock::now();
+    std::ostringstream line;
+    try {
+        line << request.get_compiled_model()->get_property(ov::model_name.name()).as<std::string>();
+    } catch (const std::exception&) {
+        // the model name is informative only
+    }
+    line << ';';
+    const auto& inputs = request.get_inputs();
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        // the unnamed inputs are replayed by their order
+        const auto& names = inputs[i].get_names();
+        line << (i ? "," : "") << (names.empty() ? "" : inputs[i].get_any_name()) << '[';
+        const auto& shape = request.get_tensor(inputs[i])->get_shape();
+        for (size_t d = 0; d < shape.size(); ++d) {
+            line << (d ? "," : "") << shape[d];
+        }
+        line << ']';
+    }
+    line << '\n';
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_file.is_open()) {
+        m_file << std::chrono::duration_cast<std::chrono::microseconds>(now - m_start).count() << ';' << line.str();
+    }
+}
+
+}  // namespace ov
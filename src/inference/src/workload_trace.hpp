@@ -0,0 +1,62 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+/**
+ * @brief This is a header file for the OpenVINO workload trace recorder
+ *
+ * @file workload_trace.hpp
+ */
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <mutex>
+#include <string>
+
+#include "openvino/runtime/iasync_infer_request.hpp"
+
+namespace ov {
+
+/**
+ * @brief Records the inferences started by the process to the file set by ov::workload_trace, so that the production
+ * mix of the request shapes and arrival times can be replayed by benchmark_app -trace.
+ *
+ * The trace is a text file with a line per inference:
+ *     <microseconds since the recording started>;<model name>;<input shapes>
+ * where the input shapes use the -data_shape syntax of benchmark_app: "input1[1,3,224,224],input2[1,4]".
+ * Lines starting with '#' are comments.
+ */
+class WorkloadTrace {
+public:
+    static WorkloadTrace& get();
+
+    /**
+     * @brief Starts recording to a new file, an empty path stops recording
+     */
+    void open(const std::string& path);
+
+    std::string path() const;
+
+    bool enabled() const {
+        return m_enabled.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Appends the inference which is about to be started by the request
+     */
+    void record(const ov::IAsyncInferRequest& request);
+
+private:
+    WorkloadTrace() = default;
+
+    std::atomic_bool m_enabled{false};
+    mutable std::mutex m_mutex;
+    std::ofstream m_file;
+    std::string m_path;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+}  // namespace ov
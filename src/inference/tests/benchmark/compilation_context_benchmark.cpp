@@ -0,0 +1,92 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <string>
+
+#include "openvino/core/graph_util.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/runtime/aligned_buffer.hpp"
+#include "openvino/runtime/compilation_context.hpp"
+#include "openvino/runtime/core.hpp"
+#include "openvino/runtime/shared_buffer.hpp"
+
+// These benchmarks measure wall-clock timing and are meaningless in a Debug (-O0) build.
+#ifndef NDEBUG
+#    error \
+        "compilation_context_benchmark.cpp must be built in Release mode: rebuild with -DCMAKE_BUILD_TYPE=Release, or delete this #error to build in Debug anyway."
+#endif
+
+// The model hash computation, which is the cost of compile_model with the model cache on a cache hit
+
+namespace ov::test {
+
+namespace {
+
+std::shared_ptr<ov::Model> create_model_with_weights(const std::shared_ptr<ov::AlignedBuffer>& weights) {
+    const ov::Shape shape{weights->size() / sizeof(float)};
+    auto data = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+    auto view = std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::AlignedBuffer>>>(weights->get_ptr<char>(),
+                                                                                       weights->size(),
+                                                                                       weights);
+    auto constant = std::make_shared<ov::op::v0::Constant>(ov::element::f32, shape, view);
+    auto add = std::make_shared<ov::op::v1::Add>(data, constant);
+    auto res = std::make_shared<ov::op::v0::Result>(add);
+    return std::make_shared<ov::Model>(ov::ResultVector{res}, ov::ParameterVector{data});
+}
+
+double hash_ms(const std::shared_ptr<const ov::Model>& model) {
+    const auto start = std::chrono::steady_clock::now();
+    ov::ModelCache::compute_hash(model, {});
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+}  // namespace
+
+class CompilationContextBenchmark : public ::testing::Test {};
+
+// The weights in memory are hashed on every call. The hash of the weights mapped from the IR file is computed once and
+// reused by the next compilations of the model and of its clones.
+TEST_F(CompilationContextBenchmark, hash_of_large_weights) {
+    const auto xml = std::filesystem::temp_directory_path() / "compilation_context_benchmark.xml";
+    auto bin = xml;
+    bin.replace_extension(".bin");
+    ov::Core core;
+
+    printf("\n--- Model hash of the weights ---\n");
+    printf("%-14s | %14s | %14s | %14s | %14s\n",
+           "Weights (MB)",
+           "memory (ms)",
+           "mapped (ms)",
+           "again (ms)",
+           "clone (ms)");
+    printf("---------------+----------------+----------------+----------------+---------------\n");
+    for (const size_t size_mb : {16, 64, 256, 1024}) {
+        const size_t size = size_mb << 20;
+        auto weights = std::make_shared<ov::AlignedBuffer>(size);
+        std::memset(weights->get_ptr(), 1, size);
+        const auto model = create_model_with_weights(weights);
+        const auto memory_ms = hash_ms(model);
+
+        ov::save_model(model, xml.string(), false);
+        const auto mapped = core.read_model(xml.string());
+        const auto mapped_ms = hash_ms(mapped);
+        const auto again_ms = hash_ms(mapped);
+        const auto clone_ms = hash_ms(mapped->clone());
+        printf("%-14zu | %14.2f | %14.2f | %14.2f | %14.2f\n", size_mb, memory_ms, mapped_ms, again_ms, clone_ms);
+    }
+    std::filesystem::remove(xml);
+    std::filesystem::remove(bin);
+}
+
+}  // namespace ov::test
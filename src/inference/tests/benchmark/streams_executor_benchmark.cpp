@@ -0,0 +1,101 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <future>
+#include <thread>
+#include <vector>
+
+#include "openvino/runtime/system_conf.hpp"
+#include "openvino/runtime/threading/cpu_streams_executor.hpp"
+
+// These benchmarks measure wall-clock timing and are meaningless in a Debug (-O0) build.
+#ifndef NDEBUG
+#    error \
+        "streams_executor_benchmark.cpp must be built in Release mode: rebuild with -DCMAKE_BUILD_TYPE=Release, or delete this #error to build in Debug anyway."
+#endif
+
+namespace ov::test {
+
+namespace {
+using ov::threading::CPUStreamsExecutor;
+using ov::threading::IStreamsExecutor;
+using clock_type = std::chrono::steady_clock;
+
+struct RunResult {
+    double tasks_per_sec;
+    double p50_latency_us;
+    double p99_latency_us;
+};
+
+// Submits `tasks_num` empty tasks from `producers_num` threads and records the enqueue -> start latency of each task
+RunResult run_tasks(IStreamsExecutor::Config::TaskScheduling scheduling, int streams, size_t tasks_num) {
+    IStreamsExecutor::Config config{"BenchmarkStreamsExecutor", streams, 1};
+    config.set_task_scheduling(scheduling);
+    auto executor = std::make_shared<CPUStreamsExecutor>(config);
+
+    const size_t producers_num = 4;
+    std::vector<double> latencies_us(tasks_num);
+    std::atomic<size_t> done{0};
+    std::promise<void> all_done;
+
+    const auto start = clock_type::now();
+    std::vector<std::thread> producers;
+    for (size_t producer = 0; producer < producers_num; ++producer) {
+        producers.emplace_back([&, producer] {
+            for (size_t i = producer; i < tasks_num; i += producers_num) {
+                const auto enqueued = clock_type::now();
+                executor->run([&, i, enqueued] {
+                    latencies_us[i] =
+                        std::chrono::duration<double, std::micro>(clock_type::now() - enqueued).count();
+                    if (done.fetch_add(1) + 1 == tasks_num) {
+                        all_done.set_value();
+                    }
+                });
+            }
+        });
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    all_done.get_future().wait();
+    const auto elapsed = std::chrono::duration<double>(clock_type::now() - start).count();
+
+    std::sort(latencies_us.begin(), latencies_us.end());
+    return {static_cast<double>(tasks_num) / elapsed,
+            latencies_us[tasks_num / 2],
+            latencies_us[std::min(tasks_num - 1, tasks_num * 99 / 100)]};
+}
+}  // namespace
+
+class StreamsExecutorBenchmark : public ::testing::Test {};
+
+TEST_F(StreamsExecutorBenchmark, shared_queue_vs_work_stealing) {
+    constexpr size_t tasks_num = 200000;
+    const int max_streams = std::max(1, ov::get_number_of_logical_cpu_cores());
+
+    printf("\n--- Empty tasks submitted from 4 threads (%zu tasks) ---\n", tasks_num);
+    printf("%-8s | %-14s | %14s | %12s | %12s\n", "Streams", "Scheduling", "Tasks/sec", "p50 (us)", "p99 (us)");
+    printf("---------+----------------+----------------+--------------+-------------\n");
+    for (int streams = 1; streams <= max_streams; streams *= 2) {
+        for (auto scheduling : {IStreamsExecutor::Config::TaskScheduling::SHARED_QUEUE,
+                                IStreamsExecutor::Config::TaskScheduling::WORK_STEALING}) {
+            const auto result = run_tasks(scheduling, streams, tasks_num);
+            printf("%-8d | %-14s | %14.0f | %12.2f | %12.2f\n",
+                   streams,
+                   scheduling == IStreamsExecutor::Config::TaskScheduling::SHARED_QUEUE ? "shared_queue"
+                                                                                        : "work_stealing",
+                   result.tasks_per_sec,
+                   result.p50_latency_us,
+                   result.p99_latency_us);
+        }
+    }
+}
+
+}  // namespace ov::test
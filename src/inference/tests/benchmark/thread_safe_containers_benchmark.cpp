@@ -0,0 +1,97 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include "openvino/runtime/threading/thread_safe_containers.hpp"
+
+// These benchmarks measure wall-clock timing and are meaningless in a Debug (-O0) build.
+#ifndef NDEBUG
+#    error \
+        "thread_safe_containers_benchmark.cpp must be built in Release mode: rebuild with -DCMAKE_BUILD_TYPE=Release, or delete this #error to build in Debug anyway."
+#endif
+
+namespace ov::test {
+
+using ov::threading::LockFreeBoundedMPSCQueue;
+using ov::threading::ThreadSafeQueueWithSize;
+
+namespace {
+
+// The way the auto-batching collects the requests: the producers enqueue a batch worth of requests at once and the
+// single consumer takes the batch as soon as it is complete, so the latency from the enqueue of the last request
+// to the start of the batch is measured.
+template <typename Queue>
+double batch_start_latency_us(Queue& queue, int num_producers, int num_batches) {
+    using Clock = std::chrono::steady_clock;
+    std::atomic<int> round{-1};
+    std::vector<double> latencies;
+    std::vector<std::thread> producers;
+    for (int p = 0; p < num_producers; p++) {
+        producers.emplace_back([&] {
+            for (int b = 0; b < num_batches; b++) {
+                while (round.load() < b)
+                    std::this_thread::yield();
+                queue.push_value(Clock::now());
+            }
+        });
+    }
+    Clock::time_point value;
+    for (int b = 0; b < num_batches; b++) {
+        round = b;
+        while (static_cast<int>(queue.size()) != num_producers)
+            ;
+        const auto start = Clock::now();
+        Clock::time_point last_push;
+        for (int n = 0; n < num_producers; n++) {
+            EXPECT_TRUE(queue.try_pop(value));
+            last_push = std::max(last_push, value);
+        }
+        latencies.push_back(std::chrono::duration<double, std::micro>(start - last_push).count());
+    }
+    for (auto& producer : producers)
+        producer.join();
+    std::sort(latencies.begin(), latencies.end());
+    return latencies[latencies.size() / 2];
+}
+
+struct LockedQueue : ThreadSafeQueueWithSize<std::chrono::steady_clock::time_point> {
+    void push_value(std::chrono::steady_clock::time_point value) {
+        push(value);
+    }
+};
+
+struct LockFreeQueue : LockFreeBoundedMPSCQueue<std::chrono::steady_clock::time_point> {
+    void push_value(std::chrono::steady_clock::time_point value) {
+        EXPECT_TRUE(try_push(value));
+    }
+};
+
+}  // namespace
+
+class ThreadSafeContainersBenchmark : public ::testing::Test {};
+
+// Reports the median latency for both queues, the numbers depend on the machine too much to be compared here
+TEST_F(ThreadSafeContainersBenchmark, batch_start_latency) {
+    constexpr int num_producers = 4;
+    constexpr int num_batches = 500;
+    LockedQueue locked;
+    LockFreeQueue lock_free;
+    lock_free.set_capacity(num_producers);
+
+    printf("\n--- Batch of %d requests from %d threads (%d batches) ---\n", num_producers, num_producers, num_batches);
+    printf("%-10s | %12s\n", "Queue", "p50 (us)");
+    printf("-----------+-------------\n");
+    printf("%-10s | %12.2f\n", "locked", batch_start_latency_us(locked, num_producers, num_batches));
+    printf("%-10s | %12.2f\n", "lock_free", batch_start_latency_us(lock_free, num_producers, num_batches));
+}
+
+}  // namespace ov::test
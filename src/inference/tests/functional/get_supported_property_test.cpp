@@ -4,6 +4,8 @@
 
 #include <gtest/gtest.h>
 
+#include <cstdio>
+#include <fstream>
 #include <string>
 
 #include "common_test_utils/file_utils.hpp"
@@ -148,6 +150,62 @@ TEST(PropertyTest, SetTBBForceTerminatePropertyCoreNoThrow) {
     EXPECT_TRUE(value);
 }
 
+TEST(PropertyTest, SetWorkloadTracePropertyCoreNoThrow) {
+    ov::Core core;
+
+    ov::Any value;
+    OV_ASSERT_NO_THROW(core.set_property(ov::workload_trace("./tmp_workload.trace")));
+    OV_ASSERT_NO_THROW(value = core.get_property(ov::workload_trace.name()));
+    EXPECT_EQ(value.as<std::string>(), std::string("./tmp_workload.trace"));
+    OV_ASSERT_NO_THROW(core.set_property(ov::workload_trace("")));
+    OV_ASSERT_NO_THROW(value = core.get_property(ov::workload_trace.name()));
+    EXPECT_EQ(value.as<std::string>(), std::string());
+
+    std::ifstream trace("./tmp_workload.trace");
+    std::string header;
+    ASSERT_TRUE(std::getline(trace, header));
+    EXPECT_EQ(header.front(), '#');
+    trace.close();
+    std::remove("./tmp_workload.trace");
+}
+
+TEST(PropertyTest, SetCacheSizeBudgetPropertyCoreNoThrow) {
+    ov::Core core;
+
+    uint64_t value = 1;
+    OV_ASSERT_NO_THROW(value = core.get_property(ov::cache_size_budget.name()).as<uint64_t>());
+    EXPECT_EQ(value, 0u);
+    OV_ASSERT_NO_THROW(core.set_property(ov::cache_size_budget(1 << 20)));
+    OV_ASSERT_NO_THROW(value = core.get_property(ov::cache_size_budget.name()).as<uint64_t>());
+    EXPECT_EQ(value, 1u << 20);
+}
+
+TEST(PropertyTest, SetTensorMemoryPoolPropertyCoreNoThrow) {
+    ov::Core core;
+
+    bool value = false;
+    OV_ASSERT_NO_THROW(core.set_property(ov::tensor_memory_pool(true)));
+    OV_ASSERT_NO_THROW(value = core.get_property(ov::tensor_memory_pool.name()).as<bool>());
+    EXPECT_TRUE(value);
+
+    using Statistics = decltype(ov::tensor_memory_pool_statistics)::value_type;
+    const auto allocations =
+        core.get_property(ov::tensor_memory_pool_statistics.name()).as<Statistics>().at("allocations");
+    {
+        ov::Tensor tensor(ov::element::f32, {1, 3, 16, 16});
+        tensor.data<float>()[0] = 1.f;
+    }
+    Statistics statistics;
+    OV_ASSERT_NO_THROW(statistics = core.get_property(ov::tensor_memory_pool_statistics.name()).as<Statistics>());
+    EXPECT_EQ(statistics.at("allocations"), allocations + 1);
+
+    OV_ASSERT_NO_THROW(core.set_property(ov::tensor_memory_pool(false)));
+    OV_ASSERT_NO_THROW(value = core.get_property(ov::tensor_memory_pool.name()).as<bool>());
+    EXPECT_FALSE(value);
+    OV_ASSERT_NO_THROW(statistics = core.get_property(ov::tensor_memory_pool_statistics.name()).as<Statistics>());
+    EXPECT_EQ(statistics.at("cached_bytes"), 0u);
+}
+
 TEST(PropertyTest, GetUnsupportedPropertyCoreThrow) {
     ov::Core core;
 
@@ -236,6 +236,13 @@ static auto Executors = ::testing::Values(
         return std::make_shared<CPUStreamsExecutor>(
             IStreamsExecutor::Config{"TestCPUStreamsExecutor", streams, threads / streams});
     },
+    [] {
+        auto streams = get_number_of_logical_cpu_cores(false);
+        auto threads = parallel_get_max_threads();
+        IStreamsExecutor::Config config{"TestWorkStealingCPUStreamsExecutor", streams, threads / streams};
+        config.set_task_scheduling(IStreamsExecutor::Config::TaskScheduling::WORK_STEALING);
+        return std::make_shared<CPUStreamsExecutor>(config);
+    },
     [] {
         return std::make_shared<ImmediateExecutor>();
     });
@@ -260,6 +267,13 @@ static auto AsyncExecutors = ::testing::Values(
         auto threads = parallel_get_max_threads();
         return std::make_shared<CPUStreamsExecutor>(
             IStreamsExecutor::Config{"TestCPUStreamsExecutor", streams, threads / streams});
+    },
+    [] {
+        auto streams = get_number_of_logical_cpu_cores(false);
+        auto threads = parallel_get_max_threads();
+        IStreamsExecutor::Config config{"TestWorkStealingCPUStreamsExecutor", streams, threads / streams};
+        config.set_task_scheduling(IStreamsExecutor::Config::TaskScheduling::WORK_STEALING);
+        return std::make_shared<CPUStreamsExecutor>(config);
     });
 
 INSTANTIATE_TEST_SUITE_P(ASyncTaskExecutorTests, ASyncTaskExecutorTests, AsyncExecutors);
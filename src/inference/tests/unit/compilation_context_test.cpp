@@ -7,6 +7,7 @@
 #include <gtest/gtest.h>
 
 #include <chrono>
+#include <cstring>
 #include <fstream>
 #include <string>
 #include <thread>
@@ -18,6 +19,7 @@
 #include "openvino/op/constant.hpp"
 #include "openvino/op/multiply.hpp"
 #include "openvino/op/parameter.hpp"
+#include "openvino/runtime/shared_buffer.hpp"
 #include "transformations/rt_info/fused_names_attribute.hpp"
 #include "transformations/rt_info/primitives_priority_attribute.hpp"
 
@@ -143,6 +145,27 @@ static std::shared_ptr<ov::Model> create_simple_model() {
     return model;
 }
 
+// Parameter--->Add--->Result
+//   Constant---'
+// where the constant is a view of the weights buffer, like the ones created by the IR frontend
+static std::shared_ptr<ov::Model> create_model_with_weights(const std::shared_ptr<ov::AlignedBuffer>& weights) {
+    const ov::Shape shape{weights->size() / sizeof(float)};
+    auto data = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+    auto view = std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::AlignedBuffer>>>(weights->get_ptr<char>(),
+                                                                                       weights->size(),
+                                                                                       weights);
+    auto constant = std::make_shared<ov::op::v0::Constant>(ov::element::f32, shape, view);
+    auto add = std::make_shared<ov::op::v1::Add>(data, constant);
+    auto res = std::make_shared<ov::op::v0::Result>(add);
+    return std::make_shared<ov::Model>(ov::ResultVector{res}, ov::ParameterVector{data});
+}
+
+static std::shared_ptr<ov::AlignedBuffer> create_weights(size_t size, char value) {
+    auto weights = std::make_shared<ov::AlignedBuffer>(size);
+    std::memset(weights->get_ptr(), value, size);
+    return weights;
+}
+
 static void checkCustomRt(const std::function<void(Node::RTMap&)>& emptyCb,
                           const std::function<void(Node::RTMap&, const std::string& name)>& nameCb) {
     auto model1 = create_simple_model();
@@ -349,6 +372,30 @@ TEST(NetworkContext, HashOfSameMultiThreading) {
     ASSERT_FALSE(fail);
 }
 
+TEST(NetworkContext, HashOfLargeWeights) {
+    // three chunks hashed in parallel, the last one is partial
+    constexpr size_t size = (32 << 20) + 4096;
+    auto weights1 = create_weights(size, 1);
+    auto weights2 = create_weights(size, 1);
+    static_cast<char*>(weights2->get_ptr())[size - 1] = 2;
+
+    ASSERT_EQ(ov::ModelCache::compute_hash(create_model_with_weights(weights1), {}),
+              ov::ModelCache::compute_hash(create_model_with_weights(create_weights(size, 1)), {}));
+    ASSERT_NE(ov::ModelCache::compute_hash(create_model_with_weights(weights1), {}),
+              ov::ModelCache::compute_hash(create_model_with_weights(weights2), {}));
+}
+
+TEST(NetworkContext, HashOfModifiedWeights) {
+    // the weights which are not mapped from a file may be modified in place, so their hash is not reused
+    constexpr size_t size = 1 << 20;
+    auto weights = create_weights(size, 1);
+    const auto model = create_model_with_weights(weights);
+    const auto hash = ov::ModelCache::compute_hash(model, {});
+
+    static_cast<char*>(weights->get_ptr())[size / 2] = 2;
+    ASSERT_NE(hash, ov::ModelCache::compute_hash(model, {}));
+}
+
 ////////////////////////////////////////////
 
 TEST(NetworkContext_ModelName, HashOfSame) {
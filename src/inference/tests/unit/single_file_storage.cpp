@@ -6,6 +6,10 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
 #include "common_test_utils/common_utils.hpp"
 #include "common_test_utils/file_utils.hpp"
 #include "common_test_utils/test_assertions.hpp"
@@ -158,41 +162,239 @@ TEST_F(SingleFileStorageTest, BlobAlignment) {
     }
 }
 
-TEST_F(SingleFileStorageTest, AppendOnlyCacheEntry) {
+TEST_F(SingleFileStorageTest, RemoveCacheEntry) {
     const auto blob_id = std::string{"123"};
     m_storage->write_cache_entry(blob_id, [&](std::ostream& s) {
         // Although pointless it shall be harmless to write nothing
     });
-    EXPECT_NO_THROW(m_storage->remove_cache_entry(blob_id));  // removal does nothing => expect legit read
-    bool read_called = false;
-    EXPECT_NO_THROW(m_storage->read_cache_entry(blob_id, false, [&](const ICacheManager::CompiledBlobVariant&) {
-        read_called = true;
-    }));
-    EXPECT_TRUE(read_called);
-
     OV_EXPECT_THROW_HAS_SUBSTRING(m_storage->write_cache_entry(blob_id, [&](std::ostream&) {}),
                                   ov::AssertFailure,
                                   blob_id + " already exists in cache");
+    EXPECT_NO_THROW(m_storage->remove_cache_entry(blob_id));
+    EXPECT_NO_THROW(m_storage->read_cache_entry(blob_id, false, [](const ICacheManager::CompiledBlobVariant&) {
+        throw "Unexpected read for removed blob id";
+    }));
+    EXPECT_NO_THROW(m_storage->remove_cache_entry("987")) << "Removal of non-existing blob id should be no-op";
     m_storage.reset();
 
     SingleFileStorage reopened_storage(m_file_path);
     reopened_storage.initialize();
-    OV_EXPECT_THROW_HAS_SUBSTRING(reopened_storage.write_cache_entry(blob_id, [&](std::ostream&) {}),
-                                  ov::AssertFailure,
-                                  blob_id + " already exists in cache");
-
-    EXPECT_NO_THROW(reopened_storage.read_cache_entry("987", false, [](const ICacheManager::CompiledBlobVariant&) {
-        throw "Unexpected read for not stored blob id";
+    EXPECT_NO_THROW(reopened_storage.read_cache_entry(blob_id, false, [](const ICacheManager::CompiledBlobVariant&) {
+        throw "Unexpected read for removed blob id";
     }));
-    EXPECT_NO_THROW(reopened_storage.remove_cache_entry("987")) << "Removal of non-existing blob id should be no-op";
+    EXPECT_NO_THROW(reopened_storage.write_cache_entry(blob_id, [&](std::ostream&) {}))
+        << "Removed blob id should be writable again";
 
-    read_called = false;
+    bool read_called = false;
     EXPECT_NO_THROW(reopened_storage.read_cache_entry(blob_id, false, [&](const ICacheManager::CompiledBlobVariant&) {
         read_called = true;
     }));
     EXPECT_TRUE(read_called);
 }
 
+namespace {
+void write_blob(SingleFileStorage& storage, const std::string& blob_id, size_t size, uint8_t value) {
+    const std::vector<uint8_t> data(size, value);
+    storage.write_cache_entry(blob_id, [&](std::ostream& s) {
+        s.write(reinterpret_cast<const char*>(data.data()), data.size());
+    });
+}
+
+bool read_blob(SingleFileStorage& storage, const std::string& blob_id, size_t size, uint8_t value) {
+    bool read_valid = false;
+    storage.read_cache_entry(blob_id, true, [&](const ICacheManager::CompiledBlobVariant& compiled_blob) {
+        const auto& tensor = std::get<const ov::Tensor>(compiled_blob);
+        const auto data = static_cast<const uint8_t*>(tensor.data());
+        read_valid = tensor.get_byte_size() == size &&
+                     reinterpret_cast<uintptr_t>(data) % SingleFileStorage::blob_alignment == 0 &&
+                     std::all_of(data, data + size, [&](uint8_t v) {
+                         return v == value;
+                     });
+    });
+    return read_valid;
+}
+}  // namespace
+
+TEST_F(SingleFileStorageTest, CompactDropsRemovedBlobs) {
+    const auto blob_size = 3 * SingleFileStorage::blob_alignment + 7;
+    write_blob(*m_storage, "1", blob_size, 0x11);
+    write_blob(*m_storage, "2", blob_size, 0x22);
+    write_blob(*m_storage, "3", blob_size, 0x33);
+    m_storage->remove_cache_entry("2");
+    const auto file_size_before = test::utils::fileSize(m_file_path.string());
+
+    ASSERT_TRUE(m_storage->compact());
+    EXPECT_LT(test::utils::fileSize(m_file_path.string()), file_size_before);
+    EXPECT_TRUE(read_blob(*m_storage, "1", blob_size, 0x11));
+    EXPECT_FALSE(read_blob(*m_storage, "2", blob_size, 0x22));
+    EXPECT_TRUE(read_blob(*m_storage, "3", blob_size, 0x33));
+
+    // Blobs appended after compaction are read from outside of the indexed region
+    write_blob(*m_storage, "4", blob_size, 0x44);
+    m_storage.reset();
+
+    SingleFileStorage reopened_storage(m_file_path);
+    reopened_storage.initialize();
+    EXPECT_TRUE(read_blob(reopened_storage, "1", blob_size, 0x11));
+    EXPECT_FALSE(read_blob(reopened_storage, "2", blob_size, 0x22));
+    EXPECT_TRUE(read_blob(reopened_storage, "3", blob_size, 0x33));
+    EXPECT_TRUE(read_blob(reopened_storage, "4", blob_size, 0x44));
+}
+
+TEST_F(SingleFileStorageTest, CompactWritesBlobIndex) {
+    write_blob(*m_storage, "1", 100, 0x11);
+    write_blob(*m_storage, "2", 200, 0x22);
+    ASSERT_TRUE(m_storage->compact());
+    m_storage.reset();
+
+    std::ifstream stream(m_file_path, std::ios::binary);
+    stream.seekg(version_size(), std::ios::beg);
+    SingleFileStorage::Tag tag;
+    TLVTraits::LengthType length;
+    uint64_t region_end, blobs_count;
+    stream.read(reinterpret_cast<char*>(&tag), sizeof(tag));
+    stream.read(reinterpret_cast<char*>(&length), sizeof(length));
+    stream.read(reinterpret_cast<char*>(&region_end), sizeof(region_end));
+    stream.read(reinterpret_cast<char*>(&blobs_count), sizeof(blobs_count));
+    ASSERT_TRUE(stream.good());
+    EXPECT_EQ(tag, SingleFileStorage::Tag::BlobIndex);
+    EXPECT_EQ(blobs_count, 2u);
+    EXPECT_EQ(region_end, static_cast<uint64_t>(test::utils::fileSize(m_file_path.string())));
+}
+
+TEST_F(SingleFileStorageTest, CompactKeepsContext) {
+    weight_sharing::Context test_context;
+    test_context.m_weight_registry[1][11] = {100, 200, element::Type_t::f32};
+    const auto buffer = std::make_shared<ov::AlignedBuffer>(1024);
+    test_context.m_cache_sources[1].m_weights = buffer;
+    m_storage->write_context(test_context);
+    write_blob(*m_storage, "1", 100, 0x11);
+    m_storage->remove_cache_entry("1");
+    ASSERT_TRUE(m_storage->compact());
+    m_storage.reset();
+
+    SingleFileStorage reopened_storage(m_file_path);
+    reopened_storage.initialize();
+    const auto got_context = reopened_storage.get_context();
+    ASSERT_EQ(got_context->m_weight_registry.count(1), 1);
+    EXPECT_EQ(got_context->m_weight_registry[1].count(11), 1);
+    EXPECT_EQ(got_context->m_cache_sources.count(1), 1);
+    EXPECT_FALSE(read_blob(reopened_storage, "1", 100, 0x11));
+}
+
+TEST_F(SingleFileStorageTest, SizeBudgetEvictsLeastRecentlyUsed) {
+    const auto blob_size = 4 * SingleFileStorage::blob_alignment;
+    write_blob(*m_storage, "1", blob_size, 0x11);
+    write_blob(*m_storage, "2", blob_size, 0x22);
+    write_blob(*m_storage, "3", blob_size, 0x33);
+    m_storage.reset();
+
+    SingleFileStorage storage(m_file_path);
+    storage.initialize();
+    EXPECT_TRUE(read_blob(storage, "1", blob_size, 0x11));  // blob "2" becomes the least recently used one
+    // Budget fits three blobs only
+    const auto size_budget = 3 * blob_size + 4 * SingleFileStorage::blob_alignment;
+    storage.set_size_budget(size_budget);
+    write_blob(storage, "4", blob_size, 0x44);
+    EXPECT_LE(test::utils::fileSize(m_file_path.string()), size_budget);
+
+    EXPECT_TRUE(read_blob(storage, "1", blob_size, 0x11));
+    EXPECT_FALSE(read_blob(storage, "2", blob_size, 0x22));
+    EXPECT_TRUE(read_blob(storage, "3", blob_size, 0x33));
+    EXPECT_TRUE(read_blob(storage, "4", blob_size, 0x44));
+}
+
+TEST_F(SingleFileStorageTest, FailedCompactionKeepsWrittenBlob) {
+    const auto blob_size = 4 * SingleFileStorage::blob_alignment;
+    write_blob(*m_storage, "1", blob_size, 0x11);
+    // The compacted file cannot be created in place of a directory
+    auto compacted_path = m_file_path;
+    compacted_path += ".compact";
+    std::filesystem::create_directory(compacted_path);
+    // Budget fits one blob only
+    m_storage->set_size_budget(blob_size + 3 * SingleFileStorage::blob_alignment);
+
+    EXPECT_NO_THROW(write_blob(*m_storage, "2", blob_size, 0x22));
+    std::filesystem::remove(compacted_path);
+    EXPECT_TRUE(read_blob(*m_storage, "1", blob_size, 0x11));
+    EXPECT_TRUE(read_blob(*m_storage, "2", blob_size, 0x22));
+}
+
+TEST_F(SingleFileStorageTest, SizeBudgetSkipsBlobLargerThanBudget) {
+    const auto blob_size = 4 * SingleFileStorage::blob_alignment;
+    write_blob(*m_storage, "1", blob_size, 0x11);
+    write_blob(*m_storage, "2", blob_size, 0x22);
+    const auto size_budget = 3 * blob_size + 4 * SingleFileStorage::blob_alignment;
+    m_storage->set_size_budget(size_budget);
+    const auto file_size = test::utils::fileSize(m_file_path.string());
+
+    // The blob is not stored instead of evicting the blobs which fit
+    EXPECT_NO_THROW(write_blob(*m_storage, "3", 4 * blob_size, 0x33));
+    EXPECT_EQ(test::utils::fileSize(m_file_path.string()), file_size);
+    EXPECT_FALSE(read_blob(*m_storage, "3", 4 * blob_size, 0x33));
+    EXPECT_TRUE(read_blob(*m_storage, "1", blob_size, 0x11));
+    EXPECT_TRUE(read_blob(*m_storage, "2", blob_size, 0x22));
+
+    m_storage.reset();
+    SingleFileStorage storage(m_file_path);
+    storage.initialize();
+    EXPECT_FALSE(read_blob(storage, "3", 4 * blob_size, 0x33));
+    EXPECT_TRUE(read_blob(storage, "1", blob_size, 0x11));
+    EXPECT_TRUE(read_blob(storage, "2", blob_size, 0x22));
+}
+
+TEST_F(SingleFileStorageTest, SizeBudgetBelowContextSkipsCompaction) {
+    const auto blob_size = 4 * SingleFileStorage::blob_alignment;
+    // The removed blob stays in the file until a compaction
+    write_blob(*m_storage, "1", blob_size, 0x11);
+    m_storage->remove_cache_entry("1");
+
+    weight_sharing::Context test_context;
+    const auto buffer = std::make_shared<ov::AlignedBuffer>(4 * blob_size);
+    test_context.m_cache_sources[1].m_weights = std::weak_ptr<ov::AlignedBuffer>{buffer};
+    m_storage->write_context(test_context);
+    m_storage->set_size_budget(2 * blob_size);
+    const auto file_size = test::utils::fileSize(m_file_path.string());
+
+    // The context alone exceeds the budget, no blob fits and the writes don't compact the storage
+    for (size_t i = 0; i < 3; ++i) {
+        EXPECT_NO_THROW(write_blob(*m_storage, std::to_string(2 + i), blob_size, 0x22));
+        EXPECT_EQ(test::utils::fileSize(m_file_path.string()), file_size);
+        EXPECT_FALSE(read_blob(*m_storage, std::to_string(2 + i), blob_size, 0x22));
+    }
+}
+
+TEST_F(SingleFileStorageTest, ReadDuringCompaction) {
+    const auto blob_size = 2 * SingleFileStorage::blob_alignment + 3;
+    write_blob(*m_storage, "1", blob_size, 0x11);
+    write_blob(*m_storage, "2", blob_size, 0x22);
+
+    std::atomic_bool done{false};
+    std::atomic_size_t invalid_reads{0};
+    std::vector<std::thread> readers;
+    for (size_t i = 0; i < 4; ++i) {
+        readers.emplace_back([&, i] {
+            const auto blob_id = i % 2 == 0 ? std::string{"1"} : std::string{"2"};
+            const uint8_t value = i % 2 == 0 ? 0x11 : 0x22;
+            while (!done) {
+                if (!read_blob(*m_storage, blob_id, blob_size, value)) {
+                    ++invalid_reads;
+                }
+            }
+        });
+    }
+    for (size_t i = 0; i < 20; ++i) {
+        write_blob(*m_storage, std::to_string(100 + i), blob_size, static_cast<uint8_t>(i));
+        m_storage->remove_cache_entry(std::to_string(100 + i));
+        m_storage->compact();
+    }
+    done = true;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    EXPECT_EQ(invalid_reads, 0u);
+}
+
 // Large blob test: write >= 4 MB so that the real DEFAULT_THRESHOLD (4 MB) in
 // ParallelReadStreamBuf is crossed on the non-mmap read path.  This exercises
 // the SingleFileStorage → ParallelReadStreamBuf integration end-to-end,
@@ -457,6 +659,22 @@ INSTANTIATE_TEST_SUITE_P(
                                [](std::ostream& s) {
                                    s.put('c');
                                }},
+                         sfstp{SingleFileStorage::Tag::BlobRemoved,
+                               [](std::ostream& s) {
+                                   s.put('d');
+                               }},
+                         sfstp{SingleFileStorage::Tag::BlobAccess,
+                               [](std::ostream& s) {
+                                   const SingleFileStorage::BlobIdType id = 0x7531;
+                                   s.write(reinterpret_cast<const char*>(&id), sizeof(id));
+                               }},
+                         sfstp{SingleFileStorage::Tag::BlobIndex,
+                               [](std::ostream& s) {
+                                   const uint64_t region_end = 0x10000000;
+                                   const uint64_t blobs_count = 0;
+                                   s.write(reinterpret_cast<const char*>(&region_end), sizeof(region_end));
+                                   s.write(reinterpret_cast<const char*>(&blobs_count), sizeof(blobs_count));
+                               }},
                          sfstp{SingleFileStorage::Tag::WeightSource, [](std::ostream& s) {
                                    const SingleFileStorage::DataIdType device_id = 9;
                                    const SingleFileStorage::DataIdType source_id = 10;
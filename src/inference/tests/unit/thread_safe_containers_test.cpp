@@ -0,0 +1,70 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/runtime/threading/thread_safe_containers.hpp"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <utility>
+#include <vector>
+
+using ov::threading::LockFreeBoundedMPSCQueue;
+
+TEST(LockFreeBoundedMPSCQueueTest, CapacityIsRespected) {
+    LockFreeBoundedMPSCQueue<int> queue;
+    // no capacity set yet
+    EXPECT_FALSE(queue.try_push(0));
+
+    queue.set_capacity(3);  // rounded up to 4
+    for (int i = 0; i < 4; i++)
+        EXPECT_TRUE(queue.try_push(i));
+    EXPECT_FALSE(queue.try_push(4));
+    EXPECT_EQ(queue.size(), 4u);
+
+    int value = -1;
+    for (int i = 0; i < 4; i++) {
+        ASSERT_TRUE(queue.try_pop(value));
+        EXPECT_EQ(value, i);
+    }
+    EXPECT_FALSE(queue.try_pop(value));
+    EXPECT_EQ(queue.size(), 0u);
+
+    // the cells are reused on the next lap
+    EXPECT_TRUE(queue.try_push(5));
+    ASSERT_TRUE(queue.try_pop(value));
+    EXPECT_EQ(value, 5);
+}
+
+TEST(LockFreeBoundedMPSCQueueTest, ManyProducersSingleConsumer) {
+    constexpr int num_producers = 4;
+    constexpr int per_producer = 20000;
+    LockFreeBoundedMPSCQueue<std::pair<int, int>> queue;
+    queue.set_capacity(16);
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < num_producers; p++) {
+        producers.emplace_back([&queue, p] {
+            for (int i = 0; i < per_producer; i++) {
+                while (!queue.try_push({p, i}))
+                    std::this_thread::yield();
+            }
+        });
+    }
+    // every value is seen exactly once and in the order of its producer
+    std::vector<int> next(num_producers, 0);
+    std::pair<int, int> value;
+    for (int received = 0; received < num_producers * per_producer;) {
+        if (!queue.try_pop(value)) {
+            std::this_thread::yield();
+            continue;
+        }
+        ASSERT_EQ(value.second, next[value.first]);
+        next[value.first]++;
+        received++;
+    }
+    for (auto& producer : producers)
+        producer.join();
+    EXPECT_EQ(queue.size(), 0u);
+}
@@ -0,0 +1,106 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include "adaptive_batching.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "openvino/core/except.hpp"
+
+namespace ov {
+namespace autobatch_plugin {
+
+namespace {
+// smoothing factors of the averages and of the mean deviation, as recommended by RFC 6298
+constexpr double mean_gain = 1.0 / 8;
+constexpr double deviation_gain = 1.0 / 4;
+// the execution time bound is the average plus this many mean deviations
+constexpr double deviation_factor = 4.0;
+}  // namespace
+
+AdaptiveBatching::AdaptiveBatching(size_t batch_size, std::chrono::milliseconds latency_target)
+    : m_batch_size(batch_size),
+      m_latency_target(latency_target) {
+    OPENVINO_ASSERT(m_batch_size > 0, "Batch size for the adaptive batching must be > 0");
+    OPENVINO_ASSERT(m_latency_target.count() > 0, "Latency target for the adaptive batching must be > 0");
+}
+
+AdaptiveBatching::Clock::time_point AdaptiveBatching::on_arrival(Clock::time_point now) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_has_arrival) {
+        // an idle period longer than the target tells nothing about the rate within the collection window
+        const auto gap = static_cast<double>(std::min(now - m_last_arrival, m_latency_target).count());
+        m_arrival_interval = m_arrival_interval == 0.0 ? gap : m_arrival_interval + mean_gain * (gap - m_arrival_interval);
+    }
+    m_last_arrival = now;
+    m_has_arrival = true;
+    m_pending.push_back(now);
+    return execute_at_unlocked(m_pending.size());
+}
+
+void AdaptiveBatching::on_dispatch(size_t count) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    count = std::min(count, m_pending.size());
+    m_pending.erase(m_pending.begin(), m_pending.begin() + count);
+}
+
+void AdaptiveBatching::on_executed(Clock::duration duration) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const auto sample = static_cast<double>(duration.count());
+    if (!m_has_execution) {
+        m_execution_time = sample;
+        m_execution_time_deviation = sample / 2;
+        m_has_execution = true;
+        return;
+    }
+    m_execution_time_deviation += deviation_gain * (std::abs(sample - m_execution_time) - m_execution_time_deviation);
+    m_execution_time += mean_gain * (sample - m_execution_time);
+}
+
+AdaptiveBatching::Clock::duration AdaptiveBatching::execution_time_bound_unlocked() const {
+    // nothing is known before the first execution, so half of the target is reserved for it
+    if (!m_has_execution)
+        return m_latency_target / 2;
+    return Clock::duration(
+        static_cast<Clock::rep>(m_execution_time + deviation_factor * m_execution_time_deviation));
+}
+
+AdaptiveBatching::Clock::duration AdaptiveBatching::execution_time_bound() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return execution_time_bound_unlocked();
+}
+
+AdaptiveBatching::Clock::duration AdaptiveBatching::arrival_interval() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return Clock::duration(static_cast<Clock::rep>(m_arrival_interval));
+}
+
+AdaptiveBatching::Clock::time_point AdaptiveBatching::execute_at(size_t queued) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return execute_at_unlocked(queued);
+}
+
+AdaptiveBatching::Clock::time_point AdaptiveBatching::execute_at_unlocked(size_t queued) const {
+    if (queued == 0 || m_pending.empty())
+        return Clock::time_point::max();
+    const auto oldest = m_pending.front();
+    if (queued >= m_batch_size)
+        return oldest;
+    const auto execution_time = execution_time_bound_unlocked();
+    // the target cannot be met anyway, waiting for more requests only makes it worse
+    if (execution_time >= m_latency_target)
+        return oldest;
+    const auto deadline = oldest + (m_latency_target - execution_time);
+    // the batch is not expected to fill by the deadline: a partial batch takes as long as the full one, so waiting
+    // would only add to the latency (under the load the batch in flight keeps collecting the requests anyway)
+    const auto interval = Clock::duration(static_cast<Clock::rep>(m_arrival_interval));
+    if (interval.count() > 0 && m_last_arrival + interval * static_cast<Clock::rep>(m_batch_size - queued) > deadline)
+        return oldest;
+    return deadline;
+}
+
+}  // namespace autobatch_plugin
+}  // namespace ov
@@ -0,0 +1,74 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <chrono>
+#include <deque>
+#include <mutex>
+
+#include "plugin.hpp"
+
+namespace ov {
+namespace autobatch_plugin {
+
+/**
+ * @brief Decides how long a batch is collected for, so that the requests meet the latency target.
+ *
+ * The inter-arrival time of the requests and the execution time of the batched request are estimated online. The
+ * oldest request in the queue may wait for the others as long as its wait plus the (pessimistic) execution time stays
+ * within the target; the batch is executed earlier when it is full or when it is not expected to fill by that
+ * deadline, so the batch size follows the load: full batches under a heavy load and immediate execution of single
+ * requests under a light one.
+ */
+class AdaptiveBatching {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    AdaptiveBatching(size_t batch_size, std::chrono::milliseconds latency_target);
+
+    /**
+     * @brief A request is queued for the batch, must be called before the request is visible to the worker
+     * @return execute_at() of all the queued requests including this one, so that the producer can tell whether the
+     * worker has to be woken up without taking the lock once more
+     */
+    Clock::time_point on_arrival(Clock::time_point now);
+
+    /// The `count` oldest queued requests are handed over to the execution
+    void on_dispatch(size_t count);
+
+    /// The batched request has completed after `duration`
+    void on_executed(Clock::duration duration);
+
+    /// The point in time the `queued` oldest requests have to be executed at, Clock::time_point::max() if none
+    Clock::time_point execute_at(size_t queued) const;
+
+    /// Estimate of the execution time of the batched request, which is exceeded by the rare outliers only
+    Clock::duration execution_time_bound() const;
+
+    /// Average time between the arrivals, zero until the second arrival
+    Clock::duration arrival_interval() const;
+
+private:
+    Clock::duration execution_time_bound_unlocked() const;
+    Clock::time_point execute_at_unlocked(size_t queued) const;
+
+    const size_t m_batch_size;
+    const Clock::duration m_latency_target;
+
+    mutable std::mutex m_mutex;
+    // arrival times of the requests waiting in the queue, the oldest first
+    std::deque<Clock::time_point> m_pending;
+    Clock::time_point m_last_arrival;
+    bool m_has_arrival = false;
+    // exponentially weighted moving averages, in the spirit of the TCP retransmission timer (RFC 6298)
+    double m_arrival_interval = 0.0;
+    double m_execution_time = 0.0;
+    double m_execution_time_deviation = 0.0;
+    bool m_has_execution = false;
+};
+
+}  // namespace autobatch_plugin
+}  // namespace ov
@@ -65,8 +65,22 @@ AsyncInferRequest::AsyncInferRequest(const std::shared_ptr<SyncInferRequest>& re
                 std::pair<AsyncInferRequest*, ov::threading::Task> t;
                 t.first = _this;
                 t.second = std::move(task);
-                workerInferRequest->_tasks.push(t);
-                // it is ok to call size() here as the queue only grows (and the bulk removal happens under the mutex)
+                if (workerInferRequest->_adaptive) {
+                    const auto due = workerInferRequest->_adaptive->on_arrival(std::chrono::steady_clock::now());
+                    OPENVINO_ASSERT(workerInferRequest->_tasks.try_push(std::move(t)));
+                    // the mutex is taken only when the sleeping worker has to act earlier than it planned to
+                    if (workerInferRequest->_is_waiting &&
+                        due.time_since_epoch().count() < workerInferRequest->_wake_at) {
+                        {
+                            std::lock_guard<std::mutex> lock(workerInferRequest->_mutex);
+                            workerInferRequest->_is_wakeup = true;
+                        }
+                        workerInferRequest->_cond.notify_one();
+                    }
+                    return;
+                }
+                OPENVINO_ASSERT(workerInferRequest->_tasks.try_push(std::move(t)));
+                // it is ok to call size() here as the queue only grows (and the bulk removal happens in the worker)
                 const int sz = static_cast<int>(workerInferRequest->_tasks.size());
                 if (sz == workerInferRequest->_batch_size) {
                     workerInferRequest->_is_wakeup = true;
@@ -5,6 +5,8 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #include "compiled_model.hpp"
 
+#include <limits>
+
 #include "async_infer_request.hpp"
 
 namespace ov {
@@ -29,6 +31,9 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
     auto time_out = config.find(ov::auto_batch_timeout.name());
     OPENVINO_ASSERT(time_out != config.end(), "No timeout property be set in config, default will be used!");
     m_time_out = time_out->second.as<std::uint32_t>();
+    auto latency_target = config.find(ov::auto_batch_latency_target.name());
+    if (latency_target != config.end())
+        m_latency_target = latency_target->second.as<std::uint32_t>();
 }
 
 CompiledModel::~CompiledModel() {
@@ -64,22 +69,38 @@ CompiledModel::GetWorkerInferRequest() const {
             workerRequestPtr->_infer_request_batched._so = m_compiled_model_with_batch._so;
         workerRequestPtr->_batch_size = m_device_info.device_batch_size;
         workerRequestPtr->_completion_tasks.resize(workerRequestPtr->_batch_size);
+        workerRequestPtr->_tasks.set_capacity(workerRequestPtr->_batch_size);
         workerRequestPtr->_is_wakeup = false;
+        if (m_latency_target)
+            workerRequestPtr->_adaptive =
+                std::make_unique<AdaptiveBatching>(workerRequestPtr->_batch_size,
+                                                   std::chrono::milliseconds(m_latency_target));
         workerRequestPtr->_infer_request_batched->set_callback(
             [workerRequestPtr](std::exception_ptr exceptionPtr) mutable {
                 if (exceptionPtr)
                     workerRequestPtr->_exception_ptr = exceptionPtr;
+                if (workerRequestPtr->_adaptive)
+                    workerRequestPtr->_adaptive->on_executed(std::chrono::steady_clock::now() -
+                                                             workerRequestPtr->_start_time);
                 OPENVINO_ASSERT(workerRequestPtr->_completion_tasks.size() == (size_t)workerRequestPtr->_batch_size);
                 // notify the individual requests on the completion
-                for (int c = 0; c < workerRequestPtr->_batch_size; c++) {
+                for (int c = 0; c < workerRequestPtr->_num_batched; c++) {
                     workerRequestPtr->_completion_tasks[c]();
                 }
                 // reset the timeout
-                workerRequestPtr->_is_wakeup = true;
+                {
+                    std::lock_guard<std::mutex> lock(workerRequestPtr->_mutex);
+                    workerRequestPtr->_is_busy = false;
+                    workerRequestPtr->_is_wakeup = true;
+                }
                 workerRequestPtr->_cond.notify_one();
             });
 
         workerRequestPtr->_thread = std::thread([workerRequestPtr, this] {
+            if (workerRequestPtr->_adaptive) {
+                adaptive_batching_loop(*workerRequestPtr);
+                return;
+            }
             while (1) {
                 std::cv_status status;
                 {
@@ -96,15 +117,7 @@ CompiledModel::GetWorkerInferRequest() const {
                     // it is ok to call size() (as the _tasks can only grow in parallel)
                     const int sz = static_cast<int>(workerRequestPtr->_tasks.size());
                     if (sz == workerRequestPtr->_batch_size) {
-                        std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task> t;
-                        for (int n = 0; n < sz; n++) {
-                            OPENVINO_ASSERT(workerRequestPtr->_tasks.try_pop(t));
-                            workerRequestPtr->_completion_tasks[n] = std::move(t.second);
-                            t.first->m_sync_request->copy_inputs_if_needed();
-                            t.first->m_sync_request->m_batched_request_status =
-                                ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED;
-                        }
-                        workerRequestPtr->_infer_request_batched->start_async();
+                        execute_batched(*workerRequestPtr, sz);
                     } else if ((status == std::cv_status::timeout) && sz) {
                         // timeout to collect the batch is over, have to execute the requests in the batch1 mode
                         std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task> t;
@@ -138,6 +151,61 @@ CompiledModel::GetWorkerInferRequest() const {
     return {m_worker_requests.back(), static_cast<int>(batch_id)};
 }
 
+void CompiledModel::execute_batched(WorkerInferRequest& worker, int num_tasks) {
+    std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task> t;
+    for (int n = 0; n < num_tasks; n++) {
+        OPENVINO_ASSERT(worker._tasks.try_pop(t));
+        worker._completion_tasks[n] = std::move(t.second);
+        t.first->m_sync_request->copy_inputs_if_needed();
+        t.first->m_sync_request->m_batched_request_status =
+            ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED;
+    }
+    worker._num_batched = num_tasks;
+    if (worker._adaptive)
+        worker._adaptive->on_dispatch(num_tasks);
+    worker._start_time = std::chrono::steady_clock::now();
+    worker._infer_request_batched->start_async();
+}
+
+void CompiledModel::adaptive_batching_loop(WorkerInferRequest& worker) const {
+    // the decision is re-evaluated on every arrival and completion, so waiting for longer than the target only
+    // delays noticing the termination
+    const auto idle_wait = std::chrono::milliseconds(m_latency_target);
+    while (!m_terminate) {
+        int sz = 0;
+        {
+            std::unique_lock<std::mutex> lock(worker._mutex);
+            const auto now = std::chrono::steady_clock::now();
+            // as we pop the tasks from the queue only here
+            // it is ok to call size() (as the _tasks can only grow in parallel)
+            sz = static_cast<int>(worker._tasks.size());
+            // the batched request is still in flight with the previous (padded) batch, the next one waits for it
+            const auto execute_at =
+                worker._is_busy ? now + idle_wait : std::min(worker._adaptive->execute_at(sz), now + idle_wait);
+            if (worker._is_busy || !sz || execute_at > now) {
+                // no arrival can make the batch due while the batched request is busy, only its completion
+                worker._wake_at = worker._is_busy ? std::numeric_limits<std::chrono::steady_clock::rep>::min()
+                                                  : execute_at.time_since_epoch().count();
+                // announce the wait before re-checking the queue: a producer either sees the announcement and wakes
+                // the worker up, or its request is seen here
+                worker._is_waiting = true;
+                if (static_cast<int>(worker._tasks.size()) == sz) {
+                    worker._cond.wait_until(lock, execute_at, [&] {
+                        return worker._is_wakeup || m_terminate;
+                    });
+                }
+                worker._is_waiting = false;
+                worker._is_wakeup = false;
+                continue;
+            }
+            worker._is_busy = true;
+        }
+        // the requests collected by the deadline are executed padded to the compiled batch size,
+        // the outputs of the padding slots are not shared with any request (see SyncInferRequest)
+        execute_batched(worker, sz);
+    }
+}
+
 std::shared_ptr<ov::IAsyncInferRequest> CompiledModel::create_infer_request() const {
     ov::SoPtr<ov::IAsyncInferRequest> infer_request_without_batch = {
         m_compiled_model_without_batch->create_infer_request(),
@@ -212,10 +280,13 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
                 ov::PropertyName{ov::optimal_number_of_infer_requests.name(), ov::PropertyMutability::RO},
                 ov::PropertyName{ov::model_name.name(), ov::PropertyMutability::RO},
                 ov::PropertyName{ov::execution_devices.name(), ov::PropertyMutability::RO},
-                ov::PropertyName{ov::auto_batch_timeout.name(), ov::PropertyMutability::RW}};
+                ov::PropertyName{ov::auto_batch_timeout.name(), ov::PropertyMutability::RW},
+                ov::PropertyName{ov::auto_batch_latency_target.name(), ov::PropertyMutability::RO}};
         } else if (name == ov::auto_batch_timeout) {
             uint32_t time_out = m_time_out;
             return time_out;
+        } else if (name == ov::auto_batch_latency_target) {
+            return m_latency_target;
         } else if (name == ov::device::properties) {
             ov::AnyMap all_devices = {};
             ov::AnyMap device_properties = {};
@@ -6,8 +6,10 @@
 #pragma once
 
 #include <condition_variable>
+#include <memory>
 #include <thread>
 
+#include "adaptive_batching.hpp"
 #include "openvino/runtime/iasync_infer_request.hpp"
 #include "openvino/runtime/icompiled_model.hpp"
 #include "openvino/runtime/threading/thread_safe_containers.hpp"
@@ -23,7 +25,9 @@ public:
     struct WorkerInferRequest {
         ov::SoPtr<ov::IAsyncInferRequest> _infer_request_batched;
         int _batch_size;
-        ov::threading::ThreadSafeQueueWithSize<std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task>>
+        // every request of the worker is queued at most once at a time, so the capacity is the batch size
+        ov::threading::LockFreeBoundedMPSCQueue<
+            std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task>>
             _tasks;
         std::vector<ov::threading::Task> _completion_tasks;
         std::thread _thread;
@@ -31,6 +35,16 @@ public:
         std::mutex _mutex;
         std::exception_ptr _exception_ptr;
         bool _is_wakeup;
+        // number of the completion tasks of the batch in flight, less than the batch size for a padded batch
+        int _num_batched = 0;
+        std::chrono::steady_clock::time_point _start_time;
+        // set when the batch is collected against ov::auto_batch_latency_target instead of the fixed timeout
+        std::unique_ptr<AdaptiveBatching> _adaptive;
+        bool _is_busy = false;
+        // the adaptive worker announces the wait and the moment it sleeps until, so that the producers take the mutex
+        // only when their request makes the batch due earlier
+        std::atomic_bool _is_waiting{false};
+        std::atomic<std::chrono::steady_clock::rep> _wake_at{0};
     };
 
     CompiledModel(const std::shared_ptr<ov::Model>& model,
@@ -68,11 +82,15 @@ protected:
 
     std::pair<std::shared_ptr<ov::autobatch_plugin::CompiledModel::WorkerInferRequest>, int> GetWorkerInferRequest()
         const;
+    // pops the `num_tasks` oldest tasks and starts them as the batch, the slots of the missing requests are padding
+    static void execute_batched(WorkerInferRequest& worker, int num_tasks);
+    void adaptive_batching_loop(WorkerInferRequest& worker) const;
     mutable std::vector<std::shared_ptr<WorkerInferRequest>> m_worker_requests;
     mutable std::mutex m_worker_requests_mutex;
 
     mutable std::atomic_size_t m_num_requests_created = {0};
     std::atomic<std::uint32_t> m_time_out = {0};  // in ms
+    std::uint32_t m_latency_target = 0;           // in ms, 0 for the fixed timeout
 
     const std::set<std::size_t> m_batched_inputs;
     const std::set<std::size_t> m_batched_outputs;
@@ -22,6 +22,7 @@ namespace autobatch_plugin {
 std::vector<ov::PropertyName> supported_configKeys = {
     ov::PropertyName{ov::device::priorities.name(), ov::PropertyMutability::RW},
     ov::PropertyName{ov::auto_batch_timeout.name(), ov::PropertyMutability::RW},
+    ov::PropertyName{ov::auto_batch_latency_target.name(), ov::PropertyMutability::RW},
     ov::PropertyName{ov::enable_profiling.name(), ov::PropertyMutability::RW}};
 
 inline ov::AnyMap merge_properties(ov::AnyMap config, const ov::AnyMap& user_config) {
@@ -118,6 +119,7 @@ OV_DEFINE_PLUGIN_CREATE_FUNCTION(Plugin, version)
 Plugin::Plugin() {
     set_device_name("BATCH");
     m_plugin_config.insert(ov::auto_batch_timeout(1000));  // default value (ms)
+    m_plugin_config.insert(ov::auto_batch_latency_target(0));  // the fixed timeout is used by default
     m_plugin_config.insert(ov::enable_profiling(false));
 }
 
@@ -70,11 +70,20 @@ void SyncInferRequest::share_tensors_with_batched_req(const std::set<std::size_t
         auto batched_tensor = m_batched_request_wrapper->_infer_request_batched->get_tensor(output);
         if (!batched_tensor._so)
             batched_tensor._so = m_batched_request_wrapper->_infer_request_batched._so;
-        res = create_shared_tensor_on_batched_tensor(batched_tensor,
-                                                     output_id,
-                                                     batched_outputs,
-                                                     m_batch_id,
-                                                     m_batch_size);
+        if (m_batched_request_wrapper->_adaptive) {
+            // a padded batch overwrites the outputs of the requests that did not take part in it,
+            // so the outputs are copied from the batched tensor on completion instead of sharing it
+            auto shape = batched_tensor->get_shape();
+            if (batched_outputs.count(output_id))
+                shape[0] = 1;
+            res = {ov::make_tensor(batched_tensor->get_element_type(), shape), nullptr};
+        } else {
+            res = create_shared_tensor_on_batched_tensor(batched_tensor,
+                                                         output_id,
+                                                         batched_outputs,
+                                                         m_batch_id,
+                                                         m_batch_size);
+        }
         set_tensor(output, res);
     }
 }
@@ -0,0 +1,144 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <deque>
+#include <random>
+#include <vector>
+
+#include "adaptive_batching.hpp"
+
+// These benchmarks simulate a long load trace and are too slow for a Debug (-O0) build.
+#ifndef NDEBUG
+#    error \
+        "adaptive_batching_benchmark.cpp must be built in Release mode: rebuild with -DCMAKE_BUILD_TYPE=Release, or delete this #error to build in Debug anyway."
+#endif
+
+namespace ov::test {
+
+using ov::autobatch_plugin::AdaptiveBatching;
+using Clock = AdaptiveBatching::Clock;
+using std::chrono::microseconds;
+using std::chrono::milliseconds;
+
+namespace {
+
+struct LoadResult {
+    double p99_ms;
+    double mean_batch;
+};
+
+// Discrete-event simulation of a worker executing a batched request that takes the same time regardless of how
+// many of its slots are filled, the way the worker of the compiled model uses the policy.
+LoadResult run_load(const std::vector<Clock::duration>& arrivals,
+                    size_t batch_size,
+                    milliseconds latency_target,
+                    milliseconds execution_time,
+                    std::mt19937& rng) {
+    AdaptiveBatching batching(batch_size, latency_target);
+    std::uniform_real_distribution<double> jitter(0.9, 1.1);
+    const auto start = Clock::now();
+    std::deque<Clock::time_point> queue;
+    std::vector<double> latencies;
+    size_t batches = 0;
+    size_t next = 0;
+    bool busy = false;
+    Clock::time_point now = start, busy_until, started;
+    while (true) {
+        if (busy && busy_until <= now) {
+            busy = false;
+            batching.on_executed(busy_until - started);
+        }
+        if (!busy && !queue.empty() && batching.execute_at(queue.size()) <= now) {
+            const auto duration =
+                std::chrono::duration_cast<Clock::duration>(execution_time * jitter(rng));
+            const size_t count = std::min(queue.size(), batch_size);
+            for (size_t i = 0; i < count; i++) {
+                latencies.push_back(std::chrono::duration<double, std::milli>(now + duration - queue.front()).count());
+                queue.pop_front();
+            }
+            batching.on_dispatch(count);
+            batches++;
+            busy = true;
+            started = now;
+            busy_until = now + duration;
+            continue;
+        }
+        auto event = next < arrivals.size() ? start + arrivals[next] : Clock::time_point::max();
+        if (busy)
+            event = std::min(event, busy_until);
+        else if (!queue.empty())
+            event = std::min(event, batching.execute_at(queue.size()));
+        if (event == Clock::time_point::max())
+            break;
+        now = std::max(now, event);
+        if (next < arrivals.size() && start + arrivals[next] <= now) {
+            batching.on_arrival(start + arrivals[next]);
+            queue.push_back(start + arrivals[next]);
+            next++;
+        }
+    }
+    EXPECT_EQ(latencies.size(), arrivals.size());
+    std::sort(latencies.begin(), latencies.end());
+    return {latencies[latencies.size() * 99 / 100], static_cast<double>(latencies.size()) / batches};
+}
+
+std::vector<Clock::duration> poisson_arrivals(double per_second, size_t count, std::mt19937& rng) {
+    std::exponential_distribution<double> interval(per_second);
+    std::vector<Clock::duration> arrivals;
+    std::chrono::duration<double> t(0);
+    for (size_t i = 0; i < count; i++) {
+        t += std::chrono::duration<double>(interval(rng));
+        arrivals.push_back(std::chrono::duration_cast<Clock::duration>(t));
+    }
+    return arrivals;
+}
+
+// bursts of back-to-back requests separated by idle periods
+std::vector<Clock::duration> bursty_arrivals(size_t bursts, size_t burst_size, milliseconds period) {
+    std::vector<Clock::duration> arrivals;
+    for (size_t b = 0; b < bursts; b++) {
+        for (size_t i = 0; i < burst_size; i++)
+            arrivals.push_back(period * b + microseconds(200) * i);
+    }
+    return arrivals;
+}
+
+void print_result(const char* load, const LoadResult& result) {
+    std::printf("%-16s %10.2f %12.2f\n", load, result.p99_ms, result.mean_batch);
+}
+
+}  // namespace
+
+// The load generator: for every arrival pattern the p99 latency has to stay within the target, while the batches
+// are filled under the heavy load (throughput) and are not waited for under the light one (latency).
+TEST(AdaptiveBatchingBenchmark, PoissonLoad) {
+    std::mt19937 rng(2024);
+    const auto target = milliseconds(50);
+    const auto heavy = run_load(poisson_arrivals(700, 20000, rng), 8, target, milliseconds(8), rng);
+    std::printf("%-16s %10s %12s\n", "load", "p99, ms", "mean batch");
+    print_result("poisson heavy", heavy);
+    EXPECT_LE(heavy.p99_ms, target.count());
+    EXPECT_GT(heavy.mean_batch, 4.0);
+
+    const auto light = run_load(poisson_arrivals(20, 2000, rng), 8, target, milliseconds(8), rng);
+    print_result("poisson light", light);
+    EXPECT_LE(light.p99_ms, target.count() / 2);
+}
+
+TEST(AdaptiveBatchingBenchmark, BurstyLoad) {
+    std::mt19937 rng(2024);
+    const auto target = milliseconds(50);
+    const auto result = run_load(bursty_arrivals(200, 40, milliseconds(200)), 8, target, milliseconds(8), rng);
+    std::printf("%-16s %10s %12s\n", "load", "p99, ms", "mean batch");
+    print_result("bursty", result);
+    EXPECT_LE(result.p99_ms, target.count());
+    EXPECT_GT(result.mean_batch, 6.0);
+}
+
+}  // namespace ov::test
@@ -0,0 +1,53 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "common_test_utils/subgraph_builders/single_conv.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include "openvino/runtime/core.hpp"
+
+namespace {
+
+// With the latency target the requests that are not enough for a full batch are executed padded to the compiled
+// batch size, which must neither change their results nor overwrite the results of the requests left out.
+TEST(AutoBatchingAdaptiveTest, PartialBatchesMatchSingleBatch) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    ov::Core core;
+    auto model = ov::test::utils::make_single_conv();
+    for (auto const& input : model->inputs()) {
+        input.get_node()->set_output_type(0, ov::element::f32, input.get_shape());
+    }
+    auto compiled_model = core.compile_model(model,
+                                             std::string(ov::test::utils::DEVICE_BATCH) + ":" +
+                                                 ov::test::utils::DEVICE_TEMPLATE + "(4)",
+                                             ov::auto_batch_latency_target(50));
+    EXPECT_EQ(compiled_model.get_property(ov::auto_batch_latency_target), 50u);
+    auto compiled_model_ref = core.compile_model(model, ov::test::utils::DEVICE_TEMPLATE);
+
+    const auto& input = model->input();
+    const auto& output = model->output();
+    std::vector<ov::InferRequest> requests, requests_ref;
+    for (size_t i = 0; i < 4; i++) {
+        auto tensor = ov::test::utils::create_and_fill_tensor(input.get_element_type(), input.get_shape());
+        requests.push_back(compiled_model.create_infer_request());
+        requests.back().set_tensor(input, tensor);
+        requests_ref.push_back(compiled_model_ref.create_infer_request());
+        requests_ref.back().set_tensor(input, tensor);
+        requests_ref.back().infer();
+    }
+
+    // two padded batches of two requests each
+    for (size_t first : {0, 2}) {
+        requests[first].start_async();
+        requests[first + 1].start_async();
+        requests[first].wait();
+        requests[first + 1].wait();
+    }
+    for (size_t i = 0; i < requests.size(); i++) {
+        ov::test::utils::compare(requests_ref[i].get_tensor(output), requests[i].get_tensor(output));
+    }
+}
+
+}  // namespace
@@ -0,0 +1,85 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "adaptive_batching.hpp"
+
+#include <gtest/gtest.h>
+
+using ov::autobatch_plugin::AdaptiveBatching;
+using Clock = AdaptiveBatching::Clock;
+using std::chrono::milliseconds;
+using std::chrono::microseconds;
+
+TEST(AutoBatchAdaptiveBatchingTest, FullBatchIsExecutedImmediately) {
+    AdaptiveBatching batching(4, milliseconds(100));
+    const auto start = Clock::now();
+    for (int i = 0; i < 4; i++)
+        batching.on_arrival(start + milliseconds(i));
+    EXPECT_EQ(batching.execute_at(4), start);
+    EXPECT_EQ(batching.execute_at(0), Clock::time_point::max());
+}
+
+TEST(AutoBatchAdaptiveBatchingTest, PartialBatchWaitsForTheDeadline) {
+    AdaptiveBatching batching(8, milliseconds(100));
+    batching.on_executed(milliseconds(20));
+    // 20 ms on average with the initial deviation of 10 ms
+    EXPECT_EQ(batching.execution_time_bound(), milliseconds(60));
+
+    const auto start = Clock::now();
+    batching.on_arrival(start);
+    batching.on_arrival(start + milliseconds(1));
+    EXPECT_EQ(batching.arrival_interval(), milliseconds(1));
+    EXPECT_EQ(batching.execute_at(2), start + milliseconds(40));
+
+    // the dispatched requests do not hold the deadline of the ones arriving later
+    batching.on_dispatch(2);
+    EXPECT_EQ(batching.execute_at(0), Clock::time_point::max());
+    batching.on_arrival(start + milliseconds(2));
+    EXPECT_EQ(batching.execute_at(1), start + milliseconds(42));
+}
+
+TEST(AutoBatchAdaptiveBatchingTest, ArrivalReturnsTheDeadlineOfTheQueue) {
+    AdaptiveBatching batching(4, milliseconds(100));
+    batching.on_executed(milliseconds(20));
+    const auto start = Clock::now();
+    EXPECT_EQ(batching.on_arrival(start), batching.execute_at(1));
+    EXPECT_EQ(batching.on_arrival(start + milliseconds(1)), batching.execute_at(2));
+    batching.on_dispatch(2);
+    EXPECT_EQ(batching.on_arrival(start + milliseconds(2)), batching.execute_at(1));
+    for (int i = 3; i < 6; i++)
+        batching.on_arrival(start + milliseconds(i));
+    // the batch is full
+    EXPECT_EQ(batching.execute_at(4), start + milliseconds(2));
+}
+
+TEST(AutoBatchAdaptiveBatchingTest, SparseArrivalsAreNotDelayed) {
+    AdaptiveBatching batching(8, milliseconds(100));
+    batching.on_executed(milliseconds(20));
+    const auto start = Clock::now();
+    for (int i = 0; i < 4; i++)
+        batching.on_arrival(start + milliseconds(80 * i));
+    batching.on_dispatch(3);
+    // a request is expected every 80 ms, so the batch cannot fill by the deadline of the queued one
+    EXPECT_EQ(batching.execute_at(1), start + milliseconds(240));
+}
+
+TEST(AutoBatchAdaptiveBatchingTest, UnreachableTargetIsNotWaitedFor) {
+    AdaptiveBatching batching(8, milliseconds(10));
+    batching.on_executed(milliseconds(20));
+    const auto start = Clock::now();
+    batching.on_arrival(start);
+    batching.on_arrival(start + microseconds(10));
+    EXPECT_EQ(batching.execute_at(2), start);
+}
+
+TEST(AutoBatchAdaptiveBatchingTest, ExecutionTimeFollowsTheSamples) {
+    AdaptiveBatching batching(8, milliseconds(100));
+    for (int i = 0; i < 100; i++)
+        batching.on_executed(milliseconds(10));
+    EXPECT_LT(batching.execution_time_bound(), milliseconds(11));
+    for (int i = 0; i < 100; i++)
+        batching.on_executed(milliseconds(30));
+    EXPECT_GT(batching.execution_time_bound(), milliseconds(29));
+    EXPECT_LT(batching.execution_time_bound(), milliseconds(31));
+}
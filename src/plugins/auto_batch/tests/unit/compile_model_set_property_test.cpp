@@ -103,6 +103,8 @@ TEST_P(CompileModelSetPropertyTest, CompileModelSetPropertyTestCase) {
 const std::vector<set_property_param> compile_model_set_property_param_test = {
     set_property_param{{{ov::auto_batch_timeout(static_cast<uint32_t>(100))}}, false},
     set_property_param{{{"INCORRECT_CONFIG", 2}}, true},
+    // the requests created so far share their outputs with the batched request, so the mode is fixed at compile time
+    set_property_param{{{ov::auto_batch_latency_target(static_cast<uint32_t>(50))}}, true},
 };
 
 INSTANTIATE_TEST_SUITE_P(smoke_AutoBatch_BehaviorTests,
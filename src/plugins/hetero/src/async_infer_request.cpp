@@ -26,6 +26,9 @@ ov::hetero::AsyncInferRequest::AsyncInferRequest(const std::shared_ptr<ov::heter
                                                  const std::shared_ptr<ov::threading::ITaskExecutor>& callback_executor)
     : ov::IAsyncInferRequest(request, task_executor, callback_executor),
       m_infer_request(std::static_pointer_cast<ov::hetero::InferRequest>(request)) {
+    // the micro-batches are pipelined through the submodels by the infer() of the request
+    if (!m_infer_request->m_micro_batch_subrequests.empty())
+        return;
     m_pipeline.clear();
     for (auto&& request : m_infer_request->m_subrequests) {
         auto request_executor = std::make_shared<RequestExecutor>(request);
@@ -46,4 +49,9 @@ void ov::hetero::AsyncInferRequest::cancel() {
     for (auto&& request : m_infer_request->m_subrequests) {
         request->cancel();
     }
+    for (auto&& subrequests : m_infer_request->m_micro_batch_subrequests) {
+        for (auto&& request : subrequests) {
+            request->cancel();
+        }
+    }
 }
\ No newline at end of file
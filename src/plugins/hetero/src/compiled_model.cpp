@@ -8,6 +8,7 @@
 #include <chrono>
 #include <cstdint>
 #include <limits>
+#include <map>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -124,6 +125,72 @@ void write_framed_payload_via_seekable_stream(std::ostream& modelStream,
     ov::hetero::write_framed_payload(modelStream, payloadType, payloadStream, payloadSize);
 }
 
+// Reshapes the submodels to the batch of a single micro-batch, returns nothing when the model cannot be split that
+// way: every input and output of the submodels must be static and batched by the 0th dimension, and the batch must
+// pass through the submodels untouched, so the micro-batches do not depend on each other
+std::vector<std::shared_ptr<ov::Model>> make_micro_batch_submodels(
+    const std::vector<ov::hetero::SubmodelInfo>& submodels,
+    const ov::hetero::SubgraphsMappingInfo& mapping_info,
+    uint32_t micro_batches) {
+    if (micro_batches < 2 || submodels.size() < 2)
+        return {};
+    // the output of a submodel is either the output of the model or the input of the next submodels, as it is bound
+    // to the different tensors in these cases
+    for (const auto& output : mapping_info._outputs_to_submodels_outputs) {
+        for (const auto& link : mapping_info._submodels_input_to_prev_output) {
+            if (link.second == output)
+                return {};
+        }
+    }
+
+    size_t batch = 0;
+    const auto get_micro_batch_shape = [&](const ov::PartialShape& shape, ov::Shape& micro_batch_shape) {
+        if (shape.is_dynamic() || shape.size() == 0)
+            return false;
+        micro_batch_shape = shape.to_shape();
+        if (batch == 0)
+            batch = micro_batch_shape[0];
+        if (micro_batch_shape[0] != batch || batch % micro_batches != 0)
+            return false;
+        micro_batch_shape[0] /= micro_batches;
+        return true;
+    };
+
+    std::vector<std::shared_ptr<ov::Model>> micro_batch_submodels;
+    for (const auto& [device, sub_model] : submodels) {
+        // the states would be shared by the micro-batches
+        if (!sub_model->get_sinks().empty() || !sub_model->get_variables().empty())
+            return {};
+        auto micro_batch_submodel = sub_model->clone();
+        ov::Shape micro_batch_shape;
+        std::map<ov::Output<ov::Node>, ov::PartialShape> new_shapes;
+        for (const auto& param : micro_batch_submodel->get_parameters()) {
+            if (param->get_element_type().bitwidth() < 8 ||
+                !get_micro_batch_shape(param->get_partial_shape(), micro_batch_shape))
+                return {};
+            new_shapes[param->output(0)] = micro_batch_shape;
+        }
+        std::vector<ov::Shape> expected_shapes;
+        for (const auto& result : micro_batch_submodel->get_results()) {
+            if (result->get_element_type().bitwidth() < 8 ||
+                !get_micro_batch_shape(result->get_output_partial_shape(0), micro_batch_shape))
+                return {};
+            expected_shapes.push_back(micro_batch_shape);
+        }
+        try {
+            micro_batch_submodel->reshape(new_shapes);
+        } catch (const ov::Exception&) {
+            return {};
+        }
+        for (size_t i = 0; i < expected_shapes.size(); i++) {
+            if (micro_batch_submodel->get_results()[i]->get_output_partial_shape(0) != expected_shapes[i])
+                return {};
+        }
+        micro_batch_submodels.push_back(std::move(micro_batch_submodel));
+    }
+    return micro_batch_submodels;
+}
+
 }  // namespace
 
 ov::hetero::CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
@@ -166,6 +233,8 @@ void ov::hetero::CompiledModel::compile_model(const std::vector<ov::hetero::Subm
     m_compiled_submodels.clear();
     m_compiled_submodels.reserve(submodels.size());
 
+    auto micro_batch_submodels = make_micro_batch_submodels(submodels, m_mapping_info, m_cfg.micro_batches);
+
     size_t submodel_index = 0;
     for (const auto& [device, sub_model] : submodels) {
         clock::time_point t_submodel_start{};
@@ -182,8 +251,8 @@ void ov::hetero::CompiledModel::compile_model(const std::vector<ov::hetero::Subm
         auto device_config = meta_devices.at(device);
         device_config[ov::cache_dir.name()] = "";
 
-        // set exclusive_async_requests in case when model is split
-        if (add_exclusive) {
+        // set exclusive_async_requests in case when model is split, unless the submodels are meant to run in parallel
+        if (add_exclusive && micro_batch_submodels.empty()) {
             auto supported_internal_properties = core->get_property(device, ov::internal::supported_properties);
             if (std::find(supported_internal_properties.begin(),
                           supported_internal_properties.end(),
@@ -201,6 +270,14 @@ void ov::hetero::CompiledModel::compile_model(const std::vector<ov::hetero::Subm
             t_compile_start = clock::now();
         }
         desc.compiled_model = core->compile_model(sub_model, device, device_config);
+        if (!micro_batch_submodels.empty()) {
+            try {
+                desc.micro_batch_compiled_model =
+                    core->compile_model(micro_batch_submodels[submodel_index], device, device_config);
+            } catch (const ov::Exception&) {
+                micro_batch_submodels.clear();
+            }
+        }
         if (perf_logging_enabled) {
             t_compile_end = clock::now();
         }
@@ -225,6 +302,13 @@ void ov::hetero::CompiledModel::compile_model(const std::vector<ov::hetero::Subm
         ++submodel_index;
     }
 
+    if (micro_batch_submodels.empty()) {
+        for (auto& desc : m_compiled_submodels)
+            desc.micro_batch_compiled_model = {};
+    } else {
+        m_micro_batches = m_cfg.micro_batches;
+    }
+
     clock::time_point t_set_io_start{};
     clock::time_point t_set_io_end{};
     if (perf_logging_enabled) {
@@ -427,7 +511,8 @@ ov::Any ov::hetero::CompiledModel::get_property(const std::string& name) const {
                                                     ov::optimal_number_of_infer_requests,
                                                     ov::execution_devices,
                                                     ov::loaded_from_cache,
-                                                    ov::hetero::number_of_submodels};
+                                                    ov::hetero::number_of_submodels,
+                                                    ov::hetero::micro_batches};
         return ro_properties;
     };
 
@@ -475,6 +560,8 @@ ov::Any ov::hetero::CompiledModel::get_property(const std::string& name) const {
     } else if (ov::hetero::number_of_submodels == name) {
         return decltype(ov::hetero::number_of_submodels)::value_type{
             (m_compiled_submodels.size() - get_hetero_plugin()->independent_submodel_size)};
+    } else if (ov::hetero::micro_batches == name) {
+        return decltype(ov::hetero::micro_batches)::value_type{m_micro_batches};
     }
     return m_cfg.get(name);
 }
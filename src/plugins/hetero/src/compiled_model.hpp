@@ -67,8 +67,12 @@ private:
         std::string device;
         std::shared_ptr<ov::Model> model;
         ov::SoPtr<ov::ICompiledModel> compiled_model;
+        // the submodel compiled for a single micro-batch, empty when the micro-batching is not in effect
+        ov::SoPtr<ov::ICompiledModel> micro_batch_compiled_model;
     };
     std::vector<CompiledModelDesc> m_compiled_submodels;
+    // number of micro-batches the requests are pipelined with, 1 when they run the submodels one after another
+    uint32_t m_micro_batches = 1;
 };
 }  // namespace hetero
 }  // namespace ov
@@ -33,6 +33,9 @@ Configuration::Configuration(const ov::AnyMap& config, const Configuration& defa
                 }
             }
             modelDistributionPolicy = value.as<std::set<ov::hint::ModelDistributionPolicy>>();
+        } else if (ov::hetero::micro_batches == key) {
+            micro_batches = value.as<uint32_t>();
+            OPENVINO_ASSERT(micro_batches > 0, "Wrong value ", micro_batches, " for property key ", key);
         } else if (ov::cache_encryption_callbacks == key) {
             encryption_callbacks = value.as<EncryptionCallbacks>();
         } else {
@@ -48,6 +51,8 @@ ov::Any Configuration::get(const std::string& name) const {
         return {device_priorities};
     } else if (name == ov::hint::model_distribution_policy) {
         return {modelDistributionPolicy};
+    } else if (name == ov::hetero::micro_batches) {
+        return {micro_batches};
     } else {
         OPENVINO_THROW("Property was not found: ", name);
     }
@@ -60,7 +65,8 @@ std::vector<ov::PropertyName> Configuration::get_supported() const {
 
 ov::AnyMap Configuration::get_hetero_properties() const {
     return {{ov::device::priorities.name(), device_priorities},
-            {ov::hint::model_distribution_policy.name(), modelDistributionPolicy}};
+            {ov::hint::model_distribution_policy.name(), modelDistributionPolicy},
+            {ov::hetero::micro_batches.name(), micro_batches}};
 }
 
 ov::AnyMap Configuration::get_device_properties() const {
@@ -40,6 +40,8 @@ struct Configuration {
 
     EncryptionCallbacks encryption_callbacks;
 
+    uint32_t micro_batches = 1;
+
     ov::AnyMap device_properties;
 };
 }  // namespace hetero
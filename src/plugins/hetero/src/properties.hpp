@@ -17,5 +17,13 @@ static constexpr Property<std::string, PropertyMutability::RO> caching_device_pr
  * @brief Read-only property showing number of compiled submodels
  */
 static constexpr Property<size_t, PropertyMutability::RO> number_of_submodels{"HETERO_NUMBER_OF_SUBMODELS"};
+
+/**
+ * @brief Number of micro-batches the batch of a request is split into, so that the submodels on different devices
+ * process different micro-batches at the same time. The samples of the batch must be independent of each other.
+ * The value of 1 (default) runs the submodels one after another for the whole batch. The compiled model reports the
+ * value in effect, which is 1 when the model cannot be split along the batch.
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> micro_batches{"HETERO_MICRO_BATCHES"};
 }  // namespace hetero
 }  // namespace ov
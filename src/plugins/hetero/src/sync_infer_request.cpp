@@ -13,6 +13,7 @@
 #include "compiled_model.hpp"
 #include "itt.hpp"
 #include "openvino/core/except.hpp"
+#include "openvino/runtime/iremote_tensor.hpp"
 #include "openvino/runtime/make_tensor.hpp"
 #include "plugin.hpp"
 #include "remote_tensor.hpp"
@@ -35,23 +36,40 @@ ov::hetero::InferRequest::InferRequest(const std::shared_ptr<const ov::hetero::C
         m_port_to_subrequest_idx[port] = submodel_idx;
     }
 
-    std::map<ov::Output<const ov::Node>, ov::SoPtr<ov::ITensor>> temp_tensor_map;
-    for (const auto& kvp : compiled_model->m_mapping_info._submodels_input_to_prev_output) {
-        const auto& submodel_idx_in = kvp.first.first;
-        const auto& port_idx_in = kvp.first.second;
-        const auto& submodel_idx_out = kvp.second.first;
-        const auto& port_idx_out = kvp.second.second;
-
-        const auto& output_port = m_subrequests[submodel_idx_out]->get_compiled_model()->outputs()[port_idx_out];
-        const auto& output_tensor = m_subrequests[submodel_idx_out]->get_tensor(output_port);
-        if (temp_tensor_map.find(output_port) == temp_tensor_map.end()) {
-            temp_tensor_map[output_port] = {
-                ov::make_tensor(output_tensor->get_element_type(), output_tensor->get_shape()),
-                nullptr};
+    // the submodels exchange the data via the tensors shared by the output of one and the input of the other
+    const auto connect_subrequests = [&](std::vector<ov::SoPtr<ov::IAsyncInferRequest>>& subrequests) {
+        std::map<ov::Output<const ov::Node>, ov::SoPtr<ov::ITensor>> temp_tensor_map;
+        for (const auto& kvp : compiled_model->m_mapping_info._submodels_input_to_prev_output) {
+            const auto& submodel_idx_in = kvp.first.first;
+            const auto& port_idx_in = kvp.first.second;
+            const auto& submodel_idx_out = kvp.second.first;
+            const auto& port_idx_out = kvp.second.second;
+
+            const auto& output_port = subrequests[submodel_idx_out]->get_compiled_model()->outputs()[port_idx_out];
+            const auto& output_tensor = subrequests[submodel_idx_out]->get_tensor(output_port);
+            if (temp_tensor_map.find(output_port) == temp_tensor_map.end()) {
+                temp_tensor_map[output_port] = {
+                    ov::make_tensor(output_tensor->get_element_type(), output_tensor->get_shape()),
+                    nullptr};
+            }
+            subrequests[submodel_idx_out]->set_tensor(output_port, temp_tensor_map[output_port]);
+            const auto& input_port = subrequests[submodel_idx_in]->get_compiled_model()->inputs()[port_idx_in];
+            subrequests[submodel_idx_in]->set_tensor(input_port, temp_tensor_map[output_port]);
+        }
+    };
+    connect_subrequests(m_subrequests);
+
+    if (compiled_model->m_micro_batches > 1) {
+        m_micro_batches = compiled_model->m_micro_batches;
+        // the submodel N works on the micro-batch k while the submodel N+M works on the micro-batch k-M
+        m_micro_batch_subrequests.resize(std::min(m_micro_batches, m_subrequests.size()));
+        for (auto& subrequests : m_micro_batch_subrequests) {
+            for (auto&& comp_model_desc : compiled_model->m_compiled_submodels) {
+                auto& comp_model = comp_model_desc.micro_batch_compiled_model;
+                subrequests.push_back({comp_model->create_infer_request(), comp_model._so});
+            }
+            connect_subrequests(subrequests);
         }
-        m_subrequests[submodel_idx_out]->set_tensor(output_port, temp_tensor_map[output_port]);
-        const auto& input_port = m_subrequests[submodel_idx_in]->get_compiled_model()->inputs()[port_idx_in];
-        m_subrequests[submodel_idx_in]->set_tensor(input_port, temp_tensor_map[output_port]);
     }
 }
 
@@ -125,16 +143,110 @@ std::vector<ov::SoPtr<ov::IVariableState>> ov::hetero::InferRequest::query_state
 }
 
 void ov::hetero::InferRequest::infer() {
+    if (infer_micro_batched())
+        return;
     for (auto&& request : m_subrequests) {
         OPENVINO_ASSERT(request);
         request->infer();
     }
 }
 
+bool ov::hetero::InferRequest::infer_micro_batched() {
+    if (m_micro_batch_subrequests.empty())
+        return false;
+    const auto& mapping_info =
+        std::static_pointer_cast<const ov::hetero::CompiledModel>(get_compiled_model())->m_mapping_info;
+
+    // the micro-batches of the model inputs and outputs are the views of the tensors of the request
+    struct Slices {
+        size_t submodel_idx;
+        size_t port_idx;
+        std::vector<ov::SoPtr<ov::ITensor>> tensors;
+    };
+    const auto make_slices = [&](const ov::hetero::NodeInfo& node_info,
+                                 const ov::SoPtr<ov::ITensor>& tensor,
+                                 Slices& slices) {
+        if (std::dynamic_pointer_cast<ov::IRemoteTensor>(tensor._ptr) || !tensor->is_continuous())
+            return false;
+        auto shape = tensor->get_shape();
+        if (shape.empty() || shape[0] % m_micro_batches != 0)
+            return false;
+        shape[0] /= m_micro_batches;
+        const auto byte_size = tensor->get_byte_size() / m_micro_batches;
+        slices.submodel_idx = node_info.first;
+        slices.port_idx = node_info.second;
+        for (size_t micro_batch = 0; micro_batch < m_micro_batches; micro_batch++) {
+            slices.tensors.push_back(
+                {ov::make_tensor(tensor->get_element_type(),
+                                 shape,
+                                 static_cast<uint8_t*>(tensor->data()) + byte_size * micro_batch),
+                 tensor._so});
+        }
+        return true;
+    };
+    std::vector<Slices> input_slices(get_inputs().size()), output_slices(get_outputs().size());
+    for (size_t i = 0; i < get_inputs().size(); i++) {
+        // e.g. the remote tensors set by the user are passed to the submodels compiled for the whole batch
+        if (!make_slices(mapping_info._inputs_to_submodels_inputs[i], get_tensor(get_inputs()[i]), input_slices[i]))
+            return false;
+    }
+    for (size_t i = 0; i < get_outputs().size(); i++) {
+        if (!make_slices(mapping_info._outputs_to_submodels_outputs[i],
+                         get_tensor(get_outputs()[i]),
+                         output_slices[i]))
+            return false;
+    }
+
+    // every step moves each micro-batch to the next submodel, so the submodels run in parallel on the different
+    // micro-batches once the pipeline is filled
+    const auto num_submodels = m_subrequests.size();
+    for (size_t step = 0; step < m_micro_batches + num_submodels - 1; step++) {
+        std::vector<ov::SoPtr<ov::IAsyncInferRequest>> started;
+        std::exception_ptr exception_ptr;
+        for (size_t submodel_idx = 0; submodel_idx < num_submodels; submodel_idx++) {
+            if (step < submodel_idx || step - submodel_idx >= m_micro_batches)
+                continue;
+            const auto micro_batch = step - submodel_idx;
+            auto& request = m_micro_batch_subrequests[micro_batch % m_micro_batch_subrequests.size()][submodel_idx];
+            const auto& compiled_submodel = request->get_compiled_model();
+            try {
+                for (const auto& slices : input_slices) {
+                    if (slices.submodel_idx == submodel_idx)
+                        request->set_tensor(compiled_submodel->inputs()[slices.port_idx],
+                                            slices.tensors[micro_batch]);
+                }
+                for (const auto& slices : output_slices) {
+                    if (slices.submodel_idx == submodel_idx)
+                        request->set_tensor(compiled_submodel->outputs()[slices.port_idx],
+                                            slices.tensors[micro_batch]);
+                }
+                request->start_async();
+                started.push_back(request);
+            } catch (...) {
+                exception_ptr = std::current_exception();
+                break;
+            }
+        }
+        // the requests of the step have to complete before any of them is reused
+        for (auto& request : started) {
+            try {
+                request->wait();
+            } catch (...) {
+                if (!exception_ptr)
+                    exception_ptr = std::current_exception();
+            }
+        }
+        if (exception_ptr)
+            std::rethrow_exception(exception_ptr);
+    }
+    return true;
+}
+
 std::vector<ov::ProfilingInfo> ov::hetero::InferRequest::get_profiling_info() const {
     std::vector<ov::ProfilingInfo> info;
-    for (size_t i = 0; i < m_subrequests.size(); ++i) {
-        auto&& subreq_info = m_subrequests[i]->get_profiling_info();
+    const auto& subrequests = m_micro_batch_subrequests.empty() ? m_subrequests : m_micro_batch_subrequests.front();
+    for (size_t i = 0; i < subrequests.size(); ++i) {
+        auto&& subreq_info = subrequests[i]->get_profiling_info();
         for (auto&& rec : subreq_info)
             rec.node_name = std::string("subgraph") + std::to_string(i) + ": " + rec.node_name;
         info.insert(info.end(), subreq_info.begin(), subreq_info.end());
@@ -50,8 +50,14 @@ private:
 
     ov::SoPtr<ov::IAsyncInferRequest> get_request(const ov::Output<const ov::Node>& port) const;
 
+    bool infer_micro_batched();
+
     std::vector<ov::SoPtr<ov::IAsyncInferRequest>> m_subrequests;
     std::map<ov::Output<const ov::Node>, size_t> m_port_to_subrequest_idx;
+    // requests of the submodels compiled for a micro-batch: a set of them per micro-batch in flight, so that the
+    // submodels do not overwrite the intermediate tensors the next submodels read
+    std::vector<std::vector<ov::SoPtr<ov::IAsyncInferRequest>>> m_micro_batch_subrequests;
+    size_t m_micro_batches = 1;
 };
 
 }  // namespace hetero
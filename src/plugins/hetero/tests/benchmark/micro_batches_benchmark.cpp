@@ -0,0 +1,131 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "openvino/core/visibility.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/runtime/core.hpp"
+#include "properties.hpp"
+
+// These benchmarks measure wall-clock timing and are meaningless in a Debug (-O0) build.
+#ifndef NDEBUG
+#    error \
+        "micro_batches_benchmark.cpp must be built in Release mode: rebuild with -DCMAKE_BUILD_TYPE=Release, or delete this #error to build in Debug anyway."
+#endif
+
+#if defined(OPENVINO_ARCH_ARM) || defined(OPENVINO_ARCH_ARM64)
+const char* cpu_plugin_file_name = "openvino_arm_cpu_plugin";
+#elif defined(OPENVINO_ARCH_X86) || defined(OPENVINO_ARCH_X86_64)
+const char* cpu_plugin_file_name = "openvino_intel_cpu_plugin";
+#elif defined(OPENVINO_ARCH_RISCV64)
+const char* cpu_plugin_file_name = "openvino_riscv_cpu_plugin";
+#else
+#    error "Undefined system processor"
+#endif
+
+// The throughput of a model split in two halves over HETERO:CPU0,CPU1, the CPU plugin registered twice with half of
+// the cores each, when the batch is pipelined through the halves in micro-batches against the sequential execution.
+
+namespace ov::test {
+
+namespace {
+
+constexpr size_t batch = 32;
+constexpr size_t features = 1024;
+constexpr size_t layers = 8;
+
+// a MLP with the first half of the layers placed on CPU0 and the second half on CPU1
+std::shared_ptr<ov::Model> make_split_mlp() {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{batch, features});
+    param->get_rt_info()["affinity"] = std::string("CPU0");
+    ov::Output<ov::Node> result = param;
+    for (size_t l = 0; l < layers; l++) {
+        const std::string affinity = l < layers / 2 ? "CPU0" : "CPU1";
+        std::vector<float> values(features * features);
+        for (size_t i = 0; i < values.size(); i++) {
+            values[i] = 0.001f * static_cast<float>(static_cast<int>((i + l) % 17) - 8);
+        }
+        auto weights = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{features, features}, values);
+        auto matmul = std::make_shared<ov::op::v0::MatMul>(result, weights);
+        auto relu = std::make_shared<ov::op::v0::Relu>(matmul);
+        for (const auto& node : ov::NodeVector{weights, matmul, relu}) {
+            node->get_rt_info()["affinity"] = affinity;
+        }
+        result = relu;
+    }
+    auto res = std::make_shared<ov::op::v0::Result>(result);
+    res->get_rt_info()["affinity"] = std::string("CPU1");
+    return std::make_shared<ov::Model>(ov::ResultVector{res}, ov::ParameterVector{param}, "SplitMLP");
+}
+
+}  // namespace
+
+class MicroBatchesBenchmark : public ::testing::Test {};
+
+// Reports the samples per second of the sequential execution (1 micro-batch) and of the pipelined one
+TEST_F(MicroBatchesBenchmark, throughput) {
+#ifdef OPENVINO_STATIC_LIBRARY
+    GTEST_SKIP() << "the CPU plugin is registered twice by its library name, which a static build does not have";
+#endif
+    constexpr size_t iterations = 50;
+    ov::Core core;
+    core.register_plugin(std::string(cpu_plugin_file_name) + OV_BUILD_POSTFIX, "CPU0");
+    core.register_plugin(std::string(cpu_plugin_file_name) + OV_BUILD_POSTFIX, "CPU1");
+    const auto threads = static_cast<int32_t>(std::max(1U, std::thread::hardware_concurrency() / 2));
+    const ov::AnyMap device_config = {ov::num_streams(1),
+                                      ov::inference_num_threads(threads),
+                                      ov::hint::inference_precision(ov::element::f32)};
+
+    const auto model = make_split_mlp();
+    const auto input = ov::test::utils::create_and_fill_tensor(ov::element::f32, model->input().get_shape());
+
+    printf("\n--- HETERO:CPU0,CPU1 MLP %zux%zu, batch %zu, %d threads per device ---\n",
+           layers,
+           features,
+           batch,
+           threads);
+    printf("%-13s | %16s | %8s\n", "Micro-batches", "samples/s", "speedup");
+    printf("--------------+------------------+---------\n");
+    double sequential = 0;
+    for (uint32_t micro_batches : {1, 2, 4, 8}) {
+        auto compiled_model = core.compile_model(model,
+                                                 ov::test::utils::DEVICE_HETERO,
+                                                 ov::device::priorities("CPU0,CPU1"),
+                                                 ov::device::properties("CPU0", device_config),
+                                                 ov::device::properties("CPU1", device_config),
+                                                 ov::hetero::micro_batches(micro_batches));
+        ASSERT_EQ(micro_batches, compiled_model.get_property(ov::hetero::micro_batches));
+        auto request = compiled_model.create_infer_request();
+        request.set_input_tensor(input);
+        for (size_t i = 0; i < 5; i++) {
+            request.infer();
+        }
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; i++) {
+            request.infer();
+        }
+        const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+        const auto throughput = static_cast<double>(iterations * batch) / duration.count();
+        if (micro_batches == 1) {
+            sequential = throughput;
+        }
+        printf("%-13u | %16.1f | %7.2fx\n", micro_batches, throughput, throughput / sequential);
+    }
+}
+
+}  // namespace ov::test
@@ -0,0 +1,99 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include "common_test_utils/test_constants.hpp"
+#include "hetero_tests.hpp"
+#include "openvino/opsets/opset11.hpp"
+#include "properties.hpp"
+
+using namespace ov::hetero::tests;
+
+namespace {
+
+// Add goes to MOCK0 and Subtract to MOCK1, so the model is split into three submodels
+std::shared_ptr<ov::Model> create_model_with_add_subtract_add(size_t batch) {
+    auto param = std::make_shared<ov::opset11::Parameter>(ov::element::i64, ov::Shape{batch, 3, 2, 2});
+    param->set_friendly_name("input");
+    auto const_value = ov::opset11::Constant::create(ov::element::i64, ov::Shape{1, 1, 1, 1}, {1});
+    const_value->set_friendly_name("const_val");
+    auto add = std::make_shared<ov::opset11::Add>(param, const_value);
+    add->set_friendly_name("add");
+    auto subtract_value = ov::opset11::Constant::create(ov::element::i64, ov::Shape{1, 1, 1, 1}, {3});
+    subtract_value->set_friendly_name("sub_val");
+    auto subtract = std::make_shared<ov::opset11::Subtract>(add, subtract_value);
+    subtract->set_friendly_name("sub");
+    auto add2 = std::make_shared<ov::opset11::Add>(subtract, add);
+    add2->set_friendly_name("add2");
+    auto result = std::make_shared<ov::opset11::Result>(add2);
+    result->set_friendly_name("res");
+    return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param});
+}
+
+// Reshape to {-1} mixes the batch into the other dimensions
+std::shared_ptr<ov::Model> create_model_with_flattened_batch(size_t batch) {
+    auto param = std::make_shared<ov::opset11::Parameter>(ov::element::i64, ov::Shape{batch, 3, 2, 2});
+    param->set_friendly_name("input");
+    auto const_value = ov::opset11::Constant::create(ov::element::i64, ov::Shape{1, 1, 1, 1}, {1});
+    const_value->set_friendly_name("const_val");
+    auto add = std::make_shared<ov::opset11::Add>(param, const_value);
+    add->set_friendly_name("add");
+    auto subtract = std::make_shared<ov::opset11::Subtract>(add, const_value);
+    subtract->set_friendly_name("sub");
+    auto reshape_val = ov::opset11::Constant::create(ov::element::i64, ov::Shape{1}, {-1});
+    reshape_val->set_friendly_name("reshape_val");
+    auto reshape = std::make_shared<ov::opset11::Reshape>(subtract, reshape_val, true);
+    reshape->set_friendly_name("reshape");
+    auto result = std::make_shared<ov::opset11::Result>(reshape);
+    result->set_friendly_name("res");
+    return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param});
+}
+
+}  // namespace
+
+TEST_F(HeteroTests, micro_batches_match_sequential_execution) {
+    auto model = create_model_with_add_subtract_add(8);
+    auto compiled_model = core.compile_model(model,
+                                             ov::test::utils::DEVICE_HETERO,
+                                             ov::device::priorities("MOCK0,MOCK1"),
+                                             ov::hetero::micro_batches(4));
+    EXPECT_EQ(4, compiled_model.get_property(ov::hetero::micro_batches));
+    auto compiled_model_ref =
+        core.compile_model(model, ov::test::utils::DEVICE_HETERO, ov::device::priorities("MOCK0,MOCK1"));
+    EXPECT_EQ(1, compiled_model_ref.get_property(ov::hetero::micro_batches));
+
+    auto input_tensor = create_and_fill_tensor(model->input().get_element_type(), model->input().get_shape());
+    auto infer_request_ref = compiled_model_ref.create_infer_request();
+    infer_request_ref.set_input_tensor(input_tensor);
+    infer_request_ref.infer();
+    const auto output_ref = infer_request_ref.get_output_tensor();
+
+    auto infer_request = compiled_model.create_infer_request();
+    infer_request.set_input_tensor(input_tensor);
+    for (bool async : {false, true}) {
+        if (async) {
+            infer_request.start_async();
+            infer_request.wait();
+        } else {
+            infer_request.infer();
+        }
+        const auto output = infer_request.get_output_tensor();
+        ASSERT_EQ(output_ref.get_shape(), output.get_shape());
+        for (size_t i = 0; i < output.get_size(); i++) {
+            EXPECT_EQ(output_ref.data<int64_t>()[i], output.data<int64_t>()[i]) << "at " << i;
+        }
+    }
+}
+
+TEST_F(HeteroTests, micro_batches_fall_back_when_batch_is_not_preserved) {
+    auto model = create_model_with_flattened_batch(4);
+    auto compiled_model = core.compile_model(model,
+                                             ov::test::utils::DEVICE_HETERO,
+                                             ov::device::priorities("MOCK0,MOCK1"),
+                                             ov::hetero::micro_batches(2));
+    EXPECT_EQ(1, compiled_model.get_property(ov::hetero::micro_batches));
+
+    auto infer_request = compiled_model.create_infer_request();
+    infer_request.set_input_tensor(
+        create_and_fill_tensor(model->input().get_element_type(), model->input().get_shape()));
+    ASSERT_NO_THROW(infer_request.infer());
+}
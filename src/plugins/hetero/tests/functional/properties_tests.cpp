@@ -15,7 +15,8 @@ TEST_F(HeteroTests, get_property_supported_properties) {
                                                                 ov::device::full_name,
                                                                 ov::device::capabilities,
                                                                 ov::device::priorities,
-                                                                ov::hint::model_distribution_policy};
+                                                                ov::hint::model_distribution_policy,
+                                                                ov::hetero::micro_batches};
     auto actual_supported_properties = core.get_property(ov::test::utils::DEVICE_HETERO, ov::supported_properties);
     EXPECT_EQ(supported_properties.size(), actual_supported_properties.size());
     for (auto& supported_property : supported_properties) {
@@ -0,0 +1,30 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Lookup counters of a runtime cache accumulated over its lifetime and the current number of stored records
+ */
+struct CacheStatistics {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+    size_t size = 0;
+
+    CacheStatistics& operator+=(const CacheStatistics& rhs) {
+        hits += rhs.hits;
+        misses += rhs.misses;
+        evictions += rhs.evictions;
+        size += rhs.size;
+        return *this;
+    }
+};
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,289 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "cache_statistics.h"
+
+/**
+ * @brief Thread safe preemptive cache with CLOCK (second chance) eviction policy.
+ * @tparam Key is a key type that must define hash() const method with return type convertible to size_t and define
+ * comparison operator.
+ * @tparam Value is a type that must be default constructible and copyable. A default constructed value is returned
+ * when the key is not found.
+ *
+ * The cache is split into independent shards, each guarded by its own mutex. A shard keeps its records in a slot array
+ * indexed with an open addressing hash table, so a lookup touches one contiguous index array instead of list/map nodes.
+ * The slot array and the index grow with the number of records up to the shard capacity, so an entry that only ever
+ * holds a few records does not reserve memory for the whole capacity. Once a shard is full, insertions reuse the slots
+ * of evicted records and do not allocate.
+ * Small caches use a single shard, which makes the eviction order exact with respect to the capacity.
+ */
+
+namespace ov::intel_cpu {
+
+template <typename Key, typename Value>
+class ClockCache {
+public:
+    using value_type = std::pair<Key, Value>;
+
+    explicit ClockCache(size_t capacity)
+        : _capacity(capacity),
+          _shardsNum(std::clamp<size_t>(capacity / minShardCapacity, 1, maxShardsNum)),
+          _shards(new Shard[_shardsNum]) {
+        const size_t shardCapacity = (_capacity + _shardsNum - 1) / _shardsNum;
+        for (size_t i = 0; i < _shardsNum; ++i) {
+            _shards[i].init(shardCapacity);
+        }
+    }
+
+    ClockCache(const ClockCache&) = delete;
+    ClockCache& operator=(const ClockCache&) = delete;
+
+    /**
+     * @brief Puts the value associated with the key into the cache.
+     * @param key
+     * @param value
+     */
+
+    void put(const Key& key, const Value& val) {
+        if (0 == _capacity) {
+            return;
+        }
+        const size_t hash = key.hash();
+        auto& shard = getShard(hash);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        const size_t sizeBefore = shard.size;
+        if (shard.put(key, hash, val)) {
+            _evictions.fetch_add(1, std::memory_order_relaxed);
+        }
+        _size.fetch_add(shard.size - sizeBefore, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Searches a value associated with the key.
+     * @param key
+     * @return Value associated with the key or default constructed instance of the Value type.
+     */
+
+    Value get(const Key& key) {
+        if (0 == _capacity) {
+            return Value();
+        }
+        const size_t hash = key.hash();
+        auto& shard = getShard(hash);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        const auto slot = shard.find(key, hash);
+        if (slot < 0) {
+            _misses.fetch_add(1, std::memory_order_relaxed);
+            return Value();
+        }
+        _hits.fetch_add(1, std::memory_order_relaxed);
+        shard.referenced[slot] = 1;
+        return shard.records[slot]->second;
+    }
+
+    /**
+     * @brief Evicts n records chosen by the CLOCK policy
+     * @param n number of records to be evicted, can be greater than capacity
+     */
+
+    void evict(size_t n) {
+        for (size_t i = 0; i < _shardsNum && n > 0; ++i) {
+            auto& shard = _shards[i];
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            for (; n > 0 && shard.size > 0; --n) {
+                shard.release(shard.nextVictim());
+                _evictions.fetch_add(1, std::memory_order_relaxed);
+                _size.fetch_sub(1, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief Returns the current capacity value
+     * @return the current capacity value
+     */
+    [[nodiscard]] size_t getCapacity() const noexcept {
+        return _capacity;
+    }
+
+    /**
+     * @brief Returns lookup and eviction counters accumulated over the cache lifetime and the current number of records
+     * @note The counters are read without locking the shards, so the values may be slightly out of sync with each other
+     */
+    [[nodiscard]] CacheStatistics getStatistics() const {
+        CacheStatistics statistics;
+        statistics.hits = _hits.load(std::memory_order_relaxed);
+        statistics.misses = _misses.load(std::memory_order_relaxed);
+        statistics.evictions = _evictions.load(std::memory_order_relaxed);
+        statistics.size = _size.load(std::memory_order_relaxed);
+        return statistics;
+    }
+
+private:
+    static constexpr size_t minShardCapacity = 64;
+    static constexpr size_t maxShardsNum = 16;
+    static constexpr size_t minIndexSize = 16;
+    static constexpr int32_t emptyIdx = -1;
+    static constexpr int32_t deletedIdx = -2;
+
+    struct Shard {
+        void init(size_t shardCapacity) {
+            capacity = shardCapacity;
+        }
+
+        [[nodiscard]] int32_t find(const Key& key, size_t hash) const {
+            if (index.empty()) {
+                return emptyIdx;
+            }
+            const size_t mask = index.size() - 1;
+            for (size_t pos = hash & mask;; pos = (pos + 1) & mask) {
+                const auto slot = index[pos];
+                if (slot == emptyIdx) {
+                    return emptyIdx;
+                }
+                if (slot != deletedIdx && hashes[slot] == hash && records[slot]->first == key) {
+                    return slot;
+                }
+            }
+        }
+
+        // returns true if a record had to be evicted to free a slot
+        bool put(const Key& key, size_t hash, const Value& val) {
+            const auto found = find(key, hash);
+            if (found >= 0) {
+                records[found]->second = val;
+                referenced[found] = 1;
+                return false;
+            }
+            bool evicted = false;
+            if (freeSlots.empty()) {
+                if (records.size() < capacity) {
+                    freeSlots.push_back(static_cast<int32_t>(records.size()));
+                    records.emplace_back();
+                    hashes.push_back(0);
+                    referenced.push_back(0);
+                } else {
+                    release(nextVictim());
+                    evicted = true;
+                }
+            }
+            reserveIndex();
+            const auto slot = freeSlots.back();
+            freeSlots.pop_back();
+            records[slot].emplace(key, val);
+            hashes[slot] = hash;
+            referenced[slot] = 0;
+            insertIndex(hash, slot);
+            ++size;
+            return evicted;
+        }
+
+        // advances the clock hand skipping the referenced records, the shard must not be empty
+        int32_t nextVictim() {
+            while (true) {
+                const auto slot = static_cast<int32_t>(hand);
+                hand = (hand + 1) % records.size();
+                if (!records[slot]) {
+                    continue;
+                }
+                if (referenced[slot]) {
+                    referenced[slot] = 0;
+                    continue;
+                }
+                return slot;
+            }
+        }
+
+        void release(int32_t slot) {
+            const size_t mask = index.size() - 1;
+            for (size_t pos = hashes[slot] & mask;; pos = (pos + 1) & mask) {
+                if (index[pos] == slot) {
+                    index[pos] = deletedIdx;
+                    ++deleted;
+                    break;
+                }
+            }
+            records[slot].reset();
+            freeSlots.push_back(slot);
+            --size;
+            if (deleted > index.size() / 4) {
+                rebuildIndex();
+            }
+        }
+
+        void insertIndex(size_t hash, int32_t slot) {
+            const size_t mask = index.size() - 1;
+            for (size_t pos = hash & mask;; pos = (pos + 1) & mask) {
+                if (index[pos] == emptyIdx || index[pos] == deletedIdx) {
+                    if (index[pos] == deletedIdx) {
+                        --deleted;
+                    }
+                    index[pos] = slot;
+                    return;
+                }
+            }
+        }
+
+        // keeps the index load factor, including the deleted marks, at or below 1/2 for the records to be inserted
+        void reserveIndex() {
+            if (2 * (size + deleted + 1) <= index.size()) {
+                return;
+            }
+            size_t indexSize = std::max(minIndexSize, index.size());
+            while (indexSize < 2 * (size + 1)) {
+                indexSize <<= 1;
+            }
+            index.resize(indexSize);
+            rebuildIndex();
+        }
+
+        void rebuildIndex() {
+            std::fill(index.begin(), index.end(), emptyIdx);
+            deleted = 0;
+            for (size_t slot = 0; slot < records.size(); ++slot) {
+                if (records[slot]) {
+                    insertIndex(hashes[slot], static_cast<int32_t>(slot));
+                }
+            }
+        }
+
+        mutable std::mutex mutex;
+        size_t capacity = 0;
+        std::vector<std::optional<value_type>> records;
+        std::vector<size_t> hashes;
+        std::vector<uint8_t> referenced;
+        std::vector<int32_t> freeSlots;
+        std::vector<int32_t> index;
+        size_t hand = 0;
+        size_t size = 0;
+        size_t deleted = 0;
+    };
+
+    Shard& getShard(size_t hash) const {
+        // the low bits are used by the shard index, so pick the shard by the mixed high bits
+        return _shards[((hash * 0x9E3779B97F4A7C15ULL) >> 32) % _shardsNum];
+    }
+
+    size_t _capacity;
+    size_t _shardsNum;
+    std::unique_ptr<Shard[]> _shards;
+    std::atomic<uint64_t> _hits{0};
+    std::atomic<uint64_t> _misses{0};
+    std::atomic<uint64_t> _evictions{0};
+    std::atomic<size_t> _size{0};
+};
+
+}  // namespace ov::intel_cpu
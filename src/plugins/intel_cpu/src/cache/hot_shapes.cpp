@@ -0,0 +1,157 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "hot_shapes.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "cpu_types.h"
+#include "openvino/core/except.hpp"
+
+namespace ov::intel_cpu {
+
+HotShapes::HotShapes(size_t count, size_t streams)
+    : m_count(count),
+      m_streams(std::max<size_t>(streams, 1)),
+      m_tables(new Table[m_streams]) {}
+
+void HotShapes::record(size_t stream, const Record& shapes, uint64_t hits) {
+    if (!enabled()) {
+        return;
+    }
+    auto& table = m_tables[stream % m_streams];
+    std::lock_guard<std::mutex> lock(table.mutex);
+    auto it = table.hits.find(shapes);
+    if (it != table.hits.end()) {
+        it->second += hits;
+    } else if (table.hits.size() < m_count * tracked_per_exported) {
+        table.hits.emplace(shapes, hits);
+    }
+}
+
+std::vector<HotShapes::Record> HotShapes::hottest() const {
+    std::map<Record, uint64_t> merged;
+    for (size_t s = 0; s < m_streams; s++) {
+        std::lock_guard<std::mutex> lock(m_tables[s].mutex);
+        for (const auto& [shapes, hits] : m_tables[s].hits) {
+            merged[shapes] += hits;
+        }
+    }
+    std::vector<std::pair<uint64_t, const Record*>> ranked;
+    ranked.reserve(merged.size());
+    for (const auto& [shapes, hits] : merged) {
+        ranked.emplace_back(hits, &shapes);
+    }
+    const size_t count = std::min(m_count, ranked.size());
+    // stable: records with the same number of hits keep the deterministic order of the map
+    std::stable_sort(ranked.begin(), ranked.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.first > rhs.first;
+    });
+    std::vector<Record> result;
+    result.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        result.push_back(*ranked[i].second);
+    }
+    return result;
+}
+
+// Records are separated by ';', every input shape is enclosed in braces, so that scalar inputs ("{}") are kept:
+// "{1,128}{1,128};{4,16}{4,16}"
+std::string HotShapes::serialize(const std::vector<Record>& records) {
+    std::ostringstream ss;
+    for (size_t r = 0; r < records.size(); r++) {
+        if (r != 0) {
+            ss << ';';
+        }
+        for (const auto& dims : records[r]) {
+            ss << '{';
+            for (size_t d = 0; d < dims.size(); d++) {
+                ss << (d != 0 ? "," : "") << dims[d];
+            }
+            ss << '}';
+        }
+    }
+    return ss.str();
+}
+
+std::vector<HotShapes::Record> HotShapes::deserialize(const std::string& str) {
+    std::vector<Record> records;
+    if (str.empty()) {
+        return records;
+    }
+    records.emplace_back();
+    size_t pos = 0;
+    while (pos < str.size()) {
+        if (str[pos] == ';') {
+            records.emplace_back();
+            pos++;
+            continue;
+        }
+        OPENVINO_ASSERT(str[pos] == '{', "[CPU] Malformed hot shapes record: ", str);
+        const auto end = str.find('}', pos);
+        OPENVINO_ASSERT(end != std::string::npos, "[CPU] Malformed hot shapes record: ", str);
+        VectorDims dims;
+        std::istringstream dims_stream(str.substr(pos + 1, end - pos - 1));
+        std::string dim;
+        while (std::getline(dims_stream, dim, ',')) {
+            OPENVINO_ASSERT(!dim.empty() && std::all_of(dim.begin(),
+                                                        dim.end(),
+                                                        [](char c) {
+                                                            return c >= '0' && c <= '9';
+                                                        }),
+                            "[CPU] Malformed hot shapes record: ",
+                            str);
+            dims.push_back(static_cast<Dim>(std::stoull(dim)));
+        }
+        records.back().push_back(std::move(dims));
+        pos = end + 1;
+    }
+    return records;
+}
+
+bool HotShapes::save(const std::filesystem::path& path, const std::vector<Record>& records) {
+    // written aside and renamed, so that a concurrent load never sees a partial file
+    auto tmp_path = path;
+    tmp_path += ".tmp";
+    {
+        std::ofstream stream(tmp_path, std::ios::trunc);
+        stream << serialize(records);
+        if (!stream.good()) {
+            return false;
+        }
+    }
+    std::error_code ec;
+    std::filesystem::rename(tmp_path, path, ec);
+    if (ec) {
+        std::filesystem::remove(tmp_path, ec);
+        return false;
+    }
+    return true;
+}
+
+std::vector<HotShapes::Record> HotShapes::load(const std::filesystem::path& path) {
+    std::ifstream stream(path);
+    if (!stream.good()) {
+        return {};
+    }
+    const std::string str{std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>()};
+    try {
+        return deserialize(str);
+    } catch (const std::exception&) {
+        return {};
+    }
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,82 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "cpu_types.h"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Input shapes a dynamic model has been executed with, ranked by the number of inferences.
+ *
+ * Every new input shape makes the nodes of a dynamic graph create their executors and JIT kernels through the runtime
+ * parameters cache, and that work is lost when the process restarts. The hottest shapes are therefore written to the
+ * blob by export_model and replayed in the background after import_model, so the cache is already warm when the
+ * first requests arrive. With ov::cache_dir the blob is exported by the core right after compile_model, before any
+ * inference, so the records are saved next to it by the compiled model instead (see save() and load()).
+ */
+class HotShapes {
+public:
+    /// Shapes of all the model inputs of one inference, in the order of the model inputs
+    using Record = std::vector<VectorDims>;
+
+    /// The model rt_info entry the records are exported to
+    static constexpr const char* rt_info_key = "intel_cpu_hot_shapes";
+    /// The model rt_info entry naming the file the records are saved to in the cache directory
+    static constexpr const char* rt_info_id_key = "intel_cpu_hot_shapes_id";
+
+    /**
+     * @param count the number of the hottest records kept for export, 0 disables recording
+     * @param streams the number of the streams recording, each one has its own table
+     */
+    explicit HotShapes(size_t count, size_t streams = 1);
+
+    [[nodiscard]] bool enabled() const {
+        return m_count != 0;
+    }
+
+    /**
+     * @brief Accounts `hits` inferences with the given input shapes in the table of the stream. A table is only updated
+     * by the requests running on its stream, so the inferences of different streams do not contend for a lock. Once
+     * a bounded number of distinct records is tracked, new shapes are dropped so that a stream of unique shapes
+     * cannot grow the table without limits.
+     */
+    void record(size_t stream, const Record& shapes, uint64_t hits = 1);
+
+    /// Up to `count` records the model has been executed with most often over all the streams, the hottest first
+    [[nodiscard]] std::vector<Record> hottest() const;
+
+    static std::string serialize(const std::vector<Record>& records);
+    static std::vector<Record> deserialize(const std::string& str);
+
+    /// Writes the records to the file, returns false if it cannot be written
+    static bool save(const std::filesystem::path& path, const std::vector<Record>& records);
+    /// The records saved to the file, empty if there is no such file or it is malformed
+    static std::vector<Record> load(const std::filesystem::path& path);
+
+private:
+    // distinct records tracked per exported one, leaves room for a shape to become hot later in the run
+    static constexpr size_t tracked_per_exported = 16;
+
+    struct Table {
+        mutable std::mutex mutex;
+        std::map<Record, uint64_t> hits;
+    };
+
+    size_t m_count;
+    size_t m_streams;
+    std::unique_ptr<Table[]> m_tables;
+};
+
+}  // namespace ov::intel_cpu
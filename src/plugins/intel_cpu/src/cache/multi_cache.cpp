@@ -5,9 +5,21 @@
 #include "multi_cache.h"
 
 #include <atomic>
+#include <mutex>
+
+#include "cache_statistics.h"
 
 namespace ov::intel_cpu {
 
 std::atomic_size_t MultiCache::_typeIdCounter{0};
 
+CacheStatistics MultiCache::getStatistics() const {
+    CacheStatistics statistics;
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (const auto& entry : _storage) {
+        statistics += entry.second->getStatistics();
+    }
+    return statistics;
+}
+
 }  // namespace ov::intel_cpu
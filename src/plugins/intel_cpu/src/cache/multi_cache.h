@@ -7,17 +7,19 @@
 #include <atomic>
 #include <cstddef>
 #include <memory>
+#include <mutex>
 #include <type_traits>
 #include <unordered_map>
 
 #include "cache_entry.h"
+#include "cache_statistics.h"
 
 namespace ov::intel_cpu {
 
 /**
  * @brief Class that represent a preemptive cache for different key/value pair types.
  *
- * @attention This implementation IS NOT THREAD SAFE!
+ * @note The cache is thread safe, so one instance can be shared between the streams of a compiled model.
  */
 
 class MultiCache {
@@ -34,6 +36,11 @@ public:
      */
     explicit MultiCache(size_t capacity) : _capacity(capacity) {}
 
+    MultiCache(const MultiCache& other) : _capacity(other._capacity) {
+        std::lock_guard<std::mutex> lock(other._mutex);
+        _storage = other._storage;
+    }
+
     /**
      * @brief Searches a value of ValueType in the cache using the provided key or creates a new ValueType instance (if
      * nothing was found) using the key and the builder functor and adds the new record to the cache
@@ -51,6 +58,11 @@ public:
         return entry->getOrCreate(key, std::move(builder));
     }
 
+    /**
+     * @brief Returns the statistics accumulated over all the entries of the cache
+     */
+    [[nodiscard]] CacheStatistics getStatistics() const;
+
 private:
     template <typename T>
     size_t getTypeId();
@@ -59,6 +71,7 @@ private:
 
     static std::atomic_size_t _typeIdCounter;
     size_t _capacity;
+    mutable std::mutex _mutex;
     std::unordered_map<size_t, EntryBasePtr> _storage;
 };
 
@@ -72,6 +85,7 @@ template <typename KeyType, typename ValueType>
 MultiCache::EntryPtr<KeyType, ValueType> MultiCache::getEntry() {
     using EntryType = EntryTypeT<KeyType, ValueType>;
     size_t id = getTypeId<EntryType>();
+    std::lock_guard<std::mutex> lock(_mutex);
     auto itr = _storage.find(id);
     if (itr == _storage.end()) {
         auto result = _storage.insert({id, std::make_shared<EntryType>(_capacity)});
@@ -8,14 +8,21 @@
 #include <cstdint>
 #include <cstring>
 #include <exception>
+#include <filesystem>
 #include <memory>
 #include <mutex>
 #include <ostream>
+#include <set>
+#include <string>
 #include <utility>
 #include <vector>
 
 #include "async_infer_request.h"
+#include "cache/cache_statistics.h"
+#include "cache/hot_shapes.h"
+#include "cache/multi_cache.h"
 #include "config.h"
+#include "cpu_memory.h"
 #include "cpu_parallel.hpp"
 #include "graph.h"
 #include "graph_context.h"
@@ -26,6 +33,7 @@
 #include "openvino/core/except.hpp"
 #include "openvino/core/model.hpp"
 #include "openvino/runtime/iasync_infer_request.hpp"
+#include "openvino/runtime/itensor.hpp"
 #include "openvino/runtime/icompiled_model.hpp"
 #include "openvino/runtime/intel_cpu/properties.hpp"
 #include "openvino/runtime/iplugin.hpp"
@@ -35,6 +43,7 @@
 #include "openvino/runtime/threading/cpu_streams_info.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
 #include "openvino/runtime/threading/itask_executor.hpp"
+#include "state_swap.h"
 #include "sub_memory_manager.hpp"
 #include "utils/debug_capabilities.h"
 #include "utils/general_utils.h"
@@ -63,6 +72,16 @@ struct ImmediateSerialExecutor : public ov::threading::ITaskExecutor {
 };
 
 CompiledModel::~CompiledModel() {
+    // with the model cache, the blob is exported before any inference, so the hot shapes are saved next to it
+    if (m_hot_shapes.enabled() && !m_cfg.cacheDir.empty() && !m_hot_shapes_id.empty()) {
+        try {
+            if (const auto records = m_hot_shapes.hottest(); !records.empty()) {
+                HotShapes::save(hot_shapes_path(), records);
+            }
+        } catch (...) {
+            // the hot shapes are an optimization only
+        }
+    }
     if (m_has_sub_compiled_models) {
         m_sub_compiled_models.clear();
         m_sub_memory_manager->_memorys_table.clear();
@@ -85,9 +104,21 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
       m_cfg{std::move(cfg)},
       m_name{model->get_name()},
       m_loaded_from_cache(loaded_from_cache),
+      m_socketWeights(m_cfg.weightsNumaPolicy, m_cfg.weightsHugePages),
+      m_dynamicMemoryPool(m_cfg.dynamicMemoryPool ? std::make_shared<DynamicMemoryPool>(m_cfg.dynamicMemoryGrowth,
+                                                                                        m_cfg.dynamicMemoryShrinkAfter,
+                                                                                        true)
+                                                  : nullptr),
       m_sub_memory_manager(std::move(sub_memory_manager)) {
     m_mutex = std::make_shared<std::mutex>();
     m_runtime_requirements = build_runtime_requirements();
+    if (!m_cfg.stateSwapDir.empty()) {
+        m_state_swap = std::make_shared<StateSwapManager>(
+            m_cfg.stateSwapBudget,
+            m_cfg.stateSwapDir,
+            m_plugin->get_executor_manager()->get_idle_cpu_streams_executor(
+                IStreamsExecutor::Config{"CPUStateSwapExecutor", 1, 0}));
+    }
     const auto& core = m_plugin->get_core();
     OPENVINO_ASSERT(core, "Unable to get API version. Core is unavailable");
 
@@ -125,6 +156,12 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
     std::vector<Task> tasks;
     tasks.resize(streams);
     m_graphs.resize(streams);
+    for (size_t i = 0; i < m_graphs.size(); i++) {
+        m_graphs[i]._streamIdx = i;
+    }
+    if (model->is_dynamic() && m_cfg.rtCacheCapacity != 0 && m_cfg.rtCacheWarmupShapes != 0) {
+        m_hot_shapes = HotShapes(m_cfg.rtCacheWarmupShapes, m_graphs.size());
+    }
     if (executor_config.get_streams() != 0) {
         auto all_graphs_ready = [&] {
             return std::all_of(m_graphs.begin(), m_graphs.end(), [&](Graph& graph) {
@@ -204,12 +241,29 @@ CompiledModel::GraphGuard::Lock CompiledModel::get_graph() const {
                     auto isQuantizedFlag = (m_cfg.lpTransformsMode == Config::On) &&
                                            ov::pass::low_precision::LowPrecision::isFunctionQuantized(m_model);
                     auto cpuParallel = std::make_shared<CpuParallel>(m_cfg.tbbPartitioner);
+                    MultiCachePtr paramsCache = nullptr;
+                    if (m_cfg.rtCacheShared) {
+                        auto& socketCache = m_socketParamsCaches[socketId];
+                        if (!socketCache) {
+                            socketCache = std::make_shared<MultiCache>(m_cfg.rtCacheCapacity);
+                        }
+                        paramsCache = socketCache;
+                    }
+                    // the node of the stream the graph is created on
+                    const int numaNodeId = streamsExecutor ? streamsExecutor->get_numa_node_id() : -1;
                     ctx = std::make_shared<GraphContext>(m_cfg,
-                                                         m_socketWeights[socketId],
+                                                         m_socketWeights.get(socketId, numaNodeId),
                                                          isQuantizedFlag,
                                                          streamsExecutor,
                                                          cpuParallel,
-                                                         m_sub_memory_manager);
+                                                         m_sub_memory_manager,
+                                                         paramsCache,
+                                                         m_dynamicMemoryPool);
+                    const auto& ctxParamsCache = ctx->getParamsCache();
+                    if (std::find(m_paramsCaches.begin(), m_paramsCaches.end(), ctxParamsCache) ==
+                        m_paramsCaches.end()) {
+                        m_paramsCaches.push_back(ctxParamsCache);
+                    }
                 }
 
                 const std::shared_ptr<const ov::Model> model = m_model;
@@ -231,6 +285,61 @@ CompiledModel::GraphGuard::Lock CompiledModel::get_graph() const {
     return graphLock;
 }
 
+std::map<std::string, uint64_t> CompiledModel::get_runtime_cache_statistics() const {
+    // the counters are atomics of the caches, so the graphs running inference are not locked
+    std::vector<MultiCachePtr> caches;
+    {
+        std::lock_guard<std::mutex> lock{*m_mutex};
+        caches = m_paramsCaches;
+    }
+    CacheStatistics statistics;
+    for (const auto& cache : caches) {
+        statistics += cache->getStatistics();
+    }
+    return {{"hits", statistics.hits},
+            {"misses", statistics.misses},
+            {"evictions", statistics.evictions},
+            {"size", statistics.size}};
+}
+
+std::map<std::string, uint64_t> CompiledModel::get_weights_cache_statistics() const {
+    const auto policy = m_socketWeights.getPolicy();
+    std::map<std::string, uint64_t> statistics{{"total", 0}};
+    for (const auto& item : m_socketWeights.dumpStatistics()) {
+        std::string name = "all";
+        if (policy == WeightsNumaPolicy::REPLICATE) {
+            name = "node" + std::to_string(item.first);
+        } else if (policy != WeightsNumaPolicy::INTERLEAVE) {
+            name = "socket" + std::to_string(item.first);
+        }
+        statistics[name] = item.second.total_size;
+        statistics["total"] += item.second.total_size;
+    }
+    return statistics;
+}
+
+std::map<std::string, uint64_t> CompiledModel::get_dynamic_memory_statistics() const {
+    std::set<DynamicMemoryPoolPtr> pools;
+    for (auto&& graph : m_graphs) {
+        GraphGuard::Lock graphLock{graph};
+        if (const auto& ctx = graphLock._graph.getGraphContext()) {
+            pools.insert(ctx->getDynamicMemoryPool());
+        }
+    }
+    DynamicMemoryPool::Statistics statistics;
+    for (const auto& pool : pools) {
+        statistics += pool->getStatistics();
+    }
+    return {{"allocations", statistics.allocations},
+            {"allocated_bytes", statistics.allocated_bytes},
+            {"reuses", statistics.reuses},
+            {"shrinks", statistics.shrinks},
+            {"frees", statistics.frees},
+            {"in_use_bytes", statistics.in_use_bytes},
+            {"cached_bytes", statistics.cached_bytes},
+            {"peak_bytes", statistics.peak_bytes}};
+}
+
 std::shared_ptr<ov::ISyncInferRequest> CompiledModel::create_sync_infer_request() const {
     return std::make_shared<SyncInferRequest>(
         CompiledModelHolder(std::static_pointer_cast<const CompiledModel>(shared_from_this())));
@@ -267,6 +376,15 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
     if (name == ov::loaded_from_cache) {
         return m_loaded_from_cache;
     }
+    if (name == ov::intel_cpu::cpu_runtime_cache_statistics) {
+        return decltype(ov::intel_cpu::cpu_runtime_cache_statistics)::value_type(get_runtime_cache_statistics());
+    }
+    if (name == ov::intel_cpu::cpu_weights_cache_statistics) {
+        return decltype(ov::intel_cpu::cpu_weights_cache_statistics)::value_type(get_weights_cache_statistics());
+    }
+    if (name == ov::intel_cpu::cpu_dynamic_memory_statistics) {
+        return decltype(ov::intel_cpu::cpu_dynamic_memory_statistics)::value_type(get_dynamic_memory_statistics());
+    }
 
     Config engConfig = get_graph()._graph.getConfig();
     auto option = engConfig._config.find(name);
@@ -305,6 +423,20 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
             RO_property(ov::log::level.name()),
             RO_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
             RO_property(ov::intel_cpu::enable_tensor_parallel.name()),
+            RO_property(ov::intel_cpu::cpu_runtime_cache_shared.name()),
+            RO_property(ov::intel_cpu::cpu_runtime_cache_warmup_shapes.name()),
+            RO_property(ov::intel_cpu::cpu_runtime_cache_statistics.name()),
+            RO_property(ov::intel_cpu::cpu_inter_op_parallelism.name()),
+            RO_property(ov::intel_cpu::cpu_extended_profiling.name()),
+            RO_property(ov::intel_cpu::cpu_state_swap_dir.name()),
+            RO_property(ov::intel_cpu::cpu_state_swap_budget.name()),
+            RO_property(ov::intel_cpu::cpu_weights_numa_policy.name()),
+            RO_property(ov::intel_cpu::cpu_weights_huge_pages.name()),
+            RO_property(ov::intel_cpu::cpu_weights_cache_statistics.name()),
+            RO_property(ov::intel_cpu::cpu_dynamic_memory_growth.name()),
+            RO_property(ov::intel_cpu::cpu_dynamic_memory_shrink_after.name()),
+            RO_property(ov::intel_cpu::cpu_dynamic_memory_pool.name()),
+            RO_property(ov::intel_cpu::cpu_dynamic_memory_statistics.name()),
             RO_property(ov::intel_cpu::tbb_partitioner.name()),
             RO_property(ov::hint::dynamic_quantization_group_size.name()),
             RO_property(ov::hint::kv_cache_precision.name()),
@@ -389,6 +521,41 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
         const auto& enable_tensor_parallel = config.enableTensorParallel;
         return enable_tensor_parallel;
     }
+    if (name == ov::intel_cpu::cpu_runtime_cache_shared) {
+        return static_cast<decltype(ov::intel_cpu::cpu_runtime_cache_shared)::value_type>(config.rtCacheShared);
+    }
+    if (name == ov::intel_cpu::cpu_runtime_cache_warmup_shapes) {
+        return static_cast<decltype(ov::intel_cpu::cpu_runtime_cache_warmup_shapes)::value_type>(
+            config.rtCacheWarmupShapes);
+    }
+    if (name == ov::intel_cpu::cpu_inter_op_parallelism) {
+        return static_cast<decltype(ov::intel_cpu::cpu_inter_op_parallelism)::value_type>(config.interOpParallelism);
+    }
+    if (name == ov::intel_cpu::cpu_extended_profiling) {
+        return config.extendedProfilingPath;
+    }
+    if (name == ov::intel_cpu::cpu_state_swap_dir) {
+        return config.stateSwapDir;
+    }
+    if (name == ov::intel_cpu::cpu_state_swap_budget) {
+        return config.stateSwapBudget;
+    }
+    if (name == ov::intel_cpu::cpu_weights_numa_policy) {
+        return config.weightsNumaPolicy;
+    }
+    if (name == ov::intel_cpu::cpu_weights_huge_pages) {
+        return static_cast<decltype(ov::intel_cpu::cpu_weights_huge_pages)::value_type>(config.weightsHugePages);
+    }
+    if (name == ov::intel_cpu::cpu_dynamic_memory_growth) {
+        return config.dynamicMemoryGrowth;
+    }
+    if (name == ov::intel_cpu::cpu_dynamic_memory_shrink_after) {
+        return static_cast<decltype(ov::intel_cpu::cpu_dynamic_memory_shrink_after)::value_type>(
+            config.dynamicMemoryShrinkAfter);
+    }
+    if (name == ov::intel_cpu::cpu_dynamic_memory_pool) {
+        return static_cast<decltype(ov::intel_cpu::cpu_dynamic_memory_pool)::value_type>(config.dynamicMemoryPool);
+    }
     if (name == ov::intel_cpu::tbb_partitioner) {
         return config.tbbPartitioner;
     }
@@ -432,9 +599,111 @@ static void write_header(std::ostream& modelStream, const std::string& runtime_r
 void CompiledModel::export_model(std::ostream& modelStream) const {
     write_header(modelStream, m_runtime_requirements);
     ModelSerializer serializer(modelStream, m_cfg.cacheEncrypt, m_cfg.m_cache_mode == ov::CacheMode::OPTIMIZE_SIZE);
+    if (!m_hot_shapes_id.empty()) {
+        serializer.set_rt_info(HotShapes::rt_info_id_key, m_hot_shapes_id);
+    }
+    if (const auto hot_shapes = m_hot_shapes.hottest(); !hot_shapes.empty()) {
+        serializer.set_rt_info(HotShapes::rt_info_key, HotShapes::serialize(hot_shapes));
+    }
     serializer << m_model;
 }
 
+std::filesystem::path CompiledModel::hot_shapes_path() const {
+    return std::filesystem::path(m_cfg.cacheDir) / (m_hot_shapes_id + ".hot_shapes");
+}
+
+void CompiledModel::warm_up(std::vector<HotShapes::Record> records, const std::string& id) {
+    if (!m_hot_shapes.enabled() || m_has_sub_compiled_models) {
+        return;
+    }
+    if (!id.empty()) {
+        m_hot_shapes_id = id;
+        if (!m_cfg.cacheDir.empty()) {
+            // saved after the blob was exported, so they go before the exported ones
+            auto saved = HotShapes::load(hot_shapes_path());
+            for (auto& shapes : records) {
+                if (std::find(saved.begin(), saved.end(), shapes) == saved.end()) {
+                    saved.push_back(std::move(shapes));
+                }
+            }
+            records = std::move(saved);
+        }
+    }
+    const auto& model_inputs = inputs();
+    const auto is_applicable = [&](const HotShapes::Record& shapes) {
+        if (shapes.size() != model_inputs.size()) {
+            return false;
+        }
+        for (size_t i = 0; i < shapes.size(); i++) {
+            const auto& input = model_inputs[i];
+            if (input.get_element_type() == ov::element::string || input.get_element_type().is_dynamic() ||
+                !input.get_partial_shape().compatible(ov::Shape(shapes[i].begin(), shapes[i].end()))) {
+                return false;
+            }
+        }
+        return true;
+    };
+    records.erase(std::remove_if(records.begin(),
+                                 records.end(),
+                                 [&](const HotShapes::Record& shapes) {
+                                     return !is_applicable(shapes);
+                                 }),
+                  records.end());
+    if (records.size() > m_cfg.rtCacheWarmupShapes) {
+        records.resize(m_cfg.rtCacheWarmupShapes);
+    }
+    if (records.empty()) {
+        return;
+    }
+    // keep the imported ranking for the next export
+    for (size_t i = 0; i < records.size(); i++) {
+        m_hot_shapes.record(0, records[i], records.size() - i);
+    }
+
+    std::weak_ptr<const CompiledModel> weak_this = std::static_pointer_cast<const CompiledModel>(shared_from_this());
+    auto executor = m_plugin->get_executor_manager()->get_executor("CPUShapeWarmupExecutor");
+    executor->run([weak_this, records = std::move(records)] {
+        if (auto compiled_model = weak_this.lock()) {
+            compiled_model->replay_hot_shapes(records);
+        }
+    });
+}
+
+void CompiledModel::replay_hot_shapes(const std::vector<HotShapes::Record>& records) const {
+    // One request per stream, started together, so that every stream builds the executors in its own graph. The
+    // inputs are zero filled: only the shapes matter for the executors, the results are dropped.
+    try {
+        std::vector<std::shared_ptr<ov::IAsyncInferRequest>> requests(m_graphs.size());
+        for (auto& request : requests) {
+            // warm_up() has ranked the replayed shapes already, accounting them again would keep stale shapes hot
+            auto sync_request = std::static_pointer_cast<SyncInferRequest>(create_sync_infer_request());
+            sync_request->disable_hot_shapes_recording();
+            request = std::make_shared<AsyncInferRequest>(sync_request,
+                                                          get_task_executor(),
+                                                          get_callback_executor(),
+                                                          m_optimized_single_stream);
+        }
+        const auto& model_inputs = inputs();
+        for (const auto& shapes : records) {
+            for (const auto& request : requests) {
+                for (size_t i = 0; i < model_inputs.size(); i++) {
+                    auto tensor = ov::make_tensor(model_inputs[i].get_element_type(),
+                                                  ov::Shape(shapes[i].begin(), shapes[i].end()));
+                    std::memset(tensor->data(), 0, tensor->get_byte_size());
+                    request->set_tensor(model_inputs[i], tensor);
+                }
+                request->start_async();
+            }
+            for (const auto& request : requests) {
+                request->wait();
+            }
+        }
+    } catch ([[maybe_unused]] const std::exception& e) {
+        // warm-up is an optimization only: a shape the model cannot execute with zero inputs just stays cold
+        DEBUG_LOG("Hot shapes warm-up of ", m_name, " stopped: ", e.what());
+    }
+}
+
 void CompiledModel::release_memory() {
     for (auto&& graph : m_graphs) {
         // try to lock mutex, since it may be already locked (e.g by an infer request)
@@ -445,6 +714,9 @@ void CompiledModel::release_memory() {
         auto ctx = graph.getGraphContext();
         ctx->releaseMemory();
     }
+    if (m_state_swap) {
+        m_state_swap->evict_all();
+    }
 }
 
 }  // namespace ov::intel_cpu
@@ -5,7 +5,10 @@
 #pragma once
 
 #include <atomic>
+#include <cstdint>
 #include <deque>
+#include <filesystem>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <ostream>
@@ -13,7 +16,10 @@
 #include <utility>
 #include <vector>
 
+#include "cache/hot_shapes.h"
+#include "cache/multi_cache.h"
 #include "config.h"
+#include "cpu_memory.h"
 #include "graph.h"
 #include "openvino/core/any.hpp"
 #include "openvino/core/except.hpp"
@@ -23,6 +29,7 @@
 #include "openvino/runtime/iplugin.hpp"
 #include "openvino/runtime/isync_infer_request.hpp"
 #include "openvino/runtime/threading/itask_executor.hpp"
+#include "state_swap.h"
 #include "sub_memory_manager.hpp"
 #include "weights_cache.hpp"
 
@@ -34,6 +41,8 @@ public:
 
     struct GraphGuard : public Graph {
         std::mutex _mutex;
+        // index of the stream the graph belongs to
+        size_t _streamIdx = 0;
         struct Lock : public std::unique_lock<std::mutex> {
             explicit Lock(GraphGuard& graph) : std::unique_lock<std::mutex>(graph._mutex), _graph(graph) {}
             GraphGuard& _graph;
@@ -63,6 +72,28 @@ public:
 
     void release_memory() override;
 
+    /**
+     * @brief Replays the hot input shapes of an imported model in the background on the streams executor, so that
+     * the executors of these shapes are already in the runtime parameters cache when the first requests arrive.
+     * The records are also kept for the next export_model.
+     * @param records shapes of the model inputs, the hottest first
+     * @param id identifier of the exported model the records are saved under in the cache directory, empty if none
+     */
+    void warm_up(std::vector<HotShapes::Record> records, const std::string& id);
+
+    /**
+     * @brief Names the file the hot shapes of a compiled model are saved to in the cache directory. The id is derived
+     * from the model and the config, so a model compiled again overwrites the file of the previous compilation instead
+     * of leaving it behind.
+     */
+    void set_hot_shapes_id(std::string id) {
+        m_hot_shapes_id = std::move(id);
+    }
+
+    [[nodiscard]] bool hot_shapes_enabled() const {
+        return m_hot_shapes.enabled();
+    }
+
     std::string name() const {
         return m_name;
     }
@@ -87,6 +118,12 @@ private:
     // WARNING: Do not use m_graphs directly.
     mutable std::deque<GraphGuard> m_graphs;
     mutable SocketsWeights m_socketWeights;
+    // runtime parameters caches shared by the streams of the same socket (see Config::rtCacheShared)
+    mutable std::map<int, MultiCachePtr> m_socketParamsCaches;
+    // distinct runtime parameters caches of the created graphs, guarded by m_mutex
+    mutable std::vector<MultiCachePtr> m_paramsCaches;
+    // the dynamic memory pool shared by the streams (see Config::dynamicMemoryPool)
+    DynamicMemoryPoolPtr m_dynamicMemoryPool;
 
     /* WARNING: Use get_graph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
@@ -94,6 +131,19 @@ private:
      */
     GraphGuard::Lock get_graph() const;
 
+    std::map<std::string, uint64_t> get_runtime_cache_statistics() const;
+
+    // bytes of the repacked weights by the copy, see ov::intel_cpu::cpu_weights_cache_statistics
+    std::map<std::string, uint64_t> get_weights_cache_statistics() const;
+
+    // see ov::intel_cpu::cpu_dynamic_memory_statistics
+    std::map<std::string, uint64_t> get_dynamic_memory_statistics() const;
+
+    void replay_hot_shapes(const std::vector<HotShapes::Record>& records) const;
+
+    // the file the hot shapes are saved to in the cache directory
+    std::filesystem::path hot_shapes_path() const;
+
     std::vector<std::shared_ptr<CompiledModel>> get_sub_compiled_models() const {
         return m_sub_compiled_models;
     }
@@ -103,6 +153,12 @@ private:
     bool m_has_sub_compiled_models = false;
     bool m_optimized_single_stream = false;
     std::string m_runtime_requirements;
+    // input shapes the model is executed with, exported to prebuild their executors after import
+    mutable HotShapes m_hot_shapes{0};
+    // names the file of the hot shapes in the cache directory, kept over export and import
+    std::string m_hot_shapes_id;
+    // swaps out the KV cache states of the idle infer requests, nullptr if disabled (see Config::stateSwapDir)
+    StateSwapManagerPtr m_state_swap;
 };
 
 // This class provides safe access to the internal CompiledModel structures and helps to decouple SyncInferRequest and
@@ -153,6 +209,14 @@ public:
         return m_id;
     }
 
+    [[nodiscard]] HotShapes& hot_shapes() const {
+        return m_compiled_model->m_hot_shapes;
+    }
+
+    [[nodiscard]] const StateSwapManagerPtr& state_swap() const {
+        return m_compiled_model->m_state_swap;
+    }
+
 private:
     std::shared_ptr<const CompiledModel> m_compiled_model;
     const Graph* m_graph;
@@ -285,6 +285,105 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
             // as zero that means disabling the cache
             rtCacheCapacity = std::max(val_i, 0);
             snippetsCacheCapacity = std::max(val_i, 0);
+        } else if (ov::intel_cpu::cpu_runtime_cache_warmup_shapes.name() == key) {
+            int val_i = -1;
+            try {
+                ov::Any value = val.as<std::string>();
+                val_i = value.as<int>();
+            } catch (const ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_runtime_cache_warmup_shapes.name(),
+                               ". Expected only integer numbers");
+            }
+            // any negative value disables recording and warm-up
+            rtCacheWarmupShapes = std::max(val_i, 0);
+        } else if (key == ov::intel_cpu::cpu_runtime_cache_shared.name()) {
+            try {
+                rtCacheShared = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_runtime_cache_shared.name(),
+                               ". Expected only true/false.");
+            }
+        } else if (key == ov::intel_cpu::cpu_inter_op_parallelism.name()) {
+            try {
+                interOpParallelism = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_inter_op_parallelism.name(),
+                               ". Expected only true/false.");
+            }
+        } else if (key == ov::intel_cpu::cpu_extended_profiling.name()) {
+            extendedProfilingPath = val.as<std::string>();
+        } else if (key == ov::cache_dir.name()) {
+            cacheDir = val.as<std::string>();
+        } else if (key == ov::intel_cpu::cpu_state_swap_dir.name()) {
+            stateSwapDir = val.as<std::string>();
+        } else if (key == ov::intel_cpu::cpu_state_swap_budget.name()) {
+            try {
+                stateSwapBudget = val.as<uint64_t>();
+            } catch (const ov::Exception&) {
+                OPENVINO_THROW("Wrong value for property key ",
+                               ov::intel_cpu::cpu_state_swap_budget.name(),
+                               ". Expected only unsigned integer numbers");
+            }
+        } else if (key == ov::intel_cpu::cpu_weights_numa_policy.name()) {
+            try {
+                weightsNumaPolicy = val.as<ov::intel_cpu::WeightsNumaPolicy>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_weights_numa_policy.name(),
+                               ". Expected values: ov::intel_cpu::WeightsNumaPolicy::FIRST_TOUCH/LOCAL/INTERLEAVE/"
+                               "REPLICATE");
+            }
+        } else if (key == ov::intel_cpu::cpu_weights_huge_pages.name()) {
+            try {
+                weightsHugePages = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_weights_huge_pages.name(),
+                               ". Expected only true/false.");
+            }
+        } else if (key == ov::intel_cpu::cpu_dynamic_memory_growth.name()) {
+            try {
+                dynamicMemoryGrowth = val.as<ov::intel_cpu::DynamicMemoryGrowth>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_dynamic_memory_growth.name(),
+                               ". Expected values: ov::intel_cpu::DynamicMemoryGrowth::EXACT/GEOMETRIC/BUCKETED");
+            }
+        } else if (key == ov::intel_cpu::cpu_dynamic_memory_shrink_after.name()) {
+            try {
+                dynamicMemoryShrinkAfter = val.as<uint32_t>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_dynamic_memory_shrink_after.name(),
+                               ". Expected only unsigned integer numbers");
+            }
+        } else if (key == ov::intel_cpu::cpu_dynamic_memory_pool.name()) {
+            try {
+                dynamicMemoryPool = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_dynamic_memory_pool.name(),
+                               ". Expected only true/false.");
+            }
         } else if (ov::intel_cpu::denormals_optimization.name() == key) {
             try {
                 denormalsOptMode = val.as<bool>() ? DenormalsOptMode::DO_On : DenormalsOptMode::DO_Off;
@@ -570,6 +669,11 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
         _config.clear();
     }
 
+    // the extended profiling extends the regular perf counters
+    if (!extendedProfilingPath.empty()) {
+        collectPerfCounters = true;
+    }
+
     if (exclusiveAsyncRequests) {  // Exclusive request feature disables the streams
         streams = 1;
         streamsChanged = true;
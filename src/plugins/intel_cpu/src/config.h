@@ -14,6 +14,7 @@
 #include <string>
 #include <vector>
 
+#include "internal_properties.hpp"
 #include "openvino/core/any.hpp"
 #include "openvino/core/attribute_visitor.hpp"
 #include "openvino/core/type/element_type.hpp"
@@ -75,6 +76,19 @@ struct Config {
     size_t rtCacheCapacity = 5000UL;
 #endif
     size_t snippetsCacheCapacity = 5000UL;
+    bool rtCacheShared = false;
+    size_t rtCacheWarmupShapes = 0UL;
+    // the model cache directory set by the core, keeps the hot shapes of the cached blobs (see HotShapes)
+    std::string cacheDir;
+    bool interOpParallelism = false;
+    std::string extendedProfilingPath;
+    std::string stateSwapDir;
+    uint64_t stateSwapBudget = 0;
+    WeightsNumaPolicy weightsNumaPolicy = WeightsNumaPolicy::FIRST_TOUCH;
+    bool weightsHugePages = false;
+    DynamicMemoryGrowth dynamicMemoryGrowth = DynamicMemoryGrowth::EXACT;
+    uint32_t dynamicMemoryShrinkAfter = 0;
+    bool dynamicMemoryPool = false;
 #if defined(OPENVINO_ARCH_X86_64) || defined(OPENVINO_ARCH_ARM64)
     ov::element::Type kvCachePrecision = ov::element::u8;
     ov::element::Type keyCachePrecision = ov::element::u8;
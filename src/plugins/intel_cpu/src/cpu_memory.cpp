@@ -21,6 +21,8 @@
 #include <mutex>
 #include <numeric>
 #include <oneapi/dnnl/dnnl_common.hpp>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 #include "cpu_parallel.hpp"
@@ -38,6 +40,7 @@
 #include "utils/debug_capabilities.h"
 #include "utils/general_utils.h"
 #if defined(__linux__)
+#    include <sys/mman.h>
 #    include <unistd.h>
 
 #    include <cstring> /* strerror(errno) */
@@ -239,34 +242,196 @@ void* Memory::getData() const {
     return data;
 }
 
+/////////////// DynamicMemoryPool ///////////////
+
+DynamicMemoryPool::Statistics& DynamicMemoryPool::Statistics::operator+=(const Statistics& rhs) {
+    allocations += rhs.allocations;
+    allocated_bytes += rhs.allocated_bytes;
+    reuses += rhs.reuses;
+    shrinks += rhs.shrinks;
+    frees += rhs.frees;
+    in_use_bytes += rhs.in_use_bytes;
+    cached_bytes += rhs.cached_bytes;
+    peak_bytes += rhs.peak_bytes;
+    return *this;
+}
+
+DynamicMemoryPool::DynamicMemoryPool(DynamicMemoryGrowth growth, uint32_t shrinkAfter, bool pooling)
+    : m_growth(growth),
+      m_shrinkAfter(shrinkAfter),
+      m_pooling(pooling) {}
+
+DynamicMemoryPool::~DynamicMemoryPool() {
+    clear();
+}
+
+size_t DynamicMemoryPool::reserve(size_t size, size_t capacity) const {
+    switch (m_growth) {
+    case DynamicMemoryGrowth::GEOMETRIC:
+        return std::max(size, capacity + capacity / 2);
+    case DynamicMemoryGrowth::BUCKETED: {
+        // four buckets per power of two, so that the rounding takes at most a quarter more
+        constexpr size_t minBucket = 256;
+        size_t power = minBucket;
+        while (power <= size / 2) {
+            power *= 2;
+        }
+        const size_t step = power / 4;
+        return std::max(minBucket, div_up(size, step) * step);
+    }
+    default:
+        return size;
+    }
+}
+
+std::pair<void*, size_t> DynamicMemoryPool::allocate(size_t size, int numaNode) {
+    if (m_pooling) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        // a much larger buffer is left for a larger request
+        auto it = m_buffers.lower_bound({numaNode, size});
+        if (it != m_buffers.end() && it->first.first == numaNode && it->first.second <= 2 * size) {
+            const std::pair<void*, size_t> buffer{it->second, it->first.second};
+            m_buffers.erase(it);
+            m_statistics.reuses++;
+            m_statistics.cached_bytes -= buffer.second;
+            m_statistics.in_use_bytes += buffer.second;
+            return buffer;
+        }
+    }
+
+    constexpr int cacheLineSize = 64;
+    void* ptr = dnnl::impl::malloc(size, cacheLineSize);
+    OPENVINO_ASSERT(ptr, "Failed to allocate ", size, " bytes of memory");
+    if (numaNode >= 0) {
+        if (!mbind_move(ptr, size, numaNode)) {
+            DEBUG_LOG("DynamicMemoryPool move_memory to node ", numaNode, " failed\n");
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_statistics.allocations++;
+    m_statistics.allocated_bytes += size;
+    m_statistics.in_use_bytes += size;
+    m_statistics.peak_bytes = std::max(m_statistics.peak_bytes, m_statistics.in_use_bytes + m_statistics.cached_bytes);
+    return {ptr, size};
+}
+
+void DynamicMemoryPool::release(void* ptr, size_t capacity, int numaNode, Release reason) {
+    if (ptr == nullptr) {
+        return;
+    }
+    std::vector<void*> buffersToFree;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_statistics.in_use_bytes -= capacity;
+        if (reason == Release::SHRINK) {
+            m_statistics.shrinks++;
+        }
+        if (m_pooling && reason == Release::FREE) {
+            m_buffers.emplace(std::make_pair(numaNode, capacity), ptr);
+            m_statistics.cached_bytes += capacity;
+        } else {
+            buffersToFree.push_back(ptr);
+        }
+        // the pool holds at most as many bytes as are in use, the largest buffers are returned first
+        while (m_statistics.cached_bytes > m_statistics.in_use_bytes) {
+            auto largest = std::max_element(m_buffers.begin(), m_buffers.end(), [](const auto& lhs, const auto& rhs) {
+                return lhs.first.second < rhs.first.second;
+            });
+            m_statistics.cached_bytes -= largest->first.second;
+            buffersToFree.push_back(largest->second);
+            m_buffers.erase(largest);
+        }
+        m_statistics.frees += buffersToFree.size();
+    }
+    for (auto* buffer : buffersToFree) {
+        dnnl::impl::free(buffer);
+    }
+}
+
+void DynamicMemoryPool::clear() {
+    decltype(m_buffers) buffers;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        buffers.swap(m_buffers);
+        m_statistics.frees += buffers.size();
+        m_statistics.cached_bytes = 0;
+    }
+    for (auto&& item : buffers) {
+        dnnl::impl::free(item.second);
+    }
+}
+
+DynamicMemoryPool::Statistics DynamicMemoryPool::getStatistics() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_statistics;
+}
+
+/////////////// MemoryBlockWithReuse ///////////////
+
+MemoryBlockWithReuse::~MemoryBlockWithReuse() {
+    releaseData();
+}
+
 void* MemoryBlockWithReuse::getRawPtr() const noexcept {
     return m_data.get();
 }
 
 void MemoryBlockWithReuse::setExtBuff(void* ptr, size_t size) {
+    releaseData();
     m_useExternalStorage = true;
     m_memUpperBound = size;
     m_data = decltype(m_data)(ptr, release);
+    m_shrinkPending = false;
 }
 
 bool MemoryBlockWithReuse::resize(size_t size) {
-    constexpr int cacheLineSize = 64;
-    bool sizeChanged = false;
+    m_requested = std::max(m_requested, size);
+    const bool shrinkPending = std::exchange(m_shrinkPending, false);
     if (size > m_memUpperBound) {
-        void* ptr = dnnl::impl::malloc(size, cacheLineSize);
-        OPENVINO_ASSERT(ptr, "Failed to allocate ", size, " bytes of memory");
-        m_memUpperBound = size;
-        m_useExternalStorage = false;
-        m_data = decltype(m_data)(ptr, destroy);
-        sizeChanged = true;
+        reallocate(m_pool ? m_pool->reserve(size, m_memUpperBound) : size, DynamicMemoryPool::Release::GROW);
+        return true;
+    }
+    if (shrinkPending) {
+        const size_t capacity = m_pool->reserve(std::max(size, m_smallPeak), 0UL);
+        m_smallPeak = 0UL;
+        if (capacity < m_memUpperBound) {
+            reallocate(capacity, DynamicMemoryPool::Release::SHRINK);
+            return true;
+        }
+    }
+    return false;
+}
 
+void MemoryBlockWithReuse::reallocate(size_t capacity, DynamicMemoryPool::Release reason) {
+    // the data isn't preserved, so the current buffer is released first to lower the peak
+    releaseData(reason);
+    void* ptr = nullptr;
+    if (m_pool) {
+        std::tie(ptr, capacity) = m_pool->allocate(capacity, numa_node);
+    } else {
+        constexpr int cacheLineSize = 64;
+        ptr = dnnl::impl::malloc(capacity, cacheLineSize);
+        OPENVINO_ASSERT(ptr, "Failed to allocate ", capacity, " bytes of memory");
         if (numa_node >= 0) {
-            if (!mbind_move(ptr, size, numa_node)) {
+            if (!mbind_move(ptr, capacity, numa_node)) {
                 DEBUG_LOG("MemoryBlockWithReuse move_memory to node ", numa_node, " failed\n");
             }
         }
     }
-    return sizeChanged;
+    m_memUpperBound = capacity;
+    m_data = decltype(m_data)(ptr, m_pool ? release : destroy);
+    m_smallPeak = 0UL;
+    m_smallInferences = 0;
+}
+
+void MemoryBlockWithReuse::releaseData(DynamicMemoryPool::Release reason) {
+    if (m_pool && !m_useExternalStorage) {
+        m_pool->release(m_data.release(), m_memUpperBound, numa_node, reason);
+    }
+    m_data = decltype(m_data)(nullptr, release);
+    m_memUpperBound = 0UL;
+    m_useExternalStorage = false;
 }
 
 bool MemoryBlockWithReuse::hasExtBuffer() const noexcept {
@@ -274,15 +439,34 @@ bool MemoryBlockWithReuse::hasExtBuffer() const noexcept {
 }
 
 void MemoryBlockWithReuse::free() {
-    m_data = decltype(m_data)(nullptr, release);
-    m_memUpperBound = 0UL;
-    m_useExternalStorage = false;
+    releaseData();
+    m_requested = 0UL;
+    m_smallPeak = 0UL;
+    m_smallInferences = 0;
+    m_shrinkPending = false;
 }
 
 size_t MemoryBlockWithReuse::size() const {
     return m_memUpperBound;
 }
 
+void MemoryBlockWithReuse::decay() {
+    const size_t requested = std::exchange(m_requested, 0UL);
+    if (!m_pool || m_pool->shrinkAfter() == 0 || m_useExternalStorage || requested == 0) {
+        return;
+    }
+    if (requested > m_memUpperBound / 2) {
+        m_smallPeak = 0UL;
+        m_smallInferences = 0;
+        return;
+    }
+    m_smallPeak = std::max(m_smallPeak, requested);
+    if (++m_smallInferences >= m_pool->shrinkAfter()) {
+        m_smallInferences = 0;
+        m_shrinkPending = true;
+    }
+}
+
 void MemoryBlockWithReuse::release(void* ptr) {}
 
 void MemoryBlockWithReuse::destroy(void* ptr) {
@@ -559,10 +743,11 @@ void StaticMemory::StaticMemoryBlock::unregisterMemory(Memory* memPtr) {
 // Android arm64 (aarch64) the seccomp filter forbids the mbind syscall. Android devices
 // are single-NUMA-node anyway, so the binding is unnecessary there.
 #if defined(__linux__) && !(defined(__ANDROID__) && defined(__aarch64__))
-#    define MPOL_DEFAULT   0
-#    define MPOL_BIND      2
-#    define MPOL_MF_STRICT (1 << 0)
-#    define MPOL_MF_MOVE   (1 << 1)
+#    define MPOL_DEFAULT    0
+#    define MPOL_BIND       2
+#    define MPOL_INTERLEAVE 3
+#    define MPOL_MF_STRICT  (1 << 0)
+#    define MPOL_MF_MOVE    (1 << 1)
 #    if !defined(__NR_mbind)
 #        define NR_mbind 237
 #    else
@@ -604,12 +789,62 @@ bool mbind_move(void* data, size_t size, int targetNode) {
     }
     return true;
 }
+
+bool mbind_interleave(void* data, size_t size) {
+    const int numaNodes = get_num_numa_nodes();
+    if (numaNodes < 2) {
+        return true;
+    }
+    uint64_t mask = 0;
+    for (int node = 0; node < numaNodes; node++) {
+        const int realNode = ov::get_org_numa_id(node);
+        if (realNode >= 0 && realNode < static_cast<int>(sizeof(mask) * 8)) {
+            mask |= 1UL << realNode;
+        }
+    }
+    auto pagesize = getpagesize();
+    auto page_count = (size + pagesize - 1) / pagesize;
+    auto* pages = reinterpret_cast<char*>(  // NOLINT(performance-no-int-to-ptr)
+        ((reinterpret_cast<uintptr_t>(data)) & ~(static_cast<uintptr_t>(pagesize - 1))));
+
+    // the pages which are already touched are spread across the nodes as well
+    auto rc = mbind(pages, page_count * pagesize, MPOL_INTERLEAVE, &mask, sizeof(mask) * 8, MPOL_MF_MOVE);
+    if (rc < 0) {
+        DEBUG_LOG("mbind failed: ", strerror(errno));
+        return false;
+    }
+    return true;
+}
 #else
 bool mbind_move(void* data, size_t size, int targetNode) {
     return false;
 }
+
+bool mbind_interleave(void* data, size_t size) {
+    return false;
+}
 #endif
 
+bool madvise_huge_pages([[maybe_unused]] void* data, [[maybe_unused]] size_t size) {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    // only the huge pages which are entirely inside the buffer, the neighbour allocations keep their pages
+    constexpr uintptr_t hugePageSize = 2 * 1024 * 1024;
+    const auto begin = (reinterpret_cast<uintptr_t>(data) + hugePageSize - 1) & ~(hugePageSize - 1);
+    const auto end = (reinterpret_cast<uintptr_t>(data) + size) & ~(hugePageSize - 1);
+    if (end <= begin) {
+        return false;
+    }
+    auto* pages = reinterpret_cast<void*>(begin);  // NOLINT(performance-no-int-to-ptr)
+    if (madvise(pages, end - begin, MADV_HUGEPAGE) != 0) {
+        DEBUG_LOG("madvise failed: ", strerror(errno));
+        return false;
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
 bool mbind_move(const MemoryCPtr& mem, int numaNodeID) {
     void* data = mem->getData();
     auto size = mem->getSize();
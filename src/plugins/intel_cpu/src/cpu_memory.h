@@ -7,6 +7,8 @@
 #include <cpu_shape.h>
 
 #include <cstddef>
+#include <cstdint>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <oneapi/dnnl/dnnl.hpp>
@@ -19,6 +21,7 @@
 #include "cpu_parallel.hpp"
 #include "cpu_types.h"
 #include "dnnl_extension_utils.h"
+#include "internal_properties.hpp"
 #include "memory_desc/cpu_memory_desc.h"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/core/type/element_type_traits.hpp"
@@ -74,12 +77,99 @@ public:
     [[nodiscard]] virtual bool hasExtBuffer() const noexcept = 0;
 };
 
+/**
+ * @brief Allocates the buffers of the dynamic shape tensors of a graph, or of all the graphs of a compiled model if
+ * shared. It defines how much a buffer grows and after how many small inferences it shrinks, and optionally keeps the
+ * released buffers for the reuse by the other blocks. The pool holds at most as many bytes as its blocks have in use,
+ * so that the memory released by a compiled model isn't pinned by the pool. Thread safe.
+ */
+class DynamicMemoryPool {
+public:
+    // only the buffers of the freed blocks are pooled: a grown block doesn't need the smaller buffer any more, and the
+    // larger buffer of a shrunk one is returned to the system
+    enum class Release : uint8_t { FREE, GROW, SHRINK };
+
+    struct Statistics {
+        uint64_t allocations = 0;  // buffers allocated from the system
+        uint64_t allocated_bytes = 0;
+        uint64_t reuses = 0;  // buffers taken from the pool
+        uint64_t shrinks = 0;
+        uint64_t frees = 0;  // buffers returned to the system
+        uint64_t in_use_bytes = 0;
+        uint64_t cached_bytes = 0;
+        uint64_t peak_bytes = 0;  // in use and cached
+
+        Statistics& operator+=(const Statistics& rhs);
+    };
+
+    explicit DynamicMemoryPool(DynamicMemoryGrowth growth = DynamicMemoryGrowth::EXACT,
+                               uint32_t shrinkAfter = 0,
+                               bool pooling = false);
+    ~DynamicMemoryPool();
+
+    DynamicMemoryPool(const DynamicMemoryPool&) = delete;
+    DynamicMemoryPool& operator=(const DynamicMemoryPool&) = delete;
+
+    /**
+     * @brief The capacity to reserve for the size requested from a buffer of the given capacity
+     */
+    [[nodiscard]] size_t reserve(size_t size, size_t capacity) const;
+
+    /**
+     * @brief The number of the consecutive small inferences after which a buffer shrinks, 0 if it never does
+     */
+    [[nodiscard]] uint32_t shrinkAfter() const {
+        return m_shrinkAfter;
+    }
+
+    /**
+     * @brief Takes a pooled buffer of at least the size, at most twice as large, on the NUMA node (-1 for any), or
+     * allocates a new one
+     * @return the buffer and its actual capacity
+     */
+    std::pair<void*, size_t> allocate(size_t size, int numaNode);
+
+    /**
+     * @brief Returns the buffer of the given capacity to the pool or to the system depending on the reason
+     */
+    void release(void* ptr, size_t capacity, int numaNode, Release reason = Release::FREE);
+
+    /**
+     * @brief Returns all the pooled buffers to the system
+     */
+    void clear();
+
+    [[nodiscard]] Statistics getStatistics() const;
+
+private:
+    DynamicMemoryGrowth m_growth;
+    uint32_t m_shrinkAfter;
+    bool m_pooling;
+
+    mutable std::mutex m_mutex;
+    // the pooled buffers by the NUMA node and the capacity
+    std::multimap<std::pair<int, size_t>, void*> m_buffers;
+    Statistics m_statistics;
+};
+
+using DynamicMemoryPoolPtr = std::shared_ptr<DynamicMemoryPool>;
+
 /**
  * @brief An implementation of the mem block where memory reallocation occurs only if a bigger buffer is requested.
+ * With a pool the buffer is allocated from the pool, grows by its policy and may shrink after the small inferences
+ * accounted by decay().
  */
 class MemoryBlockWithReuse : public IMemoryBlock {
 public:
-    explicit MemoryBlockWithReuse(int numa_node = -1) : m_data(nullptr, release), numa_node(numa_node) {}
+    explicit MemoryBlockWithReuse(int numa_node = -1, DynamicMemoryPoolPtr pool = nullptr)
+        : m_data(nullptr, release),
+          numa_node(numa_node),
+          m_pool(std::move(pool)) {}
+    ~MemoryBlockWithReuse() override;
+
+    MemoryBlockWithReuse(const MemoryBlockWithReuse&) = delete;
+    MemoryBlockWithReuse& operator=(const MemoryBlockWithReuse&) = delete;
+
     [[nodiscard]] void* getRawPtr() const noexcept override;
     void setExtBuff(void* ptr, size_t size) override;
     bool resize(size_t size) override;
@@ -87,12 +177,30 @@ public:
     void free();
     [[nodiscard]] size_t size() const;  // in bytes
 
+    /**
+     * @brief Accounts an inference: if the sizes requested by the pool's number of consecutive inferences take at most
+     * a half of the buffer, the buffer is shrunk to the largest of them on the next resize, when its data is no longer
+     * needed. The inferences which didn't resize the block aren't accounted.
+     */
+    void decay();
+
 private:
+    void reallocate(size_t capacity, DynamicMemoryPool::Release reason);
+    void releaseData(DynamicMemoryPool::Release reason = DynamicMemoryPool::Release::FREE);
+
     bool m_useExternalStorage = false;
     size_t m_memUpperBound = 0UL;
     std::unique_ptr<void, void (*)(void*)> m_data;
     int numa_node;
 
+    DynamicMemoryPoolPtr m_pool;
+    // the largest size requested since the last decay
+    size_t m_requested = 0UL;
+    // the largest size requested by the consecutive small inferences
+    size_t m_smallPeak = 0UL;
+    uint32_t m_smallInferences = 0;
+    bool m_shrinkPending = false;
+
     static void release(void* ptr);
     static void destroy(void* ptr);
 };
@@ -448,6 +556,14 @@ using StringMemoryPtr = std::shared_ptr<StringMemory>;
 bool mbind_move(void* data, size_t size, int targetNode);
 bool mbind_move(const MemoryCPtr& mem, int numaNodeID);
 bool mbind_move(const dnnl::memory& mem, int numaNodeID);
+/**
+ * @brief Interleaves the pages of the buffer across all the NUMA nodes, the pages which are already allocated are moved
+ */
+bool mbind_interleave(void* data, size_t size);
+/**
+ * @brief Advises the kernel to back the buffer by the transparent huge pages
+ */
+bool madvise_huge_pages(void* data, size_t size);
 
 MemoryPtr split_horizontal(const dnnl::engine& eng,
                            const MemoryPtr& src,
@@ -256,6 +256,7 @@ static const TypeToNameMap& get_type_to_name_tbl() {
         {"RoPE", Type::RoPE},
         {"GatherCompressed", Type::Gather},
         {"CausalMaskPreprocess", Type::CausalMaskPreprocess},
+        {"ImagePreprocess", Type::ImagePreprocess},
         {"EmbeddingBagPacked", Type::EmbeddingBagPacked},
         {"EmbeddingBagOffsets", Type::EmbeddingBagOffsets},
         {"LLMMLP", Type::LLMMLP},
@@ -267,7 +268,8 @@ static const TypeToNameMap& get_type_to_name_tbl() {
         {"GatherMatmulCompressed", Type::GatherMatmul},
         {"GatedDeltaNet", Type::GatedDeltaNet},
         {"PagedGatedDeltaNet", Type::PagedGatedDeltaNet},
-        {"PagedCausalConv1D", Type::PagedCausalConv1D}};
+        {"PagedCausalConv1D", Type::PagedCausalConv1D},
+        {"KQuantMatMul", Type::KQuantMatMul}};
     return type_to_name_tbl;
 }
 
@@ -397,6 +399,7 @@ std::string NameFromType(const Type type) {
         CASE(PaKVReorder);
         CASE(RoPE);
         CASE(CausalMaskPreprocess);
+        CASE(ImagePreprocess);
         CASE(LLMMLP);
         CASE(QKVProjection);
         CASE(RMS);
@@ -407,6 +410,7 @@ std::string NameFromType(const Type type) {
         CASE(GatedDeltaNet);
         CASE(PagedGatedDeltaNet);
         CASE(PagedCausalConv1D);
+        CASE(KQuantMatMul);
         CASE(Unknown);
     }
 #undef CASE
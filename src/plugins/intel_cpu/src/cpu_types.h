@@ -133,6 +133,7 @@ enum class Type : uint8_t {
     PaKVReorder,
     RoPE,
     CausalMaskPreprocess,
+    ImagePreprocess,
     LLMMLP,
     QKVProjection,
     RMS,
@@ -142,7 +143,8 @@ enum class Type : uint8_t {
     GatherMatmul,
     GatedDeltaNet,
     PagedGatedDeltaNet,
-    PagedCausalConv1D
+    PagedCausalConv1D,
+    KQuantMatMul
 };
 
 enum class Algorithm : uint8_t {
@@ -28,6 +28,7 @@
 #include "openvino/op/is_finite.hpp"
 #include "openvino/op/is_inf.hpp"
 #include "openvino/op/is_nan.hpp"
+#include "openvino/op/kquant_matmul.hpp"
 #include "openvino/op/less.hpp"
 #include "openvino/op/less_eq.hpp"
 #include "openvino/op/logical_and.hpp"
@@ -101,6 +102,7 @@
 #include "snippets/op/subgraph.hpp"
 #include "snippets/op/vector_buffer.hpp"
 #include "transformations/cpu_opset/common/op/causal_mask_preprocess.hpp"
+#include "transformations/cpu_opset/common/op/image_preprocess.hpp"
 #include "transformations/cpu_opset/common/op/leaky_relu.hpp"
 #include "transformations/cpu_opset/common/op/ngram.hpp"
 #include "transformations/cpu_opset/common/op/power_static.hpp"
@@ -191,6 +193,7 @@ OPENVINO_CREATE_EXTENSIONS(std::vector<ov::Extension::Ptr>({
     std::make_shared<ov::OpExtension<ov::intel_cpu::LeakyReluNode>>(),
     std::make_shared<ov::OpExtension<ov::intel_cpu::PowerStaticNode>>(),
     std::make_shared<ov::OpExtension<ov::intel_cpu::CausalMaskPreprocessNode>>(),
+    std::make_shared<ov::OpExtension<ov::intel_cpu::ImagePreprocessNode>>(),
     std::make_shared<ov::OpExtension<ov::intel_cpu::SwishNode>>(),
     std::make_shared<ov::OpExtension<ov::intel_cpu::SDPAWithTransposeReshape>>(),
     std::make_shared<ov::OpExtension<ov::intel_cpu::NgramNode>>(),
@@ -211,6 +214,7 @@ OPENVINO_CREATE_EXTENSIONS(std::vector<ov::Extension::Ptr>({
     std::make_shared<ov::OpExtension<ov::op::internal::GatedDeltaNet>>(),
     std::make_shared<ov::OpExtension<ov::op::internal::PagedGatedDeltaNet>>(),
     std::make_shared<ov::OpExtension<ov::op::internal::PagedCausalConv1D>>(),
+    std::make_shared<ov::OpExtension<ov::op::internal::KQuantMatMul>>(),
     // clang-format off
     OP_EXTENSION_X64(std::make_shared<ov::OpExtension<ov::intel_cpu::InteractionNode>>())
     OP_EXTENSION_X64(std::make_shared<ov::OpExtension<ov::intel_cpu::LLMMLPNode>>())
@@ -37,9 +37,11 @@
 #include "cpu_types.h"
 #include "edge.h"
 #include "graph_context.h"
+#include "graph_dataflow.h"
 #include "graph_dumper.h"
 #include "graph_optimizer.h"
 #include "infer_request.h"
+#include "internal_properties.hpp"
 #include "itt.h"
 #include "memory_control.hpp"
 #include "memory_desc/cpu_memory_desc.h"
@@ -71,8 +73,10 @@
 #include "proxy_mem_blk.h"
 #include "thread_pool_imp.hpp"
 #include "utils/debug_capabilities.h"
+#include "utils/extended_profiling_dump.hpp"
 #include "utils/general_utils.h"
 #include "utils/node_dumper.h"
+#include "utils/perf_events.hpp"
 #include "utils/verbose.h"
 #include "weights_cache.hpp"
 #ifdef CPU_DEBUG_CAPS
@@ -104,6 +108,7 @@ using namespace dnnl;
 namespace ov::intel_cpu {
 
 Graph::~Graph() {
+    dumpExtendedProfiling(*this);
     CPU_DEBUG_CAP_ENABLE(summary_perf(*this));
     CPU_DEBUG_CAP_ENABLE(average_counters(*this));
     CPU_DEBUG_CAP_ENABLE(serialize(*this));
@@ -919,6 +924,19 @@ std::vector<size_t> Graph::CreateExecutionGraph() {
         status = Status::ReadyStatic;
     }
 
+    if (!getConfig().extendedProfilingPath.empty()) {
+        const bool hwCounters = PerfEvents::scope() != PerfEvents::Scope::None;
+        for (const auto& node : m_executableGraphNodes) {
+            node->PerfCounter().enableExtended(hwCounters);
+        }
+    }
+
+    // the DAG is built at the first inference, when the memory is allocated
+    m_dataflow.reset();
+    if (status == Status::ReadyStatic && getConfig().interOpParallelism && m_executableGraphNodes.size() > 1) {
+        m_dataflow = std::make_unique<DataflowSchedule>();
+    }
+
     return syncNodesInds;
 }
 
@@ -1362,6 +1380,19 @@ VecMemoryDescs Graph::getOutputMemoryDescriptors() const {
 }
 
 void Graph::InferStatic(SyncInferRequest* request, int numaId) {
+    if (m_dataflow) {
+        if (!m_dataflow->isUpToDate(m_executableGraphNodes)) {
+            m_dataflow->build(m_executableGraphNodes);
+        }
+        // nothing to run concurrently if the nodes form a chain
+        if (m_dataflow->criticalPathLength() < m_executableGraphNodes.size()) {
+            m_dataflow->run([&](size_t index) {
+                ExecuteNodeWithCatch(m_executableGraphNodes[index], request, numaId);
+            });
+            return;
+        }
+    }
+
     for (const auto& node : m_executableGraphNodes) {
         ExecuteNodeWithCatch(node, request, numaId);
     }
@@ -1646,8 +1677,10 @@ void Graph::InferDynamic(SyncInferRequest* request, int numaId, UpdateStrategy&&
 static int GetNumaNodeId([[maybe_unused]] const GraphContext::CPtr& context) {
     int numaNodeId = -1;
 #if defined(OPENVINO_ARCH_X86_64) && defined(__linux__)
+    // the interleaved weights are shared by all the nodes and must not be moved to the node of the stream
     if ((context->getCPUStreamExecutor()) &&
-        (context->getConfig().hintPerfMode == ov::hint::PerformanceMode::LATENCY)) {
+        (context->getConfig().hintPerfMode == ov::hint::PerformanceMode::LATENCY) &&
+        (context->getConfig().weightsNumaPolicy != WeightsNumaPolicy::INTERLEAVE)) {
         numaNodeId = context->getCPUStreamExecutor()->get_numa_node_id();
     }
 #endif
@@ -17,6 +17,7 @@
 #include "config.h"
 #include "edge.h"
 #include "graph_context.h"
+#include "graph_dataflow.h"
 #include "memory_desc/cpu_memory_desc.h"
 #include "memory_state.h"
 #include "node.h"
@@ -371,6 +372,8 @@ private:
     // non-executable (optimized out) nodes, such as Input, Reshape, etc.
     std::vector<NodePtr> m_executableGraphNodes;
     std::vector<size_t> m_executableSyncNodesInds;
+    // dependencies of the executable nodes of a static graph if they are executed concurrently
+    std::unique_ptr<DataflowSchedule> m_dataflow;
 
     GraphContext::CPtr m_context;
     dnnl::stream m_stream;
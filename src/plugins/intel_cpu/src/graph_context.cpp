@@ -27,10 +27,13 @@ GraphContext::GraphContext(Config config,
                            bool isGraphQuantized,
                            ov::threading::IStreamsExecutor::Ptr streamExecutor,
                            std::shared_ptr<CpuParallel> cpuParallel,
-                           std::shared_ptr<SubMemoryManager> sub_memory_manager)
+                           std::shared_ptr<SubMemoryManager> sub_memory_manager,
+                           MultiCachePtr rtParamsCache,
+                           DynamicMemoryPoolPtr dynamicMemoryPool)
     : m_config(std::move(config)),
       m_weightsCache(std::move(w_cache)),
-      m_rtParamsCache(std::make_shared<MultiCache>(m_config.rtCacheCapacity)),
+      m_rtParamsCache(rtParamsCache ? std::move(rtParamsCache)
+                                    : std::make_shared<MultiCache>(m_config.rtCacheCapacity)),
       m_snippetsParamsCache(std::make_shared<MultiCache>(m_config.snippetsCacheCapacity)),
       m_isGraphQuantizedFlag(isGraphQuantized),
       m_streamExecutor(std::move(streamExecutor)),
@@ -38,7 +41,11 @@ GraphContext::GraphContext(Config config,
       m_subMemoryManager(std::move(sub_memory_manager)),
 
       m_memoryStatesRegister(std::make_shared<node::MemoryStatesRegister>()),
-      m_auxiliaryNetworkMemoryControl(std::make_shared<NetworkMemoryControl>()),
+      m_dynamicMemoryPool(dynamicMemoryPool ? std::move(dynamicMemoryPool)
+                                            : std::make_shared<DynamicMemoryPool>(m_config.dynamicMemoryGrowth,
+                                                                                  m_config.dynamicMemoryShrinkAfter,
+                                                                                  m_config.dynamicMemoryPool)),
+      m_auxiliaryNetworkMemoryControl(std::make_shared<NetworkMemoryControl>(m_dynamicMemoryPool)),
       m_memoryControl(m_auxiliaryNetworkMemoryControl->createMemoryControlUnit("main")) {
     if (m_streamExecutor) {
         m_cpuStreamExecutor = std::dynamic_pointer_cast<ov::threading::CPUStreamsExecutor>(m_streamExecutor);
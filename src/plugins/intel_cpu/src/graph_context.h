@@ -10,6 +10,7 @@
 
 #include "cache/multi_cache.h"
 #include "config.h"
+#include "cpu_memory.h"
 #include "cpu_parallel.hpp"
 #include "dnnl_scratch_pad.h"
 #include "memory_control.hpp"
@@ -37,7 +38,9 @@ public:
                  bool isGraphQuantized,
                  ov::threading::IStreamsExecutor::Ptr streamExecutor = nullptr,
                  std::shared_ptr<CpuParallel> cpuParallel = nullptr,
-                 std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr);
+                 std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr,
+                 MultiCachePtr rtParamsCache = nullptr,
+                 DynamicMemoryPoolPtr dynamicMemoryPool = nullptr);
 
     [[nodiscard]] const Config& getConfig() const {
         return m_config;
@@ -97,8 +100,20 @@ public:
         return m_auxiliaryNetworkMemoryControl;
     }
 
+    [[nodiscard]] const DynamicMemoryPoolPtr& getDynamicMemoryPool() const {
+        return m_dynamicMemoryPool;
+    }
+
     void releaseMemory() const {
         m_auxiliaryNetworkMemoryControl->releaseMemory();
+        m_dynamicMemoryPool->clear();
+    }
+
+    // accounts an inference for the shrink of the dynamic memory
+    void decayMemory() const {
+        if (m_dynamicMemoryPool->shrinkAfter() != 0) {
+            m_auxiliaryNetworkMemoryControl->decayMemory();
+        }
     }
 
     void allocateMemory() const {
@@ -135,6 +150,8 @@ private:
     int m_numaNodeId = 0;
 
     std::shared_ptr<node::MemoryStatesRegister> m_memoryStatesRegister;
+    // allocates the dynamic memory, may be shared by all the graphs of the compiled model
+    DynamicMemoryPoolPtr m_dynamicMemoryPool;
     // auxiliary object to allow creating additional memory control objects if the main one cannot be used
     // i.e. fallback graph for dynamic in-place
     std::shared_ptr<NetworkMemoryControl> m_auxiliaryNetworkMemoryControl;
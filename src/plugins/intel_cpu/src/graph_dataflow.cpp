@@ -0,0 +1,268 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "graph_dataflow.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "cpu_types.h"
+#include "edge.h"
+#include "node.h"
+#include "openvino/core/parallel.hpp"
+#include "utils/general_utils.h"
+
+#if OV_THREAD_USE_TBB
+#    include <tbb/task_group.h>
+#endif
+
+namespace ov::intel_cpu {
+
+namespace {
+
+struct Access {
+    uintptr_t begin;
+    uintptr_t end;
+    size_t node;
+    bool write;
+
+    [[nodiscard]] bool overlaps(const Access& other) const {
+        return begin < other.end && other.begin < end;
+    }
+
+    [[nodiscard]] bool covers(const Access& other) const {
+        return begin <= other.begin && other.end <= end;
+    }
+};
+
+template <typename Visitor>
+void forEachEdgeMemory(const NodePtr& node, Visitor&& visit) {
+    auto visitEdges = [&](const std::vector<EdgeWeakPtr>& edges, bool write) {
+        for (const auto& weakEdge : edges) {
+            const auto edge = weakEdge.lock();
+            const auto memory = edge ? edge->getMemoryPtr() : nullptr;
+            visit(memory ? memory->getData() : nullptr, memory ? memory->getSize() : 0, write);
+        }
+    };
+    visitEdges(node->getParentEdges(), false);
+    visitEdges(node->getChildEdges(), true);
+}
+
+}  // namespace
+
+bool DataflowSchedule::isConcurrencySafe([[maybe_unused]] const NodePtr& node) {
+#if defined(OPENVINO_ARCH_X86_64)
+    // The nodes executing with their own kernels only: neither oneDNN primitives (the shared stream), nor the
+    // scratchpad of the graph, nor the memory states. The other architectures delegate some of these nodes to the
+    // third party libraries with global state, so nothing runs concurrently there.
+    return any_of(node->getType(),
+                  Type::Eltwise,
+                  Type::Split,
+                  Type::Gather,
+                  Type::GatherElements,
+                  Type::GatherND,
+                  Type::Reduce,
+                  Type::Convert,
+                  Type::Broadcast,
+                  Type::Tile,
+                  Type::StridedSlice,
+                  Type::ShapeOf,
+                  Type::MVN,
+                  Type::Interpolate,
+                  Type::Pad,
+                  Type::RoPE,
+                  Type::RMS,
+                  Type::Math,
+                  Type::Roll,
+                  Type::Range,
+                  Type::TopK);
+#else
+    return false;
+#endif
+}
+
+void DataflowSchedule::build(const std::vector<NodePtr>& executableNodes) {
+    const size_t count = executableNodes.size();
+    std::unordered_map<const Node*, size_t> indices;
+    for (size_t i = 0; i < count; i++) {
+        indices[executableNodes[i].get()] = i;
+    }
+
+    // the executable nodes which produce the data of a non-executable one
+    std::unordered_map<const Node*, std::vector<size_t>> producers;
+    std::function<void(const NodePtr&, std::vector<size_t>&)> collectProducers;
+    collectProducers = [&](const NodePtr& node, std::vector<size_t>& result) {
+        if (auto it = indices.find(node.get()); it != indices.end()) {
+            result.push_back(it->second);
+            return;
+        }
+        auto it = producers.find(node.get());
+        if (it == producers.end()) {
+            std::vector<size_t> nodeProducers;
+            for (const auto& weakEdge : node->getParentEdges()) {
+                if (const auto edge = weakEdge.lock()) {
+                    collectProducers(edge->getParent(), nodeProducers);
+                }
+            }
+            std::sort(nodeProducers.begin(), nodeProducers.end());
+            nodeProducers.erase(std::unique(nodeProducers.begin(), nodeProducers.end()), nodeProducers.end());
+            it = producers.emplace(node.get(), std::move(nodeProducers)).first;
+        }
+        result.insert(result.end(), it->second.begin(), it->second.end());
+    };
+
+    m_successors.assign(count, {});
+    m_numDependencies.assign(count, 0);
+    m_roots.clear();
+    m_addresses.clear();
+
+    std::vector<Access> accesses;
+    std::vector<Access> nodeAccesses;
+    std::vector<size_t> dependencies;
+    std::vector<size_t> depths(count, 1);
+    size_t lastExclusive = std::numeric_limits<size_t>::max();
+    m_criticalPath = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        const auto& node = executableNodes[i];
+        dependencies.clear();
+        nodeAccesses.clear();
+
+        for (const auto& weakEdge : node->getParentEdges()) {
+            if (const auto edge = weakEdge.lock()) {
+                collectProducers(edge->getParent(), dependencies);
+            }
+        }
+
+        forEachEdgeMemory(node, [&](const void* data, size_t size, bool write) {
+            m_addresses.push_back(data);
+            if (data && size) {
+                const auto begin = reinterpret_cast<uintptr_t>(data);
+                nodeAccesses.push_back({begin, begin + size, i, write});
+            }
+        });
+        for (const auto& current : nodeAccesses) {
+            for (const auto& previous : accesses) {
+                if ((current.write || previous.write) && current.overlaps(previous)) {
+                    dependencies.push_back(previous.node);
+                }
+            }
+        }
+
+        if (!isConcurrencySafe(node)) {
+            if (lastExclusive != std::numeric_limits<size_t>::max()) {
+                dependencies.push_back(lastExclusive);
+            }
+            lastExclusive = i;
+        }
+
+        std::sort(dependencies.begin(), dependencies.end());
+        dependencies.erase(std::unique(dependencies.begin(), dependencies.end()), dependencies.end());
+        for (const auto dependency : dependencies) {
+            m_successors[dependency].push_back(i);
+            depths[i] = std::max(depths[i], depths[dependency] + 1);
+        }
+        m_numDependencies[i] = static_cast<uint32_t>(dependencies.size());
+        if (dependencies.empty()) {
+            m_roots.push_back(i);
+        }
+        m_criticalPath = std::max(m_criticalPath, depths[i]);
+
+        // the accesses covered by a write of this node are ordered before it, so the later accesses overlapping them
+        // overlap the write as well and depend on them transitively
+        accesses.erase(std::remove_if(accesses.begin(),
+                                      accesses.end(),
+                                      [&](const Access& previous) {
+                                          return std::any_of(nodeAccesses.begin(),
+                                                             nodeAccesses.end(),
+                                                             [&](const Access& current) {
+                                                                 return current.write && current.covers(previous);
+                                                             });
+                                      }),
+                       accesses.end());
+        accesses.insert(accesses.end(), nodeAccesses.begin(), nodeAccesses.end());
+    }
+
+    m_pending = std::make_unique<std::atomic<uint32_t>[]>(count);
+}
+
+bool DataflowSchedule::isUpToDate(const std::vector<NodePtr>& executableNodes) const {
+    if (executableNodes.size() != m_successors.size()) {
+        return false;
+    }
+    size_t i = 0;
+    bool upToDate = true;
+    for (const auto& node : executableNodes) {
+        forEachEdgeMemory(node, [&](const void* data, [[maybe_unused]] size_t size, [[maybe_unused]] bool write) {
+            upToDate = upToDate && i < m_addresses.size() && m_addresses[i] == data;
+            i++;
+        });
+        if (!upToDate) {
+            return false;
+        }
+    }
+    return i == m_addresses.size();
+}
+
+void DataflowSchedule::run(const std::function<void(size_t)>& body) {
+    const size_t count = m_successors.size();
+#if OV_THREAD_USE_TBB
+    if (count == 0) {
+        return;
+    }
+    m_concurrentRuns++;
+    for (size_t i = 0; i < count; i++) {
+        m_pending[i].store(m_numDependencies[i], std::memory_order_relaxed);
+    }
+
+    tbb::task_group group;
+    std::function<void(size_t)> execute;
+    execute = [&](size_t index) {
+        // one of the successors which became ready is executed by the same task, the others are spawned
+        while (true) {
+            body(index);
+            size_t next = std::numeric_limits<size_t>::max();
+            for (const auto successor : m_successors[index]) {
+                if (m_pending[successor].fetch_sub(1, std::memory_order_acq_rel) != 1) {
+                    continue;
+                }
+                if (next == std::numeric_limits<size_t>::max()) {
+                    next = successor;
+                } else {
+                    group.run([&execute, successor] {
+                        execute(successor);
+                    });
+                }
+            }
+            if (next == std::numeric_limits<size_t>::max()) {
+                return;
+            }
+            index = next;
+        }
+    };
+
+    for (size_t i = 1; i < m_roots.size(); i++) {
+        group.run([&execute, root = m_roots[i]] {
+            execute(root);
+        });
+    }
+    group.run_and_wait([&execute, root = m_roots.front()] {
+        execute(root);
+    });
+#else
+    // the execution order is a topological order of the DAG
+    for (size_t i = 0; i < count; i++) {
+        body(i);
+    }
+#endif
+}
+
+}  // namespace ov::intel_cpu
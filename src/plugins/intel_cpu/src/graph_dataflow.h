@@ -0,0 +1,75 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "node.h"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Dependency DAG of the executable nodes of a static graph, used to execute independent branches concurrently.
+ *
+ * A node depends on:
+ * - the closest executable producers of its inputs (non-executable nodes, e.g. in-place Reshape or Concat, are
+ *   looked through);
+ * - every earlier node accessing an overlapping memory range in a conflicting way (read after write, write after
+ *   read and write after write). The memory of the edges is reused by MemoryControl across the lifetimes decided for
+ *   the sequential execution order, so the overlap of the actual address ranges is what keeps that reuse valid;
+ * - the previous node that is not known to be safe for the concurrent execution. Such nodes may use the scratchpad
+ *   and the oneDNN stream shared by the whole graph, so they keep running one at a time in the original order.
+ *
+ * The DAG is built for the current memory addresses and has to be rebuilt once they change (see isUpToDate).
+ */
+class DataflowSchedule {
+public:
+    void build(const std::vector<NodePtr>& executableNodes);
+
+    // whether the memory of the edges is still at the addresses the DAG was built for
+    [[nodiscard]] bool isUpToDate(const std::vector<NodePtr>& executableNodes) const;
+
+    // the number of nodes which do not depend on one another along the longest path, 1 means a chain
+    [[nodiscard]] size_t criticalPathLength() const {
+        return m_criticalPath;
+    }
+
+    /**
+     * Executes all the nodes respecting the dependencies, \p body is called with the index of a node in the
+     * execution order. Must be called from the arena of the stream, the ready nodes are spawned as tasks in it.
+     * The first exception thrown by \p body cancels the nodes which have not started yet and is rethrown.
+     */
+    void run(const std::function<void(size_t)>& body);
+
+    // only concurrency-safe node types may run in parallel with the other nodes
+    static bool isConcurrencySafe(const NodePtr& node);
+
+    [[nodiscard]] const std::vector<std::vector<size_t>>& successors() const {
+        return m_successors;
+    }
+
+    // the number of times the nodes were actually dispatched concurrently by run
+    [[nodiscard]] size_t concurrentRuns() const {
+        return m_concurrentRuns;
+    }
+
+private:
+    std::vector<std::vector<size_t>> m_successors;
+    std::vector<uint32_t> m_numDependencies;
+    std::vector<size_t> m_roots;
+    // data pointers of the edges of the nodes in the order they were visited by build
+    std::vector<const void*> m_addresses;
+    size_t m_criticalPath = 0;
+    size_t m_concurrentRuns = 0;
+
+    std::unique_ptr<std::atomic<uint32_t>[]> m_pending;
+};
+
+}  // namespace ov::intel_cpu
@@ -17,6 +17,7 @@
 
 #include "cpu_types.h"
 #include "graph.h"
+#include "graph_dataflow.h"
 #include "node.h"
 #include "nodes/scaled_attn.h"
 #include "onednn/dnnl.h"
@@ -231,7 +232,12 @@ std::shared_ptr<ov::Model> dump_graph_as_ie_ngraph_net(const Graph& graph) {
         holder->add_control_dependency(node);
     }
 
-    return std::make_shared<ov::Model>(results, params, graph._name);
+    auto model = std::make_shared<ov::Model>(results, params, graph._name);
+    // tells whether the independent branches have actually been executed concurrently (see DataflowSchedule)
+    if (graph.m_dataflow) {
+        model->get_rt_info()["concurrent_inferences"] = std::to_string(graph.m_dataflow->concurrentRuns());
+    }
+    return model;
 }
 
 #ifdef CPU_DEBUG_CAPS
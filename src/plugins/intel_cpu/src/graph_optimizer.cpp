@@ -36,10 +36,12 @@
 #include "memory_desc/cpu_memory_desc_utils.h"
 #include "node.h"
 #include "nodes/bin_conv.h"
+#include "nodes/common/cpu_convert.h"
 #include "nodes/concat.h"
 #include "nodes/conv.h"
 #include "nodes/deconv.h"
 #include "nodes/eltwise.h"
+#include "nodes/embedding_bag.h"
 #include "nodes/fake_quantize.h"
 #include "nodes/fullyconnected.h"
 #include "nodes/input.h"
@@ -97,6 +99,10 @@ void GraphOptimizer::ApplyCommonGraphOptimizations(Graph& graph) {
     FuseConvolutionAndZeroPoints(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseEmbeddingBagAndDecompression");
+    FuseEmbeddingBagAndDecompression(graph);
+    graph.RemoveDroppedNodes();
+
 // The order of applying scales and shifts is different for ARM to get specific postops order:
 // postops order on ARM: bias, scale, fq
 // postops order on x86: scale, bias, fq
@@ -912,6 +918,121 @@ void GraphOptimizer::FuseConvDeconvFCAndConvertOnWeights(Graph& graph) {
     }
 }
 
+void GraphOptimizer::FuseEmbeddingBagAndDecompression(Graph& graph) {
+    // This optimization makes the EmbeddingBag nodes read the compressed tables directly:
+    //     Const(u8/i8/u4/i4) -> Convert -> [Subtract(zero points)] -> [Multiply(scales)] -> EmbeddingBag
+    // The rows are dequantized by the node on the fly, so only the touched rows are ever dequantized and the table
+    // takes its compressed size in memory. The f16/bf16 tables just lose the Convert.
+    auto isSuitableEltwise = [](const NodePtr& node, Algorithm algorithm) {
+        return node->getType() == Type::Eltwise && node->getAlgorithm() == algorithm && node->isConstant() &&
+               node->getChildEdges().size() == 1 && node->getFusedWith().empty();
+    };
+
+    // reads the per-row or the scalar constant into a vector of the table rows
+    auto readRowwise = [](const NodePtr& node, const VectorDims& tableDims, std::vector<float>& values) {
+        auto constant = node;
+        if (constant->getType() == Type::Convert && constant->isConstant()) {
+            constant = constant->getParentEdgeAt(0)->getParent();
+        }
+        auto* input = dynamic_cast<node::Input*>(constant.get());
+        if (!input || !input->isConstant() || !input->getOutputShapeAtPort(0).isStatic()) {
+            return false;
+        }
+        const auto& dims = input->getOutputShapeAtPort(0).getStaticDims();
+        const auto count = input->getOutputShapeAtPort(0).getElementsCount();
+        const auto rows = tableDims[0];
+        if (count != 1 && (dims.size() != tableDims.size() || dims[0] != rows || count != rows)) {
+            return false;
+        }
+        const auto memory = input->getMemoryPtr();
+        std::vector<float> data(count);
+        cpu_convert(memory->getData(), data.data(), memory->getDesc().getPrecision(), ov::element::f32, count);
+        values = count == rows ? std::move(data) : std::vector<float>(rows, data[0]);
+        return true;
+    };
+
+    // drops the decompression nodes left without consumers, the constants without edges are dropped by the graph
+    std::function<void(const NodePtr&)> dropUnused = [&](const NodePtr& node) {
+        if (!node->getChildEdges().empty() || node->getType() == Type::Input) {
+            return;
+        }
+        std::vector<NodePtr> parents;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            parents.push_back(node->getParentEdgeAt(i)->getParent());
+        }
+        graph.DropNode(node);
+        for (const auto& parent : parents) {
+            dropUnused(parent);
+        }
+    };
+
+    const auto& graphNodes = graph.GetNodes();
+    for (const auto& node : graphNodes) {
+        if (none_of(node->getType(), Type::EmbeddingBagOffsets, Type::EmbeddingBagPacked, Type::EmbeddingSegmentsSum)) {
+            continue;
+        }
+        auto* embeddingBag = dynamic_cast<node::EmbeddingBag*>(node.get());
+        if (!embeddingBag || !node->getInputShapeAtPort(0).isStatic()) {
+            continue;
+        }
+        const auto& tableDims = node->getInputShapeAtPort(0).getStaticDims();
+
+        NodePtr multiply = nullptr;
+        NodePtr subtract = nullptr;
+        auto parent = node->getParentEdgeAt(0)->getParent();
+        if (isSuitableEltwise(parent, Algorithm::EltwiseMultiply)) {
+            multiply = parent;
+            parent = multiply->getParentEdgeAt(0)->getParent();
+        }
+        if (isSuitableEltwise(parent, Algorithm::EltwiseSubtract)) {
+            subtract = parent;
+            parent = subtract->getParentEdgeAt(0)->getParent();
+        }
+        const auto convert = parent;
+        if (convert->getType() != Type::Convert || !convert->isConstant() || convert->getChildEdges().size() != 1) {
+            continue;
+        }
+        const auto table = convert->getParentEdgeAt(0)->getParent();
+        const auto tablePrecision = convert->getOriginalInputPrecisionAtPort(0);
+        if (table->getType() != Type::Input || !table->isConstant()) {
+            continue;
+        }
+
+        const bool isCompressed =
+            any_of(tablePrecision, ov::element::u8, ov::element::i8, ov::element::u4, ov::element::i4);
+        if (isCompressed) {
+            // the rows of the 4-bit table must start at the byte boundary
+            const auto depth = std::accumulate(tableDims.begin() + 1, tableDims.end(), size_t{1}, std::multiplies<>());
+            if (any_of(tablePrecision, ov::element::u4, ov::element::i4) && depth % 2 != 0) {
+                continue;
+            }
+        } else if (none_of(tablePrecision, ov::element::f16, ov::element::bf16) || multiply || subtract) {
+            continue;
+        }
+
+        std::vector<float> scales;
+        std::vector<float> zeroPoints;
+        if (multiply && !readRowwise(multiply->getParentEdgeAt(1)->getParent(), tableDims, scales)) {
+            continue;
+        }
+        if (subtract && !readRowwise(subtract->getParentEdgeAt(1)->getParent(), tableDims, zeroPoints)) {
+            continue;
+        }
+
+        CPU_GRAPH_OPTIMIZER_SCOPE(FuseEmbeddingBagAndDecompression);
+
+        const auto tableEdge = node->getParentEdgeAt(0);
+        const auto inNum = convert->getParentEdgeAt(0)->getInputNum();
+        if (isCompressed) {
+            embeddingBag->fuseDecompression(tablePrecision, std::move(scales), std::move(zeroPoints));
+        }
+        node->setOriginalInputPrecisionAtPort(0, tablePrecision);
+        graph.RemoveEdge(tableEdge);
+        graph.CreateEdge(table, node, inNum, 0);
+        dropUnused(multiply ? multiply : subtract ? subtract : convert);
+    }
+}
+
 void GraphOptimizer::FuseFCAndTransposeOnWeights(Graph& graph) {
     // This optimization allows us to avoid transposing the weights in Transpose node and do it directly along with
     // reordering in FC node
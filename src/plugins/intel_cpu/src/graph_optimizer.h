@@ -27,6 +27,7 @@ private:
     static void MergeEltwiseAndConvert(Graph& graph);
     static void MergeConvertAndEltwise(Graph& graph);
     static void FuseConvDeconvFCAndConvertOnWeights(Graph& graph);
+    static void FuseEmbeddingBagAndDecompression(Graph& graph);
     static void FuseFCAndTransposeOnWeights(Graph& graph);
     static void FuseFullyConnectedAndSimpleOperation(Graph& graph);
     static void FuseMatMulAndSimpleOperation(Graph& graph);
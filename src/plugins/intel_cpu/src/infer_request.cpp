@@ -16,12 +16,14 @@
 #include <vector>
 
 #include "async_infer_request.h"
+#include "cache/hot_shapes.h"
 #include "compiled_model.h"
 #include "cpu_memory.h"
 #include "cpu_tensor.h"
 #include "cpu_types.h"
 #include "dnnl_extension_utils.h"
 #include "edge.h"
+#include "graph_context.h"
 #include "itt.h"
 #include "memory_desc/cpu_blocked_memory_desc.h"
 #include "memory_desc/cpu_memory_desc.h"
@@ -42,6 +44,7 @@
 #include "openvino/runtime/tensor.hpp"
 #include "openvino/runtime/threading/cpu_message.hpp"
 #include "proxy_mem_blk.h"
+#include "state_swap.h"
 #include "utils/debug_capabilities.h"
 #include "utils/general_utils.h"
 
@@ -76,6 +79,9 @@ void SyncInferRequest::create_infer_request() {
 
     // create states according to the list of the MemoryStateNodes
     m_memory_states = m_compiled_model.graph().memoryStates();
+    if (const auto& state_swap = m_compiled_model.state_swap()) {
+        m_state_swap_session = state_swap->create_session(m_memory_states);
+    }
 }
 
 void SyncInferRequest::redefine_memory_for_input_nodes(Graph& graph) {
@@ -89,6 +95,19 @@ void SyncInferRequest::redefine_memory_for_input_nodes(Graph& graph) {
     }
 }
 
+void SyncInferRequest::record_input_shapes(size_t stream) {
+    auto& hot_shapes = m_compiled_model.hot_shapes();
+    if (!m_record_hot_shapes || !hot_shapes.enabled()) {
+        return;
+    }
+    HotShapes::Record shapes(m_input_ports_map.size());
+    for (const auto& [index, port] : m_input_ports_map) {
+        const auto& shape = get_tensor_ptr(port)->get_shape();
+        shapes[index] = VectorDims(shape.begin(), shape.end());
+    }
+    hot_shapes.record(stream, shapes);
+}
+
 void SyncInferRequest::update_external_tensor_ptrs() {
     // Update it due to batched_tensors case will update input tensor
     for (const auto& input : m_input_ports_map) {
@@ -120,12 +139,16 @@ void SyncInferRequest::infer() {
 
     if (graph.hasDynamicInput()) {
         redefine_memory_for_input_nodes(graph);
+        record_input_shapes(graph._streamIdx);
     }
 
     change_default_ptr(graph);
 
     throw_if_canceled();
 
+    // the swapped out states are read back before they are assigned
+    StateSwapManager::Pin state_swap_pin(m_state_swap_session);
+
     // state -> node
     if (!m_memory_states.empty()) {
         graph.assignStates(m_memory_states);
@@ -141,7 +164,10 @@ void SyncInferRequest::infer() {
     if (graph.IsDynamic()) {
         for (auto&& item : m_outputControlBlocks) {
             item.second.update();
+            item.second.decay();
         }
+        // the shrink of the dynamic memory is accounted once per inference of the top level graph
+        graph.getGraphContext()->decayMemory();
     }
 
     graph.PullOutputData(m_outputs);
@@ -323,6 +349,10 @@ std::vector<ov::SoPtr<ov::IVariableState>> SyncInferRequest::query_state() const
         }
         return states;
     }
+    if (m_state_swap_session) {
+        // the states must not be swapped out while the user reads or modifies them
+        return StateSwapManager::user_states(m_state_swap_session, m_memory_states);
+    }
     return {m_memory_states.begin(), m_memory_states.end()};
 }
 
@@ -557,7 +587,9 @@ void SyncInferRequest::init_tensor(const std::size_t& port_index, const ov::ISyn
                         tensor = std::make_shared<Tensor>(memory);
                     } else {
                         const auto graph_prec = output->getParentEdgeAt(0)->getMemory().getDesc().getPrecision();
-                        OutputControlBlock control_block{model_prec, Shape{shape}};
+                        OutputControlBlock control_block{model_prec,
+                                                         Shape{shape},
+                                                         graph.getGraphContext()->getDynamicMemoryPool()};
 
                         DEBUG_LOG(port_index,
                                   ", tensor ",
@@ -603,9 +635,12 @@ void SyncInferRequest::push_input_data(Graph& graph) {
     }
 }
 
-SyncInferRequest::OutputControlBlock::OutputControlBlock(const ov::element::Type& precision, const Shape& shape) {
+SyncInferRequest::OutputControlBlock::OutputControlBlock(const ov::element::Type& precision,
+                                                         const Shape& shape,
+                                                         DynamicMemoryPoolPtr pool)
+    : m_pool(std::move(pool)) {
     dnnl::engine eng(dnnl::engine::kind::cpu, 0);
-    m_buffers[m_buffIndx] = std::make_shared<MemoryBlockWithReuse>();
+    m_buffers[m_buffIndx] = std::make_shared<MemoryBlockWithReuse>(-1, m_pool);
     m_proxyMemBlock = std::make_shared<ProxyMemoryBlock>(m_buffers[m_buffIndx]);
 
     VectorDims memDims;
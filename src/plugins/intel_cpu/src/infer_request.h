@@ -26,6 +26,7 @@
 #include "openvino/runtime/profiling_info.hpp"
 #include "openvino/runtime/so_ptr.hpp"
 #include "proxy_mem_blk.h"
+#include "state_swap.h"
 
 namespace ov::intel_cpu {
 
@@ -63,12 +64,17 @@ public:
 
     void throw_if_canceled() const;
 
+    /// The inferences of the request are not accounted in the hot shapes, used by the warm-up requests
+    void disable_hot_shapes_recording() {
+        m_record_hot_shapes = false;
+    }
+
 private:
     class OutputControlBlock {
     public:
         using MemBlockPtr = std::shared_ptr<MemoryBlockWithReuse>;
 
-        OutputControlBlock(const ov::element::Type& precision, const Shape& shape);
+        OutputControlBlock(const ov::element::Type& precision, const Shape& shape, DynamicMemoryPoolPtr pool);
 
         OutputControlBlock(const OutputControlBlock&) = delete;
         OutputControlBlock& operator=(const OutputControlBlock&) = delete;
@@ -91,7 +97,7 @@ private:
         MemBlockPtr nextMemBlock() {
             m_buffIndx ^= 0x1;
             if (!m_buffers[m_buffIndx]) {
-                m_buffers[m_buffIndx] = std::make_shared<MemoryBlockWithReuse>();
+                m_buffers[m_buffIndx] = std::make_shared<MemoryBlockWithReuse>(-1, m_pool);
             }
             return m_buffers[m_buffIndx];
         }
@@ -100,7 +106,12 @@ private:
             m_proxyMemBlock->setMemBlockResize(currentMemBlock());
         }
 
+        void decay() {
+            currentMemBlock()->decay();
+        }
+
     private:
+        DynamicMemoryPoolPtr m_pool = nullptr;
         std::shared_ptr<Tensor> m_tensor = nullptr;
         ProxyMemoryBlockPtr m_proxyMemBlock = nullptr;
         std::array<MemBlockPtr, 2> m_buffers;
@@ -112,6 +123,8 @@ private:
 
     void push_input_data(Graph& graph);
     void redefine_memory_for_input_nodes(Graph& graph);
+    // accounts the current input shapes for the warm-up after export/import (see HotShapes)
+    void record_input_shapes(size_t stream);
     void update_external_tensor_ptrs();
     void change_default_ptr(Graph& graph);
 
@@ -125,7 +138,10 @@ private:
     std::unordered_map<std::size_t, ov::SoPtr<ov::ITensor>> m_output_external_ptr;
 
     openvino::itt::handle_t m_profiling_task = nullptr;
+    bool m_record_hot_shapes = true;
     std::vector<MemStatePtr> m_memory_states;
+    // the KV cache states of the request registered for swapping, if enabled (see StateSwapManager)
+    StateSwapManager::SessionPtr m_state_swap_session;
     AsyncInferRequest* m_asyncRequest = nullptr;
     CompiledModelHolder m_compiled_model;
 
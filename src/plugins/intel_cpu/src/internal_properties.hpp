@@ -6,6 +6,7 @@
 
 #include <cstdint>
 #include <istream>
+#include <map>
 #include <ostream>
 #include <string>
 
@@ -20,6 +21,196 @@ namespace ov::intel_cpu {
  */
 static constexpr Property<int32_t, PropertyMutability::RW> cpu_runtime_cache_capacity{"CPU_RUNTIME_CACHE_CAPACITY"};
 
+/**
+ * @brief Defines whether the streams of a compiled model placed on the same socket share one CPU runtime parameters
+ * cache, so executors for a new shape are built once instead of once per stream.
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_runtime_cache_shared{"CPU_RUNTIME_CACHE_SHARED"};
+
+/**
+ * @brief Defines how many of the most frequent input shapes of a dynamic model are written to the blob by
+ * export_model and replayed in the background after import_model to prebuild their executors. 0 (default) disables
+ * it. With ov::cache_dir the shapes are saved to the cache directory when the compiled model is destroyed and replayed
+ * when the next compile_model loads the model from the cache.
+ */
+static constexpr Property<int32_t, PropertyMutability::RW> cpu_runtime_cache_warmup_shapes{
+    "CPU_RUNTIME_CACHE_WARMUP_SHAPES"};
+
+/**
+ * @brief Read-only counters of the CPU runtime parameters cache summed over all the streams of a compiled model:
+ * "hits", "misses", "evictions" and the current number of records "size".
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> cpu_runtime_cache_statistics{
+    "CPU_RUNTIME_CACHE_STATISTICS"};
+
+/**
+ * @brief Defines whether the independent branches of a static model are executed concurrently: the nodes are
+ * dispatched as soon as the nodes they depend on (by the data and by the reused memory) are completed, instead of one
+ * by one in the topological order. Helps the latency of the multi-branch models with a poor intra-op parallelism.
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_inter_op_parallelism{"CPU_INTER_OP_PARALLELISM"};
+
+/**
+ * @brief Path prefix of the extended profiling report, an empty string (default) disables the extended profiling.
+ * Implies ov::enable_profiling. In addition to the average latency every node records the histogram of its latencies
+ * in nanoseconds and, when perf_event_open is available (Linux), the cycles, instructions and last level cache misses
+ * of the thread executing the node.
+ * Every graph writes the report as "<prefix>_<index>.json" when it is destroyed.
+ */
+static constexpr Property<std::string, PropertyMutability::RW> cpu_extended_profiling{"CPU_EXTENDED_PROFILING"};
+
+/**
+ * @brief Directory of the swap files of the KV cache states, an empty string (default) disables swapping. The states
+ * of the idle infer requests are written there by ov::CompiledModel::release_memory, or once the states of all the
+ * requests exceed cpu_state_swap_budget, and are read back before the next inference of the request.
+ */
+static constexpr Property<std::string, PropertyMutability::RW> cpu_state_swap_dir{"CPU_STATE_SWAP_DIR"};
+
+/**
+ * @brief Bytes of the KV cache states kept in memory for all the infer requests of a compiled model when
+ * cpu_state_swap_dir is set, the least recently used requests are swapped out above it. 0 (default) means no limit.
+ */
+static constexpr Property<uint64_t, PropertyMutability::RW> cpu_state_swap_budget{"CPU_STATE_SWAP_BUDGET"};
+
+/**
+ * @brief Enum to define the placement of the cached weights on the NUMA nodes.
+ */
+enum class WeightsNumaPolicy : uint8_t {
+    FIRST_TOUCH = 0,  //!<  A copy per socket, placed where the pages are touched first
+    LOCAL = 1,        //!<  A copy per socket, bound to the NUMA node of the first stream of the socket
+    INTERLEAVE = 2,   //!<  A single copy shared by all the sockets, interleaved across all the NUMA nodes
+    REPLICATE = 3,    //!<  A copy per NUMA node, bound to the node
+};
+
+/** @cond INTERNAL */
+inline std::ostream& operator<<(std::ostream& os, const WeightsNumaPolicy& policy) {
+    switch (policy) {
+    case WeightsNumaPolicy::FIRST_TOUCH:
+        return os << "FIRST_TOUCH";
+    case WeightsNumaPolicy::LOCAL:
+        return os << "LOCAL";
+    case WeightsNumaPolicy::INTERLEAVE:
+        return os << "INTERLEAVE";
+    case WeightsNumaPolicy::REPLICATE:
+        return os << "REPLICATE";
+    default:
+        OPENVINO_THROW("Unsupported weights NUMA policy value");
+    }
+}
+
+inline std::istream& operator>>(std::istream& is, WeightsNumaPolicy& policy) {
+    std::string str;
+    is >> str;
+    if (str == "FIRST_TOUCH") {
+        policy = WeightsNumaPolicy::FIRST_TOUCH;
+    } else if (str == "LOCAL") {
+        policy = WeightsNumaPolicy::LOCAL;
+    } else if (str == "INTERLEAVE") {
+        policy = WeightsNumaPolicy::INTERLEAVE;
+    } else if (str == "REPLICATE") {
+        policy = WeightsNumaPolicy::REPLICATE;
+    } else {
+        OPENVINO_THROW("Unsupported weights NUMA policy: ", str);
+    }
+    return is;
+}
+/** @endcond */
+
+/**
+ * @brief Defines the placement of the weights repacked by the CPU plugin on the NUMA nodes.
+ * @param FIRST_TOUCH - (default) a copy per socket, the pages are placed by the kernel where they are touched first
+ * @param LOCAL - a copy per socket, bound to the NUMA node of the first stream of the socket
+ * @param INTERLEAVE - a single copy shared by all the sockets with the pages interleaved across all the NUMA nodes, for
+ * the models which don't fit in the memory of one node
+ * @param REPLICATE - a copy per NUMA node, bound to the node
+ */
+static constexpr Property<WeightsNumaPolicy, PropertyMutability::RW> cpu_weights_numa_policy{
+    "CPU_WEIGHTS_NUMA_POLICY"};
+
+/**
+ * @brief Defines whether the weights repacked by the CPU plugin are advised to be backed by the transparent huge pages
+ * (madvise(MADV_HUGEPAGE), Linux only) to reduce the TLB misses of the large models.
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_weights_huge_pages{"CPU_WEIGHTS_HUGE_PAGES"};
+
+/**
+ * @brief Read-only bytes of the weights repacked by the CPU plugin by the copy: "socket<id>" for the FIRST_TOUCH and
+ * LOCAL policies, "node<id>" for REPLICATE, "all" for INTERLEAVE, and the sum of the copies "total".
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> cpu_weights_cache_statistics{
+    "CPU_WEIGHTS_CACHE_STATISTICS"};
+
+/**
+ * @brief Enum to define how the memory of the dynamic shape tensors grows.
+ */
+enum class DynamicMemoryGrowth : uint8_t {
+    EXACT = 0,      //!<  Exactly the requested size
+    GEOMETRIC = 1,  //!<  At least 1.5 times the current size
+    BUCKETED = 2,   //!<  The requested size rounded up to one of four buckets per power of two
+};
+
+/** @cond INTERNAL */
+inline std::ostream& operator<<(std::ostream& os, const DynamicMemoryGrowth& growth) {
+    switch (growth) {
+    case DynamicMemoryGrowth::EXACT:
+        return os << "EXACT";
+    case DynamicMemoryGrowth::GEOMETRIC:
+        return os << "GEOMETRIC";
+    case DynamicMemoryGrowth::BUCKETED:
+        return os << "BUCKETED";
+    default:
+        OPENVINO_THROW("Unsupported dynamic memory growth value");
+    }
+}
+
+inline std::istream& operator>>(std::istream& is, DynamicMemoryGrowth& growth) {
+    std::string str;
+    is >> str;
+    if (str == "EXACT") {
+        growth = DynamicMemoryGrowth::EXACT;
+    } else if (str == "GEOMETRIC") {
+        growth = DynamicMemoryGrowth::GEOMETRIC;
+    } else if (str == "BUCKETED") {
+        growth = DynamicMemoryGrowth::BUCKETED;
+    } else {
+        OPENVINO_THROW("Unsupported dynamic memory growth: ", str);
+    }
+    return is;
+}
+/** @endcond */
+
+/**
+ * @brief Defines how much memory is reserved when a dynamic shape tensor outgrows its buffer.
+ * @param EXACT - (default) exactly the requested size
+ * @param GEOMETRIC - at least 1.5 times the current size, so that the slowly growing shapes reallocate a logarithmic
+ * number of times
+ * @param BUCKETED - the requested size rounded up to one of four buckets per power of two, so that the buffers of the
+ * close sizes are interchangeable in the pool
+ */
+static constexpr Property<DynamicMemoryGrowth, PropertyMutability::RW> cpu_dynamic_memory_growth{
+    "CPU_DYNAMIC_MEMORY_GROWTH"};
+
+/**
+ * @brief Defines the number of consecutive inferences using at most a half of a dynamic shape tensor buffer after which
+ * the buffer is shrunk to the largest size used by them. 0 (default) disables the shrinking.
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> cpu_dynamic_memory_shrink_after{
+    "CPU_DYNAMIC_MEMORY_SHRINK_AFTER"};
+
+/**
+ * @brief Defines whether the buffers of the dynamic shape tensors released by one stream or infer request are kept in a
+ * pool shared by the compiled model and reused by the others. The pool holds at most as many bytes as are in use.
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_dynamic_memory_pool{"CPU_DYNAMIC_MEMORY_POOL"};
+
+/**
+ * @brief Read-only counters of the memory of the dynamic shape tensors: "allocations" and "allocated_bytes" from the
+ * system, "reuses" of the pooled buffers, "shrinks", "frees", and the current "in_use_bytes", "cached_bytes" and
+ * "peak_bytes".
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> cpu_dynamic_memory_statistics{
+    "CPU_DYNAMIC_MEMORY_STATISTICS"};
+
 /**
  * @brief Enum to define possible snippets mode hints.
  */
@@ -69,8 +69,8 @@ private:
 
 class MemoryBlockWithRelease : public IMemoryBlockObserver {
 public:
-    MemoryBlockWithRelease() {
-        auto pInternalMem = std::make_unique<MemoryBlockWithReuse>();
+    explicit MemoryBlockWithRelease(DynamicMemoryPoolPtr pool = nullptr) {
+        auto pInternalMem = std::make_unique<MemoryBlockWithReuse>(-1, std::move(pool));
         m_pInternalMem = pInternalMem.get();
         m_pBlock = std::make_shared<DnnlMemoryBlock>(std::move(pInternalMem));
     }
@@ -96,6 +96,9 @@ public:
     void free() {
         m_pInternalMem->free();
     }
+    void decay() {
+        m_pInternalMem->decay();
+    }
 
     [[nodiscard]] size_t size() const {
         return m_pInternalMem->size();
@@ -138,6 +141,9 @@ public:
             m_pBlock->free();
         }
     }
+    void decay() {
+        m_pBlock->decay();
+    }
 
     [[nodiscard]] size_t size() const {
         return m_max_requested_size;
@@ -160,6 +166,8 @@ public:
     virtual const MemoryControl::MemorySolution& lastSolution() = 0;
     virtual void allocate() = 0;
     virtual void release() = 0;
+    // accounts an inference for the shrink of the dynamic blocks
+    virtual void decay() = 0;
 };
 
 using MemoryManagerPtr = std::shared_ptr<IMemoryManager>;
@@ -178,9 +186,11 @@ class MemoryManagerIO : public IMemoryManager {
 public:
     using BlockType = MemoryBlockWithReuse;
 
+    explicit MemoryManagerIO(DynamicMemoryPoolPtr pool) : m_pool(std::move(pool)) {}
+
     void insert(const MemoryRegion& reg, [[maybe_unused]] const std::vector<size_t>& syncInds) override {
-        auto block = std::make_unique<BlockType>();
-        CPU_DEBUG_CAP_ENABLE(m_blocks.emplace_back(*block);)
+        auto block = std::make_unique<BlockType>(-1, m_pool);
+        m_blocks.emplace_back(*block);
         m_solution.insert({reg.id, makeDnnlMemoryBlock(std::move(block))});
     }
 
@@ -194,14 +204,20 @@ public:
     void release() override {
         // nothing to do
     }
+    void decay() override {
+        for (auto&& block : m_blocks) {
+            block.get().decay();
+        }
+    }
 
 private:
     static const char* getClassName() {
         return "MemoryManagerIO";
     }
 
+    DynamicMemoryPoolPtr m_pool;
     MemoryControl::MemorySolution m_solution;
-    CPU_DEBUG_CAP_ENABLE(std::vector<std::reference_wrapper<BlockType>> m_blocks;)
+    std::vector<std::reference_wrapper<BlockType>> m_blocks;
     CPU_DEBUG_CAP_ENABLE(friend MemoryStatisticsRecord dumpStatisticsImpl(const MemoryManagerIO& obj);)
 };
 
@@ -251,6 +267,9 @@ private:
             m_workspace->free();
         }
     }
+    void decay() override {
+        // nothing to do
+    }
 
     static const char* getClassName() {
         return "MemoryManagerStatic";
@@ -266,6 +285,8 @@ private:
 
 class MemoryManagerNonOverlappingSets : public IMemoryManager {
 public:
+    explicit MemoryManagerNonOverlappingSets(DynamicMemoryPoolPtr pool) : m_pool(std::move(pool)) {}
+
     void insert(const MemoryRegion& reg, const std::vector<size_t>& syncInds) override {
         MemorySolver::Box box = {reg.start, reg.finish, reg.size, reg.id};
         if (-1 != reg.finish) {
@@ -333,7 +354,7 @@ private:
             }
         }
         for (auto& group : groups) {
-            auto unique_block = std::make_shared<MemoryBlockWithRelease>();
+            auto unique_block = std::make_shared<MemoryBlockWithRelease>(m_pool);
             for (auto& box : group) {
                 m_internalBlocks.insert({box.id, internalBlock(unique_block)});
             }
@@ -348,11 +369,18 @@ private:
             item.second->free();
         }
     }
+    void decay() override {
+        // the blocks shared by several regions account only the first call of an inference
+        for (auto&& item : m_internalBlocks) {
+            item.second->decay();
+        }
+    }
 
     static const char* getClassName() {
         return "MemoryManagerNonOverlappingSets";
     }
 
+    DynamicMemoryPoolPtr m_pool;
     MemoryControl::MemorySolution m_blocks;
     std::vector<MemorySolver::Box> m_boxes;
     std::unordered_map<MemoryControl::MemorySolution::key_type, std::shared_ptr<InternalBlock>> m_internalBlocks;
@@ -487,6 +515,10 @@ public:
         m_memManager->release();
     }
 
+    void decay() {
+        m_memManager->decay();
+    }
+
 #ifdef CPU_DEBUG_CAPS
     [[nodiscard]] MemoryStatisticsRecord dumpStatistics() const {
         return m_statDumper(m_memManager);
@@ -525,7 +557,7 @@ MemoryControl::RegionHandlerPtr buildHandler(F&& f, Args&&... args) {
 
 }  // namespace
 
-MemoryControl::MemoryControl(std::string id) : m_id(std::move(id)) {
+MemoryControl::MemoryControl(std::string id, const DynamicMemoryPoolPtr& pool) : m_id(std::move(id)) {
     // init handlers
     m_handlers.emplace_back(buildHandler<MemoryManagerStatic>([](const MemoryRegion& reg) {
         return reg.size >= 0 && MemoryRegion::RegionType::VARIABLE == reg.type &&
@@ -533,15 +565,19 @@ MemoryControl::MemoryControl(std::string id) : m_id(std::move(id)) {
     }));
 
     // handler for static tensors
-    m_handlers.emplace_back(buildHandler<MemoryManagerNonOverlappingSets>([](const MemoryRegion& reg) {
-        return reg.size < 0 && MemoryRegion::RegionType::VARIABLE == reg.type &&
-               MemoryRegion::AllocType::POD == reg.alloc_type;
-    }));
+    m_handlers.emplace_back(buildHandler<MemoryManagerNonOverlappingSets>(
+        [](const MemoryRegion& reg) {
+            return reg.size < 0 && MemoryRegion::RegionType::VARIABLE == reg.type &&
+                   MemoryRegion::AllocType::POD == reg.alloc_type;
+        },
+        pool));
 
     // handler for I/O tensors, so far simply individual blocks
-    m_handlers.emplace_back(buildHandler<MemoryManagerIO>([](const MemoryRegion& reg) {
-        return MemoryRegion::RegionType::VARIABLE != reg.type && reg.alloc_type == MemoryRegion::AllocType::POD;
-    }));
+    m_handlers.emplace_back(buildHandler<MemoryManagerIO>(
+        [](const MemoryRegion& reg) {
+            return MemoryRegion::RegionType::VARIABLE != reg.type && reg.alloc_type == MemoryRegion::AllocType::POD;
+        },
+        pool));
 }
 
 void MemoryControl::insert(const MemoryRegion& region, const std::vector<size_t>& syncInds) {
@@ -587,6 +623,12 @@ void MemoryControl::releaseMemory() {
     m_allocated = false;
 }
 
+void MemoryControl::decayMemory() {
+    for (auto&& handler : m_handlers) {
+        handler->decay();
+    }
+}
+
 #ifdef CPU_DEBUG_CAPS
 MemoryStatistics MemoryControl::dumpStatistics() const {
     MemoryStatistics profileData;
@@ -598,7 +640,7 @@ MemoryStatistics MemoryControl::dumpStatistics() const {
 #endif  // CPU_DEBUG_CAPS
 
 MemoryControl::Ptr NetworkMemoryControl::createMemoryControlUnit(std::string id) {
-    m_controlUnits.emplace_back(std::shared_ptr<MemoryControl>(new MemoryControl(std::move(id))));
+    m_controlUnits.emplace_back(std::shared_ptr<MemoryControl>(new MemoryControl(std::move(id), m_pool)));
     return m_controlUnits.back();
 }
 
@@ -614,6 +656,12 @@ void NetworkMemoryControl::releaseMemory() {
     }
 }
 
+void NetworkMemoryControl::decayMemory() {
+    for (auto&& item : m_controlUnits) {
+        item->decayMemory();
+    }
+}
+
 std::vector<std::pair<std::string, MemoryStatistics>> NetworkMemoryControl::dumpStatistics() const {
 #ifdef CPU_DEBUG_CAPS
     std::vector<std::pair<std::string, MemoryStatistics>> retVal;
@@ -61,13 +61,15 @@ public:
 
     void allocateMemory();
     void releaseMemory();
+    // accounts an inference for the shrink of the dynamic memory, see DynamicMemoryPool
+    void decayMemory();
 
     [[nodiscard]] const std::string& getId() const {
         return m_id;
     }
 
 private:
-    explicit MemoryControl(std::string id);
+    MemoryControl(std::string id, const DynamicMemoryPoolPtr& pool);
     void insert(const MemoryRegion& region, const std::vector<size_t>& syncInds);
     [[nodiscard]] MemoryStatistics dumpStatistics() const;
 
@@ -80,11 +82,12 @@ private:
 
 class NetworkMemoryControl {
 public:
-    NetworkMemoryControl() = default;
+    explicit NetworkMemoryControl(DynamicMemoryPoolPtr pool = nullptr) : m_pool(std::move(pool)) {}
     MemoryControl::Ptr createMemoryControlUnit(std::string id);
 
     void allocateMemory();
     void releaseMemory();
+    void decayMemory();
 
     [[nodiscard]] std::vector<std::pair<std::string, MemoryStatistics>> dumpStatistics() const;
 
@@ -93,6 +96,8 @@ public:
     }
 
 private:
+    // the pool of the dynamic memory of all the control units
+    DynamicMemoryPoolPtr m_pool;
     std::vector<MemoryControl::Ptr> m_controlUnits;
 };
 
@@ -7,10 +7,15 @@
 #include <nodes/common/cpu_convert.h>
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <filesystem>
+#include <fstream>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -23,6 +28,7 @@
 #include "memory_desc/cpu_blocked_memory_desc.h"
 #include "memory_desc/cpu_memory_desc.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
+#include "nodes/common/cpu_memcpy.h"
 #include "nodes/kernels/scaled_attn/attn_quant.hpp"
 #include "nodes/kernels/scaled_attn/cache_spec.hpp"
 #include "openvino/core/except.hpp"
@@ -38,6 +44,164 @@ using namespace ov::Extensions::Cpu::XARCH;
 
 namespace ov::intel_cpu {
 
+namespace {
+
+// the buffers of a state may be larger than its current content, to append the next tokens in place
+size_t capacity_bytes(const MemoryPtr& mem, size_t max_size) {
+    return std::max(div_up(max_size * mem->getDesc().getPrecision().bitwidth(), 8), mem->getSize());
+}
+
+size_t capacity_bytes(const PlainTensor& tensor) {
+    if (!tensor) {
+        return 0;
+    }
+    return tensor.m_capacity ? tensor.m_capacity : tensor.m_strides[0] * tensor.m_dims[0] * tensor.m_element_size;
+}
+
+/*
+ * The swap record of a KV cache state is a sequence of uint64_t values and raw buffers. The buffers are aligned to
+ * swap_alignment from the start of the file, so the file can be mapped and the buffers used in place.
+ */
+constexpr uint64_t swap_magic = 0x50415753564B564FULL;  // "OVKVSWAP"
+constexpr uint64_t swap_alignment = 64;
+
+class SwapWriter {
+public:
+    explicit SwapWriter(std::ofstream& file) : m_file(file) {}
+
+    void value(uint64_t value) {
+        m_file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    void dims(const VectorDims& dims) {
+        value(dims.size());
+        for (const auto dim : dims) {
+            value(dim);
+        }
+    }
+
+    void data(const void* data, size_t size) {
+        value(size);
+        align();
+        m_file.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+    }
+
+    void align() {
+        static const std::array<char, swap_alignment> zeros{};
+        const auto position = static_cast<uint64_t>(m_file.tellp());
+        const auto padding = div_up(position, swap_alignment) * swap_alignment - position;
+        m_file.write(zeros.data(), static_cast<std::streamsize>(padding));
+    }
+
+    void memory(const MemoryPtr& mem, size_t max_size) {
+        const auto desc = mem->getDescWithType<BlockedMemoryDesc>();
+        OPENVINO_ASSERT(desc->getOffsetPadding() == 0, "Unexpected offset of the KV cache state buffer");
+        value(static_cast<uint64_t>(static_cast<ov::element::Type_t>(desc->getPrecision())));
+        dims(desc->getShape().getStaticDims());
+        dims(desc->getBlockDims());
+        dims(desc->getOrder());
+        dims(desc->getStrides());
+        value(capacity_bytes(mem, max_size));
+        data(mem->getData(), mem->getSize());
+    }
+
+    void tensor(const PlainTensor& tensor) {
+        value(tensor ? 1 : 0);
+        if (!tensor) {
+            return;
+        }
+        value(static_cast<uint64_t>(tensor.m_dt));
+        value(tensor.m_element_size);
+        value(tensor.m_sub_byte_multiplier);
+        value(tensor.m_offset);
+        dims(tensor.shape());
+        dims(tensor.get_strides<size_t>());
+        data(tensor.m_ptr.get(), capacity_bytes(tensor));
+    }
+
+private:
+    std::ofstream& m_file;
+};
+
+class SwapReader {
+public:
+    explicit SwapReader(std::ifstream& file) : m_file(file) {}
+
+    uint64_t value() {
+        uint64_t value = 0;
+        m_file.read(reinterpret_cast<char*>(&value), sizeof(value));
+        OPENVINO_ASSERT(m_file.good(), "Failed to read the swapped out KV cache state");
+        return value;
+    }
+
+    VectorDims dims() {
+        VectorDims dims(value());
+        for (auto& dim : dims) {
+            dim = value();
+        }
+        return dims;
+    }
+
+    void data(void* data, size_t size) {
+        const auto position = static_cast<uint64_t>(m_file.tellg());
+        m_file.seekg(static_cast<std::streamoff>(div_up(position, swap_alignment) * swap_alignment));
+        m_file.read(static_cast<char*>(data), static_cast<std::streamsize>(size));
+        OPENVINO_ASSERT(m_file.good(), "Failed to read the swapped out KV cache state");
+    }
+
+    MemoryPtr memory(const dnnl::engine& engine) {
+        const ov::element::Type precision(static_cast<ov::element::Type_t>(value()));
+        const auto shape = dims();
+        const auto blocked_dims = dims();
+        const auto order = dims();
+        const auto strides = dims();
+        const auto capacity = value();
+        const auto size = value();
+        auto desc = std::make_shared<CpuBlockedMemoryDesc>(precision,
+                                                           Shape(shape),
+                                                           blocked_dims,
+                                                           order,
+                                                           0,
+                                                           VectorDims{},
+                                                           strides);
+        auto block = std::make_shared<DnnlMemoryBlock>(std::make_unique<MemoryBlockWithReuse>());
+        block->resize(std::max(capacity, size));
+        data(block->getRawPtr(), size);
+        return std::make_shared<Memory>(engine, desc, block);
+    }
+
+    PlainTensor tensor() {
+        PlainTensor tensor;
+        if (!value()) {
+            return tensor;
+        }
+        const auto dt = static_cast<ov::element::Type_t>(value());
+        const auto element_size = value();
+        const auto sub_byte_multiplier = value();
+        const auto offset = value();
+        const auto shape = dims();
+        const auto strides = dims();
+        const auto size = value();
+        OPENVINO_ASSERT(shape.size() <= PLAINTENSOR_RANK_MAX && strides.size() == shape.size(),
+                        "Unexpected rank of the swapped out KV cache state");
+        tensor.resize({size}, 1, ov::element::Type_t::u8);
+        data(tensor.m_ptr.get(), size);
+        tensor.m_dt = dt;
+        tensor.m_element_size = element_size;
+        tensor.m_sub_byte_multiplier = sub_byte_multiplier;
+        tensor.m_offset = offset;
+        tensor.m_rank = shape.size();
+        std::copy(shape.begin(), shape.end(), tensor.m_dims);
+        std::copy(strides.begin(), strides.end(), tensor.m_strides);
+        return tensor;
+    }
+
+private:
+    std::ifstream& m_file;
+};
+
+}  // namespace
+
 VariableStateBase::VariableStateBase(const std::string& name, MemoryDescPtr external_desc)
     : IVariableState{name},
       m_external_desc{std::move(external_desc)} {}
@@ -240,6 +404,14 @@ ov::SoPtr<ov::ITensor> VariableStateKVcache::get_state() const {
                     "get_state() is not supported for KV cache with TURBO quantization. "
                     "TURBO stores packed bits and per-token norm in separate metadata; "
                     "scalar dequant path cannot reconstruct the original tensor.");
+    if (is_swapped()) {
+        // read a copy, the state stays swapped out
+        VariableStateKVcache resident(get_name(), get_external_desc(), m_dense_internal_desc, m_spec);
+        resident.m_swap = m_swap;
+        resident.swap_in();
+        resident.set_reset_state_flag(false);
+        return resident.get_state();
+    }
     if (!m_internal_mem || !m_hidden_state || is_reset_state()) {
         auto new_desc = to_static(get_external_desc());
         auto external_mem = std::make_shared<Memory>(get_engine(), new_desc);
@@ -320,6 +492,13 @@ void VariableStateKVcache::set_state_impl(const ov::SoPtr<ov::ITensor>& state) {
                     "set_state() is not supported for KV cache with TURBO quantization. "
                     "TURBO requires rotation+codebook encoding plus per-token norm metadata "
                     "owned by the SDPA node; external state cannot be injected directly.");
+    m_swap = {};
+    if (m_owners) {
+        // the buffers shared with the snapshots or the other states must not be written: the cache and the beam table
+        // are allocated anew below, the scales and zero points are detached here
+        m_scale_zp = PlainTensor{};
+        m_owners.reset();
+    }
     // 1. reset the memory object
     m_state = state;  // simply to extend the lifetime
     auto state_desc = MemoryDescUtils::generateCpuBlockedMemoryDesc(m_state);
@@ -408,8 +587,169 @@ void VariableStateKVcache::set_state_impl(const ov::SoPtr<ov::ITensor>& state) {
     m_hidden_state_max_size = mem_desc->getCurrentMemSize() / mem_desc->getPrecision().size();
 }
 
+KVCacheSnapshotPtr VariableStateKVcache::capture() {
+    OPENVINO_ASSERT(m_spec.alg != ov::internal::CacheQuantAlgorithm::TURBO,
+                    "capture() is not supported for KV cache with TURBO quantization, "
+                    "the per-token norms are owned by the SDPA node.");
+    auto result = std::make_shared<KVCacheSnapshot>();
+    result->is_reset = is_reset_state() || !m_internal_mem || !m_hidden_state;
+    if (result->is_reset) {
+        return result;
+    }
+    if (!m_owners) {
+        m_owners = std::make_shared<char>();
+    }
+    // separate memory objects over the same blocks, since the descriptors of the state are redefined in place
+    result->internal_mem =
+        std::make_shared<Memory>(get_engine(), m_internal_mem->getDescPtr(), m_internal_mem->getMemoryBlock());
+    result->hidden_state =
+        std::make_shared<Memory>(get_engine(), m_hidden_state->getDescPtr(), m_hidden_state->getMemoryBlock());
+    result->scale_zp = m_scale_zp;
+    result->internal_mem_max_size = m_internal_mem_max_size;
+    result->hidden_state_max_size = m_hidden_state_max_size;
+    result->owners = m_owners;
+    return result;
+}
+
+void VariableStateKVcache::restore(const KVCacheSnapshotPtr& snapshot) {
+    OPENVINO_ASSERT(snapshot, "Cannot restore the state ", get_name(), " from an empty snapshot");
+    OPENVINO_ASSERT(m_spec.alg != ov::internal::CacheQuantAlgorithm::TURBO,
+                    "restore() is not supported for KV cache with TURBO quantization, "
+                    "the per-token norms are owned by the SDPA node.");
+    if (snapshot->is_reset) {
+        reset();
+        return;
+    }
+    OPENVINO_ASSERT(snapshot->internal_mem->getDesc().getPrecision() == m_dense_internal_desc->getPrecision(),
+                    "Cannot restore the state ",
+                    get_name(),
+                    " from a snapshot of the KV cache with a different precision");
+    m_internal_mem = std::make_shared<Memory>(get_engine(),
+                                              snapshot->internal_mem->getDescPtr(),
+                                              snapshot->internal_mem->getMemoryBlock());
+    m_hidden_state = std::make_shared<Memory>(get_engine(),
+                                              snapshot->hidden_state->getDescPtr(),
+                                              snapshot->hidden_state->getMemoryBlock());
+    m_scale_zp = snapshot->scale_zp;
+    m_internal_mem_max_size = snapshot->internal_mem_max_size;
+    m_hidden_state_max_size = snapshot->hidden_state_max_size;
+    m_owners = snapshot->owners;
+    set_reset_state_flag(false);
+}
+
+void VariableStateKVcache::fork(VariableStateKVcache& other) {
+    restore(other.capture());
+}
+
+void VariableStateKVcache::fork(const ov::SoPtr<ov::IVariableState>& source) {
+    OPENVINO_ASSERT(source, "Cannot fork the state ", get_name(), " from an empty state");
+    OPENVINO_ASSERT(source->get_name() == get_name(),
+                    "Cannot fork the state ",
+                    get_name(),
+                    " from the state of another variable ",
+                    source->get_name());
+    if (auto* other = dynamic_cast<VariableStateKVcache*>(source._ptr.get())) {
+        fork(*other);
+    } else {
+        set_state(source->get_state());
+    }
+}
+
+ov::SoPtr<ov::IVariableState> VariableStateKVcache::snapshot() {
+    auto result =
+        std::make_shared<VariableStateKVcache>(get_name(), get_external_desc(), m_dense_internal_desc, m_spec);
+    result->restore(capture());
+    return {result, nullptr};
+}
+
+size_t VariableStateKVcache::tokens() const {
+    if (is_reset_state() || !m_internal_mem) {
+        return 0;
+    }
+    const auto desc = m_internal_mem->getDescWithType<BlockedMemoryDesc>();
+    // the internal layout is LBHS, so the first axis of the order is L
+    return desc->getShape().getStaticDims()[desc->getOrder()[0]];
+}
+
+void VariableStateKVcache::truncate(size_t n_tokens) {
+    const auto current = tokens();
+    OPENVINO_ASSERT(n_tokens <= current,
+                    "Cannot truncate the state ",
+                    get_name(),
+                    " to ",
+                    n_tokens,
+                    " tokens, it has only ",
+                    current);
+    if (n_tokens == current) {
+        return;
+    }
+    // the scales and zero points are shared by the group of tokens
+    OPENVINO_ASSERT(!m_spec.by_channel || n_tokens % m_spec.group_size == 0,
+                    "The state ",
+                    get_name(),
+                    " quantized by channel can only be truncated to a multiple of the group size ",
+                    m_spec.group_size);
+
+    // the strides keep addressing the same buffers
+    auto with_length = [](const MemoryPtr& mem, size_t axis, size_t length) {
+        const auto desc = mem->getDescWithType<BlockedMemoryDesc>();
+        auto dims = desc->getShape().getStaticDims();
+        dims[desc->getOrder()[axis]] = length;
+        auto blocked_dims = desc->getBlockDims();
+        blocked_dims[axis] = length;
+        mem->redefineDesc(std::make_shared<CpuBlockedMemoryDesc>(desc->getPrecision(),
+                                                                 Shape(dims),
+                                                                 blocked_dims,
+                                                                 desc->getOrder(),
+                                                                 0,
+                                                                 VectorDims{},
+                                                                 desc->getStrides()));
+    };
+    with_length(m_internal_mem, 0, n_tokens);
+    // the beam table is [B, L]
+    with_length(m_hidden_state, 1, n_tokens);
+}
+
+void VariableStateKVcache::make_exclusive() {
+    if (!m_owners) {
+        return;
+    }
+    if (m_owners.use_count() > 1) {
+        // the content of a reset state is not used anymore
+        const bool copy_content = !is_reset_state();
+        auto copy = [copy_content](const MemoryPtr& mem, size_t max_size) {
+            auto block = std::make_shared<DnnlMemoryBlock>(std::make_unique<MemoryBlockWithReuse>());
+            block->resize(capacity_bytes(mem, max_size));
+            auto result = std::make_shared<Memory>(get_engine(), mem->getDescPtr(), block);
+            if (copy_content) {
+                cpu_parallel_memcpy(result->getData(), mem->getData(), mem->getSize());
+            }
+            return result;
+        };
+        m_internal_mem = copy(m_internal_mem, m_internal_mem_max_size);
+        m_hidden_state = copy(m_hidden_state, m_hidden_state_max_size);
+        if (m_scale_zp) {
+            PlainTensor scale_zp = m_scale_zp;
+            const size_t size = capacity_bytes(m_scale_zp);
+            PlainTensor buffer;
+            buffer.resize<uint8_t>({size});
+            if (copy_content) {
+                cpu_parallel_memcpy(buffer.ptr<uint8_t>(), m_scale_zp.m_ptr.get(), size);
+            }
+            scale_zp.m_ptr = buffer.m_ptr;
+            scale_zp.m_capacity = size;
+            m_scale_zp = scale_zp;
+        }
+    } else {
+        // the release of the last other owner happens before, so its reads of the buffers do too
+        std::atomic_thread_fence(std::memory_order_acquire);
+    }
+    m_owners.reset();
+}
+
 void VariableStateKVcache::reset_impl() {
-    // nothing to do
+    // the buffers are kept for the next tokens, the swapped out content is not needed anymore
+    m_swap = {};
 }
 
 void VariableStateKVcache::commit_impl() {
@@ -443,4 +783,87 @@ MemoryPtr VariableStateKVcache::hidden_state_mem() const {
 void VariableStateKVcache::assign_hidden_state(const MemoryPtr& mem) {
     m_hidden_state = mem;
 }
+
+size_t VariableStateKVcache::resident_bytes() const {
+    size_t bytes = capacity_bytes(m_scale_zp);
+    if (m_internal_mem) {
+        bytes += capacity_bytes(m_internal_mem, m_internal_mem_max_size);
+    }
+    if (m_hidden_state) {
+        bytes += capacity_bytes(m_hidden_state, m_hidden_state_max_size);
+    }
+    return bytes;
+}
+
+std::optional<uint64_t> VariableStateKVcache::write_swap(std::ofstream& file) const {
+    OPENVINO_ASSERT(!is_swapped(), "The state ", get_name(), " is already swapped out");
+    if (is_reset_state() || !m_internal_mem || !m_hidden_state) {
+        return std::nullopt;
+    }
+    SwapWriter writer(file);
+    writer.align();
+    const auto offset = static_cast<uint64_t>(file.tellp());
+    writer.value(swap_magic);
+    // the cache is quantized by the SDPA node with the spec of the state, so it is stored for the validation
+    writer.value(static_cast<uint64_t>(m_spec.alg));
+    writer.value(static_cast<uint64_t>(static_cast<ov::element::Type_t>(m_spec.precision)));
+    writer.value(m_spec.group_size);
+    writer.value(m_spec.by_channel ? 1 : 0);
+    writer.value(m_internal_mem_max_size);
+    writer.value(m_hidden_state_max_size);
+    writer.memory(m_internal_mem, m_internal_mem_max_size);
+    writer.memory(m_hidden_state, m_hidden_state_max_size);
+    writer.tensor(m_scale_zp);
+    OPENVINO_ASSERT(file.good(), "Failed to swap out the state ", get_name());
+    return offset;
+}
+
+void VariableStateKVcache::release_swapped(const std::shared_ptr<const std::filesystem::path>& path,
+                                           std::optional<uint64_t> offset) {
+    if (offset) {
+        m_swap = {path, *offset};
+    }
+    // the buffers shared with the snapshots stay alive with them
+    m_internal_mem.reset();
+    m_hidden_state.reset();
+    m_scale_zp = PlainTensor{};
+    m_internal_mem_max_size = 0;
+    m_hidden_state_max_size = 0;
+    m_owners.reset();
+}
+
+void VariableStateKVcache::swap_in() {
+    if (!is_swapped()) {
+        return;
+    }
+    std::ifstream file(*m_swap.path, std::ios::binary);
+    OPENVINO_ASSERT(file.is_open(), "Failed to open ", m_swap.path->string(), " to swap in the state ", get_name());
+    file.seekg(static_cast<std::streamoff>(m_swap.offset));
+    SwapReader reader(file);
+    OPENVINO_ASSERT(reader.value() == swap_magic, "Unexpected content of ", m_swap.path->string());
+    const auto alg = static_cast<ov::internal::CacheQuantAlgorithm>(reader.value());
+    const ov::element::Type precision(static_cast<ov::element::Type_t>(reader.value()));
+    const auto group_size = reader.value();
+    const bool by_channel = reader.value() != 0;
+    OPENVINO_ASSERT(alg == m_spec.alg && precision == m_spec.precision && group_size == m_spec.group_size &&
+                        by_channel == m_spec.by_channel,
+                    "The swapped out state ",
+                    get_name(),
+                    " was quantized with other parameters");
+    const auto internal_mem_max_size = reader.value();
+    const auto hidden_state_max_size = reader.value();
+    auto internal_mem = reader.memory(get_engine());
+    auto hidden_state = reader.memory(get_engine());
+    OPENVINO_ASSERT(internal_mem->getDesc().getPrecision() == m_dense_internal_desc->getPrecision(),
+                    "The swapped out state ",
+                    get_name(),
+                    " has another precision of the cache");
+    m_scale_zp = reader.tensor();
+    m_internal_mem = internal_mem;
+    m_hidden_state = hidden_state;
+    m_internal_mem_max_size = internal_mem_max_size;
+    m_hidden_state_max_size = hidden_state_max_size;
+    m_swap = {};
+}
+
 }  // namespace ov::intel_cpu
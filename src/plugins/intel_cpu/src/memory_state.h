@@ -6,8 +6,12 @@
 
 #include <array>
 #include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
+#include <optional>
 #include <string>
 
 #include "cpu_memory.h"
@@ -57,6 +61,10 @@ protected:
         return m_external_desc;
     }
 
+    void set_reset_state_flag(bool flag) {
+        reset_state_flag = flag;
+    }
+
 private:
     MemoryDescPtr m_external_desc;
     bool reset_state_flag = true;
@@ -119,6 +127,24 @@ private:
     MemoryDescPtr m_internal_desc;  // mem desc required by the graph internal tensor
 };
 
+/**
+ * @brief Zero-copy capture of the content of a VariableStateKVcache: the KV cache, the beam table and the scales and
+ * zero points of a quantized cache. The buffers are shared by the snapshot and by all the states restored from it, a
+ * state copies them before it modifies them (copy-on-write), so the snapshot is never changed.
+ */
+struct KVCacheSnapshot {
+    MemoryPtr internal_mem;
+    MemoryPtr hidden_state;
+    PlainTensor scale_zp;
+    size_t internal_mem_max_size = 0;
+    size_t hidden_state_max_size = 0;
+    bool is_reset = true;
+    // shared by the snapshots and the states referencing the same buffers, see VariableStateKVcache::make_exclusive
+    std::shared_ptr<const void> owners;
+};
+
+using KVCacheSnapshotPtr = std::shared_ptr<const KVCacheSnapshot>;
+
 class VariableStateKVcache : public VariableStateBase {
 public:
     VariableStateKVcache(const std::string& name,
@@ -128,6 +154,10 @@ public:
 
     // ov::IVariableState
     ov::SoPtr<ov::ITensor> get_state() const override;
+    // shares the buffers with a KV cache state of the same variable, copies the value of other states
+    void fork(const ov::SoPtr<ov::IVariableState>& source) override;
+    // a detached state restored from capture(), so it shares the buffers as well
+    ov::SoPtr<ov::IVariableState> snapshot() override;
 
     // ov::intel_cpu::VariableStateBase
     MemoryPtr input_mem() override;
@@ -166,6 +196,54 @@ public:
         return m_spec;
     }
 
+    /**
+     * Captures the current content without copying it. The state keeps using the same buffers and copies them at the
+     * next modification, while the snapshot is alive.
+     */
+    KVCacheSnapshotPtr capture();
+
+    /**
+     * Makes the state share the buffers of the snapshot, e.g. to roll back to it or to start several requests (beam
+     * search, speculative decoding, a common system prompt) from the same prefix. No data is copied.
+     */
+    void restore(const KVCacheSnapshotPtr& snapshot);
+
+    // the same as restore(other.capture())
+    void fork(VariableStateKVcache& other);
+
+    /**
+     * Drops the tokens following the first \p n_tokens, e.g. the rejected draft tokens of the speculative decoding.
+     * Only the shapes are changed, the buffers are neither copied nor reallocated.
+     */
+    void truncate(size_t n_tokens) override;
+
+    // the current number of tokens in the cache
+    size_t tokens() const;
+
+    /**
+     * Copies the buffers shared with a snapshot or with the other states, so they can be modified. Must be called
+     * before the cache or the beam table are written.
+     */
+    void make_exclusive();
+
+    // the size of the buffers in bytes, 0 when the state is swapped out
+    size_t resident_bytes() const;
+
+    /**
+     * Swapping out takes two steps, so that the buffers are released only once the file is known to be written.
+     * write_swap() appends the content to \p file with the precision, the layout and the quantization parameters of
+     * the cache and returns its offset, none for a reset state, whose content is not written. After the file is closed
+     * successfully, release_swapped() releases the buffers, given the file name \p path and the offset. The state is
+     * paged back in by swap_in(), while get_state() reads it from the file without paging it in.
+     */
+    std::optional<uint64_t> write_swap(std::ofstream& file) const;
+    void release_swapped(const std::shared_ptr<const std::filesystem::path>& path, std::optional<uint64_t> offset);
+    void swap_in();
+
+    bool is_swapped() const {
+        return m_swap.path != nullptr;
+    }
+
 private:
     // ov::intel_cpu::VariableStateBase
     void set_state_impl(const ov::SoPtr<ov::ITensor>& state) override;
@@ -183,6 +261,15 @@ private:
     // for u8 kv cache: [B, H, L, 2], 0 for scale, 1 for zp
     PlainTensor m_scale_zp;
     ov::Extensions::Cpu::CacheSpec m_spec;
+
+    // shared with the snapshots and the other states referencing the same buffers, null when they are not shared
+    std::shared_ptr<const void> m_owners;
+
+    // where the content of a swapped out state is stored
+    struct SwapLocation {
+        std::shared_ptr<const std::filesystem::path> path;
+        uint64_t offset = 0;
+    } m_swap;
 };
 
 using MemStatePtr = std::shared_ptr<IVariableState>;
@@ -4,19 +4,24 @@
 
 #include "embedding_bag.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "cpu_memory.h"
 #include "cpu_types.h"
+#include "nodes/kernels/embedding_bag_kernel.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/node.hpp"
 #include "openvino/core/parallel.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/core/type/element_type_traits.hpp"
+#include "utils/general_utils.h"
 
 namespace ov::intel_cpu::node {
 
@@ -50,6 +55,55 @@ void EmbeddingBag::prepareParams(const VectorDims& indexStaticShape) {
     }
 }
 
+void EmbeddingBag::fuseDecompression(const ov::element::Type& tablePrecision,
+                                     std::vector<float> scales,
+                                     std::vector<float> zeroPoints) {
+    _tablePrecision = tablePrecision;
+    _compressed = true;
+    _scales = std::move(scales);
+    _zeroPoints = std::move(zeroPoints);
+}
+
+ov::element::Type EmbeddingBag::initPrecisions(const ov::element::Type& originalTablePrecision) {
+    if (_compressed) {
+        return ov::element::f32;
+    }
+    if (any_of(originalTablePrecision, ov::element::f32, ov::element::bf16, ov::element::f16)) {
+        _tablePrecision = originalTablePrecision;
+        return ov::element::f32;
+    }
+    OPENVINO_ASSERT(any_of(originalTablePrecision, ov::element::i8, ov::element::u8, ov::element::i32),
+                    "Layer EmbeddingBag with name '",
+                    _layerName,
+                    "' has unsupported precision: ",
+                    originalTablePrecision.get_type_name());
+    _tablePrecision = originalTablePrecision;
+    return originalTablePrecision;
+}
+
+void EmbeddingBag::balanceBags(size_t bagsNum) {
+    _bagsWork.resize(bagsNum + 1);
+    _bagsWork[0] = 0;
+    const int* indices = nullptr;
+    size_t indicesSize = 0LU;
+    size_t weightsIdx = 0LU;
+    bool withWeights = false;
+    for (size_t obi = 0; obi < bagsNum; obi++) {
+        getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
+        // a row per index plus the output row of the bag
+        _bagsWork[obi + 1] = _bagsWork[obi] + (indices != nullptr ? indicesSize : 0LU) + 1LU;
+    }
+}
+
+void EmbeddingBag::splitBags(int ithr, int nthr, size_t& start, size_t& end) const {
+    auto bound = [&](int i) {
+        const size_t work = _bagsWork.back() * i / nthr;
+        return static_cast<size_t>(std::lower_bound(_bagsWork.begin(), _bagsWork.end(), work) - _bagsWork.begin());
+    };
+    start = bound(ithr);
+    end = bound(ithr + 1);
+}
+
 template <typename T>
 void EmbeddingBag::processData(const T* srcData,
                                const T* weightsData,
@@ -61,11 +115,12 @@ void EmbeddingBag::processData(const T* srcData,
 
     const size_t outputBagsNum = outMemory->getShape().getStaticDims()[0];
     auto* dstData = outMemory->getDataAs<T>();
+    balanceBags(outputBagsNum);
 
     auto threadBody = [&](const int ithr, const int nthr) {
         size_t start(0LU);
         size_t end(0LU);
-        splitter(outputBagsNum, nthr, ithr, start, end);
+        splitBags(ithr, nthr, start, end);
         if (start >= end) {
             return;
         }
@@ -130,19 +185,66 @@ void EmbeddingBag::processData(const T* srcData,
     parallel_nt(0, threadBody);
 }
 
+void EmbeddingBag::processTable(const uint8_t* srcData,
+                                const float* weightsData,
+                                const ov::element::Type& srcPrc,
+                                const VectorDims& inDataDims,
+                                const MemoryPtr& outMemory) {
+    std::string msgPrefix = std::string("Node EmbeddingBag with name '") + _layerName + "' ";
+
+    initFromInputs();
+
+    const size_t outputBagsNum = outMemory->getShape().getStaticDims()[0];
+    auto* dstData = outMemory->getDataAs<float>();
+    balanceBags(outputBagsNum);
+
+    const float* scales = _scales.empty() ? nullptr : _scales.data();
+    const float* zeroPoints = _zeroPoints.empty() ? nullptr : _zeroPoints.data();
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start(0LU);
+        size_t end(0LU);
+        splitBags(ithr, nthr, start, end);
+
+        size_t indicesSize = 0LU;
+        const int* indices = nullptr;
+        size_t weightsIdx = 0LU;
+        bool withWeights = _withWeights;
+
+        for (size_t obi = start; obi < end; obi++) {
+            getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
+            if (indices == nullptr) {
+                indicesSize = 0LU;
+            }
+            for (size_t inIdx = 0LU; inIdx < indicesSize; inIdx++) {
+                OPENVINO_ASSERT(static_cast<size_t>(indices[inIdx]) < inDataDims[0],
+                                msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]));
+            }
+            ov::Extensions::Cpu::XARCH::embedding_bag_reduce(srcData,
+                                                             srcPrc,
+                                                             _embDepth,
+                                                             scales,
+                                                             zeroPoints,
+                                                             indices,
+                                                             indicesSize,
+                                                             withWeights && _withWeights ? weightsData + weightsIdx
+                                                                                         : nullptr,
+                                                             _reduction == Reduction::MEAN,
+                                                             dstData + obi * _embDepth);
+        }
+    });
+}
+
 void EmbeddingBag::execute(const uint8_t* srcData,
                            const uint8_t* weightsData,
                            const ov::element::Type& srcPrc,
                            const VectorDims& inDims,
                            const MemoryPtr& outMemory) {
-    switch (srcPrc) {
-    case ov::element::f32: {
-        processData<element_type_traits<ov::element::f32>::value_type>(reinterpret_cast<const float*>(srcData),
-                                                                       reinterpret_cast<const float*>(weightsData),
-                                                                       inDims,
-                                                                       outMemory);
-        break;
+    if (_compressed || any_of(srcPrc, ov::element::f32, ov::element::bf16, ov::element::f16)) {
+        processTable(srcData, reinterpret_cast<const float*>(weightsData), srcPrc, inDims, outMemory);
+        return;
     }
+    switch (srcPrc) {
     case ov::element::i8: {
         processData<element_type_traits<ov::element::i8>::value_type>(reinterpret_cast<const int8_t*>(srcData),
                                                                       reinterpret_cast<const int8_t*>(weightsData),
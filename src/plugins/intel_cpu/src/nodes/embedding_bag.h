@@ -8,6 +8,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "cpu_memory.h"
 #include "cpu_types.h"
@@ -31,6 +32,17 @@ public:
                  const VectorDims& inDims,
                  const MemoryPtr& outMemory);
 
+    /**
+     * @brief Makes the node read the compressed table directly and dequantize its rows on the fly, instead of
+     * dequantizing the whole table up front
+     * @param tablePrecision the precision of the compressed table: u8, i8, u4 or i4
+     * @param scales the per-row scales, empty if the rows aren't scaled
+     * @param zeroPoints the per-row zero points, empty if there are none
+     */
+    void fuseDecompression(const ov::element::Type& tablePrecision,
+                           std::vector<float> scales,
+                           std::vector<float> zeroPoints);
+
     virtual ~EmbeddingBag() = default;
 
 protected:
@@ -43,9 +55,27 @@ protected:
 
     void prepareParams(const VectorDims& indexStaticShape);
 
+    /**
+     * @brief Selects the precision of the table port and returns the one of the per-sample weights and the output.
+     * The floating point and the compressed tables are read as is and reduced into f32, the integer ones are reduced
+     * in their own precision.
+     */
+    ov::element::Type initPrecisions(const ov::element::Type& originalTablePrecision);
+
     template <typename T>
     void processData(const T* srcData, const T* weightsData, const VectorDims& inDataDims, const MemoryPtr& outMemory);
 
+    void processTable(const uint8_t* srcData,
+                      const float* weightsData,
+                      const ov::element::Type& srcPrc,
+                      const VectorDims& inDataDims,
+                      const MemoryPtr& outMemory);
+
+    // The bags are split between the threads by the number of their indices: the pooling factors of the real
+    // workloads are skewed and the even split of the bags leaves most of the threads idle
+    void balanceBags(size_t bagsNum);
+    void splitBags(int ithr, int nthr, size_t& start, size_t& end) const;
+
     const size_t EMB_TABLE_IDX = 0LU;
     const size_t INDICES_IDX;
     const size_t PER_SAMPLE_WEIGHTS_IDX;
@@ -55,6 +85,13 @@ protected:
     bool _withWeights = false;
     size_t _embDepth = 0;
     std::string _layerName;
+
+    ov::element::Type _tablePrecision = ov::element::f32;
+    bool _compressed = false;
+    std::vector<float> _scales;
+    std::vector<float> _zeroPoints;
+    // the prefix sums of the work of the bags
+    std::vector<size_t> _bagsWork;
 };
 
 }  // namespace ov::intel_cpu::node
@@ -9,7 +9,6 @@
 #include <cstdint>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
-#include <set>
 #include <string>
 #include <vector>
 
@@ -28,7 +27,6 @@
 #include "openvino/op/embeddingbag_offsets_sum.hpp"
 #include "openvino/op/util/embeddingbag_offsets_base.hpp"
 #include "shape_inference/shape_inference_cpu.hpp"
-#include "utils/general_utils.h"
 
 namespace ov::intel_cpu::node {
 
@@ -80,30 +78,9 @@ void EmbeddingBagOffset::initSupportedPrimitiveDescriptors() {
         return;
     }
 
-    static const std::set<ov::element::Type> supportedPrecisions = {ov::element::f32,
-                                                                    ov::element::i8,
-                                                                    ov::element::u8,
-                                                                    ov::element::i32};
+    const auto inDataPrecision = initPrecisions(getOriginalInputPrecisionAtPort(EMB_TABLE_IDX));
 
-    auto inDataPrecision = getOriginalInputPrecisionAtPort(EMB_TABLE_IDX);
-    if (any_of(inDataPrecision, ov::element::bf16, ov::element::f16)) {
-        inDataPrecision = ov::element::f32;
-    }
-    if (!supportedPrecisions.empty()) {
-        if (supportedPrecisions.find(inDataPrecision) == supportedPrecisions.end()) {
-            CPU_NODE_THROW("has unsupported precision: ", inDataPrecision.get_type_name());
-        }
-    } else {
-        static const std::set<ov::element::Type> defaultSupportedPrecisions = {ov::element::f32,
-                                                                               ov::element::i8,
-                                                                               ov::element::u8,
-                                                                               ov::element::i32};
-        if (defaultSupportedPrecisions.find(inDataPrecision) == defaultSupportedPrecisions.end()) {
-            CPU_NODE_THROW("has unsupported precision: ", inDataPrecision.get_type_name());
-        }
-    }
-
-    std::vector<PortConfigurator> inDataConfigurators({{LayoutType::ncsp, inDataPrecision},
+    std::vector<PortConfigurator> inDataConfigurators({{LayoutType::ncsp, _tablePrecision},
                                                        {LayoutType::ncsp, ov::element::i32},
                                                        {LayoutType::ncsp, ov::element::i32}});
     if (inputShapes.size() > DEFAULT_INDEX_IDX) {
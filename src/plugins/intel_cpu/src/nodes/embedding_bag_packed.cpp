@@ -9,7 +9,6 @@
 #include <cstdint>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
-#include <set>
 #include <string>
 #include <vector>
 
@@ -28,7 +27,6 @@
 #include "openvino/op/embeddingbag_packedsum.hpp"
 #include "openvino/op/util/embeddingbag_packed_base.hpp"
 #include "shape_inference/shape_inference_cpu.hpp"
-#include "utils/general_utils.h"
 
 namespace ov::intel_cpu::node {
 
@@ -78,31 +76,10 @@ void EmbeddingBagPacked::initSupportedPrimitiveDescriptors() {
         return;
     }
 
-    static const std::set<ov::element::Type> supportedPrecisions = {ov::element::f32,
-                                                                    ov::element::i8,
-                                                                    ov::element::u8,
-                                                                    ov::element::i32};
-
-    auto inDataPrecision = getOriginalInputPrecisionAtPort(EMB_TABLE_IDX);
-    if (any_of(inDataPrecision, ov::element::bf16, ov::element::f16)) {
-        inDataPrecision = ov::element::f32;
-    }
-    if (!supportedPrecisions.empty()) {
-        CPU_NODE_ASSERT(supportedPrecisions.find(inDataPrecision) != supportedPrecisions.end(),
-                        "has unsupported precision: ",
-                        inDataPrecision.get_type_name());
-    } else {
-        static const std::set<ov::element::Type> defaultSupportedPrecisions = {ov::element::f32,
-                                                                               ov::element::i8,
-                                                                               ov::element::u8,
-                                                                               ov::element::i32};
-        CPU_NODE_ASSERT(defaultSupportedPrecisions.find(inDataPrecision) != defaultSupportedPrecisions.end(),
-                        "has unsupported precision: ",
-                        inDataPrecision.get_type_name());
-    }
+    const auto inDataPrecision = initPrecisions(getOriginalInputPrecisionAtPort(EMB_TABLE_IDX));
 
     std::vector<PortConfigurator> inDataConfigurators(
-        {{LayoutType::ncsp, inDataPrecision}, {LayoutType::ncsp, ov::element::i32}});
+        {{LayoutType::ncsp, _tablePrecision}, {LayoutType::ncsp, ov::element::i32}});
     if (inputShapes.size() > PER_SAMPLE_WEIGHTS_IDX) {
         inDataConfigurators.emplace_back(LayoutType::ncsp, inDataPrecision);
     }
@@ -4,12 +4,12 @@
 
 #include "embedding_segments_sum.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
-#include <set>
 #include <string>
 #include <vector>
 
@@ -25,7 +25,6 @@
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/op/embedding_segments_sum.hpp"
 #include "shape_inference/shape_inference_cpu.hpp"
-#include "utils/general_utils.h"
 
 namespace ov::intel_cpu::node {
 
@@ -65,30 +64,9 @@ void EmbeddingSegmentsSum::initSupportedPrimitiveDescriptors() {
         return;
     }
 
-    static const std::set<ov::element::Type> supportedPrecisions = {ov::element::f32,
-                                                                    ov::element::i8,
-                                                                    ov::element::u8,
-                                                                    ov::element::i32};
+    const auto inDataPrecision = initPrecisions(getOriginalInputPrecisionAtPort(EMB_TABLE_IDX));
 
-    auto inDataPrecision = getOriginalInputPrecisionAtPort(EMB_TABLE_IDX);
-    if (any_of(inDataPrecision, ov::element::bf16, ov::element::f16)) {
-        inDataPrecision = ov::element::f32;
-    }
-    if (!supportedPrecisions.empty()) {
-        CPU_NODE_ASSERT(supportedPrecisions.find(inDataPrecision) != supportedPrecisions.end(),
-                        "has unsupported precision: ",
-                        inDataPrecision.get_type_name());
-    } else {
-        static const std::set<ov::element::Type> defaultSupportedPrecisions = {ov::element::f32,
-                                                                               ov::element::i8,
-                                                                               ov::element::u8,
-                                                                               ov::element::i32};
-        CPU_NODE_ASSERT(defaultSupportedPrecisions.find(inDataPrecision) != defaultSupportedPrecisions.end(),
-                        "has unsupported precision: ",
-                        inDataPrecision.get_type_name());
-    }
-
-    std::vector<PortConfigurator> inDataConfigurators({{LayoutType::ncsp, inDataPrecision},
+    std::vector<PortConfigurator> inDataConfigurators({{LayoutType::ncsp, _tablePrecision},
                                                        {LayoutType::ncsp, ov::element::i32},
                                                        {LayoutType::ncsp, ov::element::i32},
                                                        {LayoutType::ncsp, ov::element::i32}});
@@ -116,6 +94,21 @@ void EmbeddingSegmentsSum::initFromInputs() {
     if (getParentEdges().size() > DEFAULT_INDEX_IDX) {
         defaultIndices_ = getSrcDataAtPortAs<const int>(DEFAULT_INDEX_IDX);
     }
+
+    // a single pass over the segment ids instead of a scan per segment
+    const auto numSegments = static_cast<size_t>(std::max(lastNumSegments_, 0));
+    segmentBegins_.assign(numSegments, 0LU);
+    segmentSizes_.assign(numSegments, 0LU);
+    for (size_t si = 0; si < indicesSize_; si++) {
+        const auto segment = static_cast<size_t>(segmentIds_[si]);
+        if (segment >= numSegments) {
+            continue;
+        }
+        if (segmentSizes_[segment] == 0LU) {
+            segmentBegins_[segment] = si;
+        }
+        segmentSizes_[segment]++;
+    }
 }
 
 void EmbeddingSegmentsSum::getIndices(size_t embIndex,
@@ -126,19 +119,9 @@ void EmbeddingSegmentsSum::getIndices(size_t embIndex,
     CPU_NODE_ASSERT(embIndex < static_cast<size_t>(lastNumSegments_), "Invalid embedding bag index.");
 
     indices = nullptr;
-    size = 0;
+    size = segmentSizes_[embIndex];
     withWeight = true;
 
-    for (size_t si = 0; si < indicesSize_; si++) {
-        if (static_cast<size_t>(segmentIds_[si]) == embIndex) {
-            size++;
-            if (indices == nullptr) {
-                indices = indices_ + si;
-                weightsIdx = si;
-            }
-        }
-    }
-
     // Empty bag
     if (size == 0) {
         size = 1LU;
@@ -148,6 +131,9 @@ void EmbeddingSegmentsSum::getIndices(size_t embIndex,
         }
         return;
     }
+
+    indices = indices_ + segmentBegins_[embIndex];
+    weightsIdx = segmentBegins_[embIndex];
 }
 
 int32_t EmbeddingSegmentsSum::getNumSegments() const {
@@ -9,6 +9,7 @@
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
+#include <vector>
 
 #include "embedding_bag.h"
 #include "graph_context.h"
@@ -50,6 +51,10 @@ private:
     const int* defaultIndices_ = nullptr;
 
     size_t indicesSize_ = 0;
+
+    // the position of the first index and the number of the indices of every segment
+    std::vector<size_t> segmentBegins_;
+    std::vector<size_t> segmentSizes_;
 };
 
 }  // namespace ov::intel_cpu::node
@@ -0,0 +1,225 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "image_preprocess.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <oneapi/dnnl/dnnl_common.hpp>
+#include <string>
+#include <vector>
+
+#include "cpu_types.h"
+#include "graph_context.h"
+#include "memory_desc/cpu_memory_desc.h"
+#include "node.h"
+#include "nodes/kernels/image_preprocess_kernel.hpp"
+#include "onednn/iml_type_mapper.h"
+#include "openvino/core/except.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/type.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "shape_inference/shape_inference_cpu.hpp"
+#include "transformations/cpu_opset/common/op/image_preprocess.hpp"
+#include "utils/general_utils.h"
+
+namespace ov::intel_cpu::node {
+
+namespace {
+
+using Config = intel_cpu::ImagePreprocessNode::Config;
+
+// the source coordinate of an output coordinate as the Interpolate node maps it
+float source_coordinate(const Config& config, size_t out, size_t out_len, size_t in_len) {
+    using Mode = intel_cpu::ImagePreprocessNode::CoordinateTransformMode;
+    const auto scale = static_cast<float>(out_len) / static_cast<float>(in_len);
+    const auto x = static_cast<float>(out);
+    switch (config.coordinate_transformation_mode) {
+    case Mode::HALF_PIXEL:
+        return (x + 0.5F) / scale - 0.5F;
+    case Mode::PYTORCH_HALF_PIXEL:
+        return out_len > 1 ? (x + 0.5F) / scale - 0.5F : 0.F;
+    case Mode::ASYMMETRIC:
+        return x / scale;
+    case Mode::TF_HALF_PIXEL_FOR_NN:
+        return (x + 0.5F) / scale;
+    case Mode::ALIGN_CORNERS:
+        return out_len == 1 ? 0.F : x * static_cast<float>(in_len - 1) / static_cast<float>(out_len - 1);
+    }
+    return 0.F;
+}
+
+int64_t nearest_index(const Config& config, float x, bool downsample) {
+    using Mode = intel_cpu::ImagePreprocessNode::NearestMode;
+    switch (config.nearest_mode) {
+    case Mode::ROUND_PREFER_FLOOR:
+        return static_cast<int64_t>(x == std::floor(x) + 0.5F ? std::floor(x) : std::round(x));
+    case Mode::ROUND_PREFER_CEIL:
+        return static_cast<int64_t>(std::round(x));
+    case Mode::FLOOR:
+        return static_cast<int64_t>(std::floor(x));
+    case Mode::CEIL:
+        return static_cast<int64_t>(std::ceil(x));
+    case Mode::SIMPLE:
+        return downsample ? static_cast<int64_t>(std::ceil(x)) : static_cast<int64_t>(x);
+    }
+    return 0;
+}
+
+// the taps of out_len outputs along an axis of the source, cropped to [begin, begin + length)
+void build_taps(const Config& config, size_t begin, size_t length, size_t out_len, ImagePreprocessPlan::Taps& taps) {
+    for (size_t k = 0; k < 2; k++) {
+        taps.index[k].resize(out_len);
+        taps.weight[k].resize(out_len);
+    }
+    const auto last = static_cast<int64_t>(length) - 1;
+    const bool nearest = config.resize_mode == intel_cpu::ImagePreprocessNode::InterpolateMode::NEAREST;
+    for (size_t o = 0; o < out_len; o++) {
+        int64_t i0 = static_cast<int64_t>(o);
+        int64_t i1 = i0;
+        float w1 = 0.F;
+        if (config.resize && nearest) {
+            const auto x = source_coordinate(config, o, out_len, length);
+            i0 = i1 = std::clamp<int64_t>(nearest_index(config, x, out_len < length), 0, last);
+        } else if (config.resize) {
+            // the triangle filter of the linear mode is bilinear without antialiasing, the border is replicated
+            const auto x = std::clamp(source_coordinate(config, o, out_len, length), 0.F, static_cast<float>(last));
+            i0 = static_cast<int64_t>(std::floor(x));
+            i1 = std::min(i0 + 1, last);
+            w1 = i1 == i0 ? 0.F : x - static_cast<float>(i0);
+        }
+        taps.index[0][o] = static_cast<int32_t>(begin + i0);
+        taps.index[1][o] = static_cast<int32_t>(begin + i1);
+        taps.weight[0][o] = 1.F - w1;
+        taps.weight[1][o] = w1;
+    }
+}
+
+}  // namespace
+
+ImagePreprocess::ImagePreprocess(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context)
+    : Node(op, context, NgraphShapeInferFactory(op)) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        OPENVINO_THROW_NOT_IMPLEMENTED(errorMessage);
+    }
+
+    const auto node = ov::as_type_ptr<const intel_cpu::ImagePreprocessNode>(op);
+    m_config = node->get_config();
+    if (m_config.color_format == "NV12") {
+        m_plan.source = ImagePreprocessPlan::Source::NV12;
+    } else if (m_config.color_format == "I420") {
+        m_plan.source = ImagePreprocessPlan::Source::I420;
+    }
+    m_plan.planes = op->get_input_size();
+    m_plan.reverse_channels = m_config.reverse_channels;
+    m_plan.round_color = m_config.round_color;
+    m_plan.scale = m_config.scale;
+    m_plan.shift = m_config.shift;
+}
+
+bool ImagePreprocess::isSupportedOperation(const std::shared_ptr<const ov::Node>& op,
+                                           std::string& errorMessage) noexcept {
+    try {
+        const auto node = ov::as_type_ptr<const intel_cpu::ImagePreprocessNode>(op);
+        if (!node) {
+            errorMessage = "Only ImagePreprocessNode operation is supported";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+void ImagePreprocess::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty()) {
+        return;
+    }
+
+    // the kernel stores f32, bf16 or f16 directly, the other precisions fall back to f32
+    auto outputPrecision = getOriginalOutputPrecisionAtPort(0);
+    if (none_of(outputPrecision, ov::element::bf16, ov::element::f16)) {
+        outputPrecision = ov::element::f32;
+    }
+
+    std::vector<PortConfigurator> inPortConfigs;
+    for (size_t i = 0; i < getOriginalInputsNumber(); i++) {
+        inPortConfigs.emplace_back(LayoutType::ncsp, ov::element::u8, getInputShapeAtPort(i), false, -1);
+    }
+    std::vector<PortConfigurator> outPortConfigs;
+    outPortConfigs.emplace_back(LayoutType::ncsp, outputPrecision, getOutputShapeAtPort(0), false, -1);
+
+    addSupportedPrimDesc(inPortConfigs, outPortConfigs, impl_desc_type::ref_any);
+}
+
+void ImagePreprocess::prepareParams() {
+    const auto& srcDims = getSrcMemoryAtPort(0)->getStaticDims();
+    const auto& dstDims = getDstMemoryAtPort(0)->getStaticDims();
+    m_plan.batch = srcDims[0];
+    m_plan.height = srcDims[1];
+    m_plan.width = srcDims[2];
+    if (m_plan.source == ImagePreprocessPlan::Source::PACKED) {
+        m_plan.channels = srcDims[3];
+    } else {
+        if (m_plan.planes == 1) {
+            m_plan.height = srcDims[1] * 2 / 3;
+        }
+        CPU_NODE_ASSERT(m_plan.height % 2 == 0 && m_plan.width % 2 == 0,
+                        "expects even height and width of the YUV image, got ",
+                        m_plan.height,
+                        "x",
+                        m_plan.width);
+    }
+    m_plan.out_height = dstDims[2];
+    m_plan.out_width = dstDims[3];
+
+    const auto rows = intel_cpu::ImagePreprocessNode::crop_range(m_config, static_cast<int64_t>(m_plan.height), 0);
+    const auto columns = intel_cpu::ImagePreprocessNode::crop_range(m_config, static_cast<int64_t>(m_plan.width), 1);
+    CPU_NODE_ASSERT(rows.second > rows.first && columns.second > columns.first, "crops the whole image");
+    build_taps(m_config,
+               static_cast<size_t>(rows.first),
+               static_cast<size_t>(rows.second - rows.first),
+               m_plan.out_height,
+               m_plan.rows);
+    build_taps(m_config,
+               static_cast<size_t>(columns.first),
+               static_cast<size_t>(columns.second - columns.first),
+               m_plan.out_width,
+               m_plan.columns);
+
+    // every source column is read once per row, the column taps are remapped to the positions in the read columns
+    auto& sourceColumns = m_plan.source_columns;
+    sourceColumns = m_plan.columns.index[0];
+    sourceColumns.insert(sourceColumns.end(), m_plan.columns.index[1].begin(), m_plan.columns.index[1].end());
+    std::sort(sourceColumns.begin(), sourceColumns.end());
+    sourceColumns.erase(std::unique(sourceColumns.begin(), sourceColumns.end()), sourceColumns.end());
+    bool copyColumns = sourceColumns.size() == m_plan.out_width;
+    for (size_t o = 0; o < m_plan.out_width; o++) {
+        for (auto& index : m_plan.columns.index) {
+            index[o] = static_cast<int32_t>(std::lower_bound(sourceColumns.begin(), sourceColumns.end(), index[o]) -
+                                            sourceColumns.begin());
+        }
+        copyColumns = copyColumns && m_plan.columns.index[0][o] == static_cast<int32_t>(o) &&
+                      m_plan.columns.weight[1][o] == 0.F;
+    }
+    m_plan.copy_columns = copyColumns;
+}
+
+void ImagePreprocess::execute([[maybe_unused]] const dnnl::stream& strm) {
+    const uint8_t* planes[3] = {};
+    for (size_t i = 0; i < m_plan.planes; i++) {
+        planes[i] = getSrcDataAtPortAs<const uint8_t>(i);
+    }
+    ov::Extensions::Cpu::XARCH::image_preprocess_exec(m_plan,
+                                                      planes,
+                                                      getDstDataAtPort(0),
+                                                      getDstMemoryAtPort(0)->getPrecision(),
+                                                      context->getCpuParallel());
+}
+
+}  // namespace ov::intel_cpu::node
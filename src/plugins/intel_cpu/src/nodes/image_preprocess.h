@@ -0,0 +1,41 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <oneapi/dnnl/dnnl_common.hpp>
+#include <string>
+
+#include "cpu_types.h"
+#include "graph_context.h"
+#include "node.h"
+#include "nodes/kernels/image_preprocess_kernel.hpp"
+#include "openvino/core/node.hpp"
+#include "transformations/cpu_opset/common/op/image_preprocess.hpp"
+
+namespace ov::intel_cpu::node {
+
+class ImagePreprocess : public Node {
+public:
+    ImagePreprocess(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context);
+
+    void getSupportedDescriptors() override {}
+    bool created() const override {
+        return getType() == Type::ImagePreprocess;
+    }
+    void executeDynamicImpl(const dnnl::stream& strm) override {
+        execute(strm);
+    }
+    void initSupportedPrimitiveDescriptors() override;
+    void prepareParams() override;
+    void execute(const dnnl::stream& strm) override;
+    static bool isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept;
+
+private:
+    intel_cpu::ImagePreprocessNode::Config m_config;
+    ImagePreprocessPlan m_plan;
+};
+
+}  // namespace ov::intel_cpu::node
@@ -0,0 +1,208 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "embedding_bag_kernel.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "openvino/core/except.hpp"
+#include "openvino/core/type/bfloat16.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/core/type/float16.hpp"
+#include "scaled_attn/common.hpp"
+
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#    include <immintrin.h>
+#endif
+
+namespace ov::Extensions::Cpu::XARCH {
+
+namespace {
+
+// the number of indices the rows are prefetched ahead: enough to cover the memory latency with the short rows
+constexpr size_t prefetch_distance = 8;
+
+inline float nibble(const uint8_t* src, size_t i, bool is_signed) {
+    const uint8_t v = (src[i / 2] >> ((i % 2) * 4)) & 0x0F;
+    return is_signed ? static_cast<float>(static_cast<int>(v ^ 8) - 8) : static_cast<float>(v);
+}
+
+// dst[0:depth] += row[0:depth] * a
+template <typename T>
+void accumulate_row(const T* row, size_t depth, float a, float* dst) {
+    size_t i = 0;
+#if defined(HAVE_AVX512F)
+    const auto va = _mm512_set1_ps(a);
+    for (; i + vec_len_f32_avx512 <= depth; i += vec_len_f32_avx512) {
+        __m512 v;
+        if constexpr (std::is_same_v<T, uint8_t>) {
+            v = _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(row + i))));
+        } else if constexpr (std::is_same_v<T, int8_t>) {
+            v = _mm512_cvtepi32_ps(_mm512_cvtepi8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(row + i))));
+        } else {
+            v = mm512_uni_loadu_ps(row + i);
+        }
+        _mm512_storeu_ps(dst + i, _mm512_fmadd_ps(v, va, _mm512_loadu_ps(dst + i)));
+    }
+#elif defined(HAVE_AVX2)
+    const auto va = _mm256_set1_ps(a);
+    for (; i + vec_len_f32_avx2 <= depth; i += vec_len_f32_avx2) {
+        __m256 v;
+        if constexpr (std::is_same_v<T, uint8_t>) {
+            v = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(row + i))));
+        } else if constexpr (std::is_same_v<T, int8_t>) {
+            v = _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(row + i))));
+        } else {
+            v = mm256_uni_loadu_ps(row + i);
+        }
+        _mm256_storeu_ps(dst + i, _mm256_fmadd_ps(v, va, _mm256_loadu_ps(dst + i)));
+    }
+#endif
+    for (; i < depth; i++) {
+        dst[i] += static_cast<float>(row[i]) * a;
+    }
+}
+
+// the 4-bit rows hold two values per byte, the low nibble first
+void accumulate_row_4bit(const uint8_t* row, size_t depth, bool is_signed, float a, float* dst) {
+    size_t i = 0;
+#if defined(HAVE_AVX512F)
+    const auto va = _mm512_set1_ps(a);
+    const auto low_mask = _mm_set1_epi8(0x0F);
+    const auto sign = _mm512_set1_epi32(8);
+    for (; i + vec_len_f32_avx512 <= depth; i += vec_len_f32_avx512) {
+        const auto packed = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(row + i / 2));
+        const auto low = _mm_and_si128(packed, low_mask);
+        const auto high = _mm_and_si128(_mm_srli_epi16(packed, 4), low_mask);
+        auto q = _mm512_cvtepu8_epi32(_mm_unpacklo_epi8(low, high));
+        if (is_signed) {
+            q = _mm512_sub_epi32(_mm512_xor_si512(q, sign), sign);
+        }
+        _mm512_storeu_ps(dst + i, _mm512_fmadd_ps(_mm512_cvtepi32_ps(q), va, _mm512_loadu_ps(dst + i)));
+    }
+#elif defined(HAVE_AVX2)
+    const auto va = _mm256_set1_ps(a);
+    const auto low_mask = _mm_set1_epi8(0x0F);
+    const auto sign = _mm256_set1_epi32(8);
+    for (; i + vec_len_f32_avx2 <= depth; i += vec_len_f32_avx2) {
+        int32_t bytes = 0;
+        std::memcpy(&bytes, row + i / 2, sizeof(bytes));
+        const auto packed = _mm_cvtsi32_si128(bytes);
+        const auto low = _mm_and_si128(packed, low_mask);
+        const auto high = _mm_and_si128(_mm_srli_epi16(packed, 4), low_mask);
+        auto q = _mm256_cvtepu8_epi32(_mm_unpacklo_epi8(low, high));
+        if (is_signed) {
+            q = _mm256_sub_epi32(_mm256_xor_si256(q, sign), sign);
+        }
+        _mm256_storeu_ps(dst + i, _mm256_fmadd_ps(_mm256_cvtepi32_ps(q), va, _mm256_loadu_ps(dst + i)));
+    }
+#endif
+    for (; i < depth; i++) {
+        dst[i] += nibble(row, i, is_signed) * a;
+    }
+}
+
+template <typename T>
+void reduce(const uint8_t* table,
+            size_t row_bytes,
+            size_t depth,
+            const float* scales,
+            const float* zero_points,
+            const int32_t* indices,
+            size_t count,
+            const float* weights,
+            float* dst,
+            [[maybe_unused]] bool is_signed = false) {
+    // the zero points are applied to the whole row, so their contribution is accumulated as a scalar:
+    // (q - zp) * a = q * a - zp * a
+    float bias = 0.0F;
+    for (size_t k = 0; k < count; k++) {
+        if (k + prefetch_distance < count) {
+            prefetch_bytes(row_bytes,
+                           _MM_HINT_T0,
+                           0,
+                           table + static_cast<size_t>(indices[k + prefetch_distance]) * row_bytes);
+        }
+        const auto idx = static_cast<size_t>(indices[k]);
+        float a = weights ? weights[k] : 1.0F;
+        if (scales) {
+            a *= scales[idx];
+        }
+        if (zero_points) {
+            bias -= zero_points[idx] * a;
+        }
+        const auto* row = table + idx * row_bytes;
+        if constexpr (std::is_same_v<T, void>) {
+            accumulate_row_4bit(row, depth, is_signed, a, dst);
+        } else {
+            accumulate_row(reinterpret_cast<const T*>(row), depth, a, dst);
+        }
+    }
+    if (bias != 0.0F) {
+        for (size_t i = 0; i < depth; i++) {
+            dst[i] += bias;
+        }
+    }
+}
+
+}  // namespace
+
+void embedding_bag_reduce(const void* table,
+                          ov::element::Type table_precision,
+                          size_t depth,
+                          const float* scales,
+                          const float* zero_points,
+                          const int32_t* indices,
+                          size_t count,
+                          const float* weights,
+                          bool mean,
+                          float* dst) {
+    std::memset(dst, 0, depth * sizeof(float));
+    const auto* src = reinterpret_cast<const uint8_t*>(table);
+    const size_t row_bytes = depth * table_precision.bitwidth() / 8;
+    switch (table_precision) {
+    case ov::element::f32:
+        reduce<float>(src, row_bytes, depth, scales, zero_points, indices, count, weights, dst);
+        break;
+    case ov::element::bf16:
+        reduce<ov::bfloat16>(src, row_bytes, depth, scales, zero_points, indices, count, weights, dst);
+        break;
+    case ov::element::f16:
+        reduce<ov::float16>(src, row_bytes, depth, scales, zero_points, indices, count, weights, dst);
+        break;
+    case ov::element::u8:
+        reduce<uint8_t>(src, row_bytes, depth, scales, zero_points, indices, count, weights, dst);
+        break;
+    case ov::element::i8:
+        reduce<int8_t>(src, row_bytes, depth, scales, zero_points, indices, count, weights, dst);
+        break;
+    case ov::element::u4:
+    case ov::element::i4:
+        OPENVINO_ASSERT(depth % 2 == 0, "EmbeddingBag kernel expects the even rows of the 4-bit table");
+        reduce<void>(src,
+                     row_bytes,
+                     depth,
+                     scales,
+                     zero_points,
+                     indices,
+                     count,
+                     weights,
+                     dst,
+                     table_precision == ov::element::i4);
+        break;
+    default:
+        OPENVINO_THROW("EmbeddingBag kernel doesn't support the table precision ", table_precision);
+    }
+    if (mean && count > 0) {
+        const float scale = 1.0F / static_cast<float>(count);
+        for (size_t i = 0; i < depth; i++) {
+            dst[i] *= scale;
+        }
+    }
+}
+
+}  // namespace ov::Extensions::Cpu::XARCH
@@ -0,0 +1,32 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "openvino/core/type/element_type.hpp"
+
+namespace ov::Extensions::Cpu::XARCH {
+
+// Reduces the rows of an embedding table selected by the indices of one bag into dst[0:depth] in f32:
+//     dst = sum_k weights[k] * row(indices[k]), divided by count when mean is set
+// weights may be null (all ones), count may be 0 (dst is zeroed). The table may be f32/bf16/f16, or u8/i8/u4/i4
+// dequantized row-wise as (q - zero_points[row]) * scales[row]; scales and zero_points may be null. The rows of the
+// 4-bit tables are packed two values per byte, low nibble first, so depth must be even for them.
+// The rows of the next indices are prefetched while the current one is accumulated: the rows of the large tables are
+// scattered in memory and the reduction is bound by the memory latency otherwise.
+void embedding_bag_reduce(const void* table,
+                          ov::element::Type table_precision,
+                          size_t depth,
+                          const float* scales,
+                          const float* zero_points,
+                          const int32_t* indices,
+                          size_t count,
+                          const float* weights,
+                          bool mean,
+                          float* dst);
+
+}  // namespace ov::Extensions::Cpu::XARCH
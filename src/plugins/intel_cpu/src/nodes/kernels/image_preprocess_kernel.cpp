@@ -0,0 +1,351 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "image_preprocess_kernel.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "cpu_parallel.hpp"
+#include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/core/type/bfloat16.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/core/type/float16.hpp"
+#include "scaled_attn/common.hpp"
+
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#    include <immintrin.h>
+#endif
+
+namespace ov::Extensions::Cpu::XARCH {
+
+namespace {
+
+using ov::intel_cpu::ImagePreprocessPlan;
+
+// BT.601 limited range YUV to RGB of n pixels with the coefficients of the ColorConvert node. The rounding is to the
+// nearest even as in the JIT kernels of the node.
+void yuv_to_rgb(const float* y,
+                const float* u,
+                const float* v,
+                size_t n,
+                bool round,
+                float* r,
+                float* g,
+                float* b) {
+    size_t i = 0;
+#if defined(HAVE_AVX512F)
+    const auto v16 = _mm512_set1_ps(16.F);
+    const auto v128 = _mm512_set1_ps(128.F);
+    const auto v255 = _mm512_set1_ps(255.F);
+    const auto vzero = _mm512_setzero_ps();
+    const auto cy = _mm512_set1_ps(1.164F);
+    const auto crv = _mm512_set1_ps(1.596F);
+    const auto cgu = _mm512_set1_ps(0.391F);
+    const auto cgv = _mm512_set1_ps(0.813F);
+    const auto cbu = _mm512_set1_ps(2.018F);
+    auto clip_vec = [&](__m512 a) {
+        if (round) {
+            a = _mm512_roundscale_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        }
+        return _mm512_min_ps(_mm512_max_ps(a, vzero), v255);
+    };
+    for (; i + vec_len_f32_avx512 <= n; i += vec_len_f32_avx512) {
+        const auto c = _mm512_mul_ps(_mm512_sub_ps(_mm512_loadu_ps(y + i), v16), cy);
+        const auto d = _mm512_sub_ps(_mm512_loadu_ps(u + i), v128);
+        const auto e = _mm512_sub_ps(_mm512_loadu_ps(v + i), v128);
+        _mm512_storeu_ps(r + i, clip_vec(_mm512_add_ps(c, _mm512_mul_ps(crv, e))));
+        _mm512_storeu_ps(g + i, clip_vec(_mm512_sub_ps(_mm512_sub_ps(c, _mm512_mul_ps(cgu, d)), _mm512_mul_ps(cgv, e))));
+        _mm512_storeu_ps(b + i, clip_vec(_mm512_add_ps(c, _mm512_mul_ps(cbu, d))));
+    }
+#elif defined(HAVE_AVX2)
+    const auto v16 = _mm256_set1_ps(16.F);
+    const auto v128 = _mm256_set1_ps(128.F);
+    const auto v255 = _mm256_set1_ps(255.F);
+    const auto vzero = _mm256_setzero_ps();
+    const auto cy = _mm256_set1_ps(1.164F);
+    const auto crv = _mm256_set1_ps(1.596F);
+    const auto cgu = _mm256_set1_ps(0.391F);
+    const auto cgv = _mm256_set1_ps(0.813F);
+    const auto cbu = _mm256_set1_ps(2.018F);
+    auto clip_vec = [&](__m256 a) {
+        if (round) {
+            a = _mm256_round_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        }
+        return _mm256_min_ps(_mm256_max_ps(a, vzero), v255);
+    };
+    for (; i + vec_len_f32_avx2 <= n; i += vec_len_f32_avx2) {
+        const auto c = _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(y + i), v16), cy);
+        const auto d = _mm256_sub_ps(_mm256_loadu_ps(u + i), v128);
+        const auto e = _mm256_sub_ps(_mm256_loadu_ps(v + i), v128);
+        _mm256_storeu_ps(r + i, clip_vec(_mm256_add_ps(c, _mm256_mul_ps(crv, e))));
+        _mm256_storeu_ps(g + i, clip_vec(_mm256_sub_ps(_mm256_sub_ps(c, _mm256_mul_ps(cgu, d)), _mm256_mul_ps(cgv, e))));
+        _mm256_storeu_ps(b + i, clip_vec(_mm256_add_ps(c, _mm256_mul_ps(cbu, d))));
+    }
+#endif
+    auto clip = [&](float a) {
+        if (round) {
+            a = std::nearbyint(a);
+        }
+        return std::min(std::max(a, 0.F), 255.F);
+    };
+    for (; i < n; i++) {
+        const auto c = (y[i] - 16.F) * 1.164F;
+        const auto d = u[i] - 128.F;
+        const auto e = v[i] - 128.F;
+        r[i] = clip(c + 1.596F * e);
+        g[i] = clip(c - 0.391F * d - 0.813F * e);
+        b[i] = clip(c + 2.018F * d);
+    }
+}
+
+// dst[i] = src[index0[i]] * weight0[i] + src[index1[i]] * weight1[i]
+void resample(const float* src,
+              const int32_t* index0,
+              const int32_t* index1,
+              const float* weight0,
+              const float* weight1,
+              size_t n,
+              float* dst) {
+    size_t i = 0;
+#if defined(HAVE_AVX512F)
+    for (; i + vec_len_f32_avx512 <= n; i += vec_len_f32_avx512) {
+        const auto a = _mm512_i32gather_ps(_mm512_loadu_si512(index0 + i), src, sizeof(float));
+        const auto b = _mm512_i32gather_ps(_mm512_loadu_si512(index1 + i), src, sizeof(float));
+        _mm512_storeu_ps(
+            dst + i,
+            _mm512_add_ps(_mm512_mul_ps(a, _mm512_loadu_ps(weight0 + i)), _mm512_mul_ps(b, _mm512_loadu_ps(weight1 + i))));
+    }
+#elif defined(HAVE_AVX2)
+    for (; i + vec_len_f32_avx2 <= n; i += vec_len_f32_avx2) {
+        const auto a =
+            _mm256_i32gather_ps(src, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(index0 + i)), sizeof(float));
+        const auto b =
+            _mm256_i32gather_ps(src, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(index1 + i)), sizeof(float));
+        _mm256_storeu_ps(
+            dst + i,
+            _mm256_add_ps(_mm256_mul_ps(a, _mm256_loadu_ps(weight0 + i)), _mm256_mul_ps(b, _mm256_loadu_ps(weight1 + i))));
+    }
+#endif
+    for (; i < n; i++) {
+        dst[i] = src[index0[i]] * weight0[i] + src[index1[i]] * weight1[i];
+    }
+}
+
+// dst[i] = (a[i] * wa + b[i] * wb) * scale + shift, b is not read when wb is zero
+template <typename T>
+void blend_rows(const float* a, const float* b, float wa, float wb, float scale, float shift, size_t n, T* dst) {
+    if (wb == 0.F) {
+        b = a;
+    }
+    size_t i = 0;
+#if defined(HAVE_AVX512F)
+    const auto vwa = _mm512_set1_ps(wa);
+    const auto vwb = _mm512_set1_ps(wb);
+    const auto vscale = _mm512_set1_ps(scale);
+    const auto vshift = _mm512_set1_ps(shift);
+    for (; i + vec_len_f32_avx512 <= n; i += vec_len_f32_avx512) {
+        const auto v = _mm512_add_ps(_mm512_mul_ps(_mm512_loadu_ps(a + i), vwa), _mm512_mul_ps(_mm512_loadu_ps(b + i), vwb));
+        mm512_uni_storeu_ps(dst + i, _mm512_add_ps(_mm512_mul_ps(v, vscale), vshift));
+    }
+#elif defined(HAVE_AVX2)
+    const auto vwa = _mm256_set1_ps(wa);
+    const auto vwb = _mm256_set1_ps(wb);
+    const auto vscale = _mm256_set1_ps(scale);
+    const auto vshift = _mm256_set1_ps(shift);
+    for (; i + vec_len_f32_avx2 <= n; i += vec_len_f32_avx2) {
+        const auto v = _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(a + i), vwa), _mm256_mul_ps(_mm256_loadu_ps(b + i), vwb));
+        mm256_uni_storeu_ps(dst + i, _mm256_add_ps(_mm256_mul_ps(v, vscale), vshift));
+    }
+#endif
+    for (; i < n; i++) {
+        dst[i] = static_cast<T>((a[i] * wa + b[i] * wb) * scale + shift);
+    }
+}
+
+// Converts the source columns of the row sy of the image n to RGB (or takes the channels of the packed image) into
+// values[c][0:source_columns.size()]
+class RowReader {
+public:
+    RowReader(const ImagePreprocessPlan& plan, const uint8_t* const* planes) : m_plan(plan), m_planes(planes) {
+        if (plan.source != ImagePreprocessPlan::Source::PACKED) {
+            m_yuv.resize(3 * plan.source_columns.size());
+        }
+    }
+
+    void read(size_t n, size_t sy, float* const* values) {
+        const auto& columns = m_plan.source_columns;
+        const auto count = columns.size();
+        const auto h = m_plan.height;
+        const auto w = m_plan.width;
+        if (m_plan.source == ImagePreprocessPlan::Source::PACKED) {
+            const auto channels = m_plan.channels;
+            const auto* row = m_planes[0] + (n * h + sy) * w * channels;
+            for (size_t c = 0; c < channels; c++) {
+                const auto* src = row + (m_plan.reverse_channels ? channels - 1 - c : c);
+                auto* dst = values[c];
+                for (size_t k = 0; k < count; k++) {
+                    dst[k] = static_cast<float>(src[static_cast<size_t>(columns[k]) * channels]);
+                }
+            }
+            return;
+        }
+
+        const uint8_t* y_row = nullptr;
+        const uint8_t* u_row = nullptr;
+        const uint8_t* v_row = nullptr;
+        size_t uv_step = 1;
+        if (m_plan.source == ImagePreprocessPlan::Source::NV12) {
+            // the UV plane holds the interleaved U and V values of every 2x2 pixels
+            const uint8_t* uv_plane = nullptr;
+            if (m_plan.planes == 1) {
+                y_row = m_planes[0] + n * h * w * 3 / 2 + sy * w;
+                uv_plane = m_planes[0] + n * h * w * 3 / 2 + h * w;
+            } else {
+                y_row = m_planes[0] + n * h * w + sy * w;
+                uv_plane = m_planes[1] + n * h * w / 2;
+            }
+            u_row = uv_plane + (sy / 2) * w;
+            v_row = u_row + 1;
+            uv_step = 2;
+        } else {
+            if (m_plan.planes == 1) {
+                const auto* image = m_planes[0] + n * h * w * 3 / 2;
+                y_row = image + sy * w;
+                u_row = image + h * w + (sy / 2) * (w / 2);
+                v_row = image + h * w + h * w / 4 + (sy / 2) * (w / 2);
+            } else {
+                y_row = m_planes[0] + n * h * w + sy * w;
+                u_row = m_planes[1] + n * h * w / 4 + (sy / 2) * (w / 2);
+                v_row = m_planes[2] + n * h * w / 4 + (sy / 2) * (w / 2);
+            }
+        }
+
+        auto* y = m_yuv.data();
+        auto* u = y + count;
+        auto* v = u + count;
+        for (size_t k = 0; k < count; k++) {
+            const auto x = static_cast<size_t>(columns[k]);
+            y[k] = static_cast<float>(y_row[x]);
+            u[k] = static_cast<float>(u_row[(x / 2) * uv_step]);
+            v[k] = static_cast<float>(v_row[(x / 2) * uv_step]);
+        }
+        const bool reverse = m_plan.reverse_channels;
+        yuv_to_rgb(y, u, v, count, m_plan.round_color, values[reverse ? 2 : 0], values[1], values[reverse ? 0 : 2]);
+    }
+
+private:
+    const ImagePreprocessPlan& m_plan;
+    const uint8_t* const* m_planes;
+    std::vector<float> m_yuv;
+};
+
+template <typename T>
+void preprocess(const ImagePreprocessPlan& plan,
+                const uint8_t* const* planes,
+                T* dst,
+                const ov::intel_cpu::CpuParallelPtr& cpu_parallel) {
+    const auto channels = plan.channels;
+    const auto out_w = plan.out_width;
+    const auto out_h = plan.out_height;
+    const auto count = plan.source_columns.size();
+    const auto rows = plan.batch * out_h;
+    if (rows == 0 || out_w == 0) {
+        return;
+    }
+    // the rows of a thread are contiguous for the source rows to be reused by the next output rows
+    const auto chunks = std::min(rows, static_cast<size_t>(std::max(cpu_parallel->get_num_threads(), 1)));
+
+    cpu_parallel->parallel_for(chunks, [&](size_t chunk) {
+        size_t begin = 0;
+        size_t end = 0;
+        ov::splitter(rows, chunks, chunk, begin, end);
+
+        RowReader reader(plan, planes);
+        // two source rows resampled horizontally, along with the image and the row they hold
+        std::vector<float> cache(2 * channels * out_w);
+        std::vector<float> columns(plan.copy_columns ? 0 : channels * count);
+        size_t keys[2] = {std::numeric_limits<size_t>::max(), std::numeric_limits<size_t>::max()};
+        std::vector<float*> values(channels);
+
+        // returns the slot holding the row sy of the image n, the other slot is kept
+        auto fetch = [&](size_t n, size_t sy, int keep) -> int {
+            const auto key = n * plan.height + sy;
+            for (int s = 0; s < 2; s++) {
+                if (keys[s] == key) {
+                    return s;
+                }
+            }
+            const int slot = keep == 0 ? 1 : 0;
+            auto* row = cache.data() + slot * channels * out_w;
+            for (size_t c = 0; c < channels; c++) {
+                values[c] = plan.copy_columns ? row + c * out_w : columns.data() + c * count;
+            }
+            reader.read(n, sy, values.data());
+            if (!plan.copy_columns) {
+                for (size_t c = 0; c < channels; c++) {
+                    resample(values[c],
+                             plan.columns.index[0].data(),
+                             plan.columns.index[1].data(),
+                             plan.columns.weight[0].data(),
+                             plan.columns.weight[1].data(),
+                             out_w,
+                             row + c * out_w);
+                }
+            }
+            keys[slot] = key;
+            return slot;
+        };
+
+        for (size_t r = begin; r < end; r++) {
+            const auto n = r / out_h;
+            const auto oy = r % out_h;
+            const auto w0 = plan.rows.weight[0][oy];
+            const auto w1 = plan.rows.weight[1][oy];
+            const auto s0 = fetch(n, static_cast<size_t>(plan.rows.index[0][oy]), -1);
+            const auto s1 = w1 == 0.F ? s0 : fetch(n, static_cast<size_t>(plan.rows.index[1][oy]), s0);
+            const auto* row0 = cache.data() + s0 * channels * out_w;
+            const auto* row1 = cache.data() + s1 * channels * out_w;
+            for (size_t c = 0; c < channels; c++) {
+                blend_rows(row0 + c * out_w,
+                           row1 + c * out_w,
+                           w0,
+                           w1,
+                           plan.scale[c],
+                           plan.shift[c],
+                           out_w,
+                           dst + ((n * channels + c) * out_h + oy) * out_w);
+            }
+        }
+    });
+}
+
+}  // namespace
+
+void image_preprocess_exec(const ov::intel_cpu::ImagePreprocessPlan& plan,
+                           const uint8_t* const* planes,
+                           void* dst,
+                           ov::element::Type dst_precision,
+                           const ov::intel_cpu::CpuParallelPtr& cpu_parallel) {
+    switch (dst_precision) {
+    case ov::element::f32:
+        preprocess(plan, planes, static_cast<float*>(dst), cpu_parallel);
+        break;
+    case ov::element::bf16:
+        preprocess(plan, planes, static_cast<ov::bfloat16*>(dst), cpu_parallel);
+        break;
+    case ov::element::f16:
+        preprocess(plan, planes, static_cast<ov::float16*>(dst), cpu_parallel);
+        break;
+    default:
+        OPENVINO_THROW("ImagePreprocess doesn't support the output precision ", dst_precision);
+    }
+}
+
+}  // namespace ov::Extensions::Cpu::XARCH
@@ -0,0 +1,66 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "cpu_parallel.hpp"
+#include "openvino/core/type/element_type.hpp"
+
+namespace ov::intel_cpu {
+
+// The geometry and the arithmetic of the fused preprocessing of an u8 image into a planar [N, C, OH, OW] tensor
+// (see ImagePreprocessNode). Every output row and column is resampled from two taps of the source image: the taps
+// already include the crop offset, the second tap of the nearest resize and of the plain copy has zero weight.
+struct ImagePreprocessPlan {
+    enum class Source : uint8_t { PACKED, NV12, I420 };
+
+    struct Taps {
+        std::vector<int32_t> index[2];
+        std::vector<float> weight[2];
+    };
+
+    Source source = Source::PACKED;
+    // 1 for the packed and the single plane YUV images, 2 (Y, UV) for NV12 and 3 (Y, U, V) for I420 otherwise
+    size_t planes = 1;
+    size_t batch = 0;
+    // the source image, the YUV images are measured in the RGB pixels
+    size_t height = 0;
+    size_t width = 0;
+    // the channels of the packed image, 3 for the YUV images
+    size_t channels = 3;
+    // the output channel c is read from the source channel channels - 1 - c
+    bool reverse_channels = false;
+    // the YUV to RGB results are rounded as the u8 ColorConvert does
+    bool round_color = false;
+    size_t out_height = 0;
+    size_t out_width = 0;
+    // the row taps are source rows, the column taps are positions in the ordered list of the source columns read
+    Taps rows;
+    Taps columns;
+    std::vector<int32_t> source_columns;
+    // the column taps read the source columns one to one, the columns are not resampled
+    bool copy_columns = false;
+    // output channel c = value * scale[c] + shift[c]
+    std::vector<float> scale;
+    std::vector<float> shift;
+};
+
+}  // namespace ov::intel_cpu
+
+namespace ov::Extensions::Cpu::XARCH {
+
+// Preprocesses the planes of the source image into dst of f32, bf16 or f16 precision in one pass: the output rows are
+// split between the threads and every source row a thread reads is converted to RGB, resampled horizontally and kept
+// while the next output rows use it.
+void image_preprocess_exec(const ov::intel_cpu::ImagePreprocessPlan& plan,
+                           const uint8_t* const* planes,
+                           void* dst,
+                           ov::element::Type dst_precision,
+                           const ov::intel_cpu::CpuParallelPtr& cpu_parallel);
+
+}  // namespace ov::Extensions::Cpu::XARCH
@@ -0,0 +1,287 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "kquant_matmul.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "cpu_parallel.hpp"
+#include "nodes/kernels/simd/simd.hpp"
+#include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/core/type/float16.hpp"
+#include "openvino/op/kquant_matmul.hpp"
+
+namespace ov::Extensions::Cpu::XARCH {
+
+namespace {
+
+using QuantType = ov::op::internal::KQuantMatMul::QuantType;
+
+constexpr size_t kBlock = 256;
+constexpr size_t kSub = 16;
+constexpr size_t kSubBlocks = kBlock / kSub;
+// Activation rows kept in vector accumulators at once.
+constexpr size_t kRowsInRegs = 4;
+// Activation rows sharing one dequantized weight tile when M is large.
+constexpr size_t kRowsPerTile = 32;
+
+// One super-block unpacked into unsigned quants and per-16 affine parameters. Every K-quant type
+// then dequantizes as w[i] = scale[i / 16] * q[i] - min[i / 16], which is a single FMA per lane.
+struct UnpackedBlock {
+    alignas(64) uint8_t q[kBlock];
+    float scale[kSubBlocks];
+    float neg_min[kSubBlocks];
+};
+
+inline float load_f16(const uint8_t* p) {
+    uint16_t bits;
+    std::memcpy(&bits, p, sizeof(bits));
+    return static_cast<float>(ov::float16::from_bits(bits));
+}
+
+inline void get_scale_min_k4(size_t j, const uint8_t* q, uint8_t& d, uint8_t& m) {
+    if (j < 4) {
+        d = q[j] & 63;
+        m = q[j + 4] & 63;
+    } else {
+        d = (q[j + 4] & 0xF) | ((q[j - 4] >> 6) << 4);
+        m = (q[j + 4] >> 4) | ((q[j] >> 6) << 4);
+    }
+}
+
+// Q4_K and Q5_K share the 6-bit scale/min packing over 8 sub-blocks of 32 weights.
+inline void unpack_k4_scales(const uint8_t* blk, UnpackedBlock& u) {
+    const float d = load_f16(blk);
+    const float dmin = load_f16(blk + 2);
+    for (size_t j = 0; j < 8; ++j) {
+        uint8_t sc, m;
+        get_scale_min_k4(j, blk + 4, sc, m);
+        u.scale[2 * j] = u.scale[2 * j + 1] = d * sc;
+        u.neg_min[2 * j] = u.neg_min[2 * j + 1] = -dmin * m;
+    }
+}
+
+template <QuantType QT>
+struct KQuant;
+
+template <>
+struct KQuant<QuantType::Q4_K> {
+    static constexpr size_t block_bytes = 144;
+    static void unpack(const uint8_t* blk, UnpackedBlock& u) {
+        unpack_k4_scales(blk, u);
+        const uint8_t* qs = blk + 16;
+        for (size_t j = 0; j < 4; ++j) {
+            for (size_t l = 0; l < 32; ++l) {
+                u.q[64 * j + l] = qs[32 * j + l] & 0xF;
+                u.q[64 * j + 32 + l] = qs[32 * j + l] >> 4;
+            }
+        }
+    }
+};
+
+template <>
+struct KQuant<QuantType::Q5_K> {
+    static constexpr size_t block_bytes = 176;
+    static void unpack(const uint8_t* blk, UnpackedBlock& u) {
+        unpack_k4_scales(blk, u);
+        const uint8_t* qh = blk + 16;
+        const uint8_t* ql = blk + 48;
+        for (size_t j = 0; j < 4; ++j) {
+            for (size_t l = 0; l < 32; ++l) {
+                const uint8_t h = qh[l] >> (2 * j);
+                u.q[64 * j + l] = (ql[32 * j + l] & 0xF) | ((h & 1) << 4);
+                u.q[64 * j + 32 + l] = (ql[32 * j + l] >> 4) | ((h & 2) << 3);
+            }
+        }
+    }
+};
+
+template <>
+struct KQuant<QuantType::Q6_K> {
+    static constexpr size_t block_bytes = 210;
+    static void unpack(const uint8_t* blk, UnpackedBlock& u) {
+        const float d = load_f16(blk + 208);
+        const auto* sc = reinterpret_cast<const int8_t*>(blk + 192);
+        for (size_t s = 0; s < kSubBlocks; ++s) {
+            // d * sc * (q - 32) with q stored unsigned
+            u.scale[s] = d * sc[s];
+            u.neg_min[s] = -32.0F * u.scale[s];
+        }
+        for (size_t n = 0; n < 2; ++n) {
+            const uint8_t* ql = blk + 64 * n;
+            const uint8_t* qh = blk + 128 + 32 * n;
+            uint8_t* q = u.q + 128 * n;
+            for (size_t l = 0; l < 32; ++l) {
+                q[l] = (ql[l] & 0xF) | (((qh[l] >> 0) & 3) << 4);
+                q[l + 32] = (ql[l + 32] & 0xF) | (((qh[l] >> 2) & 3) << 4);
+                q[l + 64] = (ql[l] >> 4) | (((qh[l] >> 4) & 3) << 4);
+                q[l + 96] = (ql[l + 32] >> 4) | (((qh[l] >> 6) & 3) << 4);
+            }
+        }
+    }
+};
+
+// Decode-shaped path: the weight row is dequantized in registers and immediately consumed by up to
+// kRowsInRegs activation rows, so the row is read from memory exactly once per call.
+template <QuantType QT, size_t MR>
+void gemv_row(const float* src, size_t K, const uint8_t* wrow, float* dst, size_t N) {
+    constexpr size_t W = simd::f32::width;
+    simd::f32 acc[MR];
+    for (size_t r = 0; r < MR; ++r) {
+        acc[r] = simd::f32(0.0F);
+    }
+    UnpackedBlock u;
+    for (size_t b = 0; b < K / kBlock; ++b) {
+        KQuant<QT>::unpack(wrow + b * KQuant<QT>::block_bytes, u);
+        const float* x = src + b * kBlock;
+        for (size_t s = 0; s < kSubBlocks; ++s) {
+            const simd::f32 scale(u.scale[s]);
+            const simd::f32 neg_min(u.neg_min[s]);
+            for (size_t j = s * kSub; j < (s + 1) * kSub; j += W) {
+                const auto w = fmadd(scale, simd::load<simd::f32>(u.q + j), neg_min);
+                for (size_t r = 0; r < MR; ++r) {
+                    acc[r] = fmadd(w, simd::load<simd::f32>(x + r * K + j), acc[r]);
+                }
+            }
+        }
+    }
+    for (size_t r = 0; r < MR; ++r) {
+        dst[r * N] = reduce(acc[r]);
+    }
+}
+
+template <QuantType QT>
+void dequantize_row(const uint8_t* wrow, size_t K, float* out) {
+    constexpr size_t W = simd::f32::width;
+    UnpackedBlock u;
+    for (size_t b = 0; b < K / kBlock; ++b, out += kBlock) {
+        KQuant<QT>::unpack(wrow + b * KQuant<QT>::block_bytes, u);
+        for (size_t s = 0; s < kSubBlocks; ++s) {
+            const simd::f32 scale(u.scale[s]);
+            const simd::f32 neg_min(u.neg_min[s]);
+            for (size_t j = s * kSub; j < (s + 1) * kSub; j += W) {
+                store(fmadd(scale, simd::load<simd::f32>(u.q + j), neg_min), out + j);
+            }
+        }
+    }
+}
+
+template <size_t MR>
+void dot_rows(const float* src, size_t K, const float* w, float* dst, size_t N) {
+    constexpr size_t W = simd::f32::width;
+    simd::f32 acc[MR];
+    for (size_t r = 0; r < MR; ++r) {
+        acc[r] = simd::f32(0.0F);
+    }
+    for (size_t k = 0; k < K; k += W) {
+        const auto wv = simd::load<simd::f32>(w + k);
+        for (size_t r = 0; r < MR; ++r) {
+            acc[r] = fmadd(wv, simd::load<simd::f32>(src + r * K + k), acc[r]);
+        }
+    }
+    for (size_t r = 0; r < MR; ++r) {
+        dst[r * N] = reduce(acc[r]);
+    }
+}
+
+// Dispatches a runtime row count in [1, kRowsInRegs] to the matching MR instantiation.
+template <typename F>
+void with_rows(size_t rows, const F& f) {
+    switch (rows) {
+    case 1:
+        f(std::integral_constant<size_t, 1>{});
+        break;
+    case 2:
+        f(std::integral_constant<size_t, 2>{});
+        break;
+    case 3:
+        f(std::integral_constant<size_t, 3>{});
+        break;
+    default:
+        f(std::integral_constant<size_t, kRowsInRegs>{});
+        break;
+    }
+}
+
+template <QuantType QT>
+void kquant_matmul_impl(const float* src,
+                        const uint8_t* weights,
+                        float* dst,
+                        size_t M,
+                        size_t N,
+                        size_t K,
+                        float* scratch,
+                        size_t scratch_stride,
+                        const ov::intel_cpu::CpuParallelPtr& cpu_parallel) {
+    const size_t row_bytes = K / kBlock * KQuant<QT>::block_bytes;
+    const size_t n_tasks = (N + kquant_rows_per_task - 1) / kquant_rows_per_task;
+
+    if (M <= kRowsInRegs) {
+        cpu_parallel->parallel_for(n_tasks, [&](size_t task) {
+            const size_t n_end = std::min(N, (task + 1) * kquant_rows_per_task);
+            for (size_t n = task * kquant_rows_per_task; n < n_end; ++n) {
+                with_rows(M, [&](auto mr) {
+                    gemv_row<QT, decltype(mr)::value>(src, K, weights + n * row_bytes, dst + n, N);
+                });
+            }
+        });
+        return;
+    }
+
+    // Prefill-shaped path: dequantize a tile of weight rows once into the worker's scratch and reuse
+    // it for kRowsPerTile activation rows, which keeps both tiles cache resident.
+    const size_t m_tiles = (M + kRowsPerTile - 1) / kRowsPerTile;
+    cpu_parallel->parallel_for2d(m_tiles, n_tasks, [&](size_t m_tile, size_t task) {
+        float* w = scratch + static_cast<size_t>(parallel_get_thread_num()) * scratch_stride;
+        const size_t n_begin = task * kquant_rows_per_task;
+        const size_t n_end = std::min(N, n_begin + kquant_rows_per_task);
+        for (size_t n = n_begin; n < n_end; ++n) {
+            dequantize_row<QT>(weights + n * row_bytes, K, w + (n - n_begin) * K);
+        }
+        const size_t m_end = std::min(M, (m_tile + 1) * kRowsPerTile);
+        for (size_t m = m_tile * kRowsPerTile; m < m_end; m += kRowsInRegs) {
+            const size_t rows = std::min(kRowsInRegs, m_end - m);
+            for (size_t n = n_begin; n < n_end; ++n) {
+                with_rows(rows, [&](auto mr) {
+                    dot_rows<decltype(mr)::value>(src + m * K, K, w + (n - n_begin) * K, dst + m * N + n, N);
+                });
+            }
+        }
+    });
+}
+
+}  // namespace
+
+void kquant_matmul(const float* src,
+                   const uint8_t* weights,
+                   float* dst,
+                   size_t M,
+                   size_t N,
+                   size_t K,
+                   ov::op::internal::KQuantMatMul::QuantType quant_type,
+                   float* scratch,
+                   size_t scratch_stride,
+                   const ov::intel_cpu::CpuParallelPtr& cpu_parallel) {
+    OPENVINO_ASSERT(K % kBlock == 0, "KQuantMatMul: K must be a multiple of ", kBlock, ", got ", K);
+    switch (quant_type) {
+    case QuantType::Q4_K:
+        kquant_matmul_impl<QuantType::Q4_K>(src, weights, dst, M, N, K, scratch, scratch_stride, cpu_parallel);
+        break;
+    case QuantType::Q5_K:
+        kquant_matmul_impl<QuantType::Q5_K>(src, weights, dst, M, N, K, scratch, scratch_stride, cpu_parallel);
+        break;
+    case QuantType::Q6_K:
+        kquant_matmul_impl<QuantType::Q6_K>(src, weights, dst, M, N, K, scratch, scratch_stride, cpu_parallel);
+        break;
+    default:
+        OPENVINO_THROW("KQuantMatMul: unsupported quant type");
+    }
+}
+
+}  // namespace ov::Extensions::Cpu::XARCH
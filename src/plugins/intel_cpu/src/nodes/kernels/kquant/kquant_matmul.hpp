@@ -0,0 +1,35 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "cpu_parallel.hpp"
+#include "openvino/op/kquant_matmul.hpp"
+
+namespace ov::Extensions::Cpu::XARCH {
+
+// Number of weight rows a worker dequantizes at once; `scratch` must hold
+// kquant_rows_per_task * K floats per worker thread.
+constexpr size_t kquant_rows_per_task = 8;
+
+// dst[M, N] = src[M, K] * dequantize(weights[N, K])^T, where every weight row is a sequence of
+// K / 256 GGML K-quant super-blocks. Weights are dequantized in registers and never materialized,
+// except for a per-thread f32 copy of kquant_rows_per_task weight rows when M is large enough to
+// amortize it. `scratch` holds `scratch_stride` floats per worker thread.
+// Registered with `cross_compiled_file`, so the AVX512F/AVX2/ANY copy is picked at runtime.
+void kquant_matmul(const float* src,
+                   const uint8_t* weights,
+                   float* dst,
+                   size_t M,
+                   size_t N,
+                   size_t K,
+                   ov::op::internal::KQuantMatMul::QuantType quant_type,
+                   float* scratch,
+                   size_t scratch_stride,
+                   const ov::intel_cpu::CpuParallelPtr& cpu_parallel);
+
+}  // namespace ov::Extensions::Cpu::XARCH
@@ -0,0 +1,102 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "kquant_matmul.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <oneapi/dnnl/dnnl_common.hpp>
+#include <string>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "cpu_shape.h"
+#include "graph_context.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "node.h"
+#include "nodes/kernels/kquant/kquant_matmul.hpp"
+#include "onednn/iml_type_mapper.h"
+#include "openvino/core/except.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/type.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/op/kquant_matmul.hpp"
+#include "shape_inference/shape_inference_cpu.hpp"
+
+namespace ov::intel_cpu::node {
+
+KQuantMatMul::KQuantMatMul(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context)
+    : Node(op, context, NgraphShapeInferFactory(op)) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        OPENVINO_THROW_NOT_IMPLEMENTED(errorMessage);
+    }
+    const auto kquant = ov::as_type_ptr<const ov::op::internal::KQuantMatMul>(op);
+    m_quantType = kquant->get_quant_type();
+}
+
+bool KQuantMatMul::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept {
+    if (op == nullptr || !ov::is_type<ov::op::internal::KQuantMatMul>(op)) {
+        errorMessage = "Node is not an instance of ov::op::internal::KQuantMatMul.";
+        return false;
+    }
+    // the scratch tile is sized from the weights, so their shape must be known at compile time
+    if (op->get_input_partial_shape(1).is_dynamic()) {
+        errorMessage = "KQuantMatMul supports only static weights shape.";
+        return false;
+    }
+    return true;
+}
+
+void KQuantMatMul::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty()) {
+        return;
+    }
+
+    // The kernel accumulates in f32, so activations and output are declared f32 and lower precision
+    // inputs are converted by the graph. Weights are consumed as raw super-block bytes.
+    std::vector<PortConfigurator> input_configs = {
+        PortConfigurator{LayoutType::ncsp, ov::element::f32, getInputShapeAtPort(0), false, -1},
+        PortConfigurator{LayoutType::ncsp, ov::element::u8, getInputShapeAtPort(1), false, -1}};
+    std::vector<PortConfigurator> output_configs = {
+        PortConfigurator{LayoutType::ncsp, ov::element::f32, getOutputShapeAtPort(0), false, -1}};
+
+    addSupportedPrimDesc(input_configs, output_configs, impl_desc_type::ref_any);
+}
+
+void KQuantMatMul::createPrimitive() {
+    const auto& weights_dims = getInputShapeAtPort(1).getStaticDims();
+    const size_t block_bytes = ov::op::internal::KQuantMatMul::get_block_bytes(m_quantType);
+    m_K = weights_dims[1] / block_bytes * 256;
+    const auto num_threads = static_cast<size_t>(context->getCpuParallel()->get_num_worker_threads());
+    auto mem_desc = std::make_shared<CpuBlockedMemoryDesc>(
+        ov::element::f32,
+        ov::intel_cpu::Shape{num_threads, ov::Extensions::Cpu::XARCH::kquant_rows_per_task * m_K});
+    m_weightsTile = context->getScratchPad()->createScratchPadMem(mem_desc);
+}
+
+void KQuantMatMul::execute([[maybe_unused]] const dnnl::stream& strm) {
+    const auto& src_dims = getSrcMemoryAtPort(0)->getStaticDims();
+    const auto& weights_dims = getSrcMemoryAtPort(1)->getStaticDims();
+    CPU_NODE_ASSERT(!src_dims.empty() && src_dims.back() == m_K,
+                    "activations reduction size does not match weights, expected ",
+                    m_K);
+
+    const size_t N = weights_dims[0];
+    const size_t M = getSrcMemoryAtPort(0)->getShape().getElementsCount() / m_K;
+
+    ov::Extensions::Cpu::XARCH::kquant_matmul(getSrcDataAtPortAs<const float>(0),
+                                              getSrcDataAtPortAs<const uint8_t>(1),
+                                              getDstDataAtPortAs<float>(0),
+                                              M,
+                                              N,
+                                              m_K,
+                                              m_quantType,
+                                              m_weightsTile->getDataAs<float>(),
+                                              ov::Extensions::Cpu::XARCH::kquant_rows_per_task * m_K,
+                                              context->getCpuParallel());
+}
+
+}  // namespace ov::intel_cpu::node
@@ -0,0 +1,51 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <oneapi/dnnl/dnnl_common.hpp>
+#include <string>
+
+#include "cpu_memory.h"
+#include "cpu_types.h"
+#include "graph_context.h"
+#include "node.h"
+#include "openvino/core/node.hpp"
+#include "openvino/op/kquant_matmul.hpp"
+
+namespace ov::intel_cpu::node {
+
+class KQuantMatMul : public Node {
+public:
+    KQuantMatMul(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context);
+
+    static bool isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept;
+
+    void getSupportedDescriptors() override {}
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(const dnnl::stream& strm) override;
+    void executeDynamicImpl(const dnnl::stream& strm) override {
+        execute(strm);
+    }
+
+    bool created() const override {
+        return getType() == Type::KQuantMatMul;
+    }
+
+    bool needPrepareParams() const override {
+        return false;
+    }
+
+private:
+    ov::op::internal::KQuantMatMul::QuantType m_quantType;
+    size_t m_K = 0;
+    // Per-worker-thread f32 tile of dequantized weight rows used by the prefill-shaped path.
+    // Allocated once via the plugin scratchpad, the weights themselves stay packed.
+    MemoryPtr m_weightsTile;
+};
+
+}  // namespace ov::intel_cpu::node
@@ -2150,6 +2150,9 @@ void ScaledDotProductAttention::execute(const dnnl::stream& strm) {
     PlainTensor v_scale_zp;
     if (m_config.config.fuse_concat) {
         CPU_NODE_ASSERT(m_k_state && m_v_state, "has null input states");
+        // the buffers shared with a snapshot or a forked state are copied before they are written
+        m_k_state->make_exclusive();
+        m_v_state->make_exclusive();
         // initialization will be also completed in this func
         gatherConcatPastkv(inputs[1], inputs[2], getSrcMemoryAtPort(orginSDPInputNumber));
 
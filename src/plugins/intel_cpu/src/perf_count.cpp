@@ -0,0 +1,80 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "perf_count.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "utils/perf_events.hpp"
+
+namespace ov::intel_cpu {
+
+size_t LatencyHistogram::bucket(uint64_t ns) {
+    constexpr uint64_t subBuckets = 1 << subBucketsLog2;
+    if (ns < subBuckets * 2) {
+        return static_cast<size_t>(ns);
+    }
+    size_t log2 = 0;
+    for (uint64_t value = ns; value > 1; value >>= 1) {
+        log2++;
+    }
+    // the leading bit selects the power of two, the next subBucketsLog2 bits select the sub-bucket
+    const auto sub = static_cast<size_t>((ns >> (log2 - subBucketsLog2)) & (subBuckets - 1));
+    return ((log2 - subBucketsLog2 + 1) << subBucketsLog2) + sub;
+}
+
+uint64_t LatencyHistogram::upperBound(size_t bucket) {
+    constexpr size_t subBuckets = 1 << subBucketsLog2;
+    if (bucket < subBuckets * 2) {
+        return bucket;
+    }
+    const size_t shift = (bucket >> subBucketsLog2) - 1;
+    const uint64_t lower = static_cast<uint64_t>(subBuckets + (bucket & (subBuckets - 1))) << shift;
+    return lower + ((uint64_t{1} << shift) - 1);
+}
+
+void LatencyHistogram::add(uint64_t ns) {
+    m_buckets[bucket(ns)]++;
+    m_count++;
+    m_total += ns;
+    m_min = std::min(m_min, ns);
+    m_max = std::max(m_max, ns);
+}
+
+uint64_t LatencyHistogram::percentile(double fraction) const {
+    if (m_count == 0) {
+        return 0;
+    }
+    const auto rank = std::max<uint64_t>(
+        1,
+        static_cast<uint64_t>(std::ceil(std::clamp(fraction, 0.0, 1.0) * static_cast<double>(m_count))));
+    uint64_t seen = 0;
+    for (size_t i = 0; i < numBuckets; i++) {
+        seen += m_buckets[i];
+        if (seen >= rank) {
+            return std::clamp(upperBound(i), m_min, m_max);
+        }
+    }
+    return m_max;
+}
+
+void PerfCount::finish_extended() {
+    const auto ns = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(_finish - _start).count());
+    _extended->latency.add(ns);
+    if (_extended->hwStarted) {
+        HwCounters finish;
+        if (PerfEvents::read(finish)) {
+            _extended->hwTotal += finish.since(_extended->hwStart);
+            _extended->hwSamples++;
+            _extended->hwDurationNs += ns;
+        }
+        _extended->hwStarted = false;
+    }
+}
+
+}  // namespace ov::intel_cpu
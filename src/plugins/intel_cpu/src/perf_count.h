@@ -4,22 +4,93 @@
 
 #pragma once
 
+#include <array>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
+#include <limits>
+#include <memory>
 #include <ratio>
 
+#include "utils/perf_events.hpp"
+
 namespace ov::intel_cpu {
 
+/**
+ * @brief Histogram of the latencies in nanoseconds with the logarithmic buckets: every power of two is split into 4
+ * sub-buckets, so a percentile is reported with the relative error below 25% over the whole uint64_t range.
+ */
+class LatencyHistogram {
+public:
+    static constexpr size_t subBucketsLog2 = 2;
+    static constexpr size_t numBuckets = 64 << subBucketsLog2;
+
+    void add(uint64_t ns);
+
+    // the upper bound of the bucket holding the \p fraction of the samples, clamped to the observed min and max
+    [[nodiscard]] uint64_t percentile(double fraction) const;
+
+    [[nodiscard]] uint64_t count() const {
+        return m_count;
+    }
+    [[nodiscard]] uint64_t min() const {
+        return m_count ? m_min : 0;
+    }
+    [[nodiscard]] uint64_t max() const {
+        return m_max;
+    }
+    [[nodiscard]] uint64_t total() const {
+        return m_total;
+    }
+
+    static size_t bucket(uint64_t ns);
+    static uint64_t upperBound(size_t bucket);
+
+private:
+    std::array<uint64_t, numBuckets> m_buckets{};
+    uint64_t m_count = 0;
+    uint64_t m_total = 0;
+    uint64_t m_min = std::numeric_limits<uint64_t>::max();
+    uint64_t m_max = 0;
+};
+
 class PerfCount {
+public:
+    // the state of the extended profiling (see cpu_extended_profiling), allocated only when it is enabled
+    struct Extended {
+        LatencyHistogram latency;
+        bool hwCountersEnabled = false;
+        bool hwStarted = false;
+        HwCounters hwStart;
+        HwCounters hwTotal;
+        // the executions with the counters read successfully at both ends
+        uint64_t hwSamples = 0;
+        uint64_t hwDurationNs = 0;
+    };
+
+private:
     uint64_t total_duration = 0;
     uint32_t num = 0;
 
     std::chrono::high_resolution_clock::time_point _start;
     std::chrono::high_resolution_clock::time_point _finish;
 
+    std::unique_ptr<Extended> _extended;
+
 public:
     PerfCount() = default;
 
+    void enableExtended(bool hwCounters) {
+        if (!_extended) {
+            _extended = std::make_unique<Extended>();
+        }
+        _extended->hwCountersEnabled = hwCounters;
+    }
+
+    [[nodiscard]] const Extended* extended() const {
+        return _extended.get();
+    }
+
     [[nodiscard]] std::chrono::duration<double, std::milli> duration() const {
         return _finish - _start;
     }
@@ -41,6 +112,10 @@ public:
 
 private:
     void start_itr() {
+        if (_extended && _extended->hwCountersEnabled) {
+            // read before the timer is started, so the latency does not include the system calls
+            _extended->hwStarted = PerfEvents::read(_extended->hwStart);
+        }
         _start = std::chrono::high_resolution_clock::now();
     }
 
@@ -48,8 +123,13 @@ private:
         _finish = std::chrono::high_resolution_clock::now();
         total_duration += std::chrono::duration_cast<std::chrono::microseconds>(_finish - _start).count();
         num++;
+        if (_extended) {
+            finish_extended();
+        }
     }
 
+    void finish_extended();
+
     friend class PerfHelper;
 };
 
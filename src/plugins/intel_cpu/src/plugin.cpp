@@ -26,6 +26,7 @@
 #    pragma warning(disable : 4244 4267 4334)
 #endif
 
+#include "cache/hot_shapes.h"
 #include "compiled_model.h"
 #include "config.h"
 #include "cpu_streams_calculation.hpp"
@@ -45,6 +46,7 @@
 #include "openvino/op/scaled_dot_product_attention.hpp"
 #include "openvino/runtime/aligned_buffer.hpp"
 #include "openvino/runtime/common.hpp"
+#include "openvino/runtime/compilation_context.hpp"
 #include "openvino/runtime/icompiled_model.hpp"
 #include "openvino/runtime/intel_cpu/properties.hpp"
 #include "openvino/runtime/internal_properties.hpp"
@@ -429,7 +431,13 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
         }
     }
 #endif
-    return std::make_shared<CompiledModel>(cloned_model, shared_from_this(), conf, false);
+    auto compiled_model = std::make_shared<CompiledModel>(cloned_model, shared_from_this(), conf, false);
+    if (compiled_model->hot_shapes_enabled() && !conf.cacheDir.empty()) {
+        // the same model compiled with the same config saves its hot shapes to the same file, so the file of a model
+        // compiled again is overwritten instead of piling up in the cache directory
+        compiled_model->set_hot_shapes_id(ModelCache::compute_hash(model, orig_config));
+    }
+    return compiled_model;
 }
 
 void Plugin::set_property(const ov::AnyMap& config) {
@@ -552,6 +560,10 @@ ov::Any Plugin::get_property(const std::string& name, const ov::AnyMap& options)
         return decltype(ov::weights_path)::value_type(std::string(""));
     }
 
+    if (name == ov::cache_dir) {
+        return decltype(ov::cache_dir)::value_type{engConfig.cacheDir};
+    }
+
     if (name == ov::enable_weightless) {
         return decltype(ov::enable_weightless)::value_type{engConfig.enableWeightless};
     }
@@ -609,7 +621,8 @@ ov::Any Plugin::get_ro_property(const std::string& name, [[maybe_unused]] const
                                                    RW_property(ov::value_cache_precision.name()),
                                                    RW_property(ov::key_cache_group_size.name()),
                                                    RW_property(ov::value_cache_group_size.name()),
-                                                   RW_property(ov::enable_weightless.name())};
+                                                   RW_property(ov::enable_weightless.name()),
+                                                   RW_property(ov::cache_dir.name())};
 
         std::vector<ov::PropertyName> wo_properties{WO_property(ov::weights_path.name())};
 
@@ -886,6 +899,19 @@ std::shared_ptr<ov::ICompiledModel> Plugin::deserialize_model(ModelDeserializer&
     std::shared_ptr<ov::Model> model;
     deserializer >> model;
 
+    // the hot shapes are a property of the exported compiled model, not of the model itself
+    std::vector<HotShapes::Record> hot_shapes;
+    auto& rt_info = model->get_rt_info();
+    if (auto it = rt_info.find(HotShapes::rt_info_key); it != rt_info.end()) {
+        hot_shapes = HotShapes::deserialize(it->second.as<std::string>());
+        rt_info.erase(it);
+    }
+    std::string hot_shapes_id;
+    if (auto it = rt_info.find(HotShapes::rt_info_id_key); it != rt_info.end()) {
+        hot_shapes_id = it->second.as<std::string>();
+        rt_info.erase(it);
+    }
+
     auto _config = config;
     Config conf = engConfig;
     Config::ModelType modelType = getModelType(model);
@@ -902,6 +928,7 @@ std::shared_ptr<ov::ICompiledModel> Plugin::deserialize_model(ModelDeserializer&
     // import config props from caching model
     calculate_streams(conf, model, true);
     auto compiled_model = std::make_shared<CompiledModel>(model, shared_from_this(), conf, loaded_from_cache);
+    compiled_model->warm_up(std::move(hot_shapes), hot_shapes_id);
     return compiled_model;
 }
 }  // namespace ov::intel_cpu
@@ -0,0 +1,300 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "state_swap.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <ios>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "memory_state.h"
+#include "openvino/core/except.hpp"
+#include "openvino/runtime/ivariable_state.hpp"
+#include "openvino/runtime/itensor.hpp"
+#include "openvino/runtime/so_ptr.hpp"
+#include "openvino/runtime/threading/itask_executor.hpp"
+
+namespace ov::intel_cpu {
+
+class StateSwapManager::Session {
+public:
+    StateSwapManager* manager = nullptr;
+    std::vector<std::shared_ptr<VariableStateKVcache>> states;
+    std::shared_ptr<const std::filesystem::path> file;
+    // held while the session is executing or being swapped out
+    std::mutex mutex;
+    bool swapped = false;
+    size_t resident = 0;
+    std::list<Session*>::iterator position;
+
+    [[nodiscard]] size_t measure() const {
+        size_t bytes = 0;
+        for (const auto& state : states) {
+            bytes += state->resident_bytes();
+        }
+        return bytes;
+    }
+
+    void swap_out() {
+        std::vector<std::optional<uint64_t>> offsets;
+        offsets.reserve(states.size());
+        try {
+            // the file is rewritten, as the previous content has been read back by swap_in
+            std::ofstream stream(*file, std::ios::binary | std::ios::trunc);
+            OPENVINO_ASSERT(stream.is_open(), "Failed to create the state swap file ", file->string());
+            for (const auto& state : states) {
+                offsets.push_back(state->write_swap(stream));
+            }
+            // a buffered write may fail only when the stream is flushed, e.g. on a full disk
+            stream.close();
+            OPENVINO_ASSERT(!stream.fail(), "Failed to write the state swap file ", file->string());
+        } catch (...) {
+            // no state has been released yet, so the partial file is not needed
+            std::error_code error;
+            std::filesystem::remove(*file, error);
+            throw;
+        }
+        for (size_t i = 0; i < states.size(); i++) {
+            states[i]->release_swapped(file, offsets[i]);
+        }
+        swapped = true;
+    }
+
+    void swap_in() {
+        for (const auto& state : states) {
+            state->swap_in();
+        }
+        swapped = false;
+    }
+};
+
+namespace {
+
+// A state handle of the user, which keeps the session of the state resident during the calls
+class PinnedState : public ov::IVariableState {
+public:
+    PinnedState(MemStatePtr state, StateSwapManager::SessionPtr session)
+        : ov::IVariableState(state->get_name()),
+          m_state(std::move(state)),
+          m_session(std::move(session)) {}
+
+    void reset() override {
+        StateSwapManager::Pin pin(m_session);
+        m_state->reset();
+    }
+
+    void set_state(const ov::SoPtr<ov::ITensor>& state) override {
+        StateSwapManager::Pin pin(m_session);
+        m_state->set_state(state);
+    }
+
+    ov::SoPtr<ov::ITensor> get_state() const override {
+        // the KV cache states return a copy, which stays valid after the session is unpinned
+        StateSwapManager::Pin pin(m_session);
+        return m_state->get_state();
+    }
+
+    void fork(const ov::SoPtr<ov::IVariableState>& source) override {
+        // a pinned source is captured before this session is pinned, so two sessions are never pinned at once
+        auto value = dynamic_cast<PinnedState*>(source._ptr.get()) ? source->snapshot() : source;
+        StateSwapManager::Pin pin(m_session);
+        m_state->fork(value);
+    }
+
+    ov::SoPtr<ov::IVariableState> snapshot() override {
+        // the buffers shared with the snapshot stay alive when the session is swapped out
+        StateSwapManager::Pin pin(m_session);
+        return m_state->snapshot();
+    }
+
+    void truncate(size_t length) override {
+        StateSwapManager::Pin pin(m_session);
+        m_state->truncate(length);
+    }
+
+private:
+    MemStatePtr m_state;
+    StateSwapManager::SessionPtr m_session;
+};
+
+}  // namespace
+
+StateSwapManager::StateSwapManager(size_t budget,
+                                   std::filesystem::path directory,
+                                   std::shared_ptr<ov::threading::ITaskExecutor> executor)
+    : m_budget(budget),
+      m_directory(std::move(directory)),
+      m_tag((static_cast<uint64_t>(std::random_device{}()) << 32) | std::random_device{}()),
+      m_executor(std::move(executor)) {
+    OPENVINO_ASSERT(m_executor, "The state swap executor is not set");
+    OPENVINO_ASSERT(std::filesystem::is_directory(m_directory),
+                    "The state swap directory ",
+                    m_directory.string(),
+                    " does not exist");
+}
+
+StateSwapManager::SessionPtr StateSwapManager::create_session(const std::vector<MemStatePtr>& states) {
+    std::vector<std::shared_ptr<VariableStateKVcache>> kv_states;
+    for (const auto& state : states) {
+        // the buffers of the other states are bound to the edges of the graph
+        if (auto kv_state = std::dynamic_pointer_cast<VariableStateKVcache>(state)) {
+            kv_states.push_back(std::move(kv_state));
+        }
+    }
+    if (kv_states.empty()) {
+        return nullptr;
+    }
+
+    auto* session = new Session;
+    session->manager = this;
+    session->states = std::move(kv_states);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        session->file = std::make_shared<const std::filesystem::path>(
+            m_directory / ("ov_cpu_" + std::to_string(m_tag) + "_" + std::to_string(m_sessions++) + ".kvswap"));
+        session->resident = session->measure();
+        m_resident += session->resident;
+        session->position = m_lru.insert(m_lru.begin(), session);
+    }
+    return {session, [manager = shared_from_this()](Session* session) {
+                manager->remove(*session);
+                delete session;
+            }};
+}
+
+void StateSwapManager::remove(Session& session) {
+    // waits for the eviction of the session, if it is in progress
+    std::lock_guard<std::mutex> session_lock(session.mutex);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_resident -= session.resident;
+        m_lru.erase(session.position);
+    }
+    std::error_code error;
+    std::filesystem::remove(*session.file, error);
+}
+
+void StateSwapManager::pin(Session& session) {
+    session.mutex.lock();
+    try {
+        if (session.swapped) {
+            session.swap_in();
+        }
+    } catch (...) {
+        session.mutex.unlock();
+        throw;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_lru.splice(m_lru.begin(), m_lru, session.position);
+}
+
+void StateSwapManager::unpin(Session& session) {
+    const auto resident = session.measure();
+    bool over_budget = false;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_resident = m_resident - session.resident + resident;
+        session.resident = resident;
+        over_budget = m_budget != 0 && m_resident > m_budget;
+    }
+    session.mutex.unlock();
+    if (over_budget && !m_eviction_scheduled.exchange(true)) {
+        m_executor->run([weak_manager = weak_from_this()] {
+            if (auto manager = weak_manager.lock()) {
+                // the sessions exceeding the budget after this point are evicted by the next task
+                manager->m_eviction_scheduled = false;
+                manager->evict(manager->m_budget);
+            }
+        });
+    }
+}
+
+void StateSwapManager::evict(size_t budget) {
+    while (true) {
+        Session* victim = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_resident <= budget) {
+                return;
+            }
+            for (auto it = m_lru.rbegin(); it != m_lru.rend(); ++it) {
+                auto* session = *it;
+                if (session->resident == 0 || !session->mutex.try_lock()) {
+                    continue;
+                }
+                if (session->swapped) {
+                    session->mutex.unlock();
+                    continue;
+                }
+                victim = session;
+                break;
+            }
+        }
+        if (!victim) {
+            // the remaining sessions are executing
+            return;
+        }
+
+        // the file is written outside of the manager lock, so other sessions can run meanwhile
+        std::lock_guard<std::mutex> session_lock(victim->mutex, std::adopt_lock);
+        bool failed = false;
+        try {
+            victim->swap_out();
+        } catch (...) {
+            // e.g. the disk is full: the buffers of the session are kept, as are the ones of the others
+            failed = true;
+        }
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const auto resident = victim->measure();
+        m_resident = m_resident - victim->resident + resident;
+        victim->resident = resident;
+        if (failed) {
+            return;
+        }
+    }
+}
+
+std::vector<ov::SoPtr<ov::IVariableState>> StateSwapManager::user_states(const SessionPtr& session,
+                                                                         const std::vector<MemStatePtr>& states) {
+    std::vector<ov::SoPtr<ov::IVariableState>> user_states;
+    user_states.reserve(states.size());
+    for (const auto& state : states) {
+        user_states.emplace_back(std::make_shared<PinnedState>(state, session));
+    }
+    return user_states;
+}
+
+void StateSwapManager::evict_all() {
+    evict(0);
+}
+
+size_t StateSwapManager::resident_bytes() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_resident;
+}
+
+StateSwapManager::Pin::Pin(SessionPtr session) : m_session(std::move(session)) {
+    if (m_session) {
+        m_session->manager->pin(*m_session);
+    }
+}
+
+StateSwapManager::Pin::~Pin() {
+    if (m_session) {
+        m_session->manager->unpin(*m_session);
+    }
+}
+
+}  // namespace ov::intel_cpu
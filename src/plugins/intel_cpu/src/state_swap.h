@@ -0,0 +1,105 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "memory_state.h"
+#include "openvino/runtime/ivariable_state.hpp"
+#include "openvino/runtime/so_ptr.hpp"
+#include "openvino/runtime/threading/itask_executor.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Moves the KV cache states of the idle infer requests of a compiled model to disk.
+ *
+ * A serving process keeps many stateful sessions open, while only a few of them are generating at any moment. Every
+ * infer request with KV cache states is a session of the manager. When the states of all the sessions take more than
+ * the budget, the least recently used sessions which are not executing are written to their swap files and their
+ * buffers are released. The states are read back before the next inference of the session, so swapping is transparent
+ * to the user, only the latency of that inference grows. The swap files are written by the executor of the manager, so
+ * the inference which exceeds the budget doesn't wait for the disk.
+ */
+class StateSwapManager : public std::enable_shared_from_this<StateSwapManager> {
+public:
+    class Session;
+    using SessionPtr = std::shared_ptr<Session>;
+
+    /**
+     * @param budget the bytes of the resident states of all the sessions, 0 means no limit: the states are swapped out
+     * by evict_all only
+     * @param directory where the swap files are created
+     * @param executor runs the eviction of the sessions exceeding the budget
+     */
+    StateSwapManager(size_t budget,
+                     std::filesystem::path directory,
+                     std::shared_ptr<ov::threading::ITaskExecutor> executor);
+
+    /// Registers the KV cache states of an infer request, nullptr if there are none. The session is a resident one.
+    SessionPtr create_session(const std::vector<MemStatePtr>& states);
+
+    /**
+     * The states of the session as they are given to the user: the session is pinned during each of their calls, so
+     * the states are never swapped out while they are read or modified.
+     */
+    static std::vector<ov::SoPtr<ov::IVariableState>> user_states(const SessionPtr& session,
+                                                                  const std::vector<MemStatePtr>& states);
+
+    /// Swaps out the states of all the sessions which are not executing now
+    void evict_all();
+
+    /// The bytes of the resident states of all the sessions
+    [[nodiscard]] size_t resident_bytes() const;
+
+    /**
+     * @brief Keeps the states of a session resident during an inference or a call of a user state: swaps them in when
+     * needed and accounts the memory they take afterwards, scheduling the eviction of other sessions if the budget is
+     * exceeded.
+     */
+    class Pin {
+    public:
+        explicit Pin(SessionPtr session);
+        ~Pin();
+
+        Pin(const Pin&) = delete;
+        Pin& operator=(const Pin&) = delete;
+
+    private:
+        SessionPtr m_session;
+    };
+
+private:
+    void pin(Session& session);
+    void unpin(Session& session);
+    void remove(Session& session);
+    // swaps out the least recently used sessions until the budget is met, all of them for the budget equal to 0
+    void evict(size_t budget);
+
+    const size_t m_budget;
+    const std::filesystem::path m_directory;
+    // distinguishes the swap files of the managers of different processes sharing the directory
+    const uint64_t m_tag;
+    const std::shared_ptr<ov::threading::ITaskExecutor> m_executor;
+    uint64_t m_sessions = 0;
+    // an eviction is queued to the executor and has not started yet
+    std::atomic<bool> m_eviction_scheduled{false};
+
+    mutable std::mutex m_mutex;
+    // the most recently used session first
+    std::list<Session*> m_lru;
+    size_t m_resident = 0;
+};
+
+using StateSwapManagerPtr = std::shared_ptr<StateSwapManager>;
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,131 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include "image_preprocess.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <utility>
+
+#include "openvino/core/attribute_visitor.hpp"
+#include "openvino/core/dimension.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/node_vector.hpp"
+#include "openvino/core/partial_shape.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/op/op.hpp"
+#include "transformations/itt.hpp"
+
+ov::intel_cpu::ImagePreprocessNode::ImagePreprocessNode(const OutputVector& args, Config cfg)
+    : Op(args),
+      m_config(std::move(cfg)) {
+    constructor_validate_and_infer_types();
+}
+
+std::shared_ptr<ov::Node> ov::intel_cpu::ImagePreprocessNode::clone_with_new_inputs(
+    const ov::OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(ImagePreprocessNode_with_new_inputs);
+    check_new_args_count(this, new_args);
+    return std::make_shared<ov::intel_cpu::ImagePreprocessNode>(new_args, m_config);
+}
+
+std::pair<int64_t, int64_t> ov::intel_cpu::ImagePreprocessNode::crop_range(const Config& config,
+                                                                           int64_t length,
+                                                                           size_t axis) {
+    auto clamp = [length](int64_t value) {
+        if (value < 0) {
+            value += length;
+        }
+        return std::clamp<int64_t>(value, 0, length);
+    };
+    const auto begin = clamp(config.crop_begin[axis]);
+    const auto end = clamp(config.crop_end[axis]);
+    return {begin, std::max(begin, end)};
+}
+
+void ov::intel_cpu::ImagePreprocessNode::validate_and_infer_types() {
+    INTERNAL_OP_SCOPE(ImagePreprocessNode_validate_and_infer_types);
+    const auto& format = m_config.color_format;
+    const auto inputs = get_input_size();
+    NODE_VALIDATION_CHECK(this,
+                          (format == "PACKED" && inputs == 1) || (format == "NV12" && (inputs == 1 || inputs == 2)) ||
+                              (format == "I420" && (inputs == 1 || inputs == 3)),
+                          "unsupported color format ",
+                          format,
+                          " with ",
+                          inputs,
+                          " inputs");
+    for (size_t i = 0; i < inputs; i++) {
+        NODE_VALIDATION_CHECK(this,
+                              get_input_element_type(i) == ov::element::u8,
+                              "input ",
+                              i,
+                              " must be u8, got ",
+                              get_input_element_type(i));
+    }
+    NODE_VALIDATION_CHECK(this,
+                          m_config.crop_begin.size() == 2 && m_config.crop_end.size() == 2,
+                          "crop bounds must have 2 values");
+    NODE_VALIDATION_CHECK(this,
+                          !m_config.resize || m_config.resize_size.size() == 2,
+                          "resize size must have 2 values");
+    NODE_VALIDATION_CHECK(this, m_config.scale.size() == m_config.shift.size(), "scale and shift sizes differ");
+
+    const auto& shape = get_input_partial_shape(0);
+    if (shape.rank().is_dynamic()) {
+        set_output_type(0, ov::element::f32, ov::PartialShape::dynamic(4));
+        return;
+    }
+    NODE_VALIDATION_CHECK(this, shape.size() == 4, "input 0 must be 4D, got ", shape);
+
+    auto height = shape[1];
+    const auto& width = shape[2];
+    auto channels = Dimension(3);
+    if (format == "PACKED") {
+        channels = shape[3];
+    } else if (inputs == 1) {
+        // the chroma planes follow the luma plane
+        height = height.is_static() ? Dimension(height.get_length() * 2 / 3) : Dimension::dynamic();
+    }
+    NODE_VALIDATION_CHECK(this,
+                          channels.is_dynamic() || m_config.scale.size() == static_cast<size_t>(channels.get_length()),
+                          "scale and shift must have a value per channel");
+
+    Dimension out_size[2];
+    const Dimension* size[2] = {&height, &width};
+    for (size_t axis = 0; axis < 2; axis++) {
+        if (m_config.resize) {
+            out_size[axis] = Dimension(m_config.resize_size[axis]);
+        } else if (size[axis]->is_static()) {
+            const auto range = crop_range(m_config, size[axis]->get_length(), axis);
+            out_size[axis] = Dimension(range.second - range.first);
+        } else if (m_config.crop_begin[axis] == 0 && m_config.crop_end[axis] == std::numeric_limits<int64_t>::max()) {
+            out_size[axis] = *size[axis];
+        } else {
+            out_size[axis] = Dimension::dynamic();
+        }
+    }
+    set_output_type(0, ov::element::f32, {shape[0], channels, out_size[0], out_size[1]});
+}
+
+bool ov::intel_cpu::ImagePreprocessNode::visit_attributes(ov::AttributeVisitor& visitor) {
+    INTERNAL_OP_SCOPE(ImagePreprocessNode_visit_attributes);
+    visitor.start_structure("config");
+    visitor.on_attribute("color_format", m_config.color_format);
+    visitor.on_attribute("reverse_channels", m_config.reverse_channels);
+    visitor.on_attribute("round_color", m_config.round_color);
+    visitor.on_attribute("crop_begin", m_config.crop_begin);
+    visitor.on_attribute("crop_end", m_config.crop_end);
+    visitor.on_attribute("resize", m_config.resize);
+    visitor.on_attribute("resize_mode", m_config.resize_mode);
+    visitor.on_attribute("coordinate_transformation_mode", m_config.coordinate_transformation_mode);
+    visitor.on_attribute("nearest_mode", m_config.nearest_mode);
+    visitor.on_attribute("resize_size", m_config.resize_size);
+    visitor.on_attribute("scale", m_config.scale);
+    visitor.on_attribute("shift", m_config.shift);
+    visitor.finish_structure();
+    return true;
+}
@@ -0,0 +1,89 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "openvino/core/attribute_visitor.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/node_vector.hpp"
+#include "openvino/op/op.hpp"
+#include "openvino/op/util/interpolate_base.hpp"
+
+namespace ov::intel_cpu {
+
+/*
+ImagePreprocess fuses the chain lowered from PrePostProcessor for an image input:
+    color conversion -> crop -> resize -> mean/scale -> convert_layout
+
+    inputs:
+        PACKED : u8[N, H, W, C]
+        NV12   : u8[N, H * 3 / 2, W, 1] or Y u8[N, H, W, 1], UV u8[N, H / 2, W / 2, 2]
+        I420   : u8[N, H * 3 / 2, W, 1] or Y u8[N, H, W, 1], U u8[N, H / 2, W / 2, 1], V u8[N, H / 2, W / 2, 1]
+    outputs:
+        0: f32[N, C, OH, OW]
+
+    output[n, c, y, x] = resize(crop(rgb))[n, y, x, c] * scale[c] + shift[c]
+*/
+class ImagePreprocessNode : public ov::op::Op {
+public:
+    OPENVINO_OP("ImagePreprocess", "cpu_plugin_opset");
+
+    using InterpolateMode = ov::op::util::InterpolateBase::InterpolateMode;
+    using CoordinateTransformMode = ov::op::util::InterpolateBase::CoordinateTransformMode;
+    using NearestMode = ov::op::util::InterpolateBase::NearestMode;
+
+    ImagePreprocessNode() = default;
+
+    struct Config {
+        // PACKED, NV12 or I420
+        std::string color_format = "PACKED";
+        // BGR output of the YUV images, reversed channels of the packed image
+        bool reverse_channels = false;
+        // the YUV image is converted to u8 RGB before any other step
+        bool round_color = false;
+        // {H, W} bounds of the crop with the Slice semantics
+        std::vector<int64_t> crop_begin = {0, 0};
+        std::vector<int64_t> crop_end = {std::numeric_limits<int64_t>::max(), std::numeric_limits<int64_t>::max()};
+        bool resize = false;
+        InterpolateMode resize_mode = InterpolateMode::LINEAR;
+        CoordinateTransformMode coordinate_transformation_mode = CoordinateTransformMode::HALF_PIXEL;
+        NearestMode nearest_mode = NearestMode::ROUND_PREFER_FLOOR;
+        // {H, W} of the resized image
+        std::vector<int64_t> resize_size;
+        // per output channel
+        std::vector<float> scale;
+        std::vector<float> shift;
+    };
+
+    ImagePreprocessNode(const OutputVector& args, Config cfg);
+
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
+
+    void validate_and_infer_types() override;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+
+    const Config& get_config() const {
+        return m_config;
+    }
+
+    Config& get_config() {
+        return m_config;
+    }
+
+    // [begin, end) of the crop along the axis (0 is H, 1 is W) of the source image of the given length
+    static std::pair<int64_t, int64_t> crop_range(const Config& config, int64_t length, size_t axis);
+
+private:
+    Config m_config;
+};
+
+}  // namespace ov::intel_cpu
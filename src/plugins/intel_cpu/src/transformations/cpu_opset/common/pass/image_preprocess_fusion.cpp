@@ -0,0 +1,330 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "image_preprocess_fusion.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+#include "openvino/cc/pass/itt.hpp"
+#include "openvino/core/graph_util.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/node_vector.hpp"
+#include "openvino/core/rt_info.hpp"
+#include "openvino/core/type.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/core/validation_util.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/divide.hpp"
+#include "openvino/op/gather.hpp"
+#include "openvino/op/i420_to_bgr.hpp"
+#include "openvino/op/i420_to_rgb.hpp"
+#include "openvino/op/interpolate.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/nv12_to_bgr.hpp"
+#include "openvino/op/nv12_to_rgb.hpp"
+#include "openvino/op/slice.hpp"
+#include "openvino/op/subtract.hpp"
+#include "openvino/op/transpose.hpp"
+#include "openvino/pass/matcher_pass.hpp"
+#include "openvino/pass/pattern/matcher.hpp"
+#include "openvino/pass/pattern/op/label.hpp"
+#include "openvino/pass/pattern/op/pattern.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+#include "transformations/cpu_opset/common/op/image_preprocess.hpp"
+
+namespace {
+
+using ov::intel_cpu::ImagePreprocessNode;
+
+bool is_color_conversion(const std::shared_ptr<ov::Node>& node) {
+    return ov::is_type_any_of<ov::op::v8::NV12toRGB,
+                              ov::op::v8::NV12toBGR,
+                              ov::op::v8::I420toRGB,
+                              ov::op::v8::I420toBGR>(node);
+}
+
+bool is_affine(const std::shared_ptr<ov::Node>& node) {
+    return ov::is_type_any_of<ov::op::v1::Subtract, ov::op::v1::Add, ov::op::v1::Multiply, ov::op::v1::Divide>(node);
+}
+
+bool is_fusible(const std::shared_ptr<ov::Node>& node) {
+    return is_color_conversion(node) || is_affine(node) ||
+           ov::is_type_any_of<ov::op::v0::Convert,
+                              ov::op::v8::Gather,
+                              ov::op::v8::Slice,
+                              ov::op::v4::Interpolate,
+                              ov::op::v11::Interpolate>(node);
+}
+
+std::vector<int64_t> get_i64_constant(const ov::Output<ov::Node>& source) {
+    const auto constant = ov::util::get_constant_from_source(source);
+    return constant ? constant->cast_vector<int64_t>() : std::vector<int64_t>{};
+}
+
+// the values of a constant broadcast along the channels of [N, H, W, C]
+bool get_channel_values(const ov::Output<ov::Node>& source, size_t channels, std::vector<float>& values) {
+    const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(source.get_node_shared_ptr());
+    if (!constant) {
+        return false;
+    }
+    const auto& shape = constant->get_shape();
+    if (shape.size() > 4 || !std::all_of(shape.begin(), shape.end() - std::min<size_t>(shape.size(), 1), [](size_t d) {
+            return d == 1;
+        })) {
+        return false;
+    }
+    values = constant->cast_vector<float>();
+    if (values.size() == 1) {
+        values.assign(channels, values[0]);
+    }
+    return values.size() == channels;
+}
+
+bool is_channel_reverse(const std::shared_ptr<ov::Node>& node, size_t channels) {
+    const auto gather = ov::as_type_ptr<ov::op::v8::Gather>(node);
+    if (!gather || gather->get_batch_dims() != 0) {
+        return false;
+    }
+    const auto axis = get_i64_constant(gather->input_value(2));
+    if (axis.size() != 1 || (axis[0] != 3 && axis[0] != -1)) {
+        return false;
+    }
+    const auto indices = get_i64_constant(gather->input_value(1));
+    if (indices.size() != channels) {
+        return false;
+    }
+    for (size_t c = 0; c < channels; c++) {
+        if (indices[c] != static_cast<int64_t>(channels - 1 - c)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// the H, W bounds of a unit step Slice which keeps N and C
+bool get_crop(const std::shared_ptr<ov::Node>& node, ImagePreprocessNode::Config& config) {
+    const auto& shape = node->get_input_partial_shape(0);
+    const auto start = get_i64_constant(node->input_value(1));
+    const auto stop = get_i64_constant(node->input_value(2));
+    const auto step = get_i64_constant(node->input_value(3));
+    auto axes = node->get_input_size() > 4 ? get_i64_constant(node->input_value(4)) : std::vector<int64_t>{};
+    if (node->get_input_size() <= 4) {
+        axes.resize(start.size());
+        std::iota(axes.begin(), axes.end(), 0);
+    }
+    if (start.empty() || start.size() != stop.size() || start.size() != step.size() || start.size() != axes.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < axes.size(); i++) {
+        const auto axis = axes[i] < 0 ? axes[i] + 4 : axes[i];
+        if (step[i] != 1 || axis < 0 || axis > 3) {
+            return false;
+        }
+        if (axis == 1 || axis == 2) {
+            config.crop_begin[axis - 1] = start[i];
+            config.crop_end[axis - 1] = stop[i];
+            continue;
+        }
+        // N and C are not sliced
+        const bool whole = stop[i] >= std::numeric_limits<int32_t>::max() ||
+                           (shape[axis].is_static() && stop[i] >= shape[axis].get_length());
+        if (start[i] != 0 || !whole) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// the H, W sizes of a linear or nearest Interpolate along H and W
+bool get_resize(const std::shared_ptr<ov::Node>& node, ImagePreprocessNode::Config& config) {
+    const auto interpolate = ov::as_type_ptr<ov::op::util::InterpolateBase>(node);
+    const auto& attrs = interpolate->get_attrs();
+    using Base = ov::op::util::InterpolateBase;
+    auto is_zero = [](const std::vector<size_t>& pads) {
+        return std::all_of(pads.begin(), pads.end(), [](size_t pad) {
+            return pad == 0;
+        });
+    };
+    if ((attrs.mode != Base::InterpolateMode::LINEAR && attrs.mode != Base::InterpolateMode::NEAREST) ||
+        attrs.shape_calculation_mode != Base::ShapeCalcMode::SIZES || attrs.antialias ||
+        !is_zero(attrs.pads_begin) || !is_zero(attrs.pads_end)) {
+        return false;
+    }
+    const size_t axes_port = ov::is_type<ov::op::v4::Interpolate>(node) ? 3 : 2;
+    const auto sizes = get_i64_constant(node->input_value(1));
+    auto axes = node->get_input_size() > axes_port ? get_i64_constant(node->input_value(axes_port))
+                                                   : std::vector<int64_t>{0, 1, 2, 3};
+    if (sizes.empty() || sizes.size() != axes.size()) {
+        return false;
+    }
+    const auto& shape = node->get_input_partial_shape(0);
+    config.resize_size = {-1, -1};
+    for (size_t i = 0; i < axes.size(); i++) {
+        const auto axis = axes[i] < 0 ? axes[i] + 4 : axes[i];
+        if (axis == 1 || axis == 2) {
+            config.resize_size[axis - 1] = sizes[i];
+        } else if (axis < 0 || axis > 3 || shape[axis].is_dynamic() || shape[axis].get_length() != sizes[i]) {
+            return false;
+        }
+    }
+    if (config.resize_size[0] <= 0 || config.resize_size[1] <= 0) {
+        return false;
+    }
+    config.resize = true;
+    config.resize_mode = attrs.mode;
+    config.coordinate_transformation_mode = attrs.coordinate_transformation_mode;
+    config.nearest_mode = attrs.nearest_mode;
+    return true;
+}
+
+}  // namespace
+
+ov::intel_cpu::ImagePreprocessFusion::ImagePreprocessFusion() {
+    MATCHER_SCOPE(ImagePreprocessFusion);
+    auto data = ov::pass::pattern::any_input(ov::pass::pattern::type_matches(ov::element::f32) &&
+                                             ov::pass::pattern::rank_equals(4));
+    auto order = ov::pass::pattern::wrap_type<ov::op::v0::Constant>();
+    auto transpose = ov::pass::pattern::wrap_type<ov::op::v1::Transpose>({data, order});
+
+    ov::matcher_pass_callback callback = [=](ov::pass::pattern::Matcher& m) {
+        const auto& pattern_map = m.get_pattern_value_map();
+        const auto root = m.get_match_root();
+        if (get_i64_constant(pattern_map.at(order)) != std::vector<int64_t>{0, 3, 1, 2}) {
+            return false;
+        }
+        const auto& shape = pattern_map.at(data).get_partial_shape();
+        if (shape[3].is_dynamic()) {
+            return false;
+        }
+        const auto channels = static_cast<size_t>(shape[3].get_length());
+
+        // walk up the single consumer steps from the layout conversion to the source image
+        ov::NodeVector chain;
+        auto value = pattern_map.at(data);
+        while (is_fusible(value.get_node_shared_ptr()) && value.get_target_inputs().size() == 1) {
+            chain.push_back(value.get_node_shared_ptr());
+            if (is_color_conversion(chain.back())) {
+                break;
+            }
+            value = chain.back()->input_value(0);
+        }
+        std::reverse(chain.begin(), chain.end());
+
+        ImagePreprocessNode::Config config;
+        config.scale.assign(channels, 1.F);
+        config.shift.assign(channels, 0.F);
+        ov::OutputVector planes;
+        ov::NodeVector fused = chain;
+        fused.push_back(root);
+        bool is_u8 = true;
+        bool has_color = false;
+        bool has_crop = false;
+        bool has_affine = false;
+        size_t i = 0;
+        if (!chain.empty() && is_color_conversion(chain.front())) {
+            const auto& color = chain.front();
+            config.color_format =
+                ov::is_type_any_of<ov::op::v8::NV12toRGB, ov::op::v8::NV12toBGR>(color) ? "NV12" : "I420";
+            config.reverse_channels = ov::is_type_any_of<ov::op::v8::NV12toBGR, ov::op::v8::I420toBGR>(color);
+            // the planes are either u8 or converted to f32 one by one
+            for (const auto& input : color->input_values()) {
+                if (input.get_element_type() == ov::element::u8) {
+                    planes.push_back(input);
+                    continue;
+                }
+                const auto convert = ov::as_type_ptr<ov::op::v0::Convert>(input.get_node_shared_ptr());
+                if (!convert || input.get_element_type() != ov::element::f32 ||
+                    convert->get_input_element_type(0) != ov::element::u8 || input.get_target_inputs().size() != 1) {
+                    return false;
+                }
+                planes.push_back(convert->input_value(0));
+                fused.push_back(convert);
+            }
+            config.round_color = color->get_output_element_type(0) == ov::element::u8;
+            is_u8 = config.round_color;
+            has_color = true;
+            i = 1;
+        } else {
+            const auto& source = chain.empty() ? pattern_map.at(data) : chain.front()->input_value(0);
+            if (source.get_element_type() != ov::element::u8) {
+                return false;
+            }
+            planes.push_back(source);
+        }
+
+        // the crop precedes the resize, the resize and the arithmetic are done in f32
+        bool has_resize = false;
+        for (; i < chain.size(); i++) {
+            const auto& node = chain[i];
+            if (ov::is_type<ov::op::v0::Convert>(node)) {
+                if (!is_u8 || node->get_output_element_type(0) != ov::element::f32) {
+                    return false;
+                }
+                is_u8 = false;
+            } else if (ov::is_type<ov::op::v8::Gather>(node)) {
+                if (!is_channel_reverse(node, channels)) {
+                    return false;
+                }
+                // the arithmetic accumulated so far follows the channels
+                config.reverse_channels = !config.reverse_channels;
+                std::reverse(config.scale.begin(), config.scale.end());
+                std::reverse(config.shift.begin(), config.shift.end());
+            } else if (ov::is_type<ov::op::v8::Slice>(node)) {
+                if (has_crop || has_resize || !get_crop(node, config)) {
+                    return false;
+                }
+                has_crop = true;
+            } else if (ov::is_type_any_of<ov::op::v4::Interpolate, ov::op::v11::Interpolate>(node)) {
+                if (is_u8 || has_resize || !get_resize(node, config)) {
+                    return false;
+                }
+                has_resize = true;
+            } else if (is_affine(node)) {
+                std::vector<float> values;
+                if (is_u8 || !get_channel_values(node->input_value(1), channels, values) ||
+                    (ov::is_type<ov::op::v1::Divide>(node) &&
+                     std::find(values.begin(), values.end(), 0.F) != values.end())) {
+                    return false;
+                }
+                for (size_t c = 0; c < channels; c++) {
+                    if (ov::is_type<ov::op::v1::Subtract>(node)) {
+                        config.shift[c] -= values[c];
+                    } else if (ov::is_type<ov::op::v1::Add>(node)) {
+                        config.shift[c] += values[c];
+                    } else if (ov::is_type<ov::op::v1::Multiply>(node)) {
+                        config.scale[c] *= values[c];
+                        config.shift[c] *= values[c];
+                    } else {
+                        config.scale[c] /= values[c];
+                        config.shift[c] /= values[c];
+                    }
+                }
+                has_affine = true;
+            } else {
+                return false;
+            }
+        }
+        // a lone crop or convert is left to the existing nodes
+        if (is_u8 || !(has_color || has_resize || has_affine)) {
+            return false;
+        }
+
+        const auto image_preprocess = std::make_shared<ImagePreprocessNode>(planes, config);
+        image_preprocess->set_friendly_name(root->get_friendly_name());
+        ov::copy_runtime_info(fused, image_preprocess);
+        ov::replace_node(root, image_preprocess);
+        return true;
+    };
+
+    auto m = std::make_shared<ov::pass::pattern::Matcher>(transpose, matcher_name);
+    register_matcher(m, callback);
+}
@@ -0,0 +1,20 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/matcher_pass.hpp"
+
+// [NV12|I420 ->] [Convert ->] [Gather(reverse) ->] [Slice ->] [Interpolate ->] [Subtract|Add|Multiply|Divide ->] Transpose
+// (in the order PrePostProcessor lowers an image input to NCHW f32) is replaced by ImagePreprocessNode
+
+namespace ov::intel_cpu {
+
+class ImagePreprocessFusion : public ov::pass::MatcherPass {
+public:
+    OPENVINO_MATCHER_PASS_RTTI("ImagePreprocessFusion");
+    ImagePreprocessFusion();
+};
+
+}  // namespace ov::intel_cpu
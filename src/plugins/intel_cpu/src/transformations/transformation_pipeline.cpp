@@ -38,6 +38,7 @@
 #include "openvino/op/clamp.hpp"
 #include "openvino/op/constant.hpp"
 #include "openvino/op/convert.hpp"
+#include "openvino/op/embedding_segments_sum.hpp"
 #include "openvino/op/fake_quantize.hpp"
 #include "openvino/op/grouped_matmul.hpp"
 #include "openvino/op/matmul.hpp"
@@ -49,6 +50,8 @@
 #include "openvino/op/result.hpp"
 #include "openvino/op/transpose.hpp"
 #include "openvino/op/util/attr_types.hpp"
+#include "openvino/op/util/embeddingbag_offsets_base.hpp"
+#include "openvino/op/util/embeddingbag_packed_base.hpp"
 #include "ov_ops/gather_compressed.hpp"
 #include "ov_ops/gather_matmul.hpp"
 
@@ -211,6 +214,7 @@
 #    include "transformations/cpu_opset/common/pass/causal_mask_preprocess_fusion.hpp"
 #    include "transformations/cpu_opset/common/pass/convert_fq_rnn_to_quantized_rnn.hpp"
 #    include "transformations/cpu_opset/common/pass/decompose_rms_norm.hpp"
+#    include "transformations/cpu_opset/common/pass/image_preprocess_fusion.hpp"
 #    include "transformations/cpu_opset/x64/pass/convert_to_interaction.hpp"
 #    include "transformations/cpu_opset/x64/pass/mlp_fusion.hpp"
 #    include "transformations/cpu_opset/x64/pass/qkv_proj_fusion.hpp"
@@ -311,11 +315,22 @@ bool Transformations::is_decompression_multiply(const_node_ptr& node) {
         });
     };
 
-    auto benefit_from_decompression = [&all_has_type](const std::set<ov::Input<ov::Node>>& consumers) {
+    // the EmbeddingBag nodes dequantize the rows of the compressed tables on the fly
+    auto all_embedding_tables = [](const std::set<ov::Input<ov::Node>>& consumers) {
+        return std::all_of(consumers.begin(), consumers.end(), [](const ov::Input<ov::Node>& input) {
+            return input.get_index() == 0 && ov::is_type_any_of<ov::op::util::EmbeddingBagOffsetsBase,
+                                                                ov::op::util::EmbeddingBagPackedBase,
+                                                                ov::op::v3::EmbeddingSegmentsSum>(input.get_node());
+        });
+    };
+
+    auto benefit_from_decompression = [&all_has_type,
+                                       &all_embedding_tables](const std::set<ov::Input<ov::Node>>& consumers) {
         return all_has_type(consumers, ov::op::v0::MatMul::get_type_info_static()) ||
                all_has_type(consumers, ov::op::v1::Convolution::get_type_info_static()) ||
                all_has_type(consumers, ov::op::v17::GroupedMatMul::get_type_info_static()) ||
-               all_has_type(consumers, ov::op::internal::GatherMatmul::get_type_info_static());
+               all_has_type(consumers, ov::op::internal::GatherMatmul::get_type_info_static()) ||
+               all_embedding_tables(consumers);
     };
 
     const auto consumers = node->get_output_target_inputs(0);
@@ -532,6 +547,9 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
     manager.set_per_pass_validation(false);
     if (useLpt) {
         CPU_REGISTER_PASS_COMMON(manager, ov::pass::MarkDequantization, defaultPrecisions);
+    } else {
+        // before the opset conversions and the fusions split the image preprocessing steps of PrePostProcessor
+        CPU_REGISTER_PASS_X64(manager, ImagePreprocessFusion);
     }
 
     auto get_convert_precisions = [&]() {
@@ -587,7 +605,10 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
                                        ov::op::v1::GroupConvolution,
                                        ov::op::v1::ConvolutionBackpropData,
                                        ov::op::v1::GroupConvolutionBackpropData,
-                                       ov::op::v17::GroupedMatMul>(consumer.get_node());
+                                       ov::op::v17::GroupedMatMul,
+                                       ov::op::util::EmbeddingBagOffsetsBase,
+                                       ov::op::util::EmbeddingBagPackedBase,
+                                       ov::op::v3::EmbeddingSegmentsSum>(consumer.get_node());
             });
         },
         ov::pass::KeepConstAndDecompression);
@@ -913,7 +934,8 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
        and finally do CF for those constant paths that are not inputs to MatMul node */
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::EnableDecompressionConvertConstantFolding);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::KeepConstAndDecompression);
-    CPU_REGISTER_PASS_COMMON(manager, ov::pass::ConstantFolding);
+    // the decompression subgraphs of the weights are independent, so they are folded concurrently
+    CPU_REGISTER_PASS_COMMON(manager, ov::pass::ConstantFolding, true);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::LoraSubgraphFusion);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::Validate);
 
@@ -0,0 +1,119 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "utils/extended_profiling_dump.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <ostream>
+#include <string>
+
+#include "graph.h"
+#include "node.h"
+#include "perf_count.h"
+#include "utils/perf_events.hpp"
+
+namespace ov::intel_cpu {
+
+namespace {
+
+std::string escape(const std::string& value) {
+    std::string result;
+    result.reserve(value.size());
+    for (const char c : value) {
+        switch (c) {
+        case '"':
+            result += "\\\"";
+            break;
+        case '\\':
+            result += "\\\\";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                char code[7];
+                std::snprintf(code, sizeof(code), "\\u%04x", static_cast<unsigned>(c));
+                result += code;
+            } else {
+                result += c;
+            }
+        }
+    }
+    return result;
+}
+
+void dumpNode(std::ostream& os, const Node& node, const PerfCount::Extended& extended) {
+    const auto& latency = extended.latency;
+    os << "    {\"name\": \"" << escape(node.getName()) << "\", \"type\": \"" << escape(node.getTypeStr())
+       << "\", \"exec_type\": \"" << escape(node.getPrimitiveDescriptorType()) << "\",\n";
+    os << "     \"latency_ns\": {\"count\": " << latency.count() << ", \"min\": " << latency.min()
+       << ", \"p50\": " << latency.percentile(0.5) << ", \"p90\": " << latency.percentile(0.9)
+       << ", \"p99\": " << latency.percentile(0.99) << ", \"max\": " << latency.max()
+       << ", \"mean\": " << (latency.count() ? latency.total() / latency.count() : 0) << "}";
+
+    if (extended.hwSamples) {
+        const auto& hw = extended.hwTotal;
+        const auto samples = static_cast<double>(extended.hwSamples);
+        // every miss of the last level cache is a cache line loaded from the memory, so bytes per ns is GB/s
+        constexpr double cacheLineSize = 64.0;
+        const double bandwidth = extended.hwDurationNs ? static_cast<double>(hw.llcMisses) * cacheLineSize /
+                                                             static_cast<double>(extended.hwDurationNs)
+                                                       : 0.0;
+        os << ",\n     \"hw_counters\": {\"samples\": " << extended.hwSamples
+           << ", \"cycles\": " << static_cast<double>(hw.cycles) / samples
+           << ", \"instructions\": " << static_cast<double>(hw.instructions) / samples
+           << ", \"ipc\": " << (hw.cycles ? static_cast<double>(hw.instructions) / static_cast<double>(hw.cycles) : 0.0)
+           << ", \"llc_misses\": " << static_cast<double>(hw.llcMisses) / samples
+           << ", \"memory_bandwidth_gbps\": " << bandwidth << "}";
+    }
+    os << "}";
+}
+
+}  // namespace
+
+void dumpExtendedProfiling(const Graph& graph) {
+    if (!graph.getGraphContext()) {
+        return;
+    }
+
+    const std::string& path = graph.getConfig().extendedProfilingPath;
+    if (path.empty()) {
+        return;
+    }
+
+    bool executed = false;
+    for (const auto& node : graph.GetNodes()) {
+        const auto* extended = node->PerfCounter().extended();
+        executed = executed || (extended && extended->latency.count());
+    }
+    if (!executed) {
+        return;
+    }
+
+    static std::atomic<int> graphIndex{0};
+    std::filesystem::path fileName{path};
+    fileName += "_" + std::to_string(graphIndex++) + ".json";
+    std::ofstream file(fileName);
+
+    const auto scope = PerfEvents::scope();
+    file << "{\n  \"graph\": \"" << escape(graph.GetName()) << "\",\n";
+    // the values of the hardware counters are the means per execution of a node
+    file << "  \"hw_counters_scope\": \"" << PerfEvents::scopeName(scope) << "\",\n";
+    file << "  \"nodes\": [";
+    const char* separator = "\n";
+    for (const auto& node : graph.GetNodes()) {
+        const auto* extended = node->PerfCounter().extended();
+        if (node->isConstant() || !extended || !extended->latency.count()) {
+            continue;
+        }
+        file << separator;
+        dumpNode(file, *node, *extended);
+        separator = ",\n";
+    }
+    file << "\n  ]\n}\n";
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,17 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+namespace ov::intel_cpu {
+
+class Graph;
+
+/**
+ * @brief Writes the latency histograms and the hardware counters of the nodes collected by the extended profiling
+ * (see cpu_extended_profiling) to "<prefix>_<index>.json". Nothing is written for a graph which was not executed.
+ */
+void dumpExtendedProfiling(const Graph& graph);
+
+}  // namespace ov::intel_cpu
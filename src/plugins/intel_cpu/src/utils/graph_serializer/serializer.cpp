@@ -8,6 +8,7 @@
 #include <cstdint>
 #include <cstring>
 #include <functional>
+#include <map>
 #include <memory>
 #include <ostream>
 #include <sstream>
@@ -156,7 +157,15 @@ ModelSerializer::ModelSerializer(std::ostream& ostream, const CacheEncrypt& encr
       m_weightless_mode(weightless_mode) {};
 
 void ModelSerializer::operator<<(const std::shared_ptr<ov::Model>& model) {
-    run_on_model(std::const_pointer_cast<ov::Model>(model->clone()));
+    auto clone = model->clone();
+    for (const auto& [name, value] : m_rt_info) {
+        clone->get_rt_info()[name] = value;
+    }
+    run_on_model(clone);
+}
+
+void ModelSerializer::set_rt_info(const std::string& name, const std::string& value) {
+    m_rt_info[name] = value;
 }
 
 bool ModelSerializer::use_absolute_offset() {
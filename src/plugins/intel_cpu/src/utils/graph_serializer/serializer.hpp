@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <map>
 #include <ostream>
 #include <pugixml.hpp>
 #include <string>
@@ -21,6 +22,11 @@ public:
 
     void operator<<(const std::shared_ptr<ov::Model>& model);
 
+    /**
+     * @brief Adds an entry to the rt_info of the serialized copy of the model, the model itself is not modified.
+     */
+    void set_rt_info(const std::string& name, const std::string& value);
+
 private:
     bool use_absolute_offset() override;
 
@@ -34,6 +40,7 @@ private:
                                                          bool data_is_temporary) const override;
 
     bool m_weightless_mode;
+    std::map<std::string, std::string> m_rt_info;
 };
 
 static constexpr uint64_t runtime_requirements_magic = 0x4F564350555F5252ULL;  // "OVCPU_RR" in ASCII
@@ -0,0 +1,138 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "utils/perf_events.hpp"
+
+#if defined(__linux__)
+#    include <linux/perf_event.h>
+#    include <sys/ioctl.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+
+#    include <array>
+#    include <cstddef>
+#    include <vector>
+#endif
+
+namespace ov::intel_cpu {
+
+#if defined(__linux__)
+namespace {
+
+// PERF_COUNT_HW_CACHE_MISSES is mapped to the misses of the last level cache by the kernel
+constexpr std::array<uint64_t, 3> hwEvents = {PERF_COUNT_HW_CPU_CYCLES,
+                                              PERF_COUNT_HW_INSTRUCTIONS,
+                                              PERF_COUNT_HW_CACHE_MISSES};
+
+class EventGroup {
+public:
+    EventGroup(pid_t pid, int cpu) {
+        for (size_t i = 0; i < hwEvents.size(); i++) {
+            perf_event_attr attr{};
+            attr.size = sizeof(attr);
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = hwEvents[i];
+            attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+            attr.disabled = i == 0 ? 1 : 0;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            const int leader = m_fds.empty() ? -1 : m_fds.front();
+            const auto fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, pid, cpu, leader, 0));
+            if (fd < 0) {
+                closeAll();
+                return;
+            }
+            m_fds.push_back(fd);
+        }
+        ioctl(m_fds.front(), PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(m_fds.front(), PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+
+    EventGroup(const EventGroup&) = delete;
+    EventGroup& operator=(const EventGroup&) = delete;
+
+    ~EventGroup() {
+        closeAll();
+    }
+
+    [[nodiscard]] bool valid() const {
+        return m_fds.size() == hwEvents.size();
+    }
+
+    bool read(HwCounters& counters) const {
+        struct {
+            uint64_t nr;
+            uint64_t timeEnabled;
+            uint64_t timeRunning;
+            std::array<uint64_t, hwEvents.size()> values;
+        } data{};
+        if (!valid() || ::read(m_fds.front(), &data, sizeof(data)) != static_cast<ssize_t>(sizeof(data)) ||
+            data.nr != hwEvents.size()) {
+            return false;
+        }
+        // the group shares the PMU with the other users and is multiplexed, so the values are extrapolated to the
+        // whole time it was enabled
+        const double scale =
+            data.timeRunning ? static_cast<double>(data.timeEnabled) / static_cast<double>(data.timeRunning) : 0.0;
+        auto scaled = [scale](uint64_t value) {
+            return static_cast<uint64_t>(static_cast<double>(value) * scale);
+        };
+        counters.cycles += scaled(data.values[0]);
+        counters.instructions += scaled(data.values[1]);
+        counters.llcMisses += scaled(data.values[2]);
+        return true;
+    }
+
+private:
+    void closeAll() {
+        for (const auto fd : m_fds) {
+            close(fd);
+        }
+        m_fds.clear();
+    }
+
+    std::vector<int> m_fds;
+};
+
+const EventGroup& threadGroup() {
+    thread_local const EventGroup group(0, -1);
+    return group;
+}
+
+}  // namespace
+#endif
+
+PerfEvents::Scope PerfEvents::scope() {
+#if defined(__linux__)
+    static const Scope scope = EventGroup(0, -1).valid() ? Scope::Thread : Scope::None;
+    return scope;
+#else
+    return Scope::None;
+#endif
+}
+
+const char* PerfEvents::scopeName(Scope scope) {
+    switch (scope) {
+    case Scope::Thread:
+        return "thread";
+    case Scope::None:
+        break;
+    }
+    return "none";
+}
+
+bool PerfEvents::read([[maybe_unused]] HwCounters& counters) {
+#if defined(__linux__)
+    switch (scope()) {
+    case Scope::Thread:
+        counters = {};
+        return threadGroup().read(counters);
+    case Scope::None:
+        break;
+    }
+#endif
+    return false;
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,60 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Values of the hardware counters sampled by the extended profiling.
+ */
+struct HwCounters {
+    uint64_t cycles = 0;
+    uint64_t instructions = 0;
+    uint64_t llcMisses = 0;
+
+    HwCounters& operator+=(const HwCounters& other) {
+        cycles += other.cycles;
+        instructions += other.instructions;
+        llcMisses += other.llcMisses;
+        return *this;
+    }
+
+    // the counters only grow, but the scaled values of the multiplexed counters may go back slightly
+    [[nodiscard]] HwCounters since(const HwCounters& start) const {
+        auto delta = [](uint64_t finish, uint64_t begin) {
+            return finish > begin ? finish - begin : 0;
+        };
+        return {delta(cycles, start.cycles),
+                delta(instructions, start.instructions),
+                delta(llcMisses, start.llcMisses)};
+    }
+};
+
+/**
+ * @brief The cycles, instructions and last level cache misses counted with perf_event_open (Linux only).
+ *
+ * The counters belong to the thread executing the node, so they do not include the work done by the other threads of
+ * the stream in the parallel regions of the node, nor anything else running on the machine. Opening them requires
+ * perf_event_paranoid <= 2 (or CAP_PERFMON).
+ */
+class PerfEvents {
+public:
+    enum class Scope : uint8_t {
+        None,
+        Thread,
+    };
+
+    // chosen once per process
+    static Scope scope();
+
+    static const char* scopeName(Scope scope);
+
+    // the running totals of the counters in the scope, false if they are not available
+    static bool read(HwCounters& counters);
+};
+
+}  // namespace ov::intel_cpu
@@ -4,19 +4,19 @@
 
 #include "weights_cache.hpp"
 
+#include <algorithm>
 #include <atomic>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <utility>
-#ifdef CPU_DEBUG_CAPS
-#    include <vector>
-#endif
+#include <vector>
 
 #include "cpu_memory.h"
+#include "internal_properties.hpp"
 #include "openvino/core/except.hpp"
-#include "openvino/runtime/system_conf.hpp"
+#include "utils/debug_capabilities.h"
 
 namespace ov::intel_cpu {
 
@@ -39,6 +39,40 @@ void WeightsSharing::SharedMemory::valid(bool b) {
     memory->valid.store(b, std::memory_order_release);
 }
 
+WeightsSharing::WeightsSharing(WeightsNumaPolicy numaPolicy, int numaNode, bool useHugePages)
+    : policy(numaPolicy),
+      numaNodeId(numaNode),
+      hugePages(useHugePages) {}
+
+void WeightsSharing::place(const MemoryPtr& memory) const {
+    if (!memory) {
+        return;
+    }
+    void* data = memory->getData();
+    const auto size = memory->getSize();
+    if (!data || size == 0) {
+        return;
+    }
+    switch (policy) {
+    case WeightsNumaPolicy::LOCAL:
+    case WeightsNumaPolicy::REPLICATE:
+        if (numaNodeId >= 0 && !mbind_move(data, size, numaNodeId)) {
+            DEBUG_LOG("WeightsSharing: binding ", size, " bytes to node ", numaNodeId, " failed");
+        }
+        break;
+    case WeightsNumaPolicy::INTERLEAVE:
+        if (!mbind_interleave(data, size)) {
+            DEBUG_LOG("WeightsSharing: interleaving ", size, " bytes failed");
+        }
+        break;
+    default:
+        break;
+    }
+    if (hugePages) {
+        madvise_huge_pages(data, size);
+    }
+}
+
 WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreate(const std::string& key,
                                                                const std::function<MemoryPtr(void)>& create,
                                                                bool valid) {
@@ -62,6 +96,7 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreate(const std::string
 
         if (!isCached()) {
             newPtr = create();
+            place(newPtr);
             ptr = std::make_shared<MemoryInfo>(newPtr, valid);
             sharedWeights[key] = ptr;
         }
@@ -93,26 +128,31 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::get(const std::string& key) co
                                           newPtr);
 }
 
-SocketsWeights::SocketsWeights() {
-    int num_sockets = get_num_sockets();
-    for (int socket_id = 0; socket_id < num_sockets; socket_id++) {
-        _cache_map[socket_id] = std::make_shared<WeightsSharing>();
+SocketsWeights::SocketsWeights(WeightsNumaPolicy policy, bool hugePages) : _policy(policy), _huge_pages(hugePages) {}
+
+WeightsSharing::Ptr SocketsWeights::get(int socket_id, int numa_node_id) {
+    int id = 0;
+    switch (_policy) {
+    case WeightsNumaPolicy::INTERLEAVE:
+        id = 0;
+        break;
+    case WeightsNumaPolicy::REPLICATE:
+        id = std::max(0, numa_node_id);
+        break;
+    default:
+        id = std::max(0, socket_id);
+        break;
     }
-}
 
-WeightsSharing::Ptr& SocketsWeights::operator[](int socket_id) {
-    auto found = _cache_map.find(socket_id);
-    OPENVINO_ASSERT(found != _cache_map.end(), "Unknown socket id ", socket_id);
-    return found->second;
-}
-
-const WeightsSharing::Ptr& SocketsWeights::operator[](int socket_id) const {
-    auto found = _cache_map.find(socket_id);
-    OPENVINO_ASSERT(found != _cache_map.end(), "Unknown socket id ", socket_id);
-    return found->second;
+    std::lock_guard<std::mutex> lock(_guard);
+    auto& cache = _cache_map[id];
+    if (!cache) {
+        // LOCAL binds the copy of the socket to the node of the stream which requests it first
+        cache = std::make_shared<WeightsSharing>(_policy, numa_node_id, _huge_pages);
+    }
+    return cache;
 }
 
-#ifdef CPU_DEBUG_CAPS
 WeightsSharing::Statistics WeightsSharing::dumpStatistics() const {
     Statistics retVal = {0, 0};
 
@@ -131,6 +171,7 @@ WeightsSharing::Statistics WeightsSharing::dumpStatistics() const {
 
 std::vector<std::pair<int, WeightsSharing::Statistics>> SocketsWeights::dumpStatistics() const {
     std::vector<std::pair<int, WeightsSharing::Statistics>> retVal;
+    std::lock_guard<std::mutex> lock(_guard);
     for (const auto& item : _cache_map) {
         if (item.second) {
             retVal.emplace_back(item.first, item.second->dumpStatistics());
@@ -139,5 +180,5 @@ std::vector<std::pair<int, WeightsSharing::Statistics>> SocketsWeights::dumpStat
 
     return retVal;
 }
-#endif  // CPU_DEBUG_CAPS
+
 }  // namespace ov::intel_cpu
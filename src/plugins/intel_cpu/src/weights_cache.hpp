@@ -16,6 +16,7 @@
 #include <vector>
 
 #include "cpu_memory.h"
+#include "internal_properties.hpp"
 
 // TODO: While CPU plugin has no ease way to clone graph object we use weight
 //       caching in global Engine context to avoid tensor memory duplication.
@@ -27,6 +28,7 @@ namespace ov::intel_cpu {
 /**
  * Caching store of Memory objects
  * Will return a cached object or create new one
+ * The created objects are placed on the NUMA nodes according to the placement policy
  *
  * Is a thread safe
  */
@@ -42,15 +44,21 @@ class WeightsSharing {
     };
 
 public:
-#ifdef CPU_DEBUG_CAPS
     struct Statistics {
         size_t total_size;  // bytes
         size_t total_memory_objects;
     };
-#endif  // CPU_DEBUG_CAPS
 
     using Ptr = std::shared_ptr<WeightsSharing>;
 
+    WeightsSharing() = default;
+    /**
+     * @param numaPolicy placement of the created objects
+     * @param numaNode the node the objects are bound to by the LOCAL and REPLICATE policies
+     * @param useHugePages whether the created objects are advised to be backed by the transparent huge pages
+     */
+    WeightsSharing(WeightsNumaPolicy numaPolicy, int numaNode, bool useHugePages);
+
     class SharedMemory {
     public:
         using Ptr = std::shared_ptr<SharedMemory>;
@@ -73,32 +81,46 @@ public:
 
     SharedMemory::Ptr get(const std::string& key) const;
 
-#ifdef CPU_DEBUG_CAPS
     Statistics dumpStatistics() const;
-#endif  // CPU_DEBUG_CAPS
 
 protected:
+    void place(const MemoryPtr& memory) const;
+
     mutable std::mutex guard;
     std::unordered_map<std::string, MemoryInfo::Ptr> sharedWeights;
+    WeightsNumaPolicy policy = WeightsNumaPolicy::FIRST_TOUCH;
+    int numaNodeId = -1;
+    bool hugePages = false;
 };
 
 /**
- * Collection of memory caching store per socket
+ * Collection of memory caching stores, one per socket, per NUMA node or a single one depending on the NUMA policy
  *
  * Is a thread safe
  */
 class SocketsWeights {
 public:
-    SocketsWeights();
+    explicit SocketsWeights(WeightsNumaPolicy policy = WeightsNumaPolicy::FIRST_TOUCH, bool hugePages = false);
+
+    /**
+     * @brief The caching store of the streams running on the socket and the NUMA node, created on the first request
+     */
+    WeightsSharing::Ptr get(int socket_id, int numa_node_id);
 
-    WeightsSharing::Ptr& operator[](int socket_id);
-    const WeightsSharing::Ptr& operator[](int socket_id) const;
+    [[nodiscard]] WeightsNumaPolicy getPolicy() const {
+        return _policy;
+    }
 
-#ifdef CPU_DEBUG_CAPS
+    /**
+     * @brief The statistics by the caching store: by the socket id for the FIRST_TOUCH and LOCAL policies, by the NUMA
+     * node id for REPLICATE and a single store with id 0 for INTERLEAVE
+     */
     [[nodiscard]] std::vector<std::pair<int, WeightsSharing::Statistics>> dumpStatistics() const;
-#endif  // CPU_DEBUG_CAPS
 
 private:
+    WeightsNumaPolicy _policy;
+    bool _huge_pages;
+    mutable std::mutex _guard;
     std::map<int, WeightsSharing::Ptr> _cache_map;
 };
 
@@ -0,0 +1,153 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "common_test_utils/node_builders/convolution.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/runtime/core.hpp"
+
+// These benchmarks measure wall-clock timing and are meaningless in a Debug (-O0) build.
+#ifndef NDEBUG
+#    error \
+        "hot_shapes_benchmark.cpp must be built in Release mode: rebuild with -DCMAKE_BUILD_TYPE=Release, or delete this #error to build in Debug anyway."
+#endif
+
+// The latency of the first requests of an imported dynamic model with and without the warm-up of the hot shapes
+// recorded before the export. The oneDNN primitive cache is shared by the whole process, so run the benchmark with
+// ONEDNN_PRIMITIVE_CACHE_CAPACITY=0 to see the cold start of a new process.
+
+namespace ov::test {
+
+namespace {
+
+constexpr size_t channels = 16;
+
+std::shared_ptr<ov::Model> make_dynamic_conv_model() {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{-1, channels, -1, -1});
+    ov::Output<ov::Node> result = param;
+    for (size_t kernel : {3, 1, 3, 5}) {
+        const auto pad = static_cast<ptrdiff_t>(kernel / 2);
+        result = ov::test::utils::make_convolution(result,
+                                                   ov::element::f32,
+                                                   {kernel, kernel},
+                                                   {1, 1},
+                                                   {pad, pad},
+                                                   {pad, pad},
+                                                   {1, 1},
+                                                   ov::op::PadType::EXPLICIT,
+                                                   channels);
+        result = std::make_shared<ov::op::v0::Relu>(result);
+    }
+    return std::make_shared<ov::Model>(ov::OutputVector{result}, ov::ParameterVector{param}, "DynamicConv");
+}
+
+// the shapes of the traffic the model is served with: a few batch sizes over a few image sizes
+std::vector<ov::Shape> make_shape_trace() {
+    std::vector<ov::Shape> trace;
+    for (size_t batch : {1, 2, 4}) {
+        for (size_t size : {32, 48, 64, 96}) {
+            trace.push_back({batch, channels, size, size});
+        }
+    }
+    return trace;
+}
+
+uint64_t runtime_cache_size(const ov::CompiledModel& compiled_model) {
+    return compiled_model.get_property(ov::intel_cpu::cpu_runtime_cache_statistics)["size"];
+}
+
+// the warm-up runs in the background, so wait until it stops adding records to the runtime cache
+void wait_for_warm_up(const ov::CompiledModel& compiled_model) {
+    uint64_t size = runtime_cache_size(compiled_model);
+    for (int stable = 0, i = 0; stable < 3 && i < 200; i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        const auto current = runtime_cache_size(compiled_model);
+        stable = current == size ? stable + 1 : 0;
+        size = current;
+    }
+}
+
+double percentile(std::vector<double> values, double p) {
+    std::sort(values.begin(), values.end());
+    return values[std::min(values.size() - 1, static_cast<size_t>(p * static_cast<double>(values.size())))];
+}
+
+}  // namespace
+
+class HotShapesBenchmark : public ::testing::Test {};
+
+// Reports the latency of the first requests after import_model, each of them with the next shape of the trace
+TEST_F(HotShapesBenchmark, first_requests_latency) {
+    constexpr size_t imports = 5;
+    const auto trace = make_shape_trace();
+    const auto model = make_dynamic_conv_model();
+
+    ov::Core core;
+    std::stringstream exported_model;
+    {
+        auto compiled_model = core.compile_model(model,
+                                                 ov::test::utils::DEVICE_CPU,
+                                                 ov::num_streams(1),
+                                                 ov::hint::inference_precision(ov::element::f32),
+                                                 ov::intel_cpu::cpu_runtime_cache_warmup_shapes(32));
+        auto request = compiled_model.create_infer_request();
+        for (size_t i = 0; i < 3; i++) {
+            for (const auto& shape : trace) {
+                request.set_input_tensor(ov::test::utils::create_and_fill_tensor(ov::element::f32, shape));
+                request.infer();
+            }
+        }
+        compiled_model.export_model(exported_model);
+    }
+
+    printf("\n--- Latency of the first %zu requests after import_model, %zu imports ---\n", trace.size(), imports);
+    printf("%-10s | %12s | %12s | %14s\n", "Warm-up", "p50 (ms)", "p99 (ms)", "import (ms)");
+    printf("-----------+--------------+--------------+---------------\n");
+    for (const int warmup_shapes : {0, 32}) {
+        std::vector<double> latencies;
+        double import_ms = 0;
+        for (size_t i = 0; i < imports; i++) {
+            std::stringstream ss(exported_model.str());
+            const auto start = std::chrono::steady_clock::now();
+            auto compiled_model = core.import_model(ss,
+                                                    ov::test::utils::DEVICE_CPU,
+                                                    {ov::num_streams(1),
+                                                     ov::hint::inference_precision(ov::element::f32),
+                                                     ov::intel_cpu::cpu_runtime_cache_warmup_shapes(warmup_shapes)});
+            import_ms += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            if (warmup_shapes != 0) {
+                wait_for_warm_up(compiled_model);
+            }
+
+            auto request = compiled_model.create_infer_request();
+            for (const auto& shape : trace) {
+                request.set_input_tensor(ov::test::utils::create_and_fill_tensor(ov::element::f32, shape));
+                const auto request_start = std::chrono::steady_clock::now();
+                request.infer();
+                latencies.push_back(
+                    std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - request_start)
+                        .count());
+            }
+        }
+        printf("%-10s | %12.2f | %12.2f | %14.2f\n",
+               warmup_shapes != 0 ? "on" : "off",
+               percentile(latencies, 0.5),
+               percentile(latencies, 0.99),
+               import_ms / imports);
+    }
+}
+
+}  // namespace ov::test
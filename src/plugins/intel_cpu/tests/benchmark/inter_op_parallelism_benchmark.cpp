@@ -0,0 +1,179 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <sstream>
+#include <vector>
+
+#include "common_test_utils/node_builders/convolution.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/concat.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/gelu.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/max_pool.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/reduce_mean.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/sigmoid.hpp"
+#include "openvino/runtime/core.hpp"
+
+// These benchmarks measure wall-clock timing and are meaningless in a Debug (-O0) build.
+#ifndef NDEBUG
+#    error \
+        "inter_op_parallelism_benchmark.cpp must be built in Release mode: rebuild with -DCMAKE_BUILD_TYPE=Release, or delete this #error to build in Debug anyway."
+#endif
+
+// The multi-branch models of the InterOpParallelismCPUTest functional test
+
+namespace ov::test {
+
+enum class MultiBranchModel { MultiTower, Inception, QKV };
+
+std::ostream& operator<<(std::ostream& os, MultiBranchModel model) {
+    switch (model) {
+    case MultiBranchModel::MultiTower:
+        return os << "MultiTower";
+    case MultiBranchModel::Inception:
+        return os << "Inception";
+    case MultiBranchModel::QKV:
+        return os << "QKV";
+    }
+    return os;
+}
+
+namespace {
+
+std::shared_ptr<ov::Node> make_const(const ov::Shape& shape, float start) {
+    std::vector<float> values(ov::shape_size(shape));
+    for (size_t i = 0; i < values.size(); i++) {
+        values[i] = start + 0.01f * static_cast<float>(i % 17);
+    }
+    return ov::op::v0::Constant::create(ov::element::f32, shape, values);
+}
+
+std::shared_ptr<ov::Model> make_multi_tower() {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 32, 64, 64});
+    auto axes = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{2}, {2, 3});
+    ov::OutputVector towers;
+    for (size_t t = 0; t < 4; t++) {
+        ov::Output<ov::Node> tower = param;
+        for (size_t l = 0; l < 3; l++) {
+            tower = std::make_shared<ov::op::v1::Multiply>(tower, make_const({1, 32, 1, 1}, 0.5f + 0.1f * t));
+            tower = std::make_shared<ov::op::v0::Sigmoid>(tower);
+        }
+        towers.push_back(std::make_shared<ov::op::v1::ReduceMean>(tower, axes, true));
+    }
+    auto concat = std::make_shared<ov::op::v0::Concat>(towers, 1);
+    return std::make_shared<ov::Model>(ov::OutputVector{concat}, ov::ParameterVector{param}, "MultiTower");
+}
+
+std::shared_ptr<ov::Model> make_inception() {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 64, 28, 28});
+    auto conv = [](const ov::Output<ov::Node>& in, size_t kernel, size_t channels) {
+        const auto pad = static_cast<ptrdiff_t>(kernel / 2);
+        auto result = ov::test::utils::make_convolution(in,
+                                                        ov::element::f32,
+                                                        {kernel, kernel},
+                                                        {1, 1},
+                                                        {pad, pad},
+                                                        {pad, pad},
+                                                        {1, 1},
+                                                        ov::op::PadType::EXPLICIT,
+                                                        channels);
+        return std::make_shared<ov::op::v0::Relu>(result);
+    };
+    auto branch1 = conv(param, 1, 32);
+    auto branch3 = conv(conv(param, 1, 48), 3, 64);
+    auto branch5 = conv(conv(param, 1, 16), 5, 32);
+    auto pool = std::make_shared<ov::op::v1::MaxPool>(param,
+                                                      ov::Strides{1, 1},
+                                                      ov::Shape{1, 1},
+                                                      ov::Shape{1, 1},
+                                                      ov::Shape{3, 3});
+    auto branchPool = conv(pool, 1, 32);
+    auto concat = std::make_shared<ov::op::v0::Concat>(ov::OutputVector{branch1, branch3, branch5, branchPool}, 1);
+    return std::make_shared<ov::Model>(ov::OutputVector{concat}, ov::ParameterVector{param}, "Inception");
+}
+
+std::shared_ptr<ov::Model> make_qkv() {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 128, 256});
+    ov::OutputVector projections;
+    for (size_t p = 0; p < 3; p++) {
+        auto matmul = std::make_shared<ov::op::v0::MatMul>(param, make_const({256, 256}, -0.08f), false, false);
+        auto bias = std::make_shared<ov::op::v1::Add>(matmul, make_const({256}, 0.1f * p));
+        projections.push_back(std::make_shared<ov::op::v7::Gelu>(bias));
+    }
+    auto concat = std::make_shared<ov::op::v0::Concat>(projections, 2);
+    return std::make_shared<ov::Model>(ov::OutputVector{concat}, ov::ParameterVector{param}, "QKV");
+}
+
+std::shared_ptr<ov::Model> make_model(MultiBranchModel model) {
+    switch (model) {
+    case MultiBranchModel::MultiTower:
+        return make_multi_tower();
+    case MultiBranchModel::Inception:
+        return make_inception();
+    case MultiBranchModel::QKV:
+        return make_qkv();
+    }
+    OPENVINO_THROW("Unexpected model");
+}
+
+const std::vector<MultiBranchModel> models = {MultiBranchModel::MultiTower,
+                                              MultiBranchModel::Inception,
+                                              MultiBranchModel::QKV};
+
+}  // namespace
+
+class InterOpParallelismBenchmark : public ::testing::Test {};
+
+// Reports the median latency of the sequential and of the concurrent execution of every model
+TEST_F(InterOpParallelismBenchmark, latency) {
+    printf("\n--- Median latency of the multi-branch models ---\n");
+    printf("%-12s | %-12s | %14s\n", "Model", "Execution", "p50 (us)");
+    printf("-------------+--------------+---------------\n");
+    ov::Core core;
+    for (const auto model_type : models) {
+        auto model = make_model(model_type);
+        auto input = ov::test::utils::create_and_fill_tensor(ov::element::f32, model->input().get_shape());
+        for (bool inter_op : {false, true}) {
+            auto compiled_model = core.compile_model(model,
+                                                     ov::test::utils::DEVICE_CPU,
+                                                     ov::hint::performance_mode(ov::hint::PerformanceMode::LATENCY),
+                                                     ov::hint::inference_precision(ov::element::f32),
+                                                     ov::intel_cpu::cpu_inter_op_parallelism(inter_op));
+            ASSERT_EQ(inter_op, compiled_model.get_property(ov::intel_cpu::cpu_inter_op_parallelism));
+            auto request = compiled_model.create_infer_request();
+            request.set_input_tensor(input);
+            for (size_t i = 0; i < 10; i++) {
+                request.infer();
+            }
+            std::vector<double> latencies;
+            for (size_t i = 0; i < 200; i++) {
+                const auto start = std::chrono::steady_clock::now();
+                request.infer();
+                latencies.push_back(
+                    std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+            }
+            std::sort(latencies.begin(), latencies.end());
+            std::ostringstream name;
+            name << model_type;
+            printf("%-12s | %-12s | %14.2f\n",
+                   name.str().c_str(),
+                   inter_op ? "inter_op" : "sequential",
+                   latencies[latencies.size() / 2]);
+        }
+    }
+}
+
+}  // namespace ov::test
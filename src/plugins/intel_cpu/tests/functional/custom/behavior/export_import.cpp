@@ -5,6 +5,8 @@
 #include "openvino/runtime/core.hpp"
 #include "openvino/runtime/compiled_model.hpp"
 #include "common_test_utils/test_common.hpp"
+#include "common_test_utils/common_utils.hpp"
+#include "common_test_utils/file_utils.hpp"
 #include "common_test_utils/node_builders/eltwise.hpp"
 #include "common_test_utils/node_builders/constant.hpp"
 #include "functional_test_utils/skip_tests_config.hpp"
@@ -12,6 +14,10 @@
 #include "openvino/op/matmul.hpp"
 #include "openvino/op/softmax.hpp"
 #include "openvino/opsets/opset9_decl.hpp"
+#include "internal_properties.hpp"
+
+#include <chrono>
+#include <thread>
 
 namespace {
 
@@ -124,4 +130,104 @@ INSTANTIATE_TEST_SUITE_P(smoke_ExportImportTest,
                                                              testing_property_for_enable_hyper_threading,
                                                              testing_property_for_enable_cpu_pinning)));
 
+// The input shapes a dynamic model is executed with are exported together with it, and after import their executors
+// are prebuilt in the background, so the runtime cache is warm before the first request.
+std::shared_ptr<ov::Model> MakeDynamicMatMulModel() {
+    ov::ParameterVector params{std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{-1, 64})};
+    auto matmul_const = ov::test::utils::make_constant(ov::element::f32, {64, 32});
+    auto matmul = std::make_shared<ov::op::v0::MatMul>(params[0], matmul_const);
+    auto softmax = std::make_shared<ov::opset9::Softmax>(matmul);
+    return std::make_shared<ov::Model>(ov::OutputVector{softmax}, params, "DynamicMatMulModel");
+}
+
+// replay of a recorded shape trace
+void InferShapeTrace(ov::CompiledModel& compiled_model) {
+    auto request = compiled_model.create_infer_request();
+    for (size_t batch : {1, 7, 7, 16, 7, 1}) {
+        request.set_input_tensor(ov::Tensor(ov::element::f32, {batch, 64}));
+        request.infer();
+    }
+}
+
+uint64_t RuntimeCacheSize(const ov::CompiledModel& compiled_model) {
+    auto statistics = compiled_model.get_property(ov::intel_cpu::cpu_runtime_cache_statistics);
+    return statistics["size"];
+}
+
+// the warm-up runs in the background, so wait until it has prebuilt more than a cold start
+void ExpectWarmedUp(const ov::CompiledModel& compiled_model, uint64_t cold_size) {
+    uint64_t warm_size = RuntimeCacheSize(compiled_model);
+    for (int i = 0; i < 100 && warm_size <= cold_size; i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        warm_size = RuntimeCacheSize(compiled_model);
+    }
+    EXPECT_GT(warm_size, cold_size);
+}
+
+TEST(ExportImportHotShapes, smoke_ImportPrebuildsRecordedShapes) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    auto model = MakeDynamicMatMulModel();
+
+    ov::Core core;
+    auto compiled_model =
+        core.compile_model(model, "CPU", {ov::num_streams(1), ov::intel_cpu::cpu_runtime_cache_warmup_shapes(32)});
+    InferShapeTrace(compiled_model);
+    std::stringstream exported_model;
+    compiled_model.export_model(exported_model);
+
+    uint64_t cold_size = 0;
+    {
+        std::stringstream ss(exported_model.str());
+        auto imported = core.import_model(ss,
+                                          "CPU",
+                                          {ov::num_streams(1), ov::intel_cpu::cpu_runtime_cache_warmup_shapes(0)});
+        cold_size = RuntimeCacheSize(imported);
+    }
+
+    std::stringstream ss(exported_model.str());
+    auto imported =
+        core.import_model(ss, "CPU", {ov::num_streams(1), ov::intel_cpu::cpu_runtime_cache_warmup_shapes(32)});
+    ExpectWarmedUp(imported, cold_size);
+
+    // the imported records are kept, so the warm-up survives the next export/import cycle as well
+    std::stringstream reexported_model;
+    imported.export_model(reexported_model);
+    EXPECT_NE(reexported_model.str().find("{7,64}"), std::string::npos);
+}
+
+TEST(ExportImportHotShapes, smoke_CacheDirPrebuildsRecordedShapes) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    auto model = MakeDynamicMatMulModel();
+    const std::string cache_dir = ov::test::utils::generateTestFilePrefix() + "_hot_shapes_cache";
+
+    ov::Core core;
+    core.set_property(ov::cache_dir(cache_dir));
+    {
+        // the core exports the blob right here, before any inference
+        auto compiled_model =
+            core.compile_model(model, "CPU", {ov::num_streams(1), ov::intel_cpu::cpu_runtime_cache_warmup_shapes(32)});
+        ASSERT_FALSE(compiled_model.get_property(ov::loaded_from_cache));
+        InferShapeTrace(compiled_model);
+        // the recorded shapes are saved to the cache directory when the compiled model is released
+    }
+
+    uint64_t cold_size = 0;
+    {
+        auto compiled_model =
+            core.compile_model(model, "CPU", {ov::num_streams(1), ov::intel_cpu::cpu_runtime_cache_warmup_shapes(0)});
+        ASSERT_TRUE(compiled_model.get_property(ov::loaded_from_cache));
+        cold_size = RuntimeCacheSize(compiled_model);
+    }
+
+    auto compiled_model =
+        core.compile_model(model, "CPU", {ov::num_streams(1), ov::intel_cpu::cpu_runtime_cache_warmup_shapes(32)});
+    ASSERT_TRUE(compiled_model.get_property(ov::loaded_from_cache));
+    ExpectWarmedUp(compiled_model, cold_size);
+
+    compiled_model = {};
+    ov::test::utils::removeFilesWithExt(cache_dir, "blob");
+    ov::test::utils::removeFilesWithExt(cache_dir, "hot_shapes");
+    ov::test::utils::removeDir(cache_dir);
+}
+
 }  // namespace
@@ -6,7 +6,12 @@
 
 #include <gtest/gtest.h>
 
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
 #include "common_test_utils/ov_tensor_utils.hpp"
+#include "common_test_utils/subgraph_builders/conv_pool_relu.hpp"
 #include "common_test_utils/subgraph_builders/matmul_bias.hpp"
 #include "internal_properties.hpp"
 #include "openvino/runtime/compiled_model.hpp"
@@ -48,6 +53,20 @@ TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkSupportedPropertiesAreAvailable
         RO_property(ov::log::level.name()),
         RO_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
         RO_property(ov::intel_cpu::enable_tensor_parallel.name()),
+        RO_property(ov::intel_cpu::cpu_runtime_cache_shared.name()),
+        RO_property(ov::intel_cpu::cpu_runtime_cache_warmup_shapes.name()),
+        RO_property(ov::intel_cpu::cpu_runtime_cache_statistics.name()),
+        RO_property(ov::intel_cpu::cpu_inter_op_parallelism.name()),
+        RO_property(ov::intel_cpu::cpu_extended_profiling.name()),
+        RO_property(ov::intel_cpu::cpu_state_swap_dir.name()),
+        RO_property(ov::intel_cpu::cpu_state_swap_budget.name()),
+        RO_property(ov::intel_cpu::cpu_weights_numa_policy.name()),
+        RO_property(ov::intel_cpu::cpu_weights_huge_pages.name()),
+        RO_property(ov::intel_cpu::cpu_weights_cache_statistics.name()),
+        RO_property(ov::intel_cpu::cpu_dynamic_memory_growth.name()),
+        RO_property(ov::intel_cpu::cpu_dynamic_memory_shrink_after.name()),
+        RO_property(ov::intel_cpu::cpu_dynamic_memory_pool.name()),
+        RO_property(ov::intel_cpu::cpu_dynamic_memory_statistics.name()),
         RO_property(ov::intel_cpu::tbb_partitioner.name()),
         RO_property(ov::hint::dynamic_quantization_group_size.name()),
         RO_property(ov::hint::kv_cache_precision.name()),
@@ -543,4 +562,82 @@ TEST_F(OVClassConfigTestCPU, smoke_CpuModelDistributionPolicyTensorParallel) {
     ASSERT_EQ(enable_tensor_parallel, true);
 }
 
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckSharedRuntimeCache) {
+    ov::Core core;
+    // convolution and pooling executors are looked up in the runtime parameters cache
+    std::shared_ptr<ov::Model> model = ov::test::utils::make_conv_pool_relu();
+
+    auto get_statistics = [&](bool shared) {
+        // the graphs of both streams are created at compilation, each one looks up the same executors
+        ov::CompiledModel compiledModel = core.compile_model(model,
+                                                             deviceName,
+                                                             ov::num_streams(2),
+                                                             ov::intel_cpu::cpu_runtime_cache_shared(shared));
+        bool cache_shared = !shared;
+        EXPECT_NO_THROW(cache_shared = compiledModel.get_property(ov::intel_cpu::cpu_runtime_cache_shared));
+        EXPECT_EQ(cache_shared, shared);
+
+        std::map<std::string, uint64_t> statistics;
+        EXPECT_NO_THROW(statistics = compiledModel.get_property(ov::intel_cpu::cpu_runtime_cache_statistics));
+        for (const auto& counter : {"hits", "misses", "evictions", "size"}) {
+            EXPECT_EQ(statistics.count(counter), 1U) << counter;
+        }
+        return statistics;
+    };
+
+    auto privateStatistics = get_statistics(false);
+    auto sharedStatistics = get_statistics(true);
+    // both streams do the same lookups
+    ASSERT_EQ(sharedStatistics["hits"] + sharedStatistics["misses"],
+              privateStatistics["hits"] + privateStatistics["misses"]);
+    ASSERT_GT(privateStatistics["misses"], 0U);
+    // the executors built by the first stream are found by the second one in the shared cache only
+    ASSERT_GT(sharedStatistics["hits"], privateStatistics["hits"]);
+    ASSERT_LT(sharedStatistics["misses"], privateStatistics["misses"]);
+    ASSERT_LT(sharedStatistics["size"], privateStatistics["size"]);
+}
+
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckExtendedProfiling) {
+    ov::Core core;
+    std::shared_ptr<ov::Model> model = ov::test::utils::make_matmul_bias();
+    const auto dir = std::filesystem::temp_directory_path() / "cpu_extended_profiling_test";
+    std::filesystem::remove_all(dir);
+    std::filesystem::create_directories(dir);
+    const auto prefix = (dir / "report").string();
+
+    {
+        ov::CompiledModel compiledModel =
+            core.compile_model(model, deviceName, ov::num_streams(1), ov::intel_cpu::cpu_extended_profiling(prefix));
+        ASSERT_EQ(compiledModel.get_property(ov::intel_cpu::cpu_extended_profiling), prefix);
+        // the extended profiling implies the regular one
+        ASSERT_TRUE(compiledModel.get_property(ov::enable_profiling));
+
+        auto request = compiledModel.create_infer_request();
+        for (size_t i = 0; i < 10; i++) {
+            request.infer();
+        }
+        bool executed = false;
+        for (const auto& info : request.get_profiling_info()) {
+            executed = executed || info.status == ov::ProfilingInfo::Status::EXECUTED;
+        }
+        ASSERT_TRUE(executed);
+    }
+
+    // the report is written when the graph is released
+    size_t reports = 0;
+    for (const auto& entry : std::filesystem::directory_iterator(dir)) {
+        ASSERT_EQ(entry.path().extension(), ".json");
+        std::ifstream file(entry.path());
+        std::stringstream content;
+        content << file.rdbuf();
+        for (const auto& key : {"\"hw_counters_scope\"", "\"latency_ns\"", "\"count\": 10,", "\"p99\""}) {
+            EXPECT_NE(content.str().find(key), std::string::npos) << key;
+        }
+        reports++;
+    }
+    EXPECT_EQ(reports, 1U);
+    std::filesystem::remove_all(dir);
+}
+
 }  // namespace
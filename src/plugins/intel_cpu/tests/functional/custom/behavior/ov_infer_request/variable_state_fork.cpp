@@ -0,0 +1,208 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include "openvino/op/assign.hpp"
+#include "openvino/op/concat.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/gather.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/read_value.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/op/scaled_dot_product_attention.hpp"
+#include "openvino/op/util/variable.hpp"
+#include "openvino/runtime/core.hpp"
+
+namespace {
+
+constexpr size_t heads = 2;
+constexpr size_t head_size = 16;
+
+// q, k, v [1, H, L, S] and the past key and value read from and assigned to the variables, as in the stateful LLMs
+std::shared_ptr<ov::Model> make_stateful_sdpa_model() {
+    const ov::PartialShape shape{1, heads, -1, head_size};
+    ov::ParameterVector params;
+    for (const auto* name : {"q", "k", "v", "past"}) {
+        params.push_back(std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape));
+        params.back()->set_friendly_name(name);
+    }
+    auto beam_idx = std::make_shared<ov::op::v0::Parameter>(ov::element::i32, ov::PartialShape{-1});
+    beam_idx->set_friendly_name("beam_idx");
+    params.push_back(beam_idx);
+
+    const auto axis = ov::op::v0::Constant::create(ov::element::i32, {1}, {0});
+    ov::OutputVector present;
+    ov::SinkVector sinks;
+    for (const auto* name : {"pastk", "pastv"}) {
+        auto variable =
+            std::make_shared<ov::op::util::Variable>(ov::op::util::VariableInfo{shape, ov::element::f32, name});
+        auto past = std::make_shared<ov::op::v6::ReadValue>(params[3], variable);
+        auto gather = std::make_shared<ov::op::v8::Gather>(past, beam_idx, axis);
+        // the key is appended to the first variable, the value to the second one
+        const auto& current = params[present.empty() ? 1 : 2];
+        auto concat = std::make_shared<ov::op::v0::Concat>(ov::OutputVector{gather, current}, 2);
+        sinks.push_back(std::make_shared<ov::op::v6::Assign>(concat, variable));
+        present.push_back(concat);
+    }
+    auto sdpa = std::make_shared<ov::op::v13::ScaledDotProductAttention>(params[0], present[0], present[1], false);
+    return std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(sdpa)},
+                                       sinks,
+                                       params,
+                                       "StatefulSDPA");
+}
+
+ov::Tensor make_tokens(size_t tokens, float start) {
+    ov::Tensor tensor(ov::element::f32, {1, heads, tokens, head_size});
+    auto* data = tensor.data<float>();
+    for (size_t i = 0; i < tensor.get_size(); i++) {
+        data[i] = start + 0.01f * static_cast<float>(i % 113);
+    }
+    return tensor;
+}
+
+// appends the tokens to the KV cache of the request, q, k and v are filled with the same values
+ov::Tensor infer(ov::InferRequest& request, size_t tokens, float start) {
+    const auto input = make_tokens(tokens, start);
+    for (const auto* name : {"q", "k", "v"}) {
+        request.set_tensor(name, input);
+    }
+    request.set_tensor("past", ov::Tensor(ov::element::f32, {1, heads, 0, head_size}));
+    request.set_tensor("beam_idx", ov::Tensor(ov::element::i32, {1}, std::vector<int32_t>{0}.data()));
+    request.infer();
+    const auto output = request.get_output_tensor();
+    ov::Tensor copy(output.get_element_type(), output.get_shape());
+    output.copy_to(copy);
+    return copy;
+}
+
+std::map<std::string, ov::Tensor> states_of(ov::InferRequest& request) {
+    std::map<std::string, ov::Tensor> states;
+    for (auto& state : request.query_state()) {
+        const auto value = state.get_state();
+        ov::Tensor copy(value.get_element_type(), value.get_shape());
+        value.copy_to(copy);
+        states[state.get_name()] = copy;
+    }
+    return states;
+}
+
+// the first tokens of the [1, H, L, S] states are the same
+bool same_tokens(const ov::Tensor& a, const ov::Tensor& b, size_t tokens) {
+    const auto* a_data = a.data<const float>();
+    const auto* b_data = b.data<const float>();
+    for (size_t h = 0; h < heads; h++) {
+        const auto* a_head = a_data + h * a.get_shape()[2] * head_size;
+        const auto* b_head = b_data + h * b.get_shape()[2] * head_size;
+        if (std::memcmp(a_head, b_head, tokens * head_size * sizeof(float)) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void expect_equal(const ov::Tensor& expected, const ov::Tensor& actual) {
+    ASSERT_EQ(expected.get_shape(), actual.get_shape());
+    EXPECT_EQ(0, std::memcmp(expected.data(), actual.data(), expected.get_byte_size()));
+}
+
+class VariableStateForkCPUTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        SKIP_IF_CURRENT_TEST_IS_DISABLED();
+        ov::Core core;
+        m_compiled_model = core.compile_model(make_stateful_sdpa_model(),
+                                              ov::test::utils::DEVICE_CPU,
+                                              ov::hint::inference_precision(ov::element::f32),
+                                              ov::hint::kv_cache_precision(ov::element::f32));
+    }
+
+    ov::CompiledModel m_compiled_model;
+};
+
+TEST_F(VariableStateForkCPUTest, ForkedRequestsDivergeAfterAppend) {
+    auto original = m_compiled_model.create_infer_request();
+    infer(original, 4, 0.5f);
+    const auto prefix = states_of(original);
+
+    auto forked = m_compiled_model.create_infer_request();
+    auto original_states = original.query_state();
+    for (auto& state : forked.query_state()) {
+        for (const auto& source : original_states) {
+            if (source.get_name() == state.get_name()) {
+                state.fork(source);
+            }
+        }
+    }
+    for (const auto& [name, value] : states_of(forked)) {
+        expect_equal(prefix.at(name), value);
+    }
+
+    // the requests append different tokens to the common prefix
+    infer(original, 1, 2.0f);
+    const auto forked_output = infer(forked, 1, 3.0f);
+    const auto original_states_after = states_of(original);
+    const auto forked_states_after = states_of(forked);
+    ASSERT_EQ(prefix.size(), original_states_after.size());
+    for (const auto& [name, value] : prefix) {
+        const auto& original_value = original_states_after.at(name);
+        const auto& forked_value = forked_states_after.at(name);
+        ASSERT_EQ(original_value.get_shape()[2], 5U);
+        ASSERT_EQ(forked_value.get_shape()[2], 5U);
+        EXPECT_TRUE(same_tokens(value, original_value, 4)) << name;
+        EXPECT_TRUE(same_tokens(value, forked_value, 4)) << name;
+        EXPECT_FALSE(same_tokens(original_value, forked_value, 5)) << name;
+    }
+
+    // the forked request computes what a request given the same tokens does
+    auto reference = m_compiled_model.create_infer_request();
+    infer(reference, 4, 0.5f);
+    expect_equal(infer(reference, 1, 3.0f), forked_output);
+}
+
+TEST_F(VariableStateForkCPUTest, SnapshotAndTruncateRollBack) {
+    auto request = m_compiled_model.create_infer_request();
+    infer(request, 4, 0.5f);
+    const auto prefix = states_of(request);
+    std::vector<ov::VariableState> snapshots;
+    for (auto& state : request.query_state()) {
+        snapshots.push_back(state.snapshot());
+    }
+
+    infer(request, 2, 2.0f);
+    // the snapshots are not changed by the inference
+    for (const auto& snapshot : snapshots) {
+        expect_equal(prefix.at(snapshot.get_name()), snapshot.get_state());
+    }
+
+    // the rejected tokens are dropped
+    for (auto& state : request.query_state()) {
+        state.truncate(4);
+    }
+    for (const auto& [name, value] : states_of(request)) {
+        expect_equal(prefix.at(name), value);
+    }
+
+    infer(request, 1, 3.0f);
+    for (auto& state : request.query_state()) {
+        for (const auto& snapshot : snapshots) {
+            if (snapshot.get_name() == state.get_name()) {
+                state.fork(snapshot);
+            }
+        }
+    }
+    for (const auto& [name, value] : states_of(request)) {
+        expect_equal(prefix.at(name), value);
+    }
+}
+
+}  // namespace
@@ -0,0 +1,158 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/subgraph_builders/weights_decompression_builders.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/embedding_segments_sum.hpp"
+#include "openvino/op/embeddingbag_offsets.hpp"
+#include "openvino/op/embeddingbag_packed.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/result.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+namespace ov {
+namespace test {
+
+/*
+ * The compressed table is read by the EmbeddingBag node directly, the decompression subgraph is fused into it:
+ *
+ *   Constant(u8/i8/u4)  Constant(zero points, optional)
+ *            |                   |
+ *         Convert             Convert
+ *             \                 /
+ *              Subtract(optional)   Constant(scales)
+ *                       \             /
+ *                         Multiply
+ *                            |
+ *        EmbeddingBagOffsets / EmbeddingBagPacked / EmbeddingSegmentsSum  <-- Parameter(per sample weights)
+ */
+enum class EmbeddingType { OFFSETS, PACKED, SEGMENTS_SUM };
+
+std::ostream& operator<<(std::ostream& os, EmbeddingType type) {
+    switch (type) {
+    case EmbeddingType::OFFSETS:
+        return os << "EmbeddingBagOffsets";
+    case EmbeddingType::PACKED:
+        return os << "EmbeddingBagPacked";
+    case EmbeddingType::SEGMENTS_SUM:
+        return os << "EmbeddingSegmentsSum";
+    }
+    return os;
+}
+
+typedef std::tuple<EmbeddingType,
+                   ElementType,  // compressed table
+                   bool          // with zero points
+                   >
+    embeddingBagDecompressionParams;
+
+class EmbeddingBagDecompressionCPUTest : public testing::WithParamInterface<embeddingBagDecompressionParams>,
+                                         virtual public SubgraphBaseTest,
+                                         public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<embeddingBagDecompressionParams>& obj) {
+        const auto& [embeddingType, tablePrecision, withZeroPoints] = obj.param;
+        std::ostringstream result;
+        result << embeddingType << "_";
+        result << "tablePRC=" << tablePrecision << "_";
+        result << "ZP=" << withZeroPoints;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        const auto& [_embeddingType, tablePrecision, withZeroPoints] = this->GetParam();
+        embeddingType = _embeddingType;
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        // the table is dequantized to f32 by the node, as it is by the reference
+        configuration.insert({ov::hint::inference_precision.name(), ov::element::f32});
+        abs_threshold = 1e-3;
+
+        // the rows of the 4-bit tables start at the byte boundary
+        const ov::Shape tableShape{16, 32};
+        const std::vector<int32_t> indices{0, 2, 15, 7, 2, 9, 9, 4};
+        const auto table = ov::test::utils::initGatherDecompressionSubgraph(
+            tableShape,
+            -1,
+            tablePrecision,
+            ov::element::f32,
+            ov::test::utils::DecompressionType::full,
+            withZeroPoints ? ov::test::utils::DecompressionType::full : ov::test::utils::DecompressionType::empty,
+            false);
+
+        const ov::Shape weightsShape = embeddingType == EmbeddingType::PACKED ? ov::Shape{4, 2} : ov::Shape{8};
+        init_input_shapes(static_shapes_to_test_representation({weightsShape}));
+        auto perSampleWeights = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, weightsShape);
+        auto scalar = [](int32_t value) {
+            return ov::op::v0::Constant::create(ov::element::i32, {}, {value});
+        };
+
+        std::shared_ptr<ov::Node> embedding;
+        switch (embeddingType) {
+        case EmbeddingType::OFFSETS: {
+            // the third bag is empty, it takes the default row
+            const auto indicesNode = ov::op::v0::Constant::create(ov::element::i32, {indices.size()}, indices);
+            const auto offsets = ov::op::v0::Constant::create(ov::element::i32, {4}, {0, 3, 3, 6});
+            embedding = std::make_shared<ov::op::v15::EmbeddingBagOffsets>(table,
+                                                                           indicesNode,
+                                                                           offsets,
+                                                                           scalar(5),
+                                                                           perSampleWeights);
+            break;
+        }
+        case EmbeddingType::PACKED: {
+            const auto indicesNode = ov::op::v0::Constant::create(ov::element::i32, {4, 2}, indices);
+            embedding = std::make_shared<ov::op::v15::EmbeddingBagPacked>(table, indicesNode, perSampleWeights);
+            break;
+        }
+        case EmbeddingType::SEGMENTS_SUM: {
+            // the segments 2 and 4 are empty, they take the default row
+            const auto indicesNode = ov::op::v0::Constant::create(ov::element::i32, {indices.size()}, indices);
+            const auto segmentIds = ov::op::v0::Constant::create(ov::element::i32, {8}, {0, 0, 1, 1, 1, 3, 3, 3});
+            embedding = std::make_shared<ov::op::v3::EmbeddingSegmentsSum>(table,
+                                                                           indicesNode,
+                                                                           segmentIds,
+                                                                           scalar(5),
+                                                                           scalar(5),
+                                                                           perSampleWeights);
+            break;
+        }
+        }
+        function = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(embedding)},
+                                               ov::ParameterVector{perSampleWeights},
+                                               "embeddingBagDecompression");
+    }
+
+    void check_results() {
+        std::ostringstream layerType;
+        layerType << embeddingType;
+        CheckNumberOfNodesWithType(compiledModel, layerType.str(), 1);
+        // the decompression subgraph is fused into the node
+        CheckNumberOfNodesWithTypes(compiledModel, {"Convert", "Eltwise", "Subgraph"}, 0);
+    }
+
+    EmbeddingType embeddingType = EmbeddingType::OFFSETS;
+};
+
+TEST_P(EmbeddingBagDecompressionCPUTest, CompareWithRefs) {
+    run();
+    check_results();
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_EmbeddingBagDecompression,
+                         EmbeddingBagDecompressionCPUTest,
+                         ::testing::Combine(::testing::Values(EmbeddingType::OFFSETS,
+                                                              EmbeddingType::PACKED,
+                                                              EmbeddingType::SEGMENTS_SUM),
+                                            ::testing::Values(ElementType::u8, ElementType::i8, ElementType::u4),
+                                            ::testing::Values(false, true)),
+                         EmbeddingBagDecompressionCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,187 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/node_builders/convolution.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/concat.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/gelu.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/max_pool.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/reduce_mean.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/sigmoid.hpp"
+#include "openvino/core/parallel.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+/*
+  The multi-branch models executed with the inter-op parallelism, which dispatches the nodes of the independent
+  branches concurrently:
+
+  MultiTower: four towers of the element-wise and reduction nodes concatenated at the end
+
+        param
+      /  |  |  \
+    Mul Mul Mul Mul
+     |   |   |   |
+    Sig Sig Sig Sig     x 3
+     |   |   |   |
+    Mean ... ...  Mean
+      \  |   |   /
+        Concat
+
+  Inception: the 1x1, 3x3, 5x5 convolutions and the pooling branch concatenated by channels
+
+  QKV: three projections of the same input, each followed by the bias and the activation
+*/
+
+namespace ov {
+namespace test {
+
+enum class MultiBranchModel { MultiTower, Inception, QKV };
+
+std::ostream& operator<<(std::ostream& os, MultiBranchModel model) {
+    switch (model) {
+    case MultiBranchModel::MultiTower:
+        return os << "MultiTower";
+    case MultiBranchModel::Inception:
+        return os << "Inception";
+    case MultiBranchModel::QKV:
+        return os << "QKV";
+    }
+    return os;
+}
+
+namespace {
+
+std::shared_ptr<ov::Node> make_const(const ov::Shape& shape, float start) {
+    std::vector<float> values(ov::shape_size(shape));
+    for (size_t i = 0; i < values.size(); i++) {
+        values[i] = start + 0.01f * static_cast<float>(i % 17);
+    }
+    return ov::op::v0::Constant::create(ov::element::f32, shape, values);
+}
+
+std::shared_ptr<ov::Model> make_multi_tower() {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 32, 64, 64});
+    auto axes = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{2}, {2, 3});
+    ov::OutputVector towers;
+    for (size_t t = 0; t < 4; t++) {
+        ov::Output<ov::Node> tower = param;
+        for (size_t l = 0; l < 3; l++) {
+            tower = std::make_shared<ov::op::v1::Multiply>(tower, make_const({1, 32, 1, 1}, 0.5f + 0.1f * t));
+            tower = std::make_shared<ov::op::v0::Sigmoid>(tower);
+        }
+        towers.push_back(std::make_shared<ov::op::v1::ReduceMean>(tower, axes, true));
+    }
+    auto concat = std::make_shared<ov::op::v0::Concat>(towers, 1);
+    return std::make_shared<ov::Model>(ov::OutputVector{concat}, ov::ParameterVector{param}, "MultiTower");
+}
+
+std::shared_ptr<ov::Model> make_inception() {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 64, 28, 28});
+    auto conv = [](const ov::Output<ov::Node>& in, size_t kernel, size_t channels) {
+        const auto pad = static_cast<ptrdiff_t>(kernel / 2);
+        auto result = ov::test::utils::make_convolution(in,
+                                                        ov::element::f32,
+                                                        {kernel, kernel},
+                                                        {1, 1},
+                                                        {pad, pad},
+                                                        {pad, pad},
+                                                        {1, 1},
+                                                        ov::op::PadType::EXPLICIT,
+                                                        channels);
+        return std::make_shared<ov::op::v0::Relu>(result);
+    };
+    auto branch1 = conv(param, 1, 32);
+    auto branch3 = conv(conv(param, 1, 48), 3, 64);
+    auto branch5 = conv(conv(param, 1, 16), 5, 32);
+    auto pool = std::make_shared<ov::op::v1::MaxPool>(param,
+                                                      ov::Strides{1, 1},
+                                                      ov::Shape{1, 1},
+                                                      ov::Shape{1, 1},
+                                                      ov::Shape{3, 3});
+    auto branchPool = conv(pool, 1, 32);
+    auto concat = std::make_shared<ov::op::v0::Concat>(ov::OutputVector{branch1, branch3, branch5, branchPool}, 1);
+    return std::make_shared<ov::Model>(ov::OutputVector{concat}, ov::ParameterVector{param}, "Inception");
+}
+
+std::shared_ptr<ov::Model> make_qkv() {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 128, 256});
+    ov::OutputVector projections;
+    for (size_t p = 0; p < 3; p++) {
+        auto matmul = std::make_shared<ov::op::v0::MatMul>(param, make_const({256, 256}, -0.08f), false, false);
+        auto bias = std::make_shared<ov::op::v1::Add>(matmul, make_const({256}, 0.1f * p));
+        projections.push_back(std::make_shared<ov::op::v7::Gelu>(bias));
+    }
+    auto concat = std::make_shared<ov::op::v0::Concat>(projections, 2);
+    return std::make_shared<ov::Model>(ov::OutputVector{concat}, ov::ParameterVector{param}, "QKV");
+}
+
+std::shared_ptr<ov::Model> make_model(MultiBranchModel model) {
+    switch (model) {
+    case MultiBranchModel::MultiTower:
+        return make_multi_tower();
+    case MultiBranchModel::Inception:
+        return make_inception();
+    case MultiBranchModel::QKV:
+        return make_qkv();
+    }
+    OPENVINO_THROW("Unexpected model");
+}
+
+const std::vector<MultiBranchModel> models = {MultiBranchModel::MultiTower,
+                                              MultiBranchModel::Inception,
+                                              MultiBranchModel::QKV};
+
+}  // namespace
+
+class InterOpParallelismCPUTest : public testing::WithParamInterface<MultiBranchModel>,
+                                  virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<MultiBranchModel>& obj) {
+        std::ostringstream result;
+        result << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        function = make_model(GetParam());
+        init_input_shapes(static_shapes_to_test_representation({function->get_parameters().front()->get_shape()}));
+        configuration.insert({ov::intel_cpu::cpu_inter_op_parallelism.name(), true});
+        configuration.insert({ov::hint::inference_precision.name(), ov::element::f32});
+    }
+};
+
+TEST_P(InterOpParallelismCPUTest, CompareWithRefs) {
+    run();
+    // the results of the next inferences are produced with the DAG built at the first one
+    infer();
+    validate();
+
+    const auto& rt_info = compiledModel.get_runtime_model()->get_rt_info();
+    const auto it = rt_info.find("concurrent_inferences");
+    ASSERT_NE(it, rt_info.end());
+    // the towers consist of the element-wise and reduction nodes only, so they are always dispatched concurrently,
+    // while the oneDNN convolutions and matmuls of the other models may keep running one at a time
+#if defined(OPENVINO_ARCH_X86_64) && OV_THREAD_USE_TBB
+    if (GetParam() == MultiBranchModel::MultiTower) {
+        EXPECT_GT(std::stoul(it->second.as<std::string>()), 0u);
+    }
+#endif
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_InterOpParallelism,
+                         InterOpParallelismCPUTest,
+                         ::testing::ValuesIn(models),
+                         InterOpParallelismCPUTest::getTestCaseName);
+
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,117 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/op/kquant_matmul.hpp"
+
+#include <cstring>
+
+#include "openvino/core/type/float16.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/parameter.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+
+namespace ov {
+namespace test {
+
+/*
+        Input [M, K]     Constant u8 [N, K / 256 * block_bytes]
+                 \        /
+                KQuantMatMul
+                     |
+                Output [M, N]
+*/
+
+using KQuantMatMulParams = std::tuple<InputShape,                                  // activations
+                                      size_t,                                      // N
+                                      ov::op::internal::KQuantMatMul::QuantType>;  // quant type
+
+class KQuantMatMulTest : public testing::WithParamInterface<KQuantMatMulParams>,
+                         virtual public SubgraphBaseTest,
+                         public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<KQuantMatMulParams>& obj) {
+        const auto& [inputShape, N, quantType] = obj.param;
+        std::ostringstream result;
+        result << "IS=" << ov::test::utils::partialShape2str({inputShape.first}) << "_TS=";
+        for (const auto& shape : inputShape.second) {
+            result << "(" << ov::test::utils::vec2str(shape) << ")_";
+        }
+        result << "N=" << N << "_" << ov::as_string(quantType);
+        return result.str();
+    }
+
+protected:
+    // Pseudo random super-blocks with bounded f16 super-scales, so that the reference and the
+    // plugin only differ by the f32 accumulation order.
+    static std::vector<uint8_t> make_blocks(size_t rows, size_t K, ov::op::internal::KQuantMatMul::QuantType quantType) {
+        const size_t blockBytes = ov::op::internal::KQuantMatMul::get_block_bytes(quantType);
+        const size_t blocks = rows * K / 256;
+        std::vector<uint8_t> data(blocks * blockBytes);
+        uint32_t state = 12345;
+        for (auto& byte : data) {
+            state = state * 1103515245 + 12345;
+            byte = static_cast<uint8_t>(state >> 16);
+        }
+        for (size_t b = 0; b < blocks; ++b) {
+            uint8_t* blk = data.data() + b * blockBytes;
+            const uint16_t d = ov::float16(0.002f * static_cast<float>(1 + b % 7)).to_bits();
+            if (quantType == ov::op::internal::KQuantMatMul::QuantType::Q6_K) {
+                std::memcpy(blk + 208, &d, sizeof(d));
+            } else {
+                std::memcpy(blk, &d, sizeof(d));
+                std::memcpy(blk + 2, &d, sizeof(d));
+            }
+        }
+        return data;
+    }
+
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        const auto& [inputShape, N, quantType] = this->GetParam();
+        init_input_shapes({inputShape});
+
+        const size_t K = inputShape.first.rbegin()->get_length();
+        const size_t rowBytes = K / 256 * ov::op::internal::KQuantMatMul::get_block_bytes(quantType);
+        const auto blocks = make_blocks(N, K, quantType);
+
+        ov::ParameterVector params{std::make_shared<ov::op::v0::Parameter>(ElementType::f32, inputDynamicShapes[0])};
+        auto weights = std::make_shared<ov::op::v0::Constant>(ov::element::u8, ov::Shape{N, rowBytes}, blocks.data());
+        auto kquant = std::make_shared<ov::op::internal::KQuantMatMul>(params[0], weights, quantType);
+
+        function = CPUTestsBase::create_ov_model(ElementType::f32, params, kquant, "KQuantMatMul");
+        abs_threshold = 1e-3;
+        rel_threshold = 1e-3;
+    }
+};
+
+TEST_P(KQuantMatMulTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "KQuantMatMul", 1);
+}
+
+namespace {
+
+const std::vector<InputShape> inputShapes = {
+    {{1, 512}, {{1, 512}}},
+    {{-1, 256}, {{1, 256}, {3, 256}, {37, 256}, {1, 256}}},
+    {{1, -1, 768}, {{1, 1, 768}, {1, 65, 768}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_KQuantMatMul,
+                         KQuantMatMulTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::Values(7, 64),
+                                            ::testing::Values(ov::op::internal::KQuantMatMul::QuantType::Q4_K,
+                                                              ov::op::internal::KQuantMatMul::QuantType::Q5_K,
+                                                              ov::op::internal::KQuantMatMul::QuantType::Q6_K)),
+                         KQuantMatMulTest::getTestCaseName);
+
+}  // namespace
+
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,198 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "openvino/core/preprocess/pre_post_process.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/interpolate.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/result.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+namespace ov {
+namespace test {
+
+/*
+ * The PrePostProcessor steps of an u8 image are fused into a single ImagePreprocess node:
+ *
+ *   Parameter(u8 NV12 / I420 planes or packed BGR)
+ *                     |
+ *     NV12toRGB / I420toBGR / Gather(channel reverse)
+ *                     |
+ *              Convert(f32)
+ *                     |
+ *             Slice(crop, optional)
+ *                     |
+ *      Interpolate(linear / nearest, SIZES)
+ *                     |
+ *            Subtract(mean) -> Divide(scale)
+ *                     |
+ *        Transpose(NHWC -> NCHW) -> Result
+ */
+using InterpolateAttrs = ov::op::v11::Interpolate::InterpolateAttrs;
+using InterpolateMode = ov::op::v11::Interpolate::InterpolateMode;
+using CoordinateTransformMode = ov::op::v11::Interpolate::CoordinateTransformMode;
+using NearestMode = ov::op::v11::Interpolate::NearestMode;
+
+// the resize of PrePostProcessor or an explicit Interpolate added as a custom step
+struct ResizeParams {
+    bool prePostProcessor;
+    InterpolateMode mode;
+    CoordinateTransformMode coordinateMode;
+    NearestMode nearestMode;
+};
+
+typedef std::tuple<ov::preprocess::ColorFormat,  // source image
+                   bool,                         // with crop
+                   ResizeParams>
+    imagePreprocessParams;
+
+class ImagePreprocessCPUTest : public testing::WithParamInterface<imagePreprocessParams>,
+                               virtual public SubgraphBaseTest,
+                               public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<imagePreprocessParams>& obj) {
+        const auto& [colorFormat, withCrop, resize] = obj.param;
+        std::ostringstream result;
+        switch (colorFormat) {
+        case ov::preprocess::ColorFormat::NV12_TWO_PLANES:
+            result << "NV12_TWO_PLANES_";
+            break;
+        case ov::preprocess::ColorFormat::I420_THREE_PLANES:
+            result << "I420_THREE_PLANES_";
+            break;
+        default:
+            result << "BGR_";
+            break;
+        }
+        result << "crop=" << withCrop << "_";
+        result << "resize=" << (resize.prePostProcessor ? "PPP_" : "Custom_") << ov::as_string(resize.mode);
+        if (!resize.prePostProcessor) {
+            result << "_" << ov::as_string(resize.coordinateMode);
+            if (resize.mode == InterpolateMode::NEAREST) {
+                result << "_" << ov::as_string(resize.nearestMode);
+            }
+        }
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        const auto& [colorFormat, withCrop, resize] = this->GetParam();
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        // the fused node computes in f32, as the reference does
+        configuration.insert({ov::hint::inference_precision.name(), ov::element::f32});
+        // a YUV to RGB result rounded at a tie may differ by one level, which is 1/57 after the scale
+        abs_threshold = 2e-2;
+
+        constexpr size_t height = 40;
+        constexpr size_t width = 60;
+        auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 3, 24, 30});
+        auto model = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(input)},
+                                                 ov::ParameterVector{input},
+                                                 "imagePreprocess");
+
+        using namespace ov::preprocess;
+        PrePostProcessor ppp(model);
+        ppp.input()
+            .tensor()
+            .set_element_type(ov::element::u8)
+            .set_color_format(colorFormat)
+            .set_layout("NHWC")
+            .set_spatial_static_shape(height, width);
+        ppp.input().model().set_layout("NCHW");
+        auto& steps = ppp.input().preprocess();
+        // NV12 and the packed BGR go to RGB, I420 goes to BGR
+        steps.convert_color(colorFormat == ColorFormat::I420_THREE_PLANES ? ColorFormat::BGR : ColorFormat::RGB);
+        steps.convert_element_type(ov::element::f32);
+        if (withCrop) {
+            steps.crop({0, 3, 5, 0}, {1, 35, 53, 3});
+        }
+        if (resize.prePostProcessor) {
+            steps.resize(resize.mode == InterpolateMode::NEAREST ? ResizeAlgorithm::RESIZE_NEAREST
+                                                                 : ResizeAlgorithm::RESIZE_LINEAR);
+        } else {
+            steps.custom([resize](const ov::Output<ov::Node>& node) {
+                const auto sizes = ov::op::v0::Constant::create(ov::element::i64, {2}, {24, 30});
+                const auto axes = ov::op::v0::Constant::create(ov::element::i64, {2}, {1, 2});
+                const InterpolateAttrs attrs{resize.mode,
+                                             ov::op::v11::Interpolate::ShapeCalcMode::SIZES,
+                                             {0, 0, 0, 0},
+                                             {0, 0, 0, 0},
+                                             resize.coordinateMode,
+                                             resize.nearestMode,
+                                             false,
+                                             -0.75f};
+                return std::make_shared<ov::op::v11::Interpolate>(node, sizes, axes, attrs)->output(0);
+            });
+        }
+        steps.mean({123.675f, 116.28f, 103.53f}).scale({58.395f, 57.12f, 57.375f});
+        function = ppp.build();
+
+        std::vector<ov::Shape> planeShapes;
+        for (const auto& parameter : function->get_parameters()) {
+            planeShapes.push_back(parameter->get_shape());
+        }
+        init_input_shapes(static_shapes_to_test_representation(planeShapes));
+    }
+
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        const auto& modelInputs = function->inputs();
+        ov::test::utils::InputGenerateData in_data;
+        in_data.start_from = 0;
+        in_data.range = 256;
+        for (size_t i = 0; i < modelInputs.size(); i++) {
+            inputs.insert({modelInputs[i].get_node_shared_ptr(),
+                           ov::test::utils::create_and_fill_tensor(modelInputs[i].get_element_type(),
+                                                                   targetInputStaticShapes[i],
+                                                                   in_data)});
+        }
+    }
+
+    void check_results() {
+        CheckNumberOfNodesWithType(compiledModel, "ImagePreprocess", 1);
+        // the steps are not executed on their own
+        CheckNumberOfNodesWithTypes(compiledModel, {"ColorConvert", "Gather", "Interpolate", "Transpose"}, 0);
+    }
+};
+
+TEST_P(ImagePreprocessCPUTest, CompareWithRefs) {
+    run();
+    check_results();
+}
+
+namespace {
+
+const std::vector<ResizeParams> resizes = {
+    {true, InterpolateMode::LINEAR, CoordinateTransformMode::HALF_PIXEL, NearestMode::ROUND_PREFER_FLOOR},
+    {true, InterpolateMode::NEAREST, CoordinateTransformMode::HALF_PIXEL, NearestMode::ROUND_PREFER_FLOOR},
+    {false, InterpolateMode::LINEAR, CoordinateTransformMode::ALIGN_CORNERS, NearestMode::FLOOR},
+    {false, InterpolateMode::LINEAR, CoordinateTransformMode::ASYMMETRIC, NearestMode::FLOOR},
+    {false, InterpolateMode::LINEAR, CoordinateTransformMode::PYTORCH_HALF_PIXEL, NearestMode::FLOOR},
+    {false, InterpolateMode::NEAREST, CoordinateTransformMode::ASYMMETRIC, NearestMode::FLOOR},
+    {false, InterpolateMode::NEAREST, CoordinateTransformMode::TF_HALF_PIXEL_FOR_NN, NearestMode::ROUND_PREFER_CEIL},
+    {false, InterpolateMode::NEAREST, CoordinateTransformMode::HALF_PIXEL, NearestMode::CEIL},
+    {false, InterpolateMode::NEAREST, CoordinateTransformMode::ALIGN_CORNERS, NearestMode::ROUND_PREFER_FLOOR},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_ImagePreprocess,
+                         ImagePreprocessCPUTest,
+                         ::testing::Combine(::testing::Values(ov::preprocess::ColorFormat::NV12_TWO_PLANES,
+                                                              ov::preprocess::ColorFormat::I420_THREE_PLANES,
+                                                              ov::preprocess::ColorFormat::BGR),
+                                            ::testing::Values(false, true),
+                                            ::testing::ValuesIn(resizes)),
+                         ImagePreprocessCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,234 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "nodes/kernels/embedding_bag_kernel.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/core/type/bfloat16.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/core/type/float16.hpp"
+
+// These benchmarks measure wall-clock timing and are meaningless in a Debug (-O0) build.
+#ifndef NDEBUG
+#    error \
+        "embedding_bag_kernel_benchmark.cpp must be built in Release mode: rebuild with -DCMAKE_BUILD_TYPE=Release, or delete this #error to build in Debug anyway."
+#endif
+
+// The throughput of the reduction by the table precision and the time of the even split of the bags between the threads
+// against the split by the number of indices, over the Zipfian pooling factors and row popularity of the recommendation
+// workloads.
+
+namespace ov::test {
+
+using ov::Extensions::Cpu::XARCH::embedding_bag_reduce;
+
+namespace {
+
+// A table of random values in the given precision along with its values in f32
+struct Table {
+    Table(ov::element::Type precision, size_t rows, size_t depth, std::mt19937& gen)
+        : precision(precision),
+          rows(rows),
+          depth(depth),
+          data(rows * depth * precision.bitwidth() / 8),
+          values(rows * depth) {
+        std::uniform_int_distribution<int> dist(0, 255);
+        for (size_t i = 0; i < rows * depth; i++) {
+            const auto q = dist(gen);
+            switch (precision) {
+            case ov::element::f32:
+                values[i] = static_cast<float>(q - 128) / 16.0F;
+                reinterpret_cast<float*>(data.data())[i] = values[i];
+                break;
+            case ov::element::bf16:
+                reinterpret_cast<ov::bfloat16*>(data.data())[i] = ov::bfloat16(static_cast<float>(q - 128) / 16.0F);
+                values[i] = static_cast<float>(reinterpret_cast<ov::bfloat16*>(data.data())[i]);
+                break;
+            case ov::element::f16:
+                reinterpret_cast<ov::float16*>(data.data())[i] = ov::float16(static_cast<float>(q - 128) / 16.0F);
+                values[i] = static_cast<float>(reinterpret_cast<ov::float16*>(data.data())[i]);
+                break;
+            case ov::element::u8:
+                data[i] = static_cast<uint8_t>(q);
+                values[i] = static_cast<float>(q);
+                break;
+            case ov::element::i8:
+                data[i] = static_cast<uint8_t>(q);
+                values[i] = static_cast<float>(static_cast<int8_t>(q));
+                break;
+            case ov::element::u4:
+            case ov::element::i4: {
+                const auto nibble = static_cast<uint8_t>(q & 0x0F);
+                data[i / 2] = static_cast<uint8_t>(data[i / 2] | (nibble << ((i % 2) * 4)));
+                values[i] = precision == ov::element::i4 && nibble >= 8 ? static_cast<float>(nibble) - 16.0F
+                                                                       : static_cast<float>(nibble);
+                break;
+            }
+            default:
+                break;
+            }
+        }
+    }
+
+    bool compressed() const {
+        return precision.is_integral();
+    }
+
+    ov::element::Type precision;
+    size_t rows;
+    size_t depth;
+    std::vector<uint8_t> data;
+    std::vector<float> values;
+};
+
+// The ranks of the Zipf distribution over [1, n]: a few values are frequent and the tail is long
+class Zipf {
+public:
+    Zipf(size_t n, double s) : cdf(n) {
+        double sum = 0;
+        for (size_t i = 0; i < n; i++) {
+            sum += 1.0 / std::pow(static_cast<double>(i + 1), s);
+            cdf[i] = sum;
+        }
+        for (auto& value : cdf) {
+            value /= sum;
+        }
+    }
+
+    size_t operator()(std::mt19937& gen) {
+        const double u = std::uniform_real_distribution<double>(0.0, 1.0)(gen);
+        return static_cast<size_t>(std::lower_bound(cdf.begin(), cdf.end(), u) - cdf.begin()) + 1;
+    }
+
+private:
+    std::vector<double> cdf;
+};
+
+const std::vector<ov::element::Type> precisions{ov::element::f32,
+                                                ov::element::bf16,
+                                                ov::element::f16,
+                                                ov::element::u8,
+                                                ov::element::i8,
+                                                ov::element::u4,
+                                                ov::element::i4};
+
+}  // namespace
+
+class EmbeddingBagKernelBenchmark : public ::testing::Test {};
+
+TEST_F(EmbeddingBagKernelBenchmark, zipfian) {
+    constexpr size_t rows = 1 << 20;
+    constexpr size_t depth = 64;
+    constexpr size_t bags = 8192;
+    constexpr size_t max_pooling_factor = 512;
+    constexpr size_t runs = 5;
+
+    std::mt19937 gen(42);
+    Zipf pooling_factor(max_pooling_factor, 1.1);
+    Zipf row(rows, 1.05);
+    // the popular rows are scattered over the table
+    std::vector<int32_t> row_ids(rows);
+    for (size_t r = 0; r < rows; r++) {
+        row_ids[r] = static_cast<int32_t>(r);
+    }
+    std::shuffle(row_ids.begin(), row_ids.end(), gen);
+
+    std::vector<size_t> offsets(bags + 1, 0);
+    std::vector<int32_t> indices;
+    for (size_t b = 0; b < bags; b++) {
+        const auto size = pooling_factor(gen);
+        for (size_t k = 0; k < size; k++) {
+            indices.push_back(row_ids[row(gen) - 1]);
+        }
+        offsets[b + 1] = indices.size();
+    }
+    // the bags with the most indices come first as a worst case for the even split
+    std::vector<size_t> order(bags);
+    for (size_t b = 0; b < bags; b++) {
+        order[b] = b;
+    }
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return offsets[a + 1] - offsets[a] > offsets[b + 1] - offsets[b];
+    });
+
+    std::vector<size_t> work(bags + 1, 0);
+    for (size_t b = 0; b < bags; b++) {
+        const auto bag = order[b];
+        work[b + 1] = work[b] + offsets[bag + 1] - offsets[bag] + 1;
+    }
+
+    std::vector<float> scales(rows, 0.5F);
+    std::vector<float> zero_points(rows, 8.0F);
+    std::vector<float> dst(bags * depth);
+
+    printf("\n--- %zu bags of %zu indices in total, %d threads ---\n",
+           bags,
+           indices.size(),
+           parallel_get_max_threads());
+    printf("%-10s | %16s | %18s | %14s\n", "Precision", "even split (ms)", "balanced split (ms)", "GB/s");
+    printf("-----------+------------------+--------------------+---------------\n");
+    for (const auto precision : precisions) {
+        const Table table(precision, rows, depth, gen);
+        const float* scales_ptr = table.compressed() ? scales.data() : nullptr;
+        const float* zero_points_ptr = table.compressed() ? zero_points.data() : nullptr;
+
+        auto run = [&](bool balanced) {
+            double best_ms = 0;
+            for (size_t r = 0; r < runs; r++) {
+                const auto start = std::chrono::steady_clock::now();
+                ov::parallel_nt(0, [&](const int ithr, const int nthr) {
+                    size_t begin = 0;
+                    size_t end = 0;
+                    if (balanced) {
+                        auto bound = [&](int i) {
+                            return static_cast<size_t>(
+                                std::lower_bound(work.begin(), work.end(), work.back() * i / nthr) - work.begin());
+                        };
+                        begin = bound(ithr);
+                        end = bound(ithr + 1);
+                    } else {
+                        ov::splitter(bags, nthr, ithr, begin, end);
+                    }
+                    for (size_t b = begin; b < end; b++) {
+                        const auto bag = order[b];
+                        embedding_bag_reduce(table.data.data(),
+                                             precision,
+                                             depth,
+                                             scales_ptr,
+                                             zero_points_ptr,
+                                             indices.data() + offsets[bag],
+                                             offsets[bag + 1] - offsets[bag],
+                                             nullptr,
+                                             false,
+                                             dst.data() + bag * depth);
+                    }
+                });
+                const auto ms =
+                    std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+                best_ms = r == 0 ? ms : std::min(best_ms, ms);
+            }
+            return best_ms;
+        };
+
+        const auto even_ms = run(false);
+        const auto balanced_ms = run(true);
+        const double row_bytes = static_cast<double>(depth * precision.bitwidth() / 8);
+        printf("%-10s | %16.2f | %18.2f | %14.2f\n",
+               precision.get_type_name().c_str(),
+               even_ms,
+               balanced_ms,
+               indices.size() * row_bytes / balanced_ms / 1e6);
+    }
+}
+
+}  // namespace ov::test
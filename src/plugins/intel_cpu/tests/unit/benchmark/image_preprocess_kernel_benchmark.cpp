@@ -0,0 +1,208 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "cpu_parallel.hpp"
+#include "nodes/kernels/image_preprocess_kernel.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/core/type/element_type.hpp"
+
+// These benchmarks measure wall-clock timing and are meaningless in a Debug (-O0) build.
+#ifndef NDEBUG
+#    error \
+        "image_preprocess_kernel_benchmark.cpp must be built in Release mode: rebuild with -DCMAKE_BUILD_TYPE=Release, or delete this #error to build in Debug anyway."
+#endif
+
+// The latency of the fused preprocessing of a 1080p NV12 frame into a planar f32 224x224 and 640x640 tensor against
+// the steps PrePostProcessor lowers it to, each of them a full pass over the image: NV12toRGB, Convert, Interpolate,
+// Subtract, Divide and Transpose.
+
+namespace ov::test {
+
+using ov::Extensions::Cpu::XARCH::image_preprocess_exec;
+using ov::intel_cpu::ImagePreprocessPlan;
+
+namespace {
+
+// the mean and the scale of the ImageNet models
+constexpr float mean[3] = {123.675F, 116.28F, 103.53F};
+constexpr float scale[3] = {58.395F, 57.12F, 57.375F};
+
+// the taps of the half pixel linear resize of the whole axis, as ImagePreprocess builds them
+ImagePreprocessPlan::Taps make_taps(size_t in_len, size_t out_len) {
+    ImagePreprocessPlan::Taps taps;
+    for (size_t k = 0; k < 2; k++) {
+        taps.index[k].resize(out_len);
+        taps.weight[k].resize(out_len);
+    }
+    const auto last = static_cast<int64_t>(in_len) - 1;
+    for (size_t o = 0; o < out_len; o++) {
+        const auto x = std::clamp(
+            (static_cast<float>(o) + 0.5F) * static_cast<float>(in_len) / static_cast<float>(out_len) - 0.5F,
+            0.F,
+            static_cast<float>(last));
+        const auto i0 = static_cast<int64_t>(std::floor(x));
+        const auto i1 = std::min(i0 + 1, last);
+        const auto w1 = i1 == i0 ? 0.F : x - static_cast<float>(i0);
+        taps.index[0][o] = static_cast<int32_t>(i0);
+        taps.index[1][o] = static_cast<int32_t>(i1);
+        taps.weight[0][o] = 1.F - w1;
+        taps.weight[1][o] = w1;
+    }
+    return taps;
+}
+
+// the resize of a single plane NV12 image followed by the mean/scale
+ImagePreprocessPlan make_plan(size_t height, size_t width, size_t out_h, size_t out_w) {
+    ImagePreprocessPlan plan;
+    plan.source = ImagePreprocessPlan::Source::NV12;
+    plan.planes = 1;
+    plan.batch = 1;
+    plan.height = height;
+    plan.width = width;
+    plan.channels = 3;
+    plan.round_color = true;
+    plan.out_height = out_h;
+    plan.out_width = out_w;
+    plan.rows = make_taps(height, out_h);
+    plan.columns = make_taps(width, out_w);
+
+    auto& columns = plan.source_columns;
+    columns = plan.columns.index[0];
+    columns.insert(columns.end(), plan.columns.index[1].begin(), plan.columns.index[1].end());
+    std::sort(columns.begin(), columns.end());
+    columns.erase(std::unique(columns.begin(), columns.end()), columns.end());
+    for (size_t o = 0; o < plan.out_width; o++) {
+        for (auto& index : plan.columns.index) {
+            index[o] =
+                static_cast<int32_t>(std::lower_bound(columns.begin(), columns.end(), index[o]) - columns.begin());
+        }
+    }
+    for (size_t c = 0; c < plan.channels; c++) {
+        plan.scale.push_back(1.F / scale[c]);
+        plan.shift.push_back(-mean[c] / scale[c]);
+    }
+    return plan;
+}
+
+}  // namespace
+
+class ImagePreprocessKernelBenchmark : public ::testing::Test {};
+
+TEST_F(ImagePreprocessKernelBenchmark, nv12_1080p) {
+    constexpr size_t height = 1080;
+    constexpr size_t width = 1920;
+    constexpr size_t runs = 10;
+    constexpr size_t channels = 3;
+
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> dist(0, 255);
+    std::vector<uint8_t> nv12(height * width * 3 / 2);
+    for (auto& value : nv12) {
+        value = static_cast<uint8_t>(dist(gen));
+    }
+    const uint8_t* planes[] = {nv12.data()};
+    const auto cpu_parallel = std::make_shared<ov::intel_cpu::CpuParallel>(ov::intel_cpu::TbbPartitioner::STATIC);
+
+    auto best_of = [&](const auto& func) {
+        double best_ms = 0;
+        for (size_t r = 0; r < runs; r++) {
+            const auto start = std::chrono::steady_clock::now();
+            func();
+            const auto ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            best_ms = r == 0 ? ms : std::min(best_ms, ms);
+        }
+        return best_ms;
+    };
+
+    printf("\n--- NV12 %zux%zu to planar f32, %d threads ---\n", width, height, parallel_get_max_threads());
+    printf("%-10s | %12s | %14s | %8s\n", "Output", "fused (ms)", "unfused (ms)", "speedup");
+    printf("-----------+--------------+----------------+---------\n");
+    for (const size_t size : {224, 640}) {
+        const auto plan = make_plan(height, width, size, size);
+
+        std::vector<float> fused(channels * size * size);
+        const auto fused_ms = best_of([&]() {
+            image_preprocess_exec(plan, planes, fused.data(), ov::element::f32, cpu_parallel);
+        });
+
+        std::vector<uint8_t> rgb(height * width * channels);
+        std::vector<float> rgb_f32(rgb.size());
+        std::vector<float> resized(size * size * channels);
+        std::vector<float> unfused(resized.size());
+        const auto unfused_ms = best_of([&]() {
+            ov::parallel_for(height, [&](size_t y) {
+                const auto* luma = nv12.data() + y * width;
+                const auto* uv = nv12.data() + height * width + (y / 2) * width;
+                for (size_t x = 0; x < width; x++) {
+                    const auto cy = (static_cast<float>(luma[x]) - 16.F) * 1.164F;
+                    const auto d = static_cast<float>(uv[(x / 2) * 2]) - 128.F;
+                    const auto e = static_cast<float>(uv[(x / 2) * 2 + 1]) - 128.F;
+                    const float values[channels] = {cy + 1.596F * e, cy - 0.391F * d - 0.813F * e, cy + 2.018F * d};
+                    for (size_t c = 0; c < channels; c++) {
+                        rgb[(y * width + x) * channels + c] =
+                            static_cast<uint8_t>(std::min(std::max(std::nearbyint(values[c]), 0.F), 255.F));
+                    }
+                }
+            });
+            ov::parallel_for(height, [&](size_t y) {
+                for (size_t i = y * width * channels; i < (y + 1) * width * channels; i++) {
+                    rgb_f32[i] = static_cast<float>(rgb[i]);
+                }
+            });
+            ov::parallel_for(size, [&](size_t oy) {
+                const auto y0 = static_cast<size_t>(plan.rows.index[0][oy]);
+                const auto y1 = static_cast<size_t>(plan.rows.index[1][oy]);
+                const auto wy0 = plan.rows.weight[0][oy];
+                const auto wy1 = plan.rows.weight[1][oy];
+                for (size_t ox = 0; ox < size; ox++) {
+                    const auto x0 = static_cast<size_t>(plan.source_columns[plan.columns.index[0][ox]]);
+                    const auto x1 = static_cast<size_t>(plan.source_columns[plan.columns.index[1][ox]]);
+                    const auto wx0 = plan.columns.weight[0][ox];
+                    const auto wx1 = plan.columns.weight[1][ox];
+                    for (size_t c = 0; c < channels; c++) {
+                        auto at = [&](size_t y, size_t x) {
+                            return rgb_f32[(y * width + x) * channels + c];
+                        };
+                        resized[(oy * size + ox) * channels + c] = (at(y0, x0) * wx0 + at(y0, x1) * wx1) * wy0 +
+                                                                   (at(y1, x0) * wx0 + at(y1, x1) * wx1) * wy1;
+                    }
+                }
+            });
+            ov::parallel_for(size, [&](size_t oy) {
+                for (size_t i = oy * size * channels; i < (oy + 1) * size * channels; i++) {
+                    resized[i] -= mean[i % channels];
+                }
+            });
+            ov::parallel_for(size, [&](size_t oy) {
+                for (size_t i = oy * size * channels; i < (oy + 1) * size * channels; i++) {
+                    resized[i] /= scale[i % channels];
+                }
+            });
+            ov::parallel_for2d(channels, size, [&](size_t c, size_t oy) {
+                for (size_t ox = 0; ox < size; ox++) {
+                    unfused[(c * size + oy) * size + ox] = resized[(oy * size + ox) * channels + c];
+                }
+            });
+        });
+
+        // the RGB values rounded at the ties may differ by one level when the compiler contracts the conversion
+        for (size_t i = 0; i < fused.size(); i++) {
+            ASSERT_NEAR(fused[i], unfused[i], 1.F / 56.F) << "at " << i;
+        }
+        printf("%4zux%-5zu | %12.2f | %14.2f | %7.2fx\n", size, size, fused_ms, unfused_ms, unfused_ms / fused_ms);
+    }
+}
+
+}  // namespace ov::test
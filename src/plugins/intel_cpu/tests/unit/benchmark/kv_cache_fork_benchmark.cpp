@@ -0,0 +1,94 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "memory_state.h"
+#include "nodes/common/arbitrary_order_desc_creator.h"
+#include "openvino/core/partial_shape.hpp"
+#include "openvino/runtime/make_tensor.hpp"
+#include "openvino/runtime/tensor.hpp"
+
+// These benchmarks measure wall-clock timing and are meaningless in a Debug (-O0) build.
+#ifndef NDEBUG
+#    error \
+        "kv_cache_fork_benchmark.cpp must be built in Release mode: rebuild with -DCMAKE_BUILD_TYPE=Release, or delete this #error to build in Debug anyway."
+#endif
+
+// Forking a KV cache state vs copying it through get_state()/set_state()
+
+namespace ov::test {
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+// [B, H, L, S] states stored as LBHS, like the ones of the stateful SDPA
+std::shared_ptr<VariableStateKVcache> make_state(size_t heads, size_t head_size) {
+    const ov::PartialShape shape{-1, static_cast<int64_t>(heads), -1, static_cast<int64_t>(head_size)};
+    auto external_desc = std::make_shared<CpuBlockedMemoryDesc>(ov::element::f32, Shape(shape));
+    auto internal_desc = ArbitraryOrderDescCreator({2, 0, 1, 3}).createSharedDesc(ov::element::f32, Shape(shape));
+    return std::make_shared<VariableStateKVcache>("kv", external_desc, internal_desc, ov::Extensions::Cpu::CacheSpec{});
+}
+
+ov::Tensor make_tokens(size_t heads, size_t tokens, size_t head_size) {
+    ov::Tensor tensor(ov::element::f32, {1, heads, tokens, head_size});
+    auto* data = tensor.data<float>();
+    for (size_t i = 0; i < tensor.get_size(); i++) {
+        data[i] = static_cast<float>(i % 1013);
+    }
+    return tensor;
+}
+
+template <typename Body>
+double measure_us(Body&& body) {
+    const auto start = std::chrono::steady_clock::now();
+    body();
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+
+}  // namespace
+
+class KVCacheForkBenchmark : public ::testing::Test {};
+
+TEST_F(KVCacheForkBenchmark, fork_4k_tokens) {
+    constexpr size_t heads = 32;
+    constexpr size_t head_size = 128;
+    constexpr size_t tokens = 4096;
+    auto original = make_state(heads, head_size);
+    original->set_state(ov::get_tensor_impl(make_tokens(heads, tokens, head_size)));
+    const size_t state_bytes = original->internal_state_mem()->getSize() + original->hidden_state_mem()->getSize();
+
+    auto copied = make_state(heads, head_size);
+    const auto copy_us = measure_us([&] {
+        copied->set_state(original->get_state());
+    });
+    // the external tensor produced by get_state() and the internal buffers of the new state
+    const size_t copy_bytes = original->internal_state_mem()->getSize() + state_bytes;
+
+    auto forked = make_state(heads, head_size);
+    const auto fork_us = measure_us([&] {
+        forked->fork(*original);
+    });
+    ASSERT_EQ(forked->internal_state_mem()->getData(), original->internal_state_mem()->getData());
+
+    // the first append after the fork pays for the copy
+    const auto first_write_us = measure_us([&] {
+        forked->make_exclusive();
+    });
+
+    printf("\n--- KV cache of %zu tokens, %zu heads of %zu ---\n", tokens, heads, head_size);
+    printf("%-24s | %14s | %14s\n", "Operation", "time (us)", "copied bytes");
+    printf("-------------------------+----------------+---------------\n");
+    printf("%-24s | %14.2f | %14zu\n", "get_state + set_state", copy_us, copy_bytes);
+    printf("%-24s | %14.2f | %14zu\n", "fork", fork_us, static_cast<size_t>(0));
+    printf("%-24s | %14.2f | %14zu\n", "first write after fork", first_write_us, state_bytes);
+}
+
+}  // namespace ov::test
@@ -0,0 +1,96 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "memory_state.h"
+#include "nodes/common/arbitrary_order_desc_creator.h"
+#include "openvino/core/partial_shape.hpp"
+#include "openvino/runtime/make_tensor.hpp"
+#include "openvino/runtime/tensor.hpp"
+
+// These benchmarks measure wall-clock timing and are meaningless in a Debug (-O0) build.
+#ifndef NDEBUG
+#    error \
+        "kv_cache_swap_benchmark.cpp must be built in Release mode: rebuild with -DCMAKE_BUILD_TYPE=Release, or delete this #error to build in Debug anyway."
+#endif
+
+// Swapping a KV cache state out to disk and back. The alternative to swapping is the prefill of the same prefix, which
+// is at least as slow as set_state() of its result.
+
+namespace ov::test {
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+// [B, H, L, S] states stored as LBHS, like the ones of the stateful SDPA
+std::shared_ptr<VariableStateKVcache> make_state(size_t heads, size_t head_size) {
+    const ov::PartialShape shape{-1, static_cast<int64_t>(heads), -1, static_cast<int64_t>(head_size)};
+    auto external_desc = std::make_shared<CpuBlockedMemoryDesc>(ov::element::f32, Shape(shape));
+    auto internal_desc = ArbitraryOrderDescCreator({2, 0, 1, 3}).createSharedDesc(ov::element::f32, Shape(shape));
+    return std::make_shared<VariableStateKVcache>("kv", external_desc, internal_desc, ov::Extensions::Cpu::CacheSpec{});
+}
+
+ov::Tensor make_tokens(size_t heads, size_t tokens, size_t head_size) {
+    ov::Tensor tensor(ov::element::f32, {1, heads, tokens, head_size});
+    auto* data = tensor.data<float>();
+    for (size_t i = 0; i < tensor.get_size(); i++) {
+        data[i] = static_cast<float>(i % 1013);
+    }
+    return tensor;
+}
+
+template <typename Body>
+double measure_us(Body&& body) {
+    const auto start = std::chrono::steady_clock::now();
+    body();
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+
+}  // namespace
+
+class KVCacheSwapBenchmark : public ::testing::Test {};
+
+TEST_F(KVCacheSwapBenchmark, swap_4k_tokens) {
+    constexpr size_t heads = 32;
+    constexpr size_t head_size = 128;
+    constexpr size_t tokens = 4096;
+    const auto file = std::make_shared<const std::filesystem::path>(std::filesystem::temp_directory_path() /
+                                                                    "kv_cache_swap_benchmark.kvswap");
+    auto state = make_state(heads, head_size);
+    const auto prefix = make_tokens(heads, tokens, head_size);
+    state->set_state(ov::get_tensor_impl(prefix));
+    const auto state_bytes = state->resident_bytes();
+
+    const auto swap_out_us = measure_us([&] {
+        std::ofstream stream(*file, std::ios::binary | std::ios::trunc);
+        const auto offset = state->write_swap(stream);
+        stream.close();
+        state->release_swapped(file, offset);
+    });
+    const auto swap_in_us = measure_us([&] {
+        state->swap_in();
+    });
+    const auto set_state_us = measure_us([&] {
+        state->set_state(ov::get_tensor_impl(prefix));
+    });
+    std::filesystem::remove(*file);
+
+    printf("\n--- KV cache of %zu tokens, %zu heads of %zu: %zu bytes ---\n", tokens, heads, head_size, state_bytes);
+    printf("%-24s | %14s\n", "Operation", "time (us)");
+    printf("-------------------------+---------------\n");
+    printf("%-24s | %14.2f\n", "swap_out", swap_out_us);
+    printf("%-24s | %14.2f\n", "swap_in", swap_in_us);
+    printf("%-24s | %14.2f\n", "set_state of the prefix", set_state_us);
+}
+
+}  // namespace ov::test
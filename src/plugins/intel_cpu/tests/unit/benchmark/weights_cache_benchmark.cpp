@@ -0,0 +1,181 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#    include <sched.h>
+#endif
+
+#include "cpu_memory.h"
+#include "internal_properties.hpp"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "openvino/runtime/system_conf.hpp"
+#include "weights_cache.hpp"
+
+// These benchmarks measure wall-clock timing and are meaningless in a Debug (-O0) build.
+#ifndef NDEBUG
+#    error \
+        "weights_cache_benchmark.cpp must be built in Release mode: rebuild with -DCMAKE_BUILD_TYPE=Release, or delete this #error to build in Debug anyway."
+#endif
+
+// The time to create the weights, the throughput of reading them by all the streams and the memory they take by
+// policy. Two streams run on each NUMA node, a fake topology of two nodes is used on the single node hosts: the
+// streams aren't pinned then and the numbers show the overhead of the placement only.
+
+namespace ov::test {
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+const std::vector<WeightsNumaPolicy> policies{WeightsNumaPolicy::FIRST_TOUCH,
+                                              WeightsNumaPolicy::LOCAL,
+                                              WeightsNumaPolicy::INTERLEAVE,
+                                              WeightsNumaPolicy::REPLICATE};
+
+std::string policy_name(WeightsNumaPolicy policy) {
+    std::stringstream ss;
+    ss << policy;
+    return ss.str();
+}
+
+MemoryPtr make_weights(size_t size, float value) {
+    static const dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    auto memory = std::make_shared<Memory>(eng, std::make_shared<CpuBlockedMemoryDesc>(ov::element::f32, Shape{size}));
+    auto* data = memory->getDataAs<float>();
+    for (size_t i = 0; i < size; i++) {
+        data[i] = value;
+    }
+    return memory;
+}
+
+}  // namespace
+
+class WeightsCacheBenchmark : public ::testing::Test {};
+
+TEST_F(WeightsCacheBenchmark, numa_policy) {
+    constexpr size_t weights_count = 8;
+    constexpr size_t weights_size = 4 * 1024 * 1024;  // floats
+    constexpr size_t streams_per_node = 2;
+    constexpr size_t reads = 4;
+
+    const int real_nodes = ov::get_num_numa_nodes();
+    const bool fake_topology = real_nodes < 2;
+    const int nodes = fake_topology ? 2 : real_nodes;
+    const size_t streams = streams_per_node * nodes;
+
+    std::vector<std::vector<int>> node_cpus(nodes);
+    if (!fake_topology) {
+        for (int cpu = 0; cpu < ov::get_number_of_logical_cpu_cores(); cpu++) {
+            const int node = ov::get_numa_node_id(cpu);
+            if (node >= 0 && node < nodes) {
+                node_cpus[node].push_back(cpu);
+            }
+        }
+    }
+    auto pin = [&]([[maybe_unused]] int node) {
+#if defined(__linux__)
+        if (node_cpus[node].empty()) {
+            return;
+        }
+        cpu_set_t mask;
+        CPU_ZERO(&mask);
+        for (const auto cpu : node_cpus[node]) {
+            CPU_SET(cpu, &mask);
+        }
+        sched_setaffinity(0, sizeof(mask), &mask);
+#endif
+    };
+
+    auto run_streams = [&](auto&& body) {
+        const auto start = std::chrono::steady_clock::now();
+        std::vector<std::thread> threads;
+        for (size_t stream = 0; stream < streams; stream++) {
+            threads.emplace_back([&, stream] {
+                const int node = static_cast<int>(stream % nodes);
+                pin(node);
+                body(stream, node);
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    struct Run {
+        WeightsNumaPolicy policy;
+        bool huge_pages;
+    };
+    std::vector<Run> runs;
+    for (const auto policy : policies) {
+        runs.push_back({policy, false});
+    }
+    runs.push_back({WeightsNumaPolicy::INTERLEAVE, true});
+    runs.push_back({WeightsNumaPolicy::REPLICATE, true});
+
+    printf("\n--- Weights of %zu streams on %d NUMA node(s)%s ---\n",
+           streams,
+           real_nodes,
+           fake_topology ? ", fake topology of 2 nodes" : "");
+    printf("%-24s | %12s | %14s | %14s\n", "Policy", "create (ms)", "read (GB/s)", "weights (MB)");
+    printf("-------------------------+--------------+----------------+---------------\n");
+    for (const auto& run : runs) {
+        const auto name = policy_name(run.policy) + (run.huge_pages ? "_huge_pages" : "");
+        SocketsWeights weights(run.policy, run.huge_pages);
+        // the graphs of the streams keep the weights alive
+        std::vector<std::vector<MemoryPtr>> stream_weights(streams);
+
+        const auto create_ms = run_streams([&](size_t stream, int node) {
+            // a socket per node
+            auto cache = weights.get(node, node);
+            for (size_t i = 0; i < weights_count; i++) {
+                auto create = [&] {
+                    return make_weights(weights_size, static_cast<float>(i));
+                };
+                stream_weights[stream].push_back(
+                    static_cast<MemoryPtr>(*cache->findOrCreate("weights_" + std::to_string(i), create)));
+            }
+        });
+
+        std::vector<double> sums(streams);
+        const auto read_ms = run_streams([&](size_t stream, int) {
+            double sum = 0;
+            for (size_t r = 0; r < reads; r++) {
+                for (const auto& memory : stream_weights[stream]) {
+                    const auto* data = memory->getDataAs<const float>();
+                    for (size_t i = 0; i < weights_size; i++) {
+                        sum += data[i];
+                    }
+                }
+            }
+            sums[stream] = sum;
+        });
+        for (const auto sum : sums) {
+            ASSERT_EQ(sum, static_cast<double>(reads * weights_size * weights_count * (weights_count - 1) / 2));
+        }
+
+        size_t bytes = 0;
+        for (const auto& item : weights.dumpStatistics()) {
+            bytes += item.second.total_size;
+        }
+        const double read_bytes = static_cast<double>(streams * reads * weights_count * weights_size * sizeof(float));
+        printf("%-24s | %12.2f | %14.2f | %14zu\n",
+               name.c_str(),
+               create_ms,
+               read_bytes / read_ms / 1e6,
+               bytes >> 20);
+    }
+}
+
+}  // namespace ov::test
@@ -0,0 +1,189 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "internal_properties.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+std::string growth_name(DynamicMemoryGrowth growth) {
+    std::stringstream ss;
+    ss << growth;
+    return ss.str();
+}
+
+}  // namespace
+
+TEST(DynamicMemoryPoolTest, GrowthPolicies) {
+    const DynamicMemoryPool exact(DynamicMemoryGrowth::EXACT);
+    EXPECT_EQ(exact.reserve(1000, 800), 1000U);
+
+    const DynamicMemoryPool geometric(DynamicMemoryGrowth::GEOMETRIC);
+    EXPECT_EQ(geometric.reserve(1000, 0), 1000U);
+    EXPECT_EQ(geometric.reserve(1000, 800), 1200U);
+    EXPECT_EQ(geometric.reserve(2000, 800), 2000U);
+
+    const DynamicMemoryPool bucketed(DynamicMemoryGrowth::BUCKETED);
+    EXPECT_EQ(bucketed.reserve(1, 0), 256U);
+    EXPECT_EQ(bucketed.reserve(4096, 0), 4096U);
+    EXPECT_EQ(bucketed.reserve(4097, 0), 5120U);
+    EXPECT_EQ(bucketed.reserve(7000, 4096), 7168U);
+    for (size_t size = 1; size < (1 << 20); size = size * 3 + 1) {
+        const auto reserved = bucketed.reserve(size, 0);
+        EXPECT_GE(reserved, size);
+        EXPECT_LE(reserved, std::max<size_t>(256, size + size / 4)) << size;
+    }
+}
+
+TEST(DynamicMemoryPoolTest, GeometricGrowthReallocatesLess) {
+    auto pool = std::make_shared<DynamicMemoryPool>(DynamicMemoryGrowth::GEOMETRIC);
+    MemoryBlockWithReuse block(-1, pool);
+    size_t reallocations = 0;
+    for (size_t size = 1024; size <= 1024 * 1024; size += 1024) {
+        reallocations += block.resize(size) ? 1 : 0;
+        ASSERT_GE(block.size(), size);
+        ASSERT_NE(block.getRawPtr(), nullptr);
+    }
+    EXPECT_LT(reallocations, 25U);
+    EXPECT_EQ(pool->getStatistics().allocations, reallocations);
+}
+
+TEST(DynamicMemoryPoolTest, ShrinksAfterSmallInferences) {
+    constexpr uint32_t shrinkAfter = 3;
+    auto pool = std::make_shared<DynamicMemoryPool>(DynamicMemoryGrowth::EXACT, shrinkAfter);
+    MemoryBlockWithReuse block(-1, pool);
+    ASSERT_TRUE(block.resize(1024 * 1024));
+    block.decay();
+
+    // a large inference in between starts the count over
+    for (uint32_t i = 0; i < shrinkAfter - 1; i++) {
+        EXPECT_FALSE(block.resize(1024));
+        block.decay();
+    }
+    EXPECT_FALSE(block.resize(1024 * 1024));
+    block.decay();
+    // the inferences which don't resize the block aren't accounted
+    block.decay();
+
+    for (uint32_t i = 0; i < shrinkAfter; i++) {
+        EXPECT_FALSE(block.resize(1024 + i));
+        block.decay();
+    }
+    EXPECT_EQ(block.size(), 1024U * 1024U);
+    // shrinks to the largest of the small inferences on the next resize
+    EXPECT_TRUE(block.resize(1000));
+    EXPECT_EQ(block.size(), 1024U + shrinkAfter - 1);
+
+    const auto statistics = pool->getStatistics();
+    EXPECT_EQ(statistics.shrinks, 1U);
+    EXPECT_EQ(statistics.allocations, 2U);
+    EXPECT_EQ(statistics.in_use_bytes, block.size());
+}
+
+TEST(DynamicMemoryPoolTest, PoolReusesReleasedBuffers) {
+    auto pool = std::make_shared<DynamicMemoryPool>(DynamicMemoryGrowth::EXACT, 0, true);
+    auto first = std::make_unique<MemoryBlockWithReuse>(-1, pool);
+    MemoryBlockWithReuse second(-1, pool);
+    first->resize(4096);
+    second.resize(4096);
+    void* ptr = first->getRawPtr();
+    first.reset();
+    EXPECT_EQ(pool->getStatistics().cached_bytes, 4096U);
+
+    // a much larger buffer isn't taken for a small request
+    MemoryBlockWithReuse small(-1, pool);
+    small.resize(1024);
+    EXPECT_EQ(pool->getStatistics().reuses, 0U);
+
+    MemoryBlockWithReuse third(-1, pool);
+    third.resize(3000);
+    EXPECT_EQ(third.getRawPtr(), ptr);
+    EXPECT_EQ(third.size(), 4096U);
+
+    const auto statistics = pool->getStatistics();
+    EXPECT_EQ(statistics.reuses, 1U);
+    EXPECT_EQ(statistics.allocations, 3U);
+    EXPECT_EQ(statistics.cached_bytes, 0U);
+}
+
+TEST(DynamicMemoryPoolTest, PoolHoldsAtMostInUse) {
+    auto pool = std::make_shared<DynamicMemoryPool>(DynamicMemoryGrowth::EXACT, 0, true);
+    std::vector<std::unique_ptr<MemoryBlockWithReuse>> blocks;
+    for (size_t i = 1; i <= 8; i++) {
+        blocks.push_back(std::make_unique<MemoryBlockWithReuse>(-1, pool));
+        blocks.back()->resize(i * 1024);
+    }
+    while (!blocks.empty()) {
+        blocks.pop_back();
+        const auto statistics = pool->getStatistics();
+        EXPECT_LE(statistics.cached_bytes, statistics.in_use_bytes);
+    }
+    const auto statistics = pool->getStatistics();
+    EXPECT_EQ(statistics.cached_bytes, 0U);
+    EXPECT_EQ(statistics.frees, statistics.allocations);
+}
+
+// Reports the allocations from the system and the peak memory of the sequence lengths of an LLM/ASR-like workload
+// slowly growing over the requests, with an outlier in the middle, by growth policy and shrink setting. Two infer
+// requests share the pool, one of them is recreated periodically and takes the buffer of the released one.
+TEST(DynamicMemoryPoolTest, GrowingSequenceBenchmark) {
+    constexpr size_t requests = 2000;
+    constexpr size_t tokenBytes = 4096;
+    constexpr size_t settle = 100;
+    constexpr size_t recreateEvery = 50;
+
+    std::mt19937 gen(42);
+    std::vector<size_t> lengths(requests);
+    for (size_t i = 0; i < requests; i++) {
+        lengths[i] = 16 + i / 4 + gen() % 32;
+    }
+    lengths[requests / 2] = 8192;
+
+    const std::vector<DynamicMemoryGrowth> growths{DynamicMemoryGrowth::EXACT,
+                                                   DynamicMemoryGrowth::GEOMETRIC,
+                                                   DynamicMemoryGrowth::BUCKETED};
+    for (const auto growth : growths) {
+        for (const uint32_t shrinkAfter : {0U, 16U}) {
+            auto pool = std::make_shared<DynamicMemoryPool>(growth, shrinkAfter, true);
+            std::vector<std::unique_ptr<MemoryBlockWithReuse>> blocks;
+            for (size_t i = 0; i < 2; i++) {
+                blocks.push_back(std::make_unique<MemoryBlockWithReuse>(-1, pool));
+            }
+            size_t lastBytes = 0;
+            for (size_t i = 0; i < requests; i++) {
+                auto& block = blocks[i % blocks.size()];
+                block->resize(lengths[i] * tokenBytes);
+                block->decay();
+                if (i % recreateEvery == recreateEvery - 1) {
+                    block = std::make_unique<MemoryBlockWithReuse>(-1, pool);
+                }
+                if (i > requests / 2 + settle) {
+                    lastBytes = std::max(lastBytes, pool->getStatistics().in_use_bytes);
+                }
+            }
+            const auto statistics = pool->getStatistics();
+            const auto name = growth_name(growth) + (shrinkAfter ? "_shrink" : "");
+            EXPECT_GT(statistics.reuses, 0U) << name;
+            if (shrinkAfter) {
+                // the outlier isn't kept until the end
+                EXPECT_LT(lastBytes, 8192 * tokenBytes) << name;
+            }
+            RecordProperty(name + "_allocations", std::to_string(statistics.allocations));
+            RecordProperty(name + "_reuses", std::to_string(statistics.reuses));
+            RecordProperty(name + "_peak_bytes", std::to_string(statistics.peak_bytes));
+            RecordProperty(name + "_final_bytes", std::to_string(statistics.in_use_bytes));
+        }
+    }
+}
@@ -0,0 +1,183 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "nodes/kernels/embedding_bag_kernel.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "openvino/core/type/bfloat16.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/core/type/float16.hpp"
+
+using ov::Extensions::Cpu::XARCH::embedding_bag_reduce;
+
+namespace {
+
+// A table of random values in the given precision along with its values in f32
+struct Table {
+    Table(ov::element::Type precision, size_t rows, size_t depth, std::mt19937& gen)
+        : precision(precision),
+          rows(rows),
+          depth(depth),
+          data(rows * depth * precision.bitwidth() / 8),
+          values(rows * depth) {
+        std::uniform_int_distribution<int> dist(0, 255);
+        for (size_t i = 0; i < rows * depth; i++) {
+            const auto q = dist(gen);
+            switch (precision) {
+            case ov::element::f32:
+                values[i] = static_cast<float>(q - 128) / 16.0F;
+                reinterpret_cast<float*>(data.data())[i] = values[i];
+                break;
+            case ov::element::bf16:
+                reinterpret_cast<ov::bfloat16*>(data.data())[i] = ov::bfloat16(static_cast<float>(q - 128) / 16.0F);
+                values[i] = static_cast<float>(reinterpret_cast<ov::bfloat16*>(data.data())[i]);
+                break;
+            case ov::element::f16:
+                reinterpret_cast<ov::float16*>(data.data())[i] = ov::float16(static_cast<float>(q - 128) / 16.0F);
+                values[i] = static_cast<float>(reinterpret_cast<ov::float16*>(data.data())[i]);
+                break;
+            case ov::element::u8:
+                data[i] = static_cast<uint8_t>(q);
+                values[i] = static_cast<float>(q);
+                break;
+            case ov::element::i8:
+                data[i] = static_cast<uint8_t>(q);
+                values[i] = static_cast<float>(static_cast<int8_t>(q));
+                break;
+            case ov::element::u4:
+            case ov::element::i4: {
+                const auto nibble = static_cast<uint8_t>(q & 0x0F);
+                data[i / 2] = static_cast<uint8_t>(data[i / 2] | (nibble << ((i % 2) * 4)));
+                values[i] = precision == ov::element::i4 && nibble >= 8 ? static_cast<float>(nibble) - 16.0F
+                                                                       : static_cast<float>(nibble);
+                break;
+            }
+            default:
+                break;
+            }
+        }
+    }
+
+    bool compressed() const {
+        return precision.is_integral();
+    }
+
+    ov::element::Type precision;
+    size_t rows;
+    size_t depth;
+    std::vector<uint8_t> data;
+    std::vector<float> values;
+};
+
+std::vector<float> reference(const Table& table,
+                             const float* scales,
+                             const float* zero_points,
+                             const std::vector<int32_t>& indices,
+                             const float* weights,
+                             bool mean) {
+    std::vector<float> dst(table.depth, 0.0F);
+    for (size_t k = 0; k < indices.size(); k++) {
+        const auto row = static_cast<size_t>(indices[k]);
+        for (size_t i = 0; i < table.depth; i++) {
+            float value = table.values[row * table.depth + i];
+            if (zero_points) {
+                value -= zero_points[row];
+            }
+            if (scales) {
+                value *= scales[row];
+            }
+            dst[i] += value * (weights ? weights[k] : 1.0F);
+        }
+    }
+    if (mean && !indices.empty()) {
+        for (auto& value : dst) {
+            value /= static_cast<float>(indices.size());
+        }
+    }
+    return dst;
+}
+
+const std::vector<ov::element::Type> precisions{ov::element::f32,
+                                                ov::element::bf16,
+                                                ov::element::f16,
+                                                ov::element::u8,
+                                                ov::element::i8,
+                                                ov::element::u4,
+                                                ov::element::i4};
+
+}  // namespace
+
+TEST(EmbeddingBagKernelTest, MatchesReference) {
+    std::mt19937 gen(42);
+    constexpr size_t rows = 64;
+    for (const auto precision : precisions) {
+        // the vectorized part and the tail, the 4-bit rows must be even
+        const size_t depth = precision.bitwidth() == 4 ? 70 : 37;
+        const Table table(precision, rows, depth, gen);
+        std::vector<float> scales(rows);
+        std::vector<float> zero_points(rows);
+        for (size_t r = 0; r < rows; r++) {
+            scales[r] = 0.01F * static_cast<float>(r + 1);
+            zero_points[r] = static_cast<float>(r % 9);
+        }
+        // longer than the prefetch distance
+        std::vector<int32_t> indices(23);
+        std::vector<float> weights(indices.size());
+        for (size_t k = 0; k < indices.size(); k++) {
+            indices[k] = static_cast<int32_t>(gen() % rows);
+            weights[k] = static_cast<float>(k % 5) * 0.5F - 1.0F;
+        }
+
+        for (const bool with_weights : {false, true}) {
+            for (const bool mean : {false, true}) {
+                SCOPED_TRACE(precision.get_type_name() + (with_weights ? " weights" : "") + (mean ? " mean" : ""));
+                const float* scales_ptr = table.compressed() ? scales.data() : nullptr;
+                const float* zero_points_ptr = table.compressed() ? zero_points.data() : nullptr;
+                const float* weights_ptr = with_weights ? weights.data() : nullptr;
+                const auto expected = reference(table, scales_ptr, zero_points_ptr, indices, weights_ptr, mean);
+                std::vector<float> dst(depth, -1.0F);
+                embedding_bag_reduce(table.data.data(),
+                                     precision,
+                                     depth,
+                                     scales_ptr,
+                                     zero_points_ptr,
+                                     indices.data(),
+                                     indices.size(),
+                                     weights_ptr,
+                                     mean,
+                                     dst.data());
+                for (size_t i = 0; i < depth; i++) {
+                    ASSERT_NEAR(dst[i], expected[i], 1e-3F * std::max(1.0F, std::fabs(expected[i]))) << i;
+                }
+            }
+        }
+    }
+}
+
+TEST(EmbeddingBagKernelTest, EmptyBag) {
+    std::mt19937 gen(42);
+    const Table table(ov::element::u8, 4, 16, gen);
+    std::vector<float> dst(16, -1.0F);
+    embedding_bag_reduce(table.data.data(),
+                         table.precision,
+                         table.depth,
+                         nullptr,
+                         nullptr,
+                         nullptr,
+                         0,
+                         nullptr,
+                         true,
+                         dst.data());
+    for (const auto value : dst) {
+        ASSERT_EQ(value, 0.0F);
+    }
+}
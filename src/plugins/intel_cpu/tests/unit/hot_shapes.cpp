@@ -0,0 +1,103 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+#include "cache/hot_shapes.h"
+#include "common_test_utils/common_utils.hpp"
+#include "openvino/core/except.hpp"
+
+using namespace ov::intel_cpu;
+
+TEST(HotShapesTests, RankedByHits) {
+    HotShapes hot_shapes(2);
+    const HotShapes::Record a{{1, 16}, {1, 16}};
+    const HotShapes::Record b{{4, 16}, {4, 16}};
+    const HotShapes::Record c{{8, 16}, {8, 16}};
+
+    hot_shapes.record(0, a);
+    for (int i = 0; i < 3; i++) {
+        hot_shapes.record(0, b);
+    }
+    hot_shapes.record(0, c, 2);
+
+    EXPECT_EQ(hot_shapes.hottest(), (std::vector<HotShapes::Record>{b, c}));
+}
+
+TEST(HotShapesTests, Disabled) {
+    HotShapes hot_shapes(0);
+    EXPECT_FALSE(hot_shapes.enabled());
+    hot_shapes.record(0, {{1, 16}});
+    EXPECT_TRUE(hot_shapes.hottest().empty());
+}
+
+TEST(HotShapesTests, TrackedRecordsAreBounded) {
+    HotShapes hot_shapes(1);
+    // a stream of unique shapes must not grow the table without limits
+    for (size_t i = 1; i <= 1000; i++) {
+        hot_shapes.record(0, {{i}});
+    }
+    // shapes seen before the table was full are still counted
+    hot_shapes.record(0, {{1}});
+    EXPECT_EQ(hot_shapes.hottest(), (std::vector<HotShapes::Record>{{{1}}}));
+
+    // the table is full, so a new shape is dropped however hot it is
+    hot_shapes.record(0, {{5000}}, 100);
+    EXPECT_EQ(hot_shapes.hottest(), (std::vector<HotShapes::Record>{{{1}}}));
+}
+
+TEST(HotShapesTests, StreamsAreMerged) {
+    HotShapes hot_shapes(2, 3);
+    const HotShapes::Record a{{1, 16}};
+    const HotShapes::Record b{{4, 16}};
+    const HotShapes::Record c{{8, 16}};
+
+    // b is the hottest one only when the hits of all the streams are summed up
+    hot_shapes.record(0, a, 3);
+    hot_shapes.record(1, b, 2);
+    hot_shapes.record(2, b, 2);
+    hot_shapes.record(2, c, 1);
+
+    EXPECT_EQ(hot_shapes.hottest(), (std::vector<HotShapes::Record>{b, a}));
+}
+
+TEST(HotShapesTests, SerializeRoundTrip) {
+    const std::vector<HotShapes::Record> records{{{1, 128, 768}, {1, 128}, {}}, {{2, 7, 768}, {2, 7}, {}}, {{0}}};
+
+    const auto str = HotShapes::serialize(records);
+    EXPECT_EQ(str, "{1,128,768}{1,128}{};{2,7,768}{2,7}{};{0}");
+    EXPECT_EQ(HotShapes::deserialize(str), records);
+    EXPECT_TRUE(HotShapes::deserialize("").empty());
+}
+
+TEST(HotShapesTests, DeserializeMalformed) {
+    EXPECT_THROW(HotShapes::deserialize("{1,2"), ov::Exception);
+    EXPECT_THROW(HotShapes::deserialize("1,2"), ov::Exception);
+    EXPECT_THROW(HotShapes::deserialize("{1,-2}"), ov::Exception);
+    EXPECT_THROW(HotShapes::deserialize("{1,,2}"), ov::Exception);
+}
+
+TEST(HotShapesTests, SaveLoad) {
+    const auto dir = std::filesystem::path(ov::test::utils::generateTestFilePrefix() + "_hot_shapes");
+    std::filesystem::create_directories(dir);
+    const auto path = dir / "model.hot_shapes";
+    const std::vector<HotShapes::Record> records{{{1, 128}, {}}, {{2, 7}, {}}};
+
+    EXPECT_TRUE(HotShapes::load(path).empty());
+    ASSERT_TRUE(HotShapes::save(path, records));
+    EXPECT_EQ(HotShapes::load(path), records);
+
+    // a malformed file is ignored rather than failing the import
+    {
+        std::ofstream stream(path, std::ios::trunc);
+        stream << "{1,2";
+    }
+    EXPECT_TRUE(HotShapes::load(path).empty());
+
+    std::filesystem::remove_all(dir);
+}
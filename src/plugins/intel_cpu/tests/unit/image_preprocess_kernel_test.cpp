@@ -0,0 +1,342 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "nodes/kernels/image_preprocess_kernel.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "cpu_parallel.hpp"
+#include "openvino/core/type/bfloat16.hpp"
+#include "openvino/core/type/element_type.hpp"
+
+using ov::Extensions::Cpu::XARCH::image_preprocess_exec;
+using ov::intel_cpu::ImagePreprocessPlan;
+
+namespace {
+
+using Source = ImagePreprocessPlan::Source;
+
+// A random u8 image in the given format along with its planes
+struct Image {
+    Image(Source source, size_t planes, size_t batch, size_t height, size_t width, size_t channels, std::mt19937& gen)
+        : source(source),
+          batch(batch),
+          height(height),
+          width(width),
+          channels(source == Source::PACKED ? channels : 3) {
+        std::uniform_int_distribution<int> dist(0, 255);
+        auto random_plane = [&](size_t size) {
+            std::vector<uint8_t> plane(size);
+            for (auto& value : plane) {
+                value = static_cast<uint8_t>(dist(gen));
+            }
+            return plane;
+        };
+        const auto area = height * width;
+        if (source == Source::PACKED) {
+            data.push_back(random_plane(batch * area * channels));
+        } else if (planes == 1) {
+            data.push_back(random_plane(batch * area * 3 / 2));
+        } else if (source == Source::NV12) {
+            data.push_back(random_plane(batch * area));
+            data.push_back(random_plane(batch * area / 2));
+        } else {
+            data.push_back(random_plane(batch * area));
+            data.push_back(random_plane(batch * area / 4));
+            data.push_back(random_plane(batch * area / 4));
+        }
+        for (const auto& plane : data) {
+            pointers.push_back(plane.data());
+        }
+    }
+
+    // the RGB (or the packed) value of the pixel as the ColorConvert node computes it
+    float value(size_t n, size_t y, size_t x, size_t c, bool round) const {
+        const auto area = height * width;
+        if (source == Source::PACKED) {
+            return static_cast<float>(data[0][((n * height + y) * width + x) * channels + c]);
+        }
+        size_t luma = 0;
+        size_t u = 0;
+        size_t v = 0;
+        const uint8_t* u_plane = nullptr;
+        const uint8_t* v_plane = nullptr;
+        if (source == Source::NV12) {
+            const auto uv = (y / 2) * width + (x / 2) * 2;
+            if (data.size() == 1) {
+                luma = data[0][n * area * 3 / 2 + y * width + x];
+                u_plane = v_plane = data[0].data() + n * area * 3 / 2 + area;
+            } else {
+                luma = data[0][n * area + y * width + x];
+                u_plane = v_plane = data[1].data() + n * area / 2;
+            }
+            u = u_plane[uv];
+            v = v_plane[uv + 1];
+        } else {
+            const auto uv = (y / 2) * (width / 2) + x / 2;
+            if (data.size() == 1) {
+                luma = data[0][n * area * 3 / 2 + y * width + x];
+                u_plane = data[0].data() + n * area * 3 / 2 + area;
+                v_plane = u_plane + area / 4;
+            } else {
+                luma = data[0][n * area + y * width + x];
+                u_plane = data[1].data() + n * area / 4;
+                v_plane = data[2].data() + n * area / 4;
+            }
+            u = u_plane[uv];
+            v = v_plane[uv];
+        }
+        const auto cy = (static_cast<float>(luma) - 16.F) * 1.164F;
+        const auto d = static_cast<float>(u) - 128.F;
+        const auto e = static_cast<float>(v) - 128.F;
+        float rgb[3] = {cy + 1.596F * e, cy - 0.391F * d - 0.813F * e, cy + 2.018F * d};
+        auto result = round ? std::nearbyint(rgb[c]) : rgb[c];
+        return std::min(std::max(result, 0.F), 255.F);
+    }
+
+    Source source;
+    size_t batch;
+    size_t height;
+    size_t width;
+    size_t channels;
+    std::vector<std::vector<uint8_t>> data;
+    std::vector<const uint8_t*> pointers;
+};
+
+struct Options {
+    size_t crop_begin[2] = {0, 0};
+    size_t crop_length[2] = {0, 0};
+    size_t out[2] = {0, 0};
+    bool resize = true;
+    bool nearest = false;
+    bool reverse = false;
+    bool round = true;
+};
+
+// the half pixel source coordinate of an output coordinate
+float source_coordinate(size_t o, size_t out_len, size_t in_len) {
+    return (static_cast<float>(o) + 0.5F) * static_cast<float>(in_len) / static_cast<float>(out_len) - 0.5F;
+}
+
+int64_t nearest_index(float x, size_t length) {
+    const auto i = x == std::floor(x) + 0.5F ? std::floor(x) : std::round(x);
+    return std::clamp<int64_t>(static_cast<int64_t>(i), 0, static_cast<int64_t>(length) - 1);
+}
+
+// the taps of the half pixel linear or the round prefer floor nearest resize, as ImagePreprocess builds them
+ImagePreprocessPlan::Taps make_taps(const Options& options, size_t axis) {
+    const auto begin = options.crop_begin[axis];
+    const auto length = options.crop_length[axis];
+    const auto out_len = options.out[axis];
+    ImagePreprocessPlan::Taps taps;
+    for (size_t k = 0; k < 2; k++) {
+        taps.index[k].resize(out_len);
+        taps.weight[k].resize(out_len);
+    }
+    for (size_t o = 0; o < out_len; o++) {
+        int64_t i0 = static_cast<int64_t>(o);
+        int64_t i1 = i0;
+        float w1 = 0.F;
+        if (options.resize && options.nearest) {
+            i0 = i1 = nearest_index(source_coordinate(o, out_len, length), length);
+        } else if (options.resize) {
+            const auto last = static_cast<int64_t>(length) - 1;
+            const auto x = std::clamp(source_coordinate(o, out_len, length), 0.F, static_cast<float>(last));
+            i0 = static_cast<int64_t>(std::floor(x));
+            i1 = std::min(i0 + 1, last);
+            w1 = i1 == i0 ? 0.F : x - static_cast<float>(i0);
+        }
+        taps.index[0][o] = static_cast<int32_t>(begin + i0);
+        taps.index[1][o] = static_cast<int32_t>(begin + i1);
+        taps.weight[0][o] = 1.F - w1;
+        taps.weight[1][o] = w1;
+    }
+    return taps;
+}
+
+ImagePreprocessPlan make_plan(const Image& image, const Options& options) {
+    ImagePreprocessPlan plan;
+    plan.source = image.source;
+    plan.planes = image.data.size();
+    plan.batch = image.batch;
+    plan.height = image.height;
+    plan.width = image.width;
+    plan.channels = image.channels;
+    plan.reverse_channels = options.reverse;
+    plan.round_color = options.round;
+    plan.out_height = options.out[0];
+    plan.out_width = options.out[1];
+    plan.rows = make_taps(options, 0);
+    plan.columns = make_taps(options, 1);
+
+    auto& columns = plan.source_columns;
+    columns = plan.columns.index[0];
+    columns.insert(columns.end(), plan.columns.index[1].begin(), plan.columns.index[1].end());
+    std::sort(columns.begin(), columns.end());
+    columns.erase(std::unique(columns.begin(), columns.end()), columns.end());
+    plan.copy_columns = columns.size() == plan.out_width;
+    for (size_t o = 0; o < plan.out_width; o++) {
+        for (auto& index : plan.columns.index) {
+            index[o] = static_cast<int32_t>(std::lower_bound(columns.begin(), columns.end(), index[o]) - columns.begin());
+        }
+        plan.copy_columns =
+            plan.copy_columns && plan.columns.index[0][o] == static_cast<int32_t>(o) && plan.columns.weight[1][o] == 0.F;
+    }
+    for (size_t c = 0; c < plan.channels; c++) {
+        plan.scale.push_back(1.F / (58.F + static_cast<float>(c)));
+        plan.shift.push_back(-(123.F - 6.F * static_cast<float>(c)) * plan.scale.back());
+    }
+    return plan;
+}
+
+// crop -> resize -> mean/scale -> NCHW computed pixel by pixel with the 2D bilinear interpolation
+std::vector<float> reference(const Image& image, const ImagePreprocessPlan& plan, const Options& options) {
+    const auto out_h = options.out[0];
+    const auto out_w = options.out[1];
+    std::vector<float> dst(image.batch * image.channels * out_h * out_w);
+    auto value = [&](size_t n, int64_t y, int64_t x, size_t c) {
+        const auto channel = options.reverse ? image.channels - 1 - c : c;
+        return image.value(n,
+                           options.crop_begin[0] + static_cast<size_t>(y),
+                           options.crop_begin[1] + static_cast<size_t>(x),
+                           channel,
+                           options.round);
+    };
+    for (size_t n = 0; n < image.batch; n++) {
+        for (size_t c = 0; c < image.channels; c++) {
+            for (size_t oy = 0; oy < out_h; oy++) {
+                for (size_t ox = 0; ox < out_w; ox++) {
+                    float result = 0.F;
+                    if (!options.resize) {
+                        result = value(n, oy, ox, c);
+                    } else if (options.nearest) {
+                        result = value(n,
+                                       nearest_index(source_coordinate(oy, out_h, options.crop_length[0]),
+                                                     options.crop_length[0]),
+                                       nearest_index(source_coordinate(ox, out_w, options.crop_length[1]),
+                                                     options.crop_length[1]),
+                                       c);
+                    } else {
+                        const auto last_y = static_cast<float>(options.crop_length[0] - 1);
+                        const auto last_x = static_cast<float>(options.crop_length[1] - 1);
+                        const auto fy = std::clamp(source_coordinate(oy, out_h, options.crop_length[0]), 0.F, last_y);
+                        const auto fx = std::clamp(source_coordinate(ox, out_w, options.crop_length[1]), 0.F, last_x);
+                        const auto y0 = static_cast<int64_t>(std::floor(fy));
+                        const auto x0 = static_cast<int64_t>(std::floor(fx));
+                        const auto y1 = std::min<int64_t>(y0 + 1, static_cast<int64_t>(last_y));
+                        const auto x1 = std::min<int64_t>(x0 + 1, static_cast<int64_t>(last_x));
+                        const auto dy = fy - static_cast<float>(y0);
+                        const auto dx = fx - static_cast<float>(x0);
+                        result = (value(n, y0, x0, c) * (1.F - dx) + value(n, y0, x1, c) * dx) * (1.F - dy) +
+                                 (value(n, y1, x0, c) * (1.F - dx) + value(n, y1, x1, c) * dx) * dy;
+                    }
+                    dst[((n * image.channels + c) * out_h + oy) * out_w + ox] =
+                        result * plan.scale[c] + plan.shift[c];
+                }
+            }
+        }
+    }
+    return dst;
+}
+
+ov::intel_cpu::CpuParallelPtr make_cpu_parallel() {
+    return std::make_shared<ov::intel_cpu::CpuParallel>(ov::intel_cpu::TbbPartitioner::STATIC);
+}
+
+void check(const Image& image, const Options& options) {
+    const auto plan = make_plan(image, options);
+    const auto expected = reference(image, plan, options);
+    std::vector<float> dst(expected.size(), -1.F);
+    image_preprocess_exec(plan, image.pointers.data(), dst.data(), ov::element::f32, make_cpu_parallel());
+    for (size_t i = 0; i < dst.size(); i++) {
+        ASSERT_NEAR(dst[i], expected[i], 1e-4F) << "at " << i;
+    }
+
+    // bf16 stores the same values rounded
+    std::vector<ov::bfloat16> dst_bf16(expected.size());
+    image_preprocess_exec(plan, image.pointers.data(), dst_bf16.data(), ov::element::bf16, make_cpu_parallel());
+    for (size_t i = 0; i < dst_bf16.size(); i++) {
+        ASSERT_NEAR(static_cast<float>(dst_bf16[i]), expected[i], 2e-2F) << "at " << i;
+    }
+}
+
+Options make_options(size_t height, size_t width, size_t out_h, size_t out_w) {
+    Options options;
+    options.crop_length[0] = height;
+    options.crop_length[1] = width;
+    options.out[0] = out_h;
+    options.out[1] = out_w;
+    return options;
+}
+
+}  // namespace
+
+TEST(ImagePreprocessKernelTest, PackedCropResize) {
+    std::mt19937 gen(42);
+    const Image image(Source::PACKED, 1, 2, 37, 53, 3, gen);
+    auto options = make_options(30, 41, 17, 23);
+    options.crop_begin[0] = 3;
+    options.crop_begin[1] = 7;
+    options.reverse = true;
+    check(image, options);
+    options.nearest = true;
+    check(image, options);
+    // upscale
+    options = make_options(37, 53, 61, 97);
+    check(image, options);
+}
+
+TEST(ImagePreprocessKernelTest, PackedCropOnly) {
+    std::mt19937 gen(7);
+    const Image image(Source::PACKED, 1, 1, 24, 40, 4, gen);
+    auto options = make_options(16, 33, 16, 33);
+    options.crop_begin[0] = 5;
+    options.crop_begin[1] = 3;
+    options.resize = false;
+    check(image, options);
+    ASSERT_TRUE(make_plan(image, options).copy_columns);
+}
+
+TEST(ImagePreprocessKernelTest, NV12) {
+    std::mt19937 gen(1);
+    for (size_t planes : {1, 2}) {
+        const Image image(Source::NV12, planes, 2, 48, 64, 3, gen);
+        auto options = make_options(48, 64, 20, 36);
+        check(image, options);
+        options.reverse = true;
+        options.round = false;
+        options.nearest = true;
+        check(image, options);
+        // odd crop offsets inside the chroma blocks
+        options = make_options(33, 45, 33, 45);
+        options.crop_begin[0] = 5;
+        options.crop_begin[1] = 9;
+        options.resize = false;
+        check(image, options);
+    }
+}
+
+TEST(ImagePreprocessKernelTest, I420) {
+    std::mt19937 gen(2);
+    for (size_t planes : {1, 3}) {
+        const Image image(Source::I420, planes, 1, 30, 42, 3, gen);
+        auto options = make_options(30, 42, 57, 65);
+        check(image, options);
+        options.round = false;
+        options.crop_begin[0] = 1;
+        options.crop_begin[1] = 3;
+        options.crop_length[0] = 27;
+        options.crop_length[1] = 35;
+        options.out[0] = 8;
+        options.out[1] = 11;
+        check(image, options);
+    }
+}
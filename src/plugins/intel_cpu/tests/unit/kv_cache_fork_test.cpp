@@ -0,0 +1,293 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <map>
+#include <memory>
+#include <string>
+
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "memory_state.h"
+#include "nodes/common/arbitrary_order_desc_creator.h"
+#include "openvino/core/partial_shape.hpp"
+#include "openvino/op/assign.hpp"
+#include "openvino/op/concat.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/gather.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/read_value.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/op/scaled_dot_product_attention.hpp"
+#include "openvino/runtime/iasync_infer_request.hpp"
+#include "openvino/runtime/icompiled_model.hpp"
+#include "openvino/runtime/make_tensor.hpp"
+#include "openvino/runtime/properties.hpp"
+#include "openvino/runtime/tensor.hpp"
+#include "plugin.h"
+#include "unit_test_utils/mocks/openvino/runtime/mock_icore.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+// [B, H, L, S] states stored as LBHS, like the ones of the stateful SDPA, u8 ones are quantized by token
+std::shared_ptr<VariableStateKVcache> make_state(size_t heads,
+                                                 size_t head_size,
+                                                 ov::element::Type precision = ov::element::f32) {
+    const ov::PartialShape shape{-1, static_cast<int64_t>(heads), -1, static_cast<int64_t>(head_size)};
+    auto external_desc = std::make_shared<CpuBlockedMemoryDesc>(ov::element::f32, Shape(shape));
+    auto internal_desc = ArbitraryOrderDescCreator({2, 0, 1, 3}).createSharedDesc(precision, Shape(shape));
+    ov::Extensions::Cpu::CacheSpec spec;
+    if (precision == ov::element::u8) {
+        spec.precision = precision;
+        spec.group_size = head_size;
+    }
+    return std::make_shared<VariableStateKVcache>("kv", external_desc, internal_desc, spec);
+}
+
+ov::Tensor make_tokens(size_t heads, size_t tokens, size_t head_size, float scale = 1.0F) {
+    ov::Tensor tensor(ov::element::f32, {1, heads, tokens, head_size});
+    auto* data = tensor.data<float>();
+    for (size_t i = 0; i < tensor.get_size(); i++) {
+        data[i] = scale * static_cast<float>(i % 1013);
+    }
+    return tensor;
+}
+
+ov::Tensor state_of(const VariableStateKVcache& state) {
+    return ov::make_tensor(state.get_state());
+}
+
+void expect_equal(const ov::Tensor& expected, const ov::Tensor& actual) {
+    ASSERT_EQ(expected.get_shape(), actual.get_shape());
+    ASSERT_EQ(0, std::memcmp(expected.data(), actual.data(), expected.get_byte_size()));
+}
+
+}  // namespace
+
+TEST(KVCacheStateForkTest, ForkSharesBuffers) {
+    auto original = make_state(2, 16);
+    const auto tokens = make_tokens(2, 8, 16);
+    original->set_state(ov::get_tensor_impl(tokens));
+
+    auto forked = make_state(2, 16);
+    forked->fork(*original);
+    EXPECT_FALSE(forked->is_reset_state());
+    EXPECT_EQ(forked->tokens(), 8U);
+    EXPECT_EQ(forked->internal_state_mem()->getData(), original->internal_state_mem()->getData());
+    EXPECT_EQ(forked->hidden_state_mem()->getData(), original->hidden_state_mem()->getData());
+    expect_equal(tokens, state_of(*forked));
+}
+
+TEST(KVCacheStateForkTest, CopyOnWrite) {
+    auto original = make_state(2, 16);
+    const auto tokens = make_tokens(2, 8, 16);
+    original->set_state(ov::get_tensor_impl(tokens));
+    auto forked = make_state(2, 16);
+    forked->fork(*original);
+
+    // the state modified first gets its own copy, the other one keeps the shared buffers
+    const auto* shared = original->internal_state_mem()->getData();
+    forked->make_exclusive();
+    EXPECT_NE(forked->internal_state_mem()->getData(), shared);
+    EXPECT_NE(forked->hidden_state_mem()->getData(), original->hidden_state_mem()->getData());
+    static_cast<float*>(forked->internal_state_mem()->getData())[0] = -1.0F;
+    expect_equal(tokens, state_of(*original));
+    EXPECT_EQ(state_of(*forked).data<float>()[0], -1.0F);
+
+    // no one else references the buffers anymore
+    original->make_exclusive();
+    EXPECT_EQ(original->internal_state_mem()->getData(), shared);
+}
+
+TEST(KVCacheStateForkTest, SnapshotIsNotModified) {
+    auto state = make_state(2, 16);
+    const auto tokens = make_tokens(2, 8, 16);
+    state->set_state(ov::get_tensor_impl(tokens));
+
+    auto snapshot = state->capture();
+    state->make_exclusive();
+    static_cast<float*>(state->internal_state_mem()->getData())[0] = -1.0F;
+    state->truncate(4);
+    EXPECT_EQ(state->tokens(), 4U);
+
+    // roll back
+    state->restore(snapshot);
+    EXPECT_EQ(state->tokens(), 8U);
+    expect_equal(tokens, state_of(*state));
+
+    auto reset = make_state(2, 16);
+    state->restore(reset->capture());
+    EXPECT_TRUE(state->is_reset_state());
+}
+
+TEST(KVCacheStateForkTest, Truncate) {
+    auto state = make_state(2, 16);
+    state->set_state(ov::get_tensor_impl(make_tokens(2, 8, 16)));
+    const auto* data = state->internal_state_mem()->getData();
+
+    state->truncate(5);
+    EXPECT_EQ(state->tokens(), 5U);
+    EXPECT_EQ(state->internal_state_mem()->getData(), data);
+    EXPECT_EQ(state->hidden_state_mem()->getStaticDims(), (VectorDims{1, 5}));
+
+    const auto prefix = state_of(*state);
+    ASSERT_EQ(prefix.get_shape(), (ov::Shape{1, 2, 5, 16}));
+    const auto expected = make_tokens(2, 8, 16);
+    for (size_t h = 0; h < 2; h++) {
+        EXPECT_EQ(0,
+                  std::memcmp(prefix.data<float>() + h * 5 * 16,
+                              expected.data<float>() + h * 8 * 16,
+                              5 * 16 * sizeof(float)));
+    }
+    EXPECT_THROW(state->truncate(6), ov::Exception);
+}
+
+TEST(KVCacheStateForkTest, SetStateAfterFork) {
+    // the scales and zero points of a quantized cache are shared by the fork as well
+    auto original = make_state(2, 16, ov::element::u8);
+    original->set_state(ov::get_tensor_impl(make_tokens(2, 8, 16)));
+    const auto expected = state_of(*original);
+    auto forked = make_state(2, 16, ov::element::u8);
+    forked->fork(*original);
+
+    // the new content of the same size does not go to the buffers of the original state
+    const auto other_tokens = make_tokens(2, 8, 16, -2.0F);
+    forked->set_state(ov::get_tensor_impl(other_tokens));
+    EXPECT_NE(forked->internal_state_mem()->getData(), original->internal_state_mem()->getData());
+    EXPECT_NE(forked->get_scale_zp().ptr<float>(), original->get_scale_zp().ptr<float>());
+    expect_equal(expected, state_of(*original));
+
+    const auto forked_state = state_of(*forked);
+    const auto reference = make_state(2, 16, ov::element::u8);
+    reference->set_state(ov::get_tensor_impl(other_tokens));
+    expect_equal(state_of(*reference), forked_state);
+}
+
+namespace {
+
+// q, k, v: [1, H, L, S], the past keys and values are concatenated by L and kept in the states fused into the SDPA
+std::shared_ptr<ov::Model> make_stateful_sdpa(size_t heads, size_t head_size) {
+    const ov::PartialShape shape{1, static_cast<int64_t>(heads), -1, static_cast<int64_t>(head_size)};
+    ov::ParameterVector params;
+    for (const auto* name : {"q", "k", "v"}) {
+        params.push_back(std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape));
+        params.back()->set_friendly_name(name);
+    }
+    auto beam_idx = std::make_shared<ov::op::v0::Parameter>(ov::element::i32, ov::PartialShape{-1});
+    beam_idx->set_friendly_name("beam_idx");
+    params.push_back(beam_idx);
+    const auto axis = ov::op::v0::Constant::create(ov::element::i32, {}, {0});
+
+    ov::OutputVector kv;
+    ov::SinkVector sinks;
+    for (const auto& [name, index] : {std::pair{"pastk", 1}, std::pair{"pastv", 2}}) {
+        auto variable =
+            std::make_shared<ov::op::util::Variable>(ov::op::util::VariableInfo{shape, ov::element::f32, name});
+        auto past = std::make_shared<ov::op::v6::ReadValue>(variable);
+        auto gather = std::make_shared<ov::op::v8::Gather>(past, beam_idx, axis);
+        auto concat = std::make_shared<ov::op::v0::Concat>(ov::OutputVector{gather, params[index]}, 2);
+        sinks.push_back(std::make_shared<ov::op::v6::Assign>(concat, variable));
+        kv.push_back(concat);
+    }
+    auto sdpa = std::make_shared<ov::op::v13::ScaledDotProductAttention>(params[0], kv[0], kv[1], false);
+    auto result = std::make_shared<ov::op::v0::Result>(sdpa);
+    return std::make_shared<ov::Model>(ov::ResultVector{result}, sinks, params, "StatefulSDPA");
+}
+
+class StatefulSDPARequest {
+public:
+    StatefulSDPARequest(const std::shared_ptr<ov::ICompiledModel>& compiled_model, size_t heads, size_t head_size)
+        : m_request(compiled_model->create_infer_request()),
+          m_heads(heads),
+          m_head_size(head_size) {
+        for (const auto& state : m_request->query_state()) {
+            auto kv_cache = std::dynamic_pointer_cast<VariableStateKVcache>(state._ptr);
+            OPENVINO_ASSERT(kv_cache, "The state ", state->get_name(), " is not fused into the SDPA");
+            m_states[state->get_name()] = kv_cache;
+        }
+    }
+
+    // appends the tokens to the cache and returns the attention output of the last of them
+    ov::Tensor infer(size_t tokens, float scale) {
+        const auto& inputs = m_request->get_compiled_model()->inputs();
+        for (size_t i = 0; i < 3; i++) {
+            m_request->set_tensor(inputs[i], ov::get_tensor_impl(make_tokens(m_heads, tokens, m_head_size, scale)));
+        }
+        ov::Tensor beam_idx(ov::element::i32, {1});
+        beam_idx.data<int32_t>()[0] = 0;
+        m_request->set_tensor(inputs[3], ov::get_tensor_impl(beam_idx));
+        m_request->infer();
+        auto output = ov::make_tensor(m_request->get_tensor(m_request->get_compiled_model()->outputs()[0]));
+        ov::Tensor copy(output.get_element_type(), output.get_shape());
+        output.copy_to(copy);
+        return copy;
+    }
+
+    void fork(const StatefulSDPARequest& other) {
+        for (const auto& [name, state] : m_states) {
+            state->fork(*other.m_states.at(name));
+        }
+    }
+
+    void truncate(size_t tokens) {
+        for (const auto& [name, state] : m_states) {
+            state->truncate(tokens);
+        }
+    }
+
+    [[nodiscard]] size_t tokens() const {
+        return m_states.begin()->second->tokens();
+    }
+
+private:
+    std::shared_ptr<ov::IAsyncInferRequest> m_request;
+    std::map<std::string, std::shared_ptr<VariableStateKVcache>> m_states;
+    size_t m_heads;
+    size_t m_head_size;
+};
+
+void expect_near(const ov::Tensor& expected, const ov::Tensor& actual) {
+    ASSERT_EQ(expected.get_shape(), actual.get_shape());
+    for (size_t i = 0; i < expected.get_size(); i++) {
+        ASSERT_NEAR(expected.data<float>()[i], actual.data<float>()[i], 1e-5F) << "at " << i;
+    }
+}
+
+}  // namespace
+
+TEST(KVCacheStateForkTest, SDPAInferenceAfterForkAndTruncate) {
+    constexpr size_t heads = 2;
+    constexpr size_t head_size = 16;
+    auto plugin = std::make_shared<Plugin>();
+    plugin->set_core(std::make_shared<testing::NiceMock<ov::MockICore>>());
+    const auto compiled_model = plugin->compile_model(make_stateful_sdpa(heads, head_size),
+                                                      {ov::hint::inference_precision(ov::element::f32),
+                                                       ov::hint::kv_cache_precision(ov::element::f32),
+                                                       ov::num_streams(1)});
+
+    // the prompt of 4 tokens followed by the next one, without any fork
+    StatefulSDPARequest reference(compiled_model, heads, head_size);
+    reference.infer(4, 0.01F);
+    const auto expected = reference.infer(1, 0.02F);
+
+    StatefulSDPARequest original(compiled_model, heads, head_size);
+    original.infer(4, 0.01F);
+    StatefulSDPARequest forked(compiled_model, heads, head_size);
+    forked.fork(original);
+    ASSERT_EQ(forked.tokens(), 4U);
+
+    // the fork appends other tokens (e.g. a rejected draft) to its own copy of the cache
+    forked.infer(2, -0.03F);
+    ASSERT_EQ(forked.tokens(), 6U);
+    expect_near(expected, original.infer(1, 0.02F));
+
+    // rolled back to the prompt, the fork continues as if the draft was never there
+    forked.truncate(4);
+    expect_near(expected, forked.infer(1, 0.02F));
+    EXPECT_EQ(forked.tokens(), 5U);
+}
@@ -0,0 +1,333 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "memory_state.h"
+#include "nodes/common/arbitrary_order_desc_creator.h"
+#include "openvino/core/partial_shape.hpp"
+#include "openvino/runtime/make_tensor.hpp"
+#include "openvino/runtime/tensor.hpp"
+#include "openvino/runtime/threading/immediate_executor.hpp"
+#include "openvino/runtime/threading/itask_executor.hpp"
+#include "state_swap.h"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+// [B, H, L, S] states stored as LBHS, like the ones of the stateful SDPA, optionally quantized to u8 by head
+std::shared_ptr<VariableStateKVcache> make_state(size_t heads, size_t head_size, bool quantized = false) {
+    const ov::PartialShape shape{-1, static_cast<int64_t>(heads), -1, static_cast<int64_t>(head_size)};
+    auto external_desc = std::make_shared<CpuBlockedMemoryDesc>(ov::element::f32, Shape(shape));
+    ov::Extensions::Cpu::CacheSpec spec;
+    if (quantized) {
+        spec.precision = ov::element::u8;
+        spec.group_size = head_size;
+    }
+    auto internal_desc = ArbitraryOrderDescCreator({2, 0, 1, 3})
+                             .createSharedDesc(quantized ? ov::element::u8 : ov::element::f32, Shape(shape));
+    return std::make_shared<VariableStateKVcache>("kv", external_desc, internal_desc, spec);
+}
+
+ov::Tensor make_tokens(size_t heads, size_t tokens, size_t head_size) {
+    ov::Tensor tensor(ov::element::f32, {1, heads, tokens, head_size});
+    auto* data = tensor.data<float>();
+    for (size_t i = 0; i < tensor.get_size(); i++) {
+        data[i] = static_cast<float>(i % 1013);
+    }
+    return tensor;
+}
+
+ov::Tensor state_of(const VariableStateKVcache& state) {
+    return ov::make_tensor(state.get_state());
+}
+
+void expect_equal(const ov::Tensor& expected, const ov::Tensor& actual) {
+    ASSERT_EQ(expected.get_shape(), actual.get_shape());
+    ASSERT_EQ(0, std::memcmp(expected.data(), actual.data(), expected.get_byte_size()));
+}
+
+// keeps the tasks until they are run explicitly, like a background thread busy with other work
+class DeferredExecutor : public ov::threading::ITaskExecutor {
+public:
+    void run(ov::threading::Task task) override {
+        m_tasks.push_back(std::move(task));
+    }
+
+    size_t run_pending() {
+        auto tasks = std::move(m_tasks);
+        m_tasks.clear();
+        for (const auto& task : tasks) {
+            task();
+        }
+        return tasks.size();
+    }
+
+private:
+    std::vector<ov::threading::Task> m_tasks;
+};
+
+class KVCacheStateSwapTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        const std::string test_name = testing::UnitTest::GetInstance()->current_test_info()->name();
+        m_directory = std::filesystem::temp_directory_path() / ("kv_cache_swap_test_" + test_name);
+        std::filesystem::create_directories(m_directory);
+        m_file = std::make_shared<const std::filesystem::path>(m_directory / "states.kvswap");
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(m_directory);
+    }
+
+    void swap_out(const std::shared_ptr<VariableStateKVcache>& state) const {
+        std::ofstream file(*m_file, std::ios::binary | std::ios::trunc);
+        const auto offset = state->write_swap(file);
+        file.close();
+        ASSERT_FALSE(file.fail());
+        state->release_swapped(m_file, offset);
+    }
+
+    std::filesystem::path m_directory;
+    std::shared_ptr<const std::filesystem::path> m_file;
+};
+
+}  // namespace
+
+TEST_F(KVCacheStateSwapTest, RoundTrip) {
+    auto state = make_state(2, 16);
+    const auto tokens = make_tokens(2, 8, 16);
+    state->set_state(ov::get_tensor_impl(tokens));
+    const auto max_size = state->internal_state_max_size();
+
+    swap_out(state);
+    EXPECT_TRUE(state->is_swapped());
+    EXPECT_EQ(state->resident_bytes(), 0U);
+    EXPECT_EQ(state->internal_state_mem(), nullptr);
+    // readable without paging the state in
+    expect_equal(tokens, state_of(*state));
+    EXPECT_TRUE(state->is_swapped());
+
+    state->swap_in();
+    EXPECT_FALSE(state->is_swapped());
+    EXPECT_FALSE(state->is_reset_state());
+    EXPECT_EQ(state->tokens(), 8U);
+    EXPECT_EQ(state->internal_state_max_size(), max_size);
+    EXPECT_EQ(state->internal_state_mem()->getDesc().getPrecision(), ov::element::f32);
+    expect_equal(tokens, state_of(*state));
+}
+
+TEST_F(KVCacheStateSwapTest, RoundTripQuantized) {
+    auto state = make_state(2, 16, true);
+    state->set_state(ov::get_tensor_impl(make_tokens(2, 8, 16)));
+    const auto dequantized = state_of(*state);
+
+    swap_out(state);
+    EXPECT_FALSE(static_cast<bool>(state->get_scale_zp()));
+    state->swap_in();
+    EXPECT_EQ(state->internal_state_mem()->getDesc().getPrecision(), ov::element::u8);
+    EXPECT_TRUE(static_cast<bool>(state->get_scale_zp()));
+    expect_equal(dequantized, state_of(*state));
+}
+
+TEST_F(KVCacheStateSwapTest, ResetStateIsNotWritten) {
+    auto state = make_state(2, 16);
+    state->set_state(ov::get_tensor_impl(make_tokens(2, 8, 16)));
+    state->reset();
+
+    swap_out(state);
+    EXPECT_FALSE(state->is_swapped());
+    EXPECT_TRUE(state->is_reset_state());
+    EXPECT_EQ(std::filesystem::file_size(*m_file), 0U);
+}
+
+TEST_F(KVCacheStateSwapTest, SetStateDropsSwappedContent) {
+    auto state = make_state(2, 16);
+    state->set_state(ov::get_tensor_impl(make_tokens(2, 8, 16)));
+    swap_out(state);
+
+    const auto tokens = make_tokens(2, 3, 16);
+    state->set_state(ov::get_tensor_impl(tokens));
+    EXPECT_FALSE(state->is_swapped());
+    expect_equal(tokens, state_of(*state));
+}
+
+TEST_F(KVCacheStateSwapTest, ManagerEvictsLeastRecentlyUsed) {
+    auto first = make_state(2, 16);
+    auto second = make_state(2, 16);
+    first->set_state(ov::get_tensor_impl(make_tokens(2, 8, 16)));
+    second->set_state(ov::get_tensor_impl(make_tokens(2, 8, 16)));
+
+    // room for one of the states only
+    auto manager = std::make_shared<StateSwapManager>(first->resident_bytes(),
+                                                      m_directory,
+                                                      std::make_shared<ov::threading::ImmediateExecutor>());
+    auto first_session = manager->create_session({first});
+    auto second_session = manager->create_session({second});
+
+    {
+        StateSwapManager::Pin pin(first_session);
+    }
+    EXPECT_FALSE(first->is_swapped());
+    EXPECT_TRUE(second->is_swapped());
+    EXPECT_EQ(manager->resident_bytes(), first->resident_bytes());
+
+    {
+        StateSwapManager::Pin pin(second_session);
+    }
+    EXPECT_TRUE(first->is_swapped());
+    EXPECT_FALSE(second->is_swapped());
+    expect_equal(make_tokens(2, 8, 16), state_of(*second));
+
+    // the state of the session being executed is never swapped out
+    {
+        StateSwapManager::Pin pin(first_session);
+        manager->evict_all();
+        EXPECT_FALSE(first->is_swapped());
+        EXPECT_TRUE(second->is_swapped());
+    }
+
+    first_session.reset();
+    second_session.reset();
+    EXPECT_EQ(manager->resident_bytes(), 0U);
+    EXPECT_TRUE(std::filesystem::is_empty(m_directory));
+}
+
+TEST_F(KVCacheStateSwapTest, ManagerEvictsOnExecutor) {
+    auto first = make_state(2, 16);
+    auto second = make_state(2, 16);
+    first->set_state(ov::get_tensor_impl(make_tokens(2, 8, 16)));
+    second->set_state(ov::get_tensor_impl(make_tokens(2, 8, 16)));
+
+    auto executor = std::make_shared<DeferredExecutor>();
+    auto manager = std::make_shared<StateSwapManager>(first->resident_bytes(), m_directory, executor);
+    auto first_session = manager->create_session({first});
+    auto second_session = manager->create_session({second});
+
+    // the inference exceeding the budget doesn't write the swap files itself
+    {
+        StateSwapManager::Pin pin(first_session);
+    }
+    {
+        StateSwapManager::Pin pin(second_session);
+    }
+    EXPECT_FALSE(first->is_swapped());
+    EXPECT_FALSE(second->is_swapped());
+
+    // a single eviction is queued for both
+    EXPECT_EQ(executor->run_pending(), 1U);
+    EXPECT_TRUE(first->is_swapped());
+    EXPECT_FALSE(second->is_swapped());
+    EXPECT_EQ(manager->resident_bytes(), second->resident_bytes());
+    EXPECT_EQ(executor->run_pending(), 0U);
+}
+
+TEST_F(KVCacheStateSwapTest, ManagerKeepsStatesOnFailedWrite) {
+    auto state = make_state(2, 16);
+    const auto tokens = make_tokens(2, 8, 16);
+    state->set_state(ov::get_tensor_impl(tokens));
+    const auto resident = state->resident_bytes();
+
+    auto manager =
+        std::make_shared<StateSwapManager>(0, m_directory, std::make_shared<ov::threading::ImmediateExecutor>());
+    auto session = manager->create_session({state});
+
+    // the swap files can't be created anymore, as when the disk is full
+    std::filesystem::remove_all(m_directory);
+    manager->evict_all();
+    EXPECT_FALSE(state->is_swapped());
+    EXPECT_EQ(state->resident_bytes(), resident);
+    EXPECT_EQ(manager->resident_bytes(), resident);
+    expect_equal(tokens, state_of(*state));
+
+    // the next eviction succeeds
+    std::filesystem::create_directories(m_directory);
+    manager->evict_all();
+    EXPECT_TRUE(state->is_swapped());
+    {
+        StateSwapManager::Pin pin(session);
+    }
+    EXPECT_FALSE(state->is_swapped());
+    expect_equal(tokens, state_of(*state));
+}
+
+TEST_F(KVCacheStateSwapTest, UserStatesPinTheSession) {
+    auto state = make_state(2, 16);
+    const auto tokens = make_tokens(2, 8, 16);
+    state->set_state(ov::get_tensor_impl(tokens));
+
+    auto manager =
+        std::make_shared<StateSwapManager>(0, m_directory, std::make_shared<ov::threading::ImmediateExecutor>());
+    auto session = manager->create_session({state});
+    const auto user_states = StateSwapManager::user_states(session, {state});
+    ASSERT_EQ(user_states.size(), 1U);
+    const auto& user_state = user_states[0];
+    EXPECT_EQ(user_state->get_name(), state->get_name());
+
+    manager->evict_all();
+    EXPECT_TRUE(state->is_swapped());
+    expect_equal(tokens, ov::make_tensor(user_state->get_state()));
+    EXPECT_FALSE(state->is_swapped());
+
+    // the memory taken by the new content is accounted
+    manager->evict_all();
+    user_state->set_state(ov::get_tensor_impl(make_tokens(2, 3, 16)));
+    EXPECT_EQ(manager->resident_bytes(), state->resident_bytes());
+    EXPECT_NE(manager->resident_bytes(), 0U);
+
+    // the user calls and the eviction by the other requests are serialized
+    std::thread evicting([&] {
+        for (size_t i = 0; i < 100; i++) {
+            manager->evict_all();
+        }
+    });
+    for (size_t i = 0; i < 100; i++) {
+        const auto expected = make_tokens(2, 1 + i % 8, 16);
+        user_state->set_state(ov::get_tensor_impl(expected));
+        expect_equal(expected, ov::make_tensor(user_state->get_state()));
+    }
+    evicting.join();
+}
+
+TEST_F(KVCacheStateSwapTest, UserStatesForkSwappedOutState) {
+    auto original = make_state(2, 16);
+    auto forked = make_state(2, 16);
+    const auto tokens = make_tokens(2, 8, 16);
+    original->set_state(ov::get_tensor_impl(tokens));
+
+    auto manager =
+        std::make_shared<StateSwapManager>(0, m_directory, std::make_shared<ov::threading::ImmediateExecutor>());
+    auto original_session = manager->create_session({original});
+    auto forked_session = manager->create_session({forked});
+    const auto original_user_states = StateSwapManager::user_states(original_session, {original});
+    const auto forked_user_states = StateSwapManager::user_states(forked_session, {forked});
+
+    // the source is paged in to be shared
+    manager->evict_all();
+    ASSERT_TRUE(original->is_swapped());
+    forked_user_states[0]->fork(original_user_states[0]);
+    EXPECT_FALSE(original->is_swapped());
+    expect_equal(tokens, state_of(*forked));
+
+    forked_user_states[0]->truncate(5);
+    EXPECT_EQ(forked->tokens(), 5U);
+    EXPECT_EQ(original->tokens(), 8U);
+
+    // the snapshot outlives the eviction of its session
+    const auto snapshot = original_user_states[0]->snapshot();
+    manager->evict_all();
+    EXPECT_TRUE(original->is_swapped());
+    expect_equal(tokens, ov::make_tensor(snapshot->get_state()));
+}
@@ -0,0 +1,72 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+
+#include "perf_count.h"
+
+using namespace ov::intel_cpu;
+
+TEST(LatencyHistogramTests, BucketsAreContiguous) {
+    EXPECT_EQ(LatencyHistogram::bucket(0), 0U);
+    for (uint64_t ns = 1; ns < (1U << 16); ns++) {
+        const auto bucket = LatencyHistogram::bucket(ns);
+        const auto previous = LatencyHistogram::bucket(ns - 1);
+        ASSERT_TRUE(bucket == previous || bucket == previous + 1) << ns;
+        ASSERT_GE(LatencyHistogram::upperBound(bucket), ns) << ns;
+        if (bucket != previous) {
+            ASSERT_EQ(LatencyHistogram::upperBound(previous), ns - 1) << ns;
+        }
+    }
+    const auto last = LatencyHistogram::bucket(std::numeric_limits<uint64_t>::max());
+    EXPECT_LT(last, LatencyHistogram::numBuckets);
+    EXPECT_EQ(LatencyHistogram::upperBound(last), std::numeric_limits<uint64_t>::max());
+}
+
+TEST(LatencyHistogramTests, PercentilesWithinBucketError) {
+    LatencyHistogram histogram;
+    // 1..1000 us
+    for (uint64_t us = 1; us <= 1000; us++) {
+        histogram.add(us * 1000);
+    }
+    EXPECT_EQ(histogram.count(), 1000U);
+    EXPECT_EQ(histogram.min(), 1000U);
+    EXPECT_EQ(histogram.max(), 1000000U);
+    for (const auto& [fraction, expected] : {std::pair{0.5, 500000.0}, {0.9, 900000.0}, {0.99, 990000.0}}) {
+        const auto value = static_cast<double>(histogram.percentile(fraction));
+        EXPECT_GE(value, expected) << fraction;
+        EXPECT_LE(value, expected * 1.25) << fraction;
+    }
+    EXPECT_EQ(histogram.percentile(1.0), histogram.max());
+}
+
+TEST(LatencyHistogramTests, TailOutlier) {
+    LatencyHistogram histogram;
+    for (int i = 0; i < 99; i++) {
+        histogram.add(10000);
+    }
+    histogram.add(5000000);
+    EXPECT_LE(histogram.percentile(0.5), 12500U);
+    EXPECT_LE(histogram.percentile(0.99), 12500U);
+    EXPECT_EQ(histogram.max(), 5000000U);
+}
+
+TEST(PerfCountTests, ExtendedIsAllocatedOnDemand) {
+    PerfCount counter;
+    { PerfHelper helper(counter); }
+    EXPECT_EQ(counter.extended(), nullptr);
+    EXPECT_EQ(counter.count(), 1U);
+
+    counter.enableExtended(false);
+    for (int i = 0; i < 3; i++) {
+        PerfHelper helper(counter);
+    }
+    ASSERT_NE(counter.extended(), nullptr);
+    EXPECT_EQ(counter.extended()->latency.count(), 3U);
+    EXPECT_EQ(counter.extended()->hwSamples, 0U);
+    EXPECT_EQ(counter.count(), 4U);
+}
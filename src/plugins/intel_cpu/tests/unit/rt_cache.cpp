@@ -7,6 +7,7 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include "cache/clock_cache.h"
 #include "cache/lru_cache.h"
 #include "cache/multi_cache.h"
 #include "common_test_utils/test_assertions.hpp"
@@ -97,6 +98,124 @@ TEST(LruCacheTests, Empty) {
         ASSERT_EQ(cache.get({i}), int());
     }
 }
+
+TEST(ClockCacheTests, Get) {
+    constexpr int capacity = 10;
+    ClockCache<IntKey, int> cache(capacity);
+    for (int i = 1; i < 2 * capacity; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 1; i < capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), int());
+    }
+
+    for (int i = capacity; i < 2 * capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), i);
+    }
+}
+
+TEST(ClockCacheTests, SecondChance) {
+    constexpr int capacity = 4;
+    ClockCache<IntKey, int> cache(capacity);
+    for (int i = 1; i <= capacity; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i));
+    }
+    // the referenced record survives the next eviction
+    ASSERT_EQ(cache.get({1}), 1);
+    OV_ASSERT_NO_THROW(cache.put({5}, 5));
+
+    ASSERT_EQ(cache.get({1}), 1);
+    ASSERT_EQ(cache.get({2}), int());
+    for (int i = 3; i <= 5; ++i) {
+        ASSERT_EQ(cache.get({i}), i);
+    }
+}
+
+TEST(ClockCacheTests, Evict) {
+    constexpr int capacity = 10;
+    ClockCache<IntKey, int> cache(capacity);
+    for (int i = 0; i < capacity; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i));
+    }
+    OV_ASSERT_NO_THROW(cache.evict(5));
+    ASSERT_EQ(cache.getStatistics().size, 5U);
+    OV_ASSERT_NO_THROW(cache.evict(2 * capacity));
+    ASSERT_EQ(cache.getStatistics().size, 0U);
+    for (int i = 0; i < capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), int());
+    }
+    // the released slots are reused
+    for (int i = 0; i < capacity; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i));
+    }
+    for (int i = 0; i < capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), i);
+    }
+}
+
+TEST(ClockCacheTests, GrowOnDemand) {
+    // slots and index are allocated as records are added, the records stay reachable across the index growth
+    constexpr int capacity = 5000;
+    constexpr int recordsNum = 3000;
+    ClockCache<IntKey, int> cache(capacity);
+    ASSERT_EQ(cache.get({0}), int());
+    for (int i = 0; i < recordsNum; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i));
+    }
+    for (int i = 0; i < recordsNum; ++i) {
+        ASSERT_EQ(cache.get({i}), i);
+    }
+    const auto statistics = cache.getStatistics();
+    ASSERT_EQ(statistics.size, static_cast<size_t>(recordsNum));
+    ASSERT_EQ(statistics.evictions, 0U);
+}
+
+TEST(ClockCacheTests, Statistics) {
+    constexpr int capacity = 10;
+    ClockCache<IntKey, int> cache(capacity);
+    for (int i = 0; i < 2 * capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), int());
+        cache.put({i}, i);
+        ASSERT_EQ(cache.get({i}), i);
+    }
+
+    const auto statistics = cache.getStatistics();
+    ASSERT_EQ(statistics.hits, 2U * capacity);
+    ASSERT_EQ(statistics.misses, 2U * capacity);
+    ASSERT_EQ(statistics.evictions, static_cast<uint64_t>(capacity));
+    ASSERT_EQ(statistics.size, static_cast<size_t>(capacity));
+}
+
+TEST(ClockCacheTests, ConcurrentAccess) {
+    constexpr int capacity = 1024;
+    constexpr int numThreads = 8;
+    constexpr int keysNum = 4 * capacity;
+    ClockCache<IntKey, int> cache(capacity);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < numThreads; ++t) {
+        threads.emplace_back([&cache, t] {
+            for (int i = 0; i < keysNum; ++i) {
+                const int key = (i * (t + 1)) % keysNum;
+                const int value = cache.get({key});
+                if (value != int()) {
+                    ASSERT_EQ(value, key);
+                } else {
+                    cache.put({key}, key);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    const auto statistics = cache.getStatistics();
+    ASSERT_EQ(statistics.hits + statistics.misses, static_cast<uint64_t>(numThreads) * keysNum);
+    ASSERT_LE(statistics.size, capacity + 16U);
+}
+
 namespace {
 template<typename T, typename K>
 class mockBuilder {
@@ -0,0 +1,144 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "common_test_utils/ov_test_utils.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/core/preprocess/pre_post_process.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/divide.hpp"
+#include "openvino/op/interpolate.hpp"
+#include "openvino/op/nv12_to_rgb.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/subtract.hpp"
+#include "openvino/op/transpose.hpp"
+#include "openvino/pass/manager.hpp"
+#include "transformations/cpu_opset/common/op/image_preprocess.hpp"
+#include "transformations/cpu_opset/common/pass/image_preprocess_fusion.hpp"
+
+using namespace testing;
+using namespace ov::intel_cpu;
+
+namespace {
+
+using InterpolateBase = ov::op::util::InterpolateBase;
+
+const std::vector<float> mean{123.675F, 116.28F, 103.53F};
+const std::vector<float> scale{58.395F, 57.12F, 57.375F};
+
+// NV12 -> Convert -> Interpolate -> Subtract -> Divide -> Transpose as PrePostProcessor lowers it
+std::shared_ptr<ov::Model> make_nv12_model(InterpolateBase::InterpolateMode mode, bool convert_after_resize) {
+    auto y = std::make_shared<ov::op::v0::Parameter>(ov::element::u8, ov::PartialShape{-1, 480, 640, 1});
+    auto uv = std::make_shared<ov::op::v0::Parameter>(ov::element::u8, ov::PartialShape{-1, 240, 320, 2});
+    ov::Output<ov::Node> node = std::make_shared<ov::op::v8::NV12toRGB>(y, uv);
+    if (!convert_after_resize) {
+        node = std::make_shared<ov::op::v0::Convert>(node, ov::element::f32);
+    }
+    const auto sizes = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{2}, {224, 224});
+    const auto axes = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{2}, {1, 2});
+    InterpolateBase::InterpolateAttrs attrs(mode, InterpolateBase::ShapeCalcMode::SIZES, {0, 0}, {0, 0});
+    node = std::make_shared<ov::op::v11::Interpolate>(node, sizes, axes, attrs);
+    if (convert_after_resize) {
+        node = std::make_shared<ov::op::v0::Convert>(node, ov::element::f32);
+    }
+    node = std::make_shared<ov::op::v1::Subtract>(
+        node,
+        ov::op::v0::Constant::create(ov::element::f32, ov::Shape{1, 1, 1, 3}, mean));
+    node = std::make_shared<ov::op::v1::Divide>(
+        node,
+        ov::op::v0::Constant::create(ov::element::f32, ov::Shape{1, 1, 1, 3}, scale));
+    node = std::make_shared<ov::op::v1::Transpose>(
+        node,
+        ov::op::v0::Constant::create(ov::element::i64, ov::Shape{4}, {0, 3, 1, 2}));
+    return std::make_shared<ov::Model>(ov::OutputVector{node}, ov::ParameterVector{y, uv});
+}
+
+}  // namespace
+
+TEST_F(TransformationTestsF, ImagePreprocessFusion_NV12) {
+    model = make_nv12_model(InterpolateBase::InterpolateMode::LINEAR, false);
+    manager.register_pass<ImagePreprocessFusion>();
+    {
+        auto y = std::make_shared<ov::op::v0::Parameter>(ov::element::u8, ov::PartialShape{-1, 480, 640, 1});
+        auto uv = std::make_shared<ov::op::v0::Parameter>(ov::element::u8, ov::PartialShape{-1, 240, 320, 2});
+        ImagePreprocessNode::Config config;
+        config.color_format = "NV12";
+        config.round_color = true;
+        config.resize = true;
+        config.resize_mode = InterpolateBase::InterpolateMode::LINEAR;
+        config.resize_size = {224, 224};
+        for (size_t c = 0; c < 3; c++) {
+            config.scale.push_back(1.F / scale[c]);
+            config.shift.push_back((0.F - mean[c]) / scale[c]);
+        }
+        auto image_preprocess = std::make_shared<ImagePreprocessNode>(ov::OutputVector{y, uv}, config);
+        model_ref = std::make_shared<ov::Model>(ov::OutputVector{image_preprocess}, ov::ParameterVector{y, uv});
+    }
+}
+
+// the u8 Interpolate rounds its results, the chain is left as is
+TEST_F(TransformationTestsF, ImagePreprocessFusion_ResizeBeforeConvert) {
+    model = make_nv12_model(InterpolateBase::InterpolateMode::LINEAR, true);
+    manager.register_pass<ImagePreprocessFusion>();
+}
+
+TEST_F(TransformationTestsF, ImagePreprocessFusion_CubicResize) {
+    model = make_nv12_model(InterpolateBase::InterpolateMode::CUBIC, false);
+    manager.register_pass<ImagePreprocessFusion>();
+}
+
+// BGR u8 NHWC -> RGB -> crop -> f32 -> resize -> mean/scale -> NCHW built by PrePostProcessor is a single node
+TEST(ImagePreprocessFusionTest, PrePostProcessorPacked) {
+    auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{1, 3, 224, 224});
+    auto relu = std::make_shared<ov::op::v0::Relu>(input);
+    auto model = std::make_shared<ov::Model>(ov::OutputVector{relu}, ov::ParameterVector{input});
+
+    ov::preprocess::PrePostProcessor ppp(model);
+    ppp.input()
+        .tensor()
+        .set_element_type(ov::element::u8)
+        .set_layout("NHWC")
+        .set_color_format(ov::preprocess::ColorFormat::BGR)
+        .set_spatial_static_shape(1080, 1920);
+    ppp.input()
+        .preprocess()
+        .convert_color(ov::preprocess::ColorFormat::RGB)
+        .crop({0, 0, 60, 420}, {1, 3, 1020, 1500})
+        .convert_element_type(ov::element::f32)
+        .resize(ov::preprocess::ResizeAlgorithm::RESIZE_LINEAR)
+        .mean(mean)
+        .scale(scale);
+    ppp.input().model().set_layout("NCHW");
+    model = ppp.build();
+
+    ov::pass::Manager manager;
+    manager.register_pass<ImagePreprocessFusion>();
+    manager.run_passes(model);
+
+    std::shared_ptr<ImagePreprocessNode> image_preprocess;
+    for (const auto& node : model->get_ordered_ops()) {
+        ASSERT_FALSE(ov::is_type<ov::op::v11::Interpolate>(node));
+        if (const auto fused = ov::as_type_ptr<ImagePreprocessNode>(node)) {
+            image_preprocess = fused;
+        }
+    }
+    ASSERT_NE(image_preprocess, nullptr);
+    const auto& config = image_preprocess->get_config();
+    ASSERT_EQ(config.color_format, "PACKED");
+    ASSERT_TRUE(config.reverse_channels);
+    ASSERT_EQ(config.crop_begin, (std::vector<int64_t>{60, 420}));
+    ASSERT_EQ(config.crop_end, (std::vector<int64_t>{1020, 1500}));
+    ASSERT_EQ(config.resize_size, (std::vector<int64_t>{224, 224}));
+    ASSERT_EQ(image_preprocess->get_output_partial_shape(0), (ov::PartialShape{1, 3, 224, 224}));
+    for (size_t c = 0; c < 3; c++) {
+        ASSERT_NEAR(config.scale[c] * 255.F + config.shift[c], (255.F - mean[c]) / scale[c], 1e-5F);
+        ASSERT_NEAR(config.shift[c], -mean[c] / scale[c], 1e-5F);
+    }
+}
@@ -0,0 +1,95 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "internal_properties.hpp"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "weights_cache.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+const std::vector<WeightsNumaPolicy> policies{WeightsNumaPolicy::FIRST_TOUCH,
+                                              WeightsNumaPolicy::LOCAL,
+                                              WeightsNumaPolicy::INTERLEAVE,
+                                              WeightsNumaPolicy::REPLICATE};
+
+std::string policy_name(WeightsNumaPolicy policy) {
+    std::stringstream ss;
+    ss << policy;
+    return ss.str();
+}
+
+MemoryPtr make_weights(size_t size, float value) {
+    static const dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    auto memory = std::make_shared<Memory>(eng, std::make_shared<CpuBlockedMemoryDesc>(ov::element::f32, Shape{size}));
+    auto* data = memory->getDataAs<float>();
+    for (size_t i = 0; i < size; i++) {
+        data[i] = value;
+    }
+    return memory;
+}
+
+}  // namespace
+
+TEST(WeightsCacheTest, CopiesByPolicy) {
+    for (const auto policy : policies) {
+        SCOPED_TRACE(policy_name(policy));
+        SocketsWeights weights(policy);
+        const auto socket0_node0 = weights.get(0, 0);
+        const auto socket0_node1 = weights.get(0, 1);
+        const auto socket1_node1 = weights.get(1, 1);
+        EXPECT_EQ(socket0_node0, weights.get(0, 0));
+        switch (policy) {
+        case WeightsNumaPolicy::INTERLEAVE:
+            EXPECT_EQ(socket0_node0, socket0_node1);
+            EXPECT_EQ(socket0_node0, socket1_node1);
+            break;
+        case WeightsNumaPolicy::REPLICATE:
+            EXPECT_NE(socket0_node0, socket0_node1);
+            EXPECT_EQ(socket0_node1, socket1_node1);
+            break;
+        default:
+            EXPECT_EQ(socket0_node0, socket0_node1);
+            EXPECT_NE(socket0_node0, socket1_node1);
+            break;
+        }
+    }
+}
+
+TEST(WeightsCacheTest, PlacementKeepsData) {
+    // larger than a huge page, so that madvise applies to a part of it
+    constexpr size_t size = 3 * 1024 * 1024;
+    for (const auto policy : policies) {
+        SCOPED_TRACE(policy_name(policy));
+        SocketsWeights weights(policy, true);
+        auto cache = weights.get(0, 0);
+        size_t created = 0;
+        auto create = [&] {
+            created++;
+            return make_weights(size, 42.0F);
+        };
+        auto memory = static_cast<MemoryPtr>(*cache->findOrCreate("weights", create));
+        ASSERT_EQ(static_cast<MemoryPtr>(*cache->findOrCreate("weights", create)), memory);
+        EXPECT_EQ(created, 1U);
+
+        const auto* data = memory->getDataAs<const float>();
+        for (size_t i = 0; i < size; i++) {
+            ASSERT_EQ(data[i], 42.0F) << i;
+        }
+        const auto statistics = weights.dumpStatistics();
+        ASSERT_EQ(statistics.size(), 1U);
+        EXPECT_EQ(statistics.front().second.total_size, size * sizeof(float));
+        EXPECT_EQ(statistics.front().second.total_memory_objects, 1U);
+    }
+}
@@ -0,0 +1,68 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/reference/kquant_matmul.hpp"
+
+#include "evaluate_node.hpp"
+#include "openvino/core/shape_util.hpp"
+#include "openvino/core/type/element_type_traits.hpp"
+#include "openvino/op/kquant_matmul.hpp"
+
+namespace {
+ov::reference::kquant::dequantize_block_fn get_dequantize_fn(ov::op::internal::KQuantMatMul::QuantType quant_type) {
+    using QuantType = ov::op::internal::KQuantMatMul::QuantType;
+    switch (quant_type) {
+    case QuantType::Q4_K:
+        return ov::reference::kquant::dequantize_q4_k_block;
+    case QuantType::Q5_K:
+        return ov::reference::kquant::dequantize_q5_k_block;
+    case QuantType::Q6_K:
+        return ov::reference::kquant::dequantize_q6_k_block;
+    default:
+        OPENVINO_THROW("Unsupported KQuantMatMul quant type");
+    }
+}
+}  // namespace
+
+template <ov::element::Type_t ET>
+bool evaluate(const std::shared_ptr<ov::op::internal::KQuantMatMul>& op,
+              ov::TensorVector& outputs,
+              const ov::TensorVector& inputs) {
+    using T = typename ov::element_type_traits<ET>::value_type;
+
+    const auto& data_shape = inputs[0].get_shape();
+    const auto& weights_shape = inputs[1].get_shape();
+    auto output_shape = data_shape;
+    output_shape.back() = weights_shape[0];
+    outputs[0].set_shape(output_shape);
+
+    const size_t K = data_shape.back();
+    ov::reference::kquant_matmul<T>(inputs[0].data<const T>(),
+                                    inputs[1].data<const uint8_t>(),
+                                    outputs[0].data<T>(),
+                                    ov::shape_size(data_shape) / K,
+                                    weights_shape[0],
+                                    K,
+                                    ov::op::internal::KQuantMatMul::get_block_bytes(op->get_quant_type()),
+                                    get_dequantize_fn(op->get_quant_type()));
+    return true;
+}
+
+template <>
+bool evaluate_node<ov::op::internal::KQuantMatMul>(std::shared_ptr<ov::Node> node,
+                                                   ov::TensorVector& outputs,
+                                                   const ov::TensorVector& inputs) {
+    const auto& element_type = node->get_input_element_type(0);
+
+    switch (element_type) {
+    case ov::element::f32:
+        return evaluate<ov::element::f32>(ov::as_type_ptr<ov::op::internal::KQuantMatMul>(node), outputs, inputs);
+    case ov::element::f16:
+        return evaluate<ov::element::f16>(ov::as_type_ptr<ov::op::internal::KQuantMatMul>(node), outputs, inputs);
+    case ov::element::bf16:
+        return evaluate<ov::element::bf16>(ov::as_type_ptr<ov::op::internal::KQuantMatMul>(node), outputs, inputs);
+    default:
+        OPENVINO_THROW("Unhandled data type ", element_type, " in evaluate_node()");
+    }
+}